@@ -0,0 +1,514 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+// ----------------------------------------------------------------------------
+// broomstyx_bench: runs a fixed set of representative problems on structured
+// meshes generated in memory (see StructuredMeshGenerator) and records the
+// time spent in each phase together with the peak resident set size of each
+// run to a JSON file, for tracking performance between releases.
+//
+// Usage:
+//   broomstyx_bench [--size N] [--case NAME]... [--solver NAME]
+//                   [--output FILE] [--workdir DIR] [--list]
+//
+// Every case runs in a child process of its own (the analysis model is a
+// singleton), in a subdirectory of the working directory that also receives
+// the input file, log and Paraview output of the run. 2D cases use N x N
+// subdivisions of the unit square and the Tet4 case uses (N/4)^3
+// subdivisions of the unit cube. Without a linear solver only problem
+// setup and initial output are timed.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "config.h"
+#include "Core/AnalysisModel.hpp"
+#include "Core/Diagnostics.hpp"
+#include "Core/ObjectFactory.hpp"
+
+using namespace broomstyx;
+
+namespace
+{
+    struct BenchmarkCase
+    {
+        std::string name;
+        std::string description;
+        bool symmetric;
+    };
+    
+    const std::vector<BenchmarkCase> benchmarkCase =
+    {
+        {"elasticity_tri3", "Plane strain linear elasticity, Tri3 (PlaneStrain_Fe_Tri3)", true},
+        {"elasticity_tri6", "Plane strain linear elasticity, Tri6 (PlaneStrain_Fe_Tri6)", true},
+        {"elasticity_quad8", "Plane strain linear elasticity, Quad8 (PlaneStrain_Fe_Quad8)", true},
+        {"elasticity_tet4", "3D linear elasticity, Tet4 (Mech_Fe_Tet4)", true},
+        {"heat_tri3", "Steady heat conduction, Tri3 (HeatTransfer_Fe_Tri3)", true},
+        {"phasefield_tri3", "Phase-field fracture, staggered, Tri3 (PhaseFieldFracture_Fe_Tri3)", true},
+        {"biot_tri3", "Biot poromechanics, FE-FV, Tri3 (Biot_FeFv_Tri3)", false}
+    };
+    
+    const std::vector<std::string> solverName =
+        {"MKL_Pardiso", "UB_Pardiso", "ConjugateGradient", "ViennaCL_openmp", "None"};
+    
+    // ------------------------------------------------------------------------
+    const BenchmarkCase* findCase( const std::string& caseName )
+    {
+        for ( auto& curCase : benchmarkCase )
+            if ( curCase.name == caseName )
+                return &curCase;
+        
+        return nullptr;
+    }
+    // ------------------------------------------------------------------------
+    bool solverSupports( const std::string& solver, const BenchmarkCase& curCase )
+    {
+        // The conjugate gradient method requires a symmetric system
+        return solver != "ConjugateGradient" || curCase.symmetric;
+    }
+    // ------------------------------------------------------------------------
+    std::string giveSolverDeclaration( const std::string& solver, bool symmetric )
+    {
+        int nThreads = 1;
+#ifdef _OPENMP
+        nThreads = omp_get_max_threads();
+#endif
+        if ( solver == "MKL_Pardiso" || solver == "UB_Pardiso" )
+            return solver + " nThreads " + std::to_string(nThreads) + (symmetric ? " Symmetric" : " Unsymmetric");
+        
+        if ( solver == "ConjugateGradient" && symmetric )
+            return solver + " Format MatrixFree 1.0e-10 10000 Preconditioner Chebyshev 4";
+        
+        if ( solver == "ViennaCL_openmp" )
+            return solver + " Algorithm BiCGStab 1.0e-10 10000 Preconditioner Chow_Patel_ILU0 3 2";
+        
+        throw std::runtime_error("No input template for linear solver '" + solver + "'!");
+    }
+    // ------------------------------------------------------------------------
+    std::string giveMeshSpecificationFor( const std::string& caseName, int size )
+    {
+        std::string n = std::to_string(size);
+        if ( caseName == "elasticity_tri6" )
+            return "Tri6:" + n + "x" + n;
+        else if ( caseName == "elasticity_quad8" )
+            return "Quad8:" + n + "x" + n;
+        else if ( caseName == "elasticity_tet4" )
+        {
+            std::string m = std::to_string(size/4 > 0 ? size/4 : 1);
+            return "Tet4:" + m + "x" + m + "x" + m;
+        }
+        
+        return "Tri3:" + n + "x" + n;
+    }
+    // ------------------------------------------------------------------------
+    std::string giveInputFor( const std::string& caseName, const std::string& meshSpec, const std::string& solver )
+    {
+        std::string numerics, dofs, fields, cellDofs, materials, domain, output, bc, method;
+        std::string cellOutput = "CELL_DATA 0\n";
+        bool hasSolver = ( solver != "None" );
+        
+        if ( caseName == "elasticity_tri3" || caseName == "elasticity_tri6" || caseName == "elasticity_quad8" )
+        {
+            std::string type = ( caseName == "elasticity_tri3" ) ? "PlaneStrain_Fe_Tri3" :
+                               ( caseName == "elasticity_tri6" ) ? "PlaneStrain_Fe_Tri6" : "PlaneStrain_Fe_Quad8";
+            fields = "*FIELDS_PER_NODE 2\n*FIELDS_PER_CELL 0\n";
+            dofs = "*DOF_PER_NODE\n2\nux DofGroup 1 NodalField 1 0\nuy DofGroup 1 NodalField 2 0\n";
+            numerics = "1 " + type + " NodalDof ux uy Stage 1 Subsystem 1 CellFieldOutput 1 1 s_xx\n";
+            materials = "2\n1 Density 1.0\n2 LinearIsotropicElasticity PlaneStrain 210.0e3 0.3\n";
+            domain = "\"domain\" Numerics 1 MaterialSet 1 2\n";
+            output = "POINT_DATA 1\nVECTOR u 1 2 0\n";
+            if ( caseName == "elasticity_tri3" )
+                cellOutput = "CELL_DATA 1\nSCALAR s_xx 1\n";
+            bc = "3\n\"left\" 1 NodalConstraint ux Constant 0.0\n"
+                 "\"bottom\" 1 NodalConstraint uy Constant 0.0\n"
+                 "\"right\" 1 NodalConstraint ux Constant 0.01\n";
+            method = "Stage 1 LinearStatic LinearSolver " + (hasSolver ? giveSolverDeclaration(solver, true) : "") + "\n";
+        }
+        else if ( caseName == "elasticity_tet4" )
+        {
+            fields = "*FIELDS_PER_NODE 3\n*FIELDS_PER_CELL 0\n";
+            dofs = "*DOF_PER_NODE\n3\nux DofGroup 1 NodalField 1 0\nuy DofGroup 1 NodalField 2 0\nuz DofGroup 1 NodalField 3 0\n";
+            numerics = "1 Mech_Fe_Tet4 NodalDof ux uy uz Stage 1 Subsystem 1 CellFieldOutput 0\n";
+            materials = "2\n1 Density 1.0\n2 LinearIsotropicElasticity 3D 210.0e3 0.3\n";
+            domain = "\"domain\" Numerics 1 MaterialSet 1 2\n";
+            output = "POINT_DATA 1\nVECTOR u 1 2 3\n";
+            bc = "4\n\"left\" 1 NodalConstraint ux Constant 0.0\n"
+                 "\"bottom\" 1 NodalConstraint uy Constant 0.0\n"
+                 "\"back\" 1 NodalConstraint uz Constant 0.0\n"
+                 "\"right\" 1 NodalConstraint ux Constant 0.01\n";
+            method = "Stage 1 LinearStatic LinearSolver " + (hasSolver ? giveSolverDeclaration(solver, true) : "") + "\n";
+        }
+        else if ( caseName == "heat_tri3" )
+        {
+            fields = "*FIELDS_PER_NODE 1\n*FIELDS_PER_CELL 0\n";
+            dofs = "*DOF_PER_NODE\n1\nT DofGroup 1 NodalField 1 0\n";
+            numerics = "1 HeatTransfer_Fe_Tri3 NodalDof T Stage 1 Subsystem 1 CellFieldOutput 2 1 T_x 2 T_y\n";
+            materials = "3\n1 Density 1.0\n2 HeatCapacity 1.0\n3 IsotropicThermalConductivity 2D 1.0\n";
+            domain = "\"domain\" Numerics 1 MaterialSet 1 2 3\n";
+            output = "POINT_DATA 1\nSCALAR T 1\n";
+            cellOutput = "CELL_DATA 1\nVECTOR gradT 1 2 0\n";
+            bc = "2\n\"left\" 1 NodalConstraint T Constant 0.0\n"
+                 "\"right\" 1 NodalConstraint T Constant 1.0\n";
+            method = "Stage 1 LinearStatic LinearSolver " + (hasSolver ? giveSolverDeclaration(solver, true) : "") + "\n";
+        }
+        else if ( caseName == "phasefield_tri3" )
+        {
+            fields = "*FIELDS_PER_NODE 3\n*FIELDS_PER_CELL 0\n";
+            dofs = "*DOF_PER_NODE\n3\nux DofGroup 1 NodalField 1 0\nuy DofGroup 1 NodalField 2 0\nphi DofGroup 2 NodalField 3 0\n";
+            numerics = "1 PhaseFieldFracture_Fe_Tri3 NodalDof ux uy phi Stage 1 Subsystem 1 2 CellFieldOutput 0\n"
+                       "AnalysisMode PlaneStrain CharacteristicLength 0.05 IrreversibilityThreshold 0.9\n";
+            materials = "3\n1 Density 1.0\n2 MieheDamageModel PlaneStrain 210.0e3 0.3 QuadraticDegradation\n3 Constant_CERR 2.7\n";
+            domain = "\"domain\" Numerics 1 MaterialSet 1 2 3\n";
+            output = "POINT_DATA 2\nVECTOR u 1 2 0\nSCALAR phi 3\n";
+            bc = "3\n\"left\" 1 NodalConstraint ux Constant 0.0\n"
+                 "\"bottom\" 1 NodalConstraint uy Constant 0.0\n"
+                 "\"right\" 1 NodalConstraint ux Constant 0.01\n";
+            if ( hasSolver )
+                method = "Stage 1 AlternateMinimization DofGroups 2\n"
+                         "1 L2_L1 C 1.0e-6 1.0e-6\n"
+                         "2 L2_L1 C 1.0e-6 1.0e-6\n"
+                         "Subsystems 2\n"
+                         "1 nDofGroups 1 Label 1 LinearSolver " + giveSolverDeclaration(solver, true) + " OverRelaxation 1.0\n"
+                         "2 nDofGroups 1 Label 2 LinearSolver " + giveSolverDeclaration(solver, true) + " OverRelaxation 1.0\n"
+                         "MaxIterations 50 Continue\n";
+        }
+        else if ( caseName == "biot_tri3" )
+        {
+            fields = "*FIELDS_PER_NODE 2\n*FIELDS_PER_CELL 0\n";
+            dofs = "*DOF_PER_NODE\n2\nux DofGroup 1 NodalField 1 0\nuy DofGroup 1 NodalField 2 0\n";
+            cellDofs = "*DOF_PER_CELL\n1\nh DofGroup 2\n";
+            numerics = "1 Biot_FeFv_Tri3 NodalDof ux uy CellDof h Stage 1 Subsystem 1 CellFieldOutput 0\n"
+                       "BiotCoefficient 1.0 StorageCoefficient 1.0e-4 FluidDensity 1.0 FluidViscosity 1.0 GravitationalAcceleration 9.81\n";
+            materials = "3\n1 Density 1.0\n2 LinearIsotropicElasticity PlaneStrain 210.0e3 0.3\n3 ConstantPermeability 2D 1.0e-3 1.0e-3 0.0\n";
+            domain = "\"domain\" Numerics 1 MaterialSet 1 2 3\n";
+            output = "POINT_DATA 1\nVECTOR u 1 2 0\n";
+            bc = "4\n\"left\" 1 NodalConstraint ux Constant 0.0\n"
+                 "\"bottom\" 1 NodalConstraint uy Constant 0.0\n"
+                 "\"left\" 1 HydraulicHead h Constant 0.0\n"
+                 "\"right\" 1 HydraulicHead h Constant 1.0\n";
+            method = "Stage 1 LinearTransient LinearSolver " + (hasSolver ? giveSolverDeclaration(solver, false) : "") + "\n";
+        }
+        else
+            throw std::runtime_error("Unknown benchmark case '" + caseName + "'!");
+        
+        std::string input;
+        input += fields;
+        input += dofs;
+        input += cellDofs;
+        input += "*SOLUTION_STAGES 1\n";
+        input += "*NUMERICS\n1\n" + numerics;
+        input += "*MATERIALS\n" + materials;
+        input += "*DOMAIN_ASSIGNMENTS\n1\n" + domain;
+        input += "*MESH_READER StructuredMeshGenerator\n";
+        input += "*MESH_FILE " + meshSpec + "\n";
+        input += "*OUTPUT_FORMAT Paraview\nFILENAME " + caseName + "\n" + output + cellOutput;
+        
+        if ( hasSolver )
+        {
+            input += "*LOADSTEPS\n1\n1\n";
+            input += "PREPROCESSING 0\n";
+            input += "START_TIME 0.0\nEND_TIME 1.0\nINITIAL_TIME_INCREMENT 1.0\nMAX_SUBSTEPS 1\n";
+            input += "BOUNDARY_CONDITIONS " + bc;
+            input += "FIELD_CONDITIONS 0\n";
+            input += "SOLUTION_METHODS\n" + method;
+            input += "WRITE_INTERVAL 1\n";
+            input += "POSTPROCESSING 0\n";
+        }
+        input += "*END\n";
+        
+        return input;
+    }
+    // ------------------------------------------------------------------------
+    std::string readFile( const std::string& filename )
+    {
+        std::string contents;
+        FILE* fp = std::fopen(filename.c_str(), "r");
+        if ( !fp )
+            return contents;
+        
+        char buf[4096];
+        std::size_t n;
+        while ( (n = std::fread(buf, 1, sizeof(buf), fp)) > 0 )
+            contents.append(buf, n);
+        std::fclose(fp);
+        
+        return contents;
+    }
+    // ------------------------------------------------------------------------
+    void makeDirectory( const std::string& dir )
+    {
+        if ( mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST )
+            throw std::runtime_error("Failed to create directory '" + dir + "'!");
+    }
+    // ------------------------------------------------------------------------
+    int runCase( const std::string& caseDir, const std::string& caseName )
+    {
+        // Executed in the child process
+        if ( chdir(caseDir.c_str()) != 0 )
+            return 1;
+        if ( !std::freopen((caseName + ".log").c_str(), "w", stdout) )
+            return 1;
+        
+        int status = 0;
+        if ( objectFactory().hasError() )
+        {
+            std::printf("\n\tRegistration error detected in class factory.\n\n");
+            status = 1;
+        }
+        else
+        {
+            try
+            {
+                analysisModel().initializeYourself(caseName);
+                analysisModel().solveYourself();
+                std::printf("\n\nRun successful ---> program will now terminate.");
+            }
+            catch (std::exception& e)
+            {
+                std::printf("\n%s\nException caught in broomstyx_bench\n\n", e.what());
+                status = 1;
+            }
+        }
+        diagnostics().outputDiagnostics();
+        std::fflush(stdout);
+        
+        FILE* fp = std::fopen("diagnostics.json", "w");
+        if ( fp )
+        {
+            diagnostics().writeDiagnosticsTo(fp);
+            std::fclose(fp);
+        }
+        
+        return status;
+    }
+    // ------------------------------------------------------------------------
+    void printUsage()
+    {
+        std::printf("\nUsage: broomstyx_bench [--size N] [--case NAME]... [--solver NAME]\n");
+        std::printf("                       [--output FILE] [--workdir DIR] [--list]\n\n");
+        std::printf("  --size N       subdivisions per direction of 2D meshes (default 128)\n");
+        std::printf("  --case NAME    run only the named case (may be repeated)\n");
+        std::printf("  --solver NAME  linear solver: MKL_Pardiso, UB_Pardiso,\n");
+        std::printf("                 ConjugateGradient (matrix-free), ViennaCL_openmp or None\n");
+        std::printf("  --output FILE  JSON results file (default bench_results.json)\n");
+        std::printf("  --workdir DIR  directory for inputs, logs and output (default bench_work)\n");
+        std::printf("  --list         list available cases\n\n");
+    }
+}
+
+// ----------------------------------------------------------------------------
+int main( int argc, char **argv )
+{
+    int size = 128;
+    std::vector<std::string> selectedCase;
+    std::string outputFile = "bench_results.json";
+    std::string workDir = "bench_work";
+#ifdef HAVE_MKL
+    std::string solver = "MKL_Pardiso";
+#else
+    std::string solver = "None";
+#endif
+    
+    for ( int i = 1; i < argc; i++ )
+    {
+        std::string arg = argv[i];
+        bool hasValue = ( i + 1 < argc );
+        
+        if ( arg == "--size" && hasValue )
+            size = std::atoi(argv[++i]);
+        else if ( arg == "--case" && hasValue )
+            selectedCase.push_back(argv[++i]);
+        else if ( arg == "--solver" && hasValue )
+            solver = argv[++i];
+        else if ( arg == "--output" && hasValue )
+            outputFile = argv[++i];
+        else if ( arg == "--workdir" && hasValue )
+            workDir = argv[++i];
+        else if ( arg == "--list" )
+        {
+            for ( auto& curCase : benchmarkCase )
+                std::printf("  %-20s %s\n", curCase.name.c_str(), curCase.description.c_str());
+            return 0;
+        }
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+    
+    if ( size < 1 )
+    {
+        std::printf("\n\tError: mesh size must be positive!\n\n");
+        return 1;
+    }
+    
+    if ( std::find(solverName.begin(), solverName.end(), solver) == solverName.end() )
+    {
+        std::printf("\n\tError: unknown linear solver '%s'!\n\n", solver.c_str());
+        return 1;
+    }
+    
+    for ( auto& caseName : selectedCase )
+        if ( !findCase(caseName) )
+        {
+            std::printf("\n\tError: unknown benchmark case '%s'!\n\n", caseName.c_str());
+            return 1;
+        }
+    
+    if ( selectedCase.empty() )
+        for ( auto& curCase : benchmarkCase )
+            selectedCase.push_back(curCase.name);
+    
+    int nThreads = 1;
+#ifdef _OPENMP
+    nThreads = omp_get_max_threads();
+#endif
+    
+    char hostname[256] = "unknown";
+    gethostname(hostname, sizeof(hostname) - 1);
+    
+    std::string results;
+    int nFailed = 0;
+    
+    try
+    {
+        makeDirectory(workDir);
+        
+        for ( int i = 0; i < (int)selectedCase.size(); i++ )
+        {
+            std::string caseName = selectedCase[i];
+            std::string meshSpec = giveMeshSpecificationFor(caseName, size);
+            std::string caseDir = workDir + "/" + caseName;
+            
+            // Unsupported combinations are recorded without running them
+            if ( !solverSupports(solver, *findCase(caseName)) )
+            {
+                std::printf("  %-40s%s\n", ("Running " + caseName + " (" + meshSpec + ") ...").c_str(), "skipped (unsymmetric system)");
+                
+                results += std::string(i > 0 ? ",\n" : "") + "    {\n";
+                results += "      \"name\": \"" + caseName + "\",\n";
+                results += "      \"mesh\": \"" + meshSpec + "\",\n";
+                results += "      \"status\": \"skipped\",\n";
+                results += "      \"reason\": \"" + solver + " does not support unsymmetric systems\"\n";
+                results += "    }";
+                continue;
+            }
+            makeDirectory(caseDir);
+            
+            std::string input = giveInputFor(caseName, meshSpec, solver);
+            FILE* fp = std::fopen((caseDir + "/" + caseName + ".inp").c_str(), "w");
+            if ( !fp )
+                throw std::runtime_error("Failed to write input file for case '" + caseName + "'!");
+            std::fputs(input.c_str(), fp);
+            std::fclose(fp);
+            std::remove((caseDir + "/diagnostics.json").c_str());
+            
+            std::printf("  %-40s", ("Running " + caseName + " (" + meshSpec + ") ...").c_str());
+            std::fflush(stdout);
+            
+            auto tic = std::chrono::high_resolution_clock::now();
+            pid_t pid = fork();
+            if ( pid < 0 )
+                throw std::runtime_error("Failed to fork benchmark process!");
+            if ( pid == 0 )
+                std::_Exit(runCase(caseDir, caseName));
+            
+            int status = 0;
+            struct rusage usage;
+            wait4(pid, &status, 0, &usage);
+            auto toc = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double> tictoc = toc - tic;
+            
+            bool success = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+            if ( !success )
+                ++nFailed;
+            
+            std::printf("%s (time = %f sec., peak RSS = %ld KiB)\n", success ? "done" : "FAILED", tictoc.count(), usage.ru_maxrss);
+            
+            std::string phases = readFile(caseDir + "/diagnostics.json");
+            if ( phases.empty() )
+                phases = "{}\n";
+            
+            // Indent nested diagnostics object
+            std::string indented;
+            for ( char c : phases.substr(0, phases.size() - 1) )
+            {
+                indented += c;
+                if ( c == '\n' )
+                    indented += "      ";
+            }
+            
+            results += std::string(i > 0 ? ",\n" : "") + "    {\n";
+            results += "      \"name\": \"" + caseName + "\",\n";
+            results += "      \"mesh\": \"" + meshSpec + "\",\n";
+            results += "      \"status\": \"" + std::string(success ? "ok" : "failed") + "\",\n";
+            results += "      \"wallTime\": " + std::to_string(tictoc.count()) + ",\n";
+            results += "      \"peakRssKiB\": " + std::to_string(usage.ru_maxrss) + ",\n";
+            results += "      \"phases\": " + indented + "\n";
+            results += "    }";
+        }
+    }
+    catch (std::exception& e)
+    {
+        std::printf("\n%s\nException caught in broomstyx_bench\n\n", e.what());
+        return 1;
+    }
+    
+    FILE* fp = std::fopen(outputFile.c_str(), "w");
+    if ( !fp )
+    {
+        std::printf("\n\tError: cannot open '%s' for writing!\n\n", outputFile.c_str());
+        return 1;
+    }
+    std::fprintf(fp, "{\n");
+    std::fprintf(fp, "  \"host\": \"%s\",\n", hostname);
+    std::fprintf(fp, "  \"threads\": %d,\n", nThreads);
+    std::fprintf(fp, "  \"size\": %d,\n", size);
+    std::fprintf(fp, "  \"solver\": \"%s\",\n", solver.c_str());
+    std::fprintf(fp, "  \"cases\": [\n%s\n  ]\n", results.c_str());
+    std::fprintf(fp, "}\n");
+    std::fclose(fp);
+    
+    std::printf("\n  Results written to %s\n\n", outputFile.c_str());
+    
+    return nFailed > 0 ? 1 : 0;
+}
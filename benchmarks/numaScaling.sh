@@ -0,0 +1,42 @@
+#!/bin/bash
+#
+# Thread scaling benchmark across sockets.
+#
+# Runs a BROOMStyx analysis for increasing thread counts under the 'Compact'
+# and 'Scatter' thread affinity policies and tabulates the setup, assembly
+# and total times reported in the simulation diagnostics.
+#
+# Usage: numaScaling.sh <path/to/broomstyx> <input file without .inp> [max threads]
+#
+# The input file is copied with a *THREAD_AFFINITY declaration prepended, so
+# it must not itself contain one. The copy is placed next to the original so
+# that relative mesh paths remain valid.
+
+if [ $# -lt 2 ]; then
+    echo "Usage: $0 <path/to/broomstyx> <input file without .inp> [max threads]"
+    exit 1
+fi
+
+EXE=$1
+INPUT=$2
+MAXTHREADS=${3:-$(nproc)}
+TMPINPUT="${INPUT}_numaScaling"
+
+printf "%-8s %8s %12s %12s %12s\n" "policy" "threads" "setup" "assembly" "total"
+for POLICY in Compact Scatter; do
+    NT=1
+    while [ $NT -le $MAXTHREADS ]; do
+        { printf "*THREAD_AFFINITY\n%s\n\n" "$POLICY"; cat "${INPUT}.inp"; } > "${TMPINPUT}.inp"
+        LOG=$(OMP_NUM_THREADS=$NT "$EXE" "$TMPINPUT" 2>&1)
+        SETUP=$(echo "$LOG" | awk '/^Problem setup/ {print $3}')
+        ASSEMBLY=$(echo "$LOG" | awk '/^System Assembly/ {print $3}')
+        TOTAL=$(echo "$LOG" | awk '/^Sum/ {print $2}')
+        printf "%-8s %8d %12s %12s %12s\n" "$POLICY" $NT "$SETUP" "$ASSEMBLY" "$TOTAL"
+        if [ $NT -lt $MAXTHREADS ] && [ $((2*NT)) -gt $MAXTHREADS ]; then
+            NT=$MAXTHREADS
+        else
+            NT=$((2*NT))
+        fi
+    done
+done
+rm -f "${TMPINPUT}.inp"
@@ -85,6 +85,7 @@ mark_as_advanced (MKL_INCLUDE_DIRS MKL_LIBRARIES MKL_INTERFACE_LIBRARY MKL_THREA
 if (MKL_FOUND)
     include_directories ("${MKL_INCLUDE_DIRS}")
     target_link_libraries(broomstyx ${MKL_LIBRARIES})
+    target_link_libraries(broomstyx_bench ${MKL_LIBRARIES})
     set (HAVE_MKL ON)
 else()
     set (HAVE_MKL OFF)
@@ -28,6 +28,7 @@
 #include "Diagnostics.hpp"
 #include "ObjectFactory.hpp"
 #include "Util/readOperations.hpp"
+#include "Util/threadAffinity.hpp"
 
 using namespace broomstyx;
 
@@ -36,13 +37,14 @@ typedef std::chrono::duration<double> TimeDuration;
 typedef std::chrono::high_resolution_clock Timer;
 
 AnalysisModel::AnalysisModel()
-    : _meshReader( nullptr )
+    : _threadAffinity( "None" )
     , _dofManager( nullptr )
     , _domainManager( nullptr )
     , _materialManager( nullptr )
     , _numericsManager( nullptr )
     , _outputManager( nullptr )
     , _solutionManager( nullptr )
+    , _meshReader( nullptr )
 {}
 
 AnalysisModel::~AnalysisModel()
@@ -99,23 +101,53 @@ void AnalysisModel::initializeYourself( const std::string& filename )
         throw std::runtime_error("Program run aborted!");
     }
     
+    // Pin threads and report their placement
+    pinThreads(_threadAffinity);
+    reportThreadPlacement(_threadAffinity);
+    
     // Initialize materials
     _materialManager->initializeMaterials();
     
-    // Read mesh file and create node and cell objects
-    if ( !_meshReader )
-        throw std::runtime_error("Error: MeshReader not defined!\n");
-    else
-        _meshReader->readMeshFile( _meshFilename );
+    // Read mesh file and create node and cell objects, unless the
+    // preprocessed mesh can be loaded from cache
+    TimePoint meshTic = Timer::now();
+    if ( !_domainManager->loadMeshCacheFor( _meshFilename ) )
+    {
+        if ( !_meshReader )
+            throw std::runtime_error("Error: MeshReader not defined!\n");
+        else
+            _meshReader->readMeshFile( _meshFilename );
+        
+        // Form node-to-cell adjacency
+        _domainManager->formNodeToCellAdjacency();
+        
+        // Reorder nodes and cells for locality (also determines equation numbering)
+        _domainManager->reorderMeshEntities();
+        
+        // Recreate nodes and cells within the threads that own them (first touch)
+        _domainManager->placeMeshDataForThreads();
+        
+        // Find domain cell neighbors
+        _domainManager->findDomainCellNeighbors();
+        
+        // Construct cell faces
+        _domainManager->constructCellFaces();
+        
+        // Find boundary cell associations
+        _domainManager->findBoundaryAssociations();
+        
+        // Store preprocessed mesh for subsequent runs
+        _domainManager->writeMeshCacheFor( _meshFilename );
+    }
     
-    // Find domain cell neighbors
-    _domainManager->findDomainCellNeighbors();
+    // Group cells by physical entity
+    _domainManager->formPhysicalEntityCellLists();
     
-    // Construct cell faces
-    _domainManager->constructCellFaces();
+    // Face geometry for finite volume numerics
+    _domainManager->formFaceGeometry();
     
-    // Find boundary cell associations
-    _domainManager->findBoundaryAssociations();
+    TimeDuration meshTictoc = Timer::now() - meshTic;
+    diagnostics().addMeshSetupTime(meshTictoc.count());
     
     // Initialize numerics at cells
     _domainManager->initializeNumericsAtCells();
@@ -216,10 +248,14 @@ void AnalysisModel::readInputFile()
             _solutionManager->readLoadStepsFrom(fp);
         else if ( decl == "MATERIALS" )
             _materialManager->readMaterialsFrom(fp);
+        else if ( decl == "MESH_CACHE" )
+            _domainManager->readMeshCacheFrom(fp);
         else if ( decl == "MESH_FILE" )
             _meshFilename = getStringInputFrom( fp, "\nFailed to read mesh filename from input file!", src);
         else if ( decl == "MESH_READER" )
             this->readMeshReaderFrom(fp);
+        else if ( decl == "MESH_REORDERING" )
+            _domainManager->readMeshReorderingFrom(fp);
         else if ( decl == "MULTIFREEDOM_CONSTRAINTS" )
             _dofManager->readMultiFreedomConstraintsFrom(fp);
         else if ( decl == "NUMERICS" )
@@ -228,6 +264,8 @@ void AnalysisModel::readInputFile()
             _outputManager->readOutputWriterFromFile(fp);
         else if ( decl == "SOLUTION_STAGES" )
             _solutionManager->readNumberOfStagesFrom(fp);
+        else if ( decl == "THREAD_AFFINITY" )
+            _threadAffinity = getStringInputFrom(fp, "\nFailed to read thread affinity policy from input file!", src);
         else if ( decl != "END" )
             throw std::runtime_error("Error: Unrecognized declaration '" + decl + "' encountered in input file!\n");
     }
@@ -60,6 +60,7 @@ namespace broomstyx
     private:
         std::string _inputFilename;
         std::string _meshFilename;
+        std::string _threadAffinity;
         
         DofManager*      _dofManager;
         DomainManager*   _domainManager;
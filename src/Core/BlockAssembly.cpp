@@ -0,0 +1,311 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "BlockAssembly.hpp"
+#include <algorithm>
+#include <omp.h>
+#include <stdexcept>
+#include "AnalysisModel.hpp"
+#include "Diagnostics.hpp"
+#include "DomainManager.hpp"
+#include "SparseMatrix/SparseMatrix.hpp"
+
+using namespace broomstyx;
+
+namespace
+{
+    const int unreachedRow = -1;
+    const int sharedRow = -2;
+}
+
+// Constructor
+AssemblyBuffer::AssemblyBuffer() {}
+
+// Destructor
+AssemblyBuffer::~AssemblyBuffer() {}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void AssemblyBuffer::addToMatrixComponent( int rowNum, int colNum, double val )
+{
+    _matRow.push_back(rowNum);
+    _matCol.push_back(colNum);
+    _matVal.push_back(val);
+}
+// ----------------------------------------------------------------------------
+void AssemblyBuffer::addToVectorComponent( int rowNum, double val )
+{
+    _vecRow.push_back(rowNum);
+    _vecVal.push_back(val);
+}
+// ----------------------------------------------------------------------------
+void AssemblyBuffer::mergeInto( SparseMatrix* spMatrix )
+{
+    for ( int i = 0; i < (int)_matRow.size(); i++ )
+        spMatrix->atomicAddToComponent(_matRow[i], _matCol[i], _matVal[i]);
+    
+    _matRow.clear();
+    _matCol.clear();
+    _matVal.clear();
+}
+// ----------------------------------------------------------------------------
+void AssemblyBuffer::mergeInto( RealVector& vec )
+{
+    for ( int i = 0; i < (int)_vecRow.size(); i++ )
+    {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        vec(_vecRow[i]) += _vecVal[i];
+    }
+    
+    _vecRow.clear();
+    _vecVal.clear();
+}
+
+// Constructor
+BlockAssembly::BlockAssembly()
+    : _blockSize(256)
+    , _blockPtr(1, 0)
+    , _nPasses(0)
+    , _rebalanceInterval(10)
+{}
+
+// Destructor
+BlockAssembly::~BlockAssembly() {}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void BlockAssembly::finishAssemblyPass()
+{
+    int nThreads = 1;
+#ifdef _OPENMP
+    nThreads = omp_get_max_threads();
+#endif
+    if ( nThreads != (int)_threadBlockPtr.size() - 1 )
+    {
+        this->distributeBlocksOverThreads(nThreads);
+        return;
+    }
+    
+    // Load imbalance of the pass, measured as the ratio of the largest to the
+    // average thread assembly time, less one
+    double maxTime = 0., totalTime = 0.;
+    for ( int i = 0; i < nThreads; i++ )
+    {
+        double threadTime = 0.;
+        for ( int j = _threadBlockPtr[i]; j < _threadBlockPtr[i + 1]; j++ )
+            threadTime += _blockCost[j];
+        
+        maxTime = std::max(maxTime, threadTime);
+        totalTime += threadTime;
+    }
+    
+    if ( totalTime > 0. )
+        diagnostics().addAssemblyImbalance(maxTime*nThreads/totalTime - 1.);
+    
+    // Block ranges are recomputed from the costs measured in the first pass
+    // and periodically thereafter, since cell costs change as the state of
+    // cells evolves
+    if ( _nPasses++ % _rebalanceInterval == 0 )
+        this->distributeBlocksOverThreads(nThreads);
+}
+// ----------------------------------------------------------------------------
+void BlockAssembly::formBlocksFrom( const std::vector<Cell*>& cell )
+{
+    // Blocks consist of consecutive cells and do not extend over mesh
+    // partitions, so cell lists are expected to be grouped by partition
+    // and ordered with spatial locality within each partition
+    _cell = cell;
+    _blockPtr.assign(1, 0);
+    
+    int nCells = _cell.size();
+    int blockStart = 0;
+    for ( int i = 1; i <= nCells; i++ )
+    {
+        bool isLastCell = (i == nCells);
+        if ( isLastCell || i - blockStart == _blockSize
+                || analysisModel().domainManager().givePartitionOf(_cell[i]) != analysisModel().domainManager().givePartitionOf(_cell[blockStart]) )
+        {
+            _blockPtr.push_back(i);
+            blockStart = i;
+        }
+    }
+    
+    _batchPtr.assign(1, 0);
+    _blockBatchPtr.assign(1, 0);
+    _batchNumerics.clear();
+    for ( int i = 0; i < this->giveNumberOfBlocks(); i++ )
+        this->formBatchesOfBlock(i);
+    
+    _rowBlock.clear();
+    
+    // Cells are assumed to have equal cost until assembly times are measured
+    int nBlocks = this->giveNumberOfBlocks();
+    _blockCost.assign(nBlocks, 0.);
+    _blockTic.assign(nBlocks, std::chrono::high_resolution_clock::now());
+    for ( int i = 0; i < nBlocks; i++ )
+        _blockCost[i] = _blockPtr[i + 1] - _blockPtr[i];
+    
+    int nThreads = 1;
+#ifdef _OPENMP
+    nThreads = omp_get_max_threads();
+#endif
+    _nPasses = 0;
+    this->distributeBlocksOverThreads(nThreads);
+}
+// ----------------------------------------------------------------------------
+std::tuple<int,int> BlockAssembly::giveBatchRangeOfBlock( int blockNum )
+{
+    return std::make_tuple(_blockBatchPtr[blockNum], _blockBatchPtr[blockNum + 1]);
+}
+// ----------------------------------------------------------------------------
+std::tuple<int,int> BlockAssembly::giveBlockRangeOfThread( int threadNum, int nThreads )
+{
+    // Blocks are split evenly if the number of threads has changed since
+    // block ranges were last computed
+    if ( nThreads != (int)_threadBlockPtr.size() - 1 )
+    {
+        int nBlocks = this->giveNumberOfBlocks();
+        return std::make_tuple(nBlocks*threadNum/nThreads, nBlocks*(threadNum + 1)/nThreads);
+    }
+    
+    return std::make_tuple(_threadBlockPtr[threadNum], _threadBlockPtr[threadNum + 1]);
+}
+// ----------------------------------------------------------------------------
+ArraySpan<Cell* const> BlockAssembly::giveCellsOfBatch( int batchNum )
+{
+    return ArraySpan<Cell* const>(_cell.data() + _batchPtr[batchNum], _batchPtr[batchNum + 1] - _batchPtr[batchNum]);
+}
+// ----------------------------------------------------------------------------
+ArraySpan<Cell* const> BlockAssembly::giveCellsOfBlock( int blockNum )
+{
+    return ArraySpan<Cell* const>(_cell.data() + _blockPtr[blockNum], _blockPtr[blockNum + 1] - _blockPtr[blockNum]);
+}
+// ----------------------------------------------------------------------------
+int BlockAssembly::giveNumberOfBlocks()
+{
+    return (int)_blockPtr.size() - 1;
+}
+// ----------------------------------------------------------------------------
+int BlockAssembly::giveNumberOfInterfaceRows()
+{
+    int nInterfaceRows = 0;
+    for ( int blockNum : _rowBlock )
+        if ( blockNum == sharedRow )
+            ++nInterfaceRows;
+    
+    return nInterfaceRows;
+}
+// ----------------------------------------------------------------------------
+Numerics* BlockAssembly::giveNumericsOfBatch( int batchNum )
+{
+    return _batchNumerics[batchNum];
+}
+// ----------------------------------------------------------------------------
+void BlockAssembly::initializeRowOwnership( int nRows )
+{
+    _rowBlock.assign(nRows, unreachedRow);
+}
+// ----------------------------------------------------------------------------
+bool BlockAssembly::ownsRow( int blockNum, int rowNum )
+{
+    return _rowBlock[rowNum] == blockNum;
+}
+// ----------------------------------------------------------------------------
+void BlockAssembly::registerRowOfBlock( int rowNum, int blockNum )
+{
+    if ( _rowBlock[rowNum] == unreachedRow )
+        _rowBlock[rowNum] = blockNum;
+    else if ( _rowBlock[rowNum] != blockNum )
+        _rowBlock[rowNum] = sharedRow;
+}
+// ----------------------------------------------------------------------------
+void BlockAssembly::setBlockSizeTo( int blockSize )
+{
+    if ( blockSize < 1 )
+        throw std::runtime_error("Assembly block size must be positive!\nSource: BlockAssembly");
+    
+    _blockSize = blockSize;
+}
+// ----------------------------------------------------------------------------
+void BlockAssembly::startTimingOf( int blockNum )
+{
+    _blockTic[blockNum] = std::chrono::high_resolution_clock::now();
+}
+// ----------------------------------------------------------------------------
+void BlockAssembly::stopTimingOf( int blockNum )
+{
+    std::chrono::duration<double> tictoc = std::chrono::high_resolution_clock::now() - _blockTic[blockNum];
+    _blockCost[blockNum] = tictoc.count();
+}
+
+// Private methods
+// ----------------------------------------------------------------------------
+void BlockAssembly::distributeBlocksOverThreads( int nThreads )
+{
+    // Each thread receives a contiguous range of blocks. Ranges end where
+    // the cumulative cost first reaches the thread's share of the total.
+    int nBlocks = this->giveNumberOfBlocks();
+    double totalCost = 0.;
+    for ( int i = 0; i < nBlocks; i++ )
+        totalCost += _blockCost[i];
+    
+    _threadBlockPtr.assign(nThreads + 1, nBlocks);
+    _threadBlockPtr[0] = 0;
+    
+    double cumulativeCost = 0.;
+    int curThread = 1;
+    for ( int i = 0; i < nBlocks && curThread < nThreads; i++ )
+    {
+        cumulativeCost += _blockCost[i];
+        while ( curThread < nThreads && cumulativeCost >= totalCost*curThread/nThreads )
+            _threadBlockPtr[curThread++] = i + 1;
+    }
+}
+// ----------------------------------------------------------------------------
+void BlockAssembly::formBatchesOfBlock( int blockNum )
+{
+    // Cells of the block are sorted by domain and element type, keeping
+    // their relative order otherwise, and each run of cells sharing both
+    // forms a batch
+    DomainManager& domainManager = analysisModel().domainManager();
+    auto batchKeyOf = [&domainManager]( Cell* targetCell )
+    {
+        return std::make_tuple(domainManager.giveLabelOf(targetCell), domainManager.giveElementTypeOf(targetCell));
+    };
+    
+    auto first = _cell.begin() + _blockPtr[blockNum];
+    auto last = _cell.begin() + _blockPtr[blockNum + 1];
+    std::stable_sort(first, last, [&batchKeyOf]( Cell* a, Cell* b ) { return batchKeyOf(a) < batchKeyOf(b); });
+    
+    for ( int i = _blockPtr[blockNum] + 1; i <= _blockPtr[blockNum + 1]; i++ )
+    {
+        if ( i == _blockPtr[blockNum + 1] || batchKeyOf(_cell[i]) != batchKeyOf(_cell[i - 1]) )
+        {
+            _batchNumerics.push_back(domainManager.giveNumericsFor(_cell[i - 1]));
+            _batchPtr.push_back(i);
+        }
+    }
+    _blockBatchPtr.push_back((int)_batchPtr.size() - 1);
+}
@@ -0,0 +1,130 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef BLOCKASSEMBLY_HPP
+#define BLOCKASSEMBLY_HPP
+
+#include <chrono>
+#include <tuple>
+#include <vector>
+#include "Util/ArraySpan.hpp"
+#include "Util/RealVector.hpp"
+
+namespace broomstyx
+{
+    class Cell;
+    class Numerics;
+    class SparseMatrix;
+    
+    // Contributions to equation rows shared by several assembly blocks,
+    // accumulated privately by each thread and merged into the global system
+    // once the thread has assembled its blocks
+    class AssemblyBuffer
+    {
+    public:
+        AssemblyBuffer();
+        virtual ~AssemblyBuffer();
+        
+        void addToMatrixComponent( int rowNum, int colNum, double val );
+        void addToVectorComponent( int rowNum, double val );
+        void mergeInto( SparseMatrix* spMatrix );
+        void mergeInto( RealVector& vec );
+        
+    private:
+        std::vector<int>    _matRow;
+        std::vector<int>    _matCol;
+        std::vector<double> _matVal;
+        std::vector<int>    _vecRow;
+        std::vector<double> _vecVal;
+    };
+    
+    // Division of cells into small blocks of consecutive cells. Each thread
+    // assembles a contiguous range of blocks whose measured assembly cost is
+    // close to an equal share of the total, and the ranges are recomputed
+    // periodically from the latest costs. Rows that receive contributions
+    // from the cells of a single block (interior rows) are written directly
+    // by the thread assembling that block, without atomics. Contributions to
+    // rows shared by several blocks (interface rows) go through an
+    // AssemblyBuffer. Row ownership is taken from the coefficient matrix
+    // pattern of the cells, so vectors assembled per block must only have
+    // contributions to rows in this pattern. Cells within a block are
+    // further grouped into batches of the same domain and element type, so
+    // that element matrices can be computed one batch at a time.
+    class BlockAssembly
+    {
+    public:
+        BlockAssembly();
+        virtual ~BlockAssembly();
+        
+        void finishAssemblyPass();
+        void formBlocksFrom( const std::vector<Cell*>& cell );
+        std::tuple<int,int> 
+             giveBatchRangeOfBlock( int blockNum );
+        std::tuple<int,int> 
+             giveBlockRangeOfThread( int threadNum, int nThreads );
+        ArraySpan<Cell* const> 
+             giveCellsOfBatch( int batchNum );
+        ArraySpan<Cell* const> 
+             giveCellsOfBlock( int blockNum );
+        int  giveNumberOfBlocks();
+        int  giveNumberOfInterfaceRows();
+        Numerics* giveNumericsOfBatch( int batchNum );
+        void initializeRowOwnership( int nRows );
+        bool ownsRow( int blockNum, int rowNum );
+        void registerRowOfBlock( int rowNum, int blockNum );
+        void setBlockSizeTo( int blockSize );
+        void startTimingOf( int blockNum );
+        void stopTimingOf( int blockNum );
+        
+    private:
+        int _blockSize;
+        
+        // Cells of each block, stored contiguously
+        std::vector<Cell*> _cell;
+        std::vector<int>   _blockPtr;
+        
+        // Cells of each batch, the first batch of each block, and the
+        // numerics of each batch
+        std::vector<int>       _batchPtr;
+        std::vector<int>       _blockBatchPtr;
+        std::vector<Numerics*> _batchNumerics;
+        
+        // Block owning each row, or a negative value for interface rows and
+        // rows not reached by any block
+        std::vector<int> _rowBlock;
+        
+        // Assembly time of each block in the last pass, and the first block
+        // assigned to each thread
+        std::vector<double> _blockCost;
+        std::vector<std::chrono::time_point<std::chrono::high_resolution_clock>> 
+                            _blockTic;
+        std::vector<int>    _threadBlockPtr;
+        int _nPasses;
+        int _rebalanceInterval;
+        
+        void distributeBlocksOverThreads( int nThreads );
+        void formBatchesOfBlock( int blockNum );
+    };
+}
+
+#endif /* BLOCKASSEMBLY_HPP */
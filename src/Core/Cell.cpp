@@ -32,11 +32,22 @@ using namespace broomstyx;
 Cell::Cell()
     : numericsStatus(nullptr)
     , _partition(-1)
+    , _coefMatRevision(0)
     , _isPartOfDomain(false)
 {}
 
 Cell::~Cell() {}
 
+void Cell::flagCoefficientMatrixChange()
+{
+    ++_coefMatRevision;
+}
+
+int Cell::giveCoefficientMatrixRevision()
+{
+    return _coefMatRevision;
+}
+
 int Cell::id()
 {
     return _id;
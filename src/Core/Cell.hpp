@@ -53,6 +53,13 @@ namespace broomstyx
         
         int  id();
         void showInfo();
+        
+        // Revision of the state from which the coefficient matrix of the
+        // cell is computed. Numerics that track changes to this state
+        // advance the revision on every change, so that stored copies of the
+        // coefficient matrix can be recognized as outdated.
+        void flagCoefficientMatrixChange();
+        int  giveCoefficientMatrixRevision();
 
     private:
         int _elType;
@@ -60,6 +67,7 @@ namespace broomstyx
         int _dim;
         int _id;
         int _partition;
+        int _coefMatRevision;
 
         bool _isPartOfDomain;
         std::vector<Node*> _node;
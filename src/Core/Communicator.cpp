@@ -0,0 +1,156 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "Communicator.hpp"
+#include <config.h>
+
+#ifdef HAVE_MPI
+#include <mpi.h>
+#endif
+
+using namespace broomstyx;
+
+// Constructor
+Communicator::Communicator()
+    : _isInitialized(false)
+    , _rank(0)
+    , _nProcesses(1)
+{}
+
+// Destructor
+Communicator::~Communicator() {}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void Communicator::abort()
+{
+#ifdef HAVE_MPI
+    if ( _isInitialized )
+        MPI_Abort(MPI_COMM_WORLD, 1);
+#endif
+}
+// ----------------------------------------------------------------------------
+void Communicator::finalize()
+{
+#ifdef HAVE_MPI
+    if ( _isInitialized )
+        MPI_Finalize();
+#endif
+    _isInitialized = false;
+}
+// ----------------------------------------------------------------------------
+std::vector<int> Communicator::gatherFromAll( int val )
+{
+    std::vector<int> gathered(_nProcesses, val);
+#ifdef HAVE_MPI
+    if ( _nProcesses > 1 )
+        MPI_Allgather(&val, 1, MPI_INT, gathered.data(), 1, MPI_INT, MPI_COMM_WORLD);
+#endif
+    return gathered;
+}
+// ----------------------------------------------------------------------------
+std::vector<double> Communicator::gatherOnRoot( const std::vector<double>& val )
+{
+    // Values of all processes are concatenated in the order of their ranks
+    // on the root process. Other processes receive nothing.
+#ifdef HAVE_MPI
+    if ( _nProcesses > 1 )
+    {
+        int count = val.size();
+        std::vector<int> recvCount(_nProcesses, 0), recvDispl(_nProcesses, 0);
+        MPI_Gather(&count, 1, MPI_INT, recvCount.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+        
+        std::vector<double> gathered;
+        if ( _rank == 0 )
+        {
+            for ( int i = 1; i < _nProcesses; i++ )
+                recvDispl[i] = recvDispl[i-1] + recvCount[i-1];
+            gathered.resize(recvDispl[_nProcesses-1] + recvCount[_nProcesses-1]);
+        }
+        
+        MPI_Gatherv(val.data(), count, MPI_DOUBLE, gathered.data(), recvCount.data(), recvDispl.data()
+                   , MPI_DOUBLE, 0, MPI_COMM_WORLD);
+        return gathered;
+    }
+#endif
+    return val;
+}
+// ----------------------------------------------------------------------------
+int Communicator::giveNumberOfProcesses()
+{
+    return _nProcesses;
+}
+// ----------------------------------------------------------------------------
+int Communicator::givePartitionOwnedByThisProcess()
+{
+    // Gmsh numbers partitions starting from 1
+    return _rank + 1;
+}
+// ----------------------------------------------------------------------------
+int Communicator::giveRank()
+{
+    return _rank;
+}
+// ----------------------------------------------------------------------------
+int Communicator::giveRankOwningPartition( int partNum )
+{
+    // Cells without partition information (partition 0) belong to the root
+    return partNum > 0 ? partNum - 1 : 0;
+}
+// ----------------------------------------------------------------------------
+void Communicator::initialize( int* argc, char*** argv )
+{
+#ifdef HAVE_MPI
+    MPI_Init(argc, argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &_nProcesses);
+    _isInitialized = true;
+#endif
+}
+// ----------------------------------------------------------------------------
+bool Communicator::isDistributed()
+{
+    return _nProcesses > 1;
+}
+// ----------------------------------------------------------------------------
+bool Communicator::isRoot()
+{
+    return _rank == 0;
+}
+// ----------------------------------------------------------------------------
+double Communicator::sumOverProcesses( double val )
+{
+    double sum = val;
+#ifdef HAVE_MPI
+    if ( _nProcesses > 1 )
+        MPI_Allreduce(&val, &sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    return sum;
+}
+
+// ----------------------------------------------------------------------------
+Communicator& broomstyx::communicator()
+{
+    static Communicator communicator;
+    return communicator;
+}
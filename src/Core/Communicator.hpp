@@ -0,0 +1,66 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef COMMUNICATOR_HPP
+#define COMMUNICATOR_HPP
+
+#include <vector>
+
+namespace broomstyx
+{
+    // Process layout for distributed-memory (MPI) execution, in which each
+    // process owns one partition of the mesh. Without MPI, or when started as
+    // a single process, collective operations leave their arguments as is.
+    class Communicator final
+    {
+        friend Communicator& communicator();
+
+    public:
+        void   abort();
+        void   finalize();
+        std::vector<int> 
+               gatherFromAll( int val );
+        std::vector<double> 
+               gatherOnRoot( const std::vector<double>& val );
+        int    giveNumberOfProcesses();
+        int    givePartitionOwnedByThisProcess();
+        int    giveRank();
+        int    giveRankOwningPartition( int partNum );
+        void   initialize( int* argc, char*** argv );
+        bool   isDistributed();
+        bool   isRoot();
+        double sumOverProcesses( double val );
+
+    private:
+        bool _isInitialized;
+        int  _rank;
+        int  _nProcesses;
+
+        Communicator();
+        virtual ~Communicator();
+    };
+
+    Communicator& communicator();
+}
+
+#endif /* COMMUNICATOR_HPP */
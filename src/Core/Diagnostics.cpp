@@ -29,18 +29,25 @@
 using namespace broomstyx;
 
 Diagnostics::Diagnostics()
-    : _nCoefMatAssembly(0)
+    : _nAssemblyPasses(0)
+    , _nCoefMatAssembly(0)
     , _nConvergenceChecks(0)
     , _nLhsAssembly(0)
     , _nRhsAssembly(0)
     , _nSolves(0)
     , _nUpdates(0)
+    , _nElMatCacheHits(0)
+    , _nElMatCacheMisses(0)
+    , _assemblyImbalance(0.)
+    , _maxAssemblyImbalance(0.)
     , _coefMatAssemblyTime(0.)
     , _lhsAssemblyTime(0.)
+    , _meshSetupTime(0.)
     , _outputWriteTime(0.)
     , _rhsAssemblyTime(0.)
     , _setupTime(0.)
     , _solveTime(0.)
+    , _sparsityProfileTime(0.)
     , _updateTime(0.)
 {}
 
@@ -49,6 +56,16 @@ Diagnostics::~Diagnostics()
 
 // Public methods
 // ----------------------------------------------------------------------------
+void Diagnostics::addAssemblyImbalance( double imbalance )
+{
+    // Excess of the slowest thread's assembly time over the average, as a
+    // fraction of the average
+    ++_nAssemblyPasses;
+    _assemblyImbalance += imbalance;
+    if ( imbalance > _maxAssemblyImbalance )
+        _maxAssemblyImbalance = imbalance;
+}
+
 void Diagnostics::addCoefMatAssemblyTime( double duration )
 {
     ++_nCoefMatAssembly;
@@ -61,12 +78,25 @@ void Diagnostics::addConvergenceCheckTime( double duration )
     _convergenceCheckTime += duration;
 }
 
+void Diagnostics::addElementMatrixCacheAccesses( long hits, long misses )
+{
+    // Misses include element matrices that are not eligible for caching
+    _nElMatCacheHits += hits;
+    _nElMatCacheMisses += misses;
+}
+
 void Diagnostics::addLhsAssemblyTime( double duration )
 {
     ++_nLhsAssembly;
     _lhsAssemblyTime += duration;
 }
 
+void Diagnostics::addMeshSetupTime( double duration )
+{
+    // Part of problem setup time
+    _meshSetupTime += duration;
+}
+
 void Diagnostics::addOutputWriteTime( double duration )
 {
     _outputWriteTime += duration;
@@ -94,6 +124,12 @@ void Diagnostics::addSolveTime( double duration )
     _solveTime += duration;
 }
 
+void Diagnostics::addSparsityProfileTime( double duration )
+{
+    // Part of problem setup time
+    _sparsityProfileTime += duration;
+}
+
 void Diagnostics::addUpdateTime( double duration )
 {
     ++_nUpdates;
@@ -105,13 +141,23 @@ void Diagnostics::outputDiagnostics()
     std::printf("\n================= SIMULATION DIAGNOSTICS =================\n\n");
     std::printf("                   Number    Total time (seconds)\n\n");
     std::printf("%-20s          %f\n", "Problem setup", _setupTime);
+    if ( _meshSetupTime > ZEROTIME_TOL )
+        std::printf("%-20s          (%f)\n", "  Mesh", _meshSetupTime);
+    if ( _sparsityProfileTime > ZEROTIME_TOL )
+        std::printf("%-20s          (%f)\n", "  Sparsity profile", _sparsityProfileTime);
     std::printf("%-20s          %f\n", "System Assembly", _coefMatAssemblyTime + _lhsAssemblyTime + _rhsAssemblyTime);
     if ( _coefMatAssemblyTime > ZEROTIME_TOL)
         std::printf("%-20s%-10d(%f)\n", "  Coef. Matrix", _nCoefMatAssembly, _coefMatAssemblyTime);
+    if ( _nElMatCacheHits + _nElMatCacheMisses > 0 )
+        std::printf("%-20s          (%.2f%% of %ld element matrices)\n", "  Cache hits"
+                   , 100.*_nElMatCacheHits/(_nElMatCacheHits + _nElMatCacheMisses), _nElMatCacheHits + _nElMatCacheMisses);
     if ( _lhsAssemblyTime > ZEROTIME_TOL )
         std::printf("%-20s%-10d(%f)\n", "  Left hand side", _nLhsAssembly, _lhsAssemblyTime);
     if ( _rhsAssemblyTime > ZEROTIME_TOL )
         std::printf("%-20s%-10d(%f)\n", "  Right hand side", _nRhsAssembly, _rhsAssemblyTime);
+    if ( _nAssemblyPasses > 0 )
+        std::printf("%-20s%-10d(%f average, %f max)\n", "  Thread imbalance", _nAssemblyPasses
+                   , _assemblyImbalance/_nAssemblyPasses, _maxAssemblyImbalance);
     std::printf("%-20s%-10d%f\n", "Linear Solve", _nSolves, _solveTime);
     if ( _convergenceCheckTime > ZEROTIME_TOL )
         std::printf("%-20s%-10d%f\n", "Convergence checks", _nConvergenceChecks, _convergenceCheckTime);
@@ -131,6 +177,28 @@ void Diagnostics::outputDiagnostics()
     std::printf("\n==========================================================\n\n");
 }
 
+void Diagnostics::writeDiagnosticsTo( FILE* fp )
+{
+    // Machine-readable summary (JSON object) of the timings above
+    std::fprintf(fp, "{\n");
+    std::fprintf(fp, "  \"setup\": %.6f,\n", _setupTime);
+    std::fprintf(fp, "  \"meshSetup\": %.6f,\n", _meshSetupTime);
+    std::fprintf(fp, "  \"sparsityProfile\": %.6f,\n", _sparsityProfileTime);
+    std::fprintf(fp, "  \"assembly\": %.6f,\n", _coefMatAssemblyTime + _lhsAssemblyTime + _rhsAssemblyTime);
+    std::fprintf(fp, "  \"coefMatAssembly\": { \"count\": %d, \"time\": %.6f },\n", _nCoefMatAssembly, _coefMatAssemblyTime);
+    std::fprintf(fp, "  \"elementMatrixCache\": { \"hits\": %ld, \"misses\": %ld },\n", _nElMatCacheHits, _nElMatCacheMisses);
+    std::fprintf(fp, "  \"lhsAssembly\": { \"count\": %d, \"time\": %.6f },\n", _nLhsAssembly, _lhsAssemblyTime);
+    std::fprintf(fp, "  \"rhsAssembly\": { \"count\": %d, \"time\": %.6f },\n", _nRhsAssembly, _rhsAssemblyTime);
+    std::fprintf(fp, "  \"assemblyImbalance\": { \"count\": %d, \"average\": %.6f, \"max\": %.6f },\n", _nAssemblyPasses
+                , _nAssemblyPasses > 0 ? _assemblyImbalance/_nAssemblyPasses : 0., _maxAssemblyImbalance);
+    std::fprintf(fp, "  \"solve\": { \"count\": %d, \"time\": %.6f },\n", _nSolves, _solveTime);
+    std::fprintf(fp, "  \"convergenceCheck\": { \"count\": %d, \"time\": %.6f },\n", _nConvergenceChecks, _convergenceCheckTime);
+    std::fprintf(fp, "  \"update\": %.6f,\n", _updateTime);
+    std::fprintf(fp, "  \"postprocessing\": %.6f,\n", _postprocessingTime);
+    std::fprintf(fp, "  \"output\": %.6f\n", _outputWriteTime);
+    std::fprintf(fp, "}\n");
+}
+
 // ----------------------------------------------------------------------------
 Diagnostics& broomstyx::diagnostics()
 {
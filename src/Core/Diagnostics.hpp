@@ -24,6 +24,8 @@
 #ifndef DIAGNOSTICS_HPP
 #define DIAGNOSTICS_HPP
 
+#include <cstdio>
+
 namespace broomstyx
 {
     class Diagnostics final
@@ -31,33 +33,46 @@ namespace broomstyx
         friend Diagnostics& diagnostics();
 
     public:
+        void addAssemblyImbalance( double imbalance );
         void addCoefMatAssemblyTime( double duration );
         void addConvergenceCheckTime( double duration );
+        void addElementMatrixCacheAccesses( long hits, long misses );
         void addLhsAssemblyTime( double duration );
+        void addMeshSetupTime( double duration );
         void addOutputWriteTime( double duration );
         void addPostprocessingTime( double duration );
         void addRhsAssemblyTime( double duration );
         void addSetupTime( double duration );
         void addSolveTime( double duration );
+        void addSparsityProfileTime( double duration );
         void addUpdateTime( double duration );
         void outputDiagnostics();
+        void writeDiagnosticsTo( FILE* fp );
 
     private:
+        int _nAssemblyPasses;
         int _nCoefMatAssembly;
         int _nConvergenceChecks;
         int _nLhsAssembly;
         int _nRhsAssembly;
         int _nSolves;
         int _nUpdates;
+        
+        long _nElMatCacheHits;
+        long _nElMatCacheMisses;
 
+        double _assemblyImbalance;
+        double _maxAssemblyImbalance;
         double _coefMatAssemblyTime;
         double _convergenceCheckTime;
         double _lhsAssemblyTime;
+        double _meshSetupTime;
         double _outputWriteTime;
         double _postprocessingTime;
         double _rhsAssemblyTime;
         double _setupTime;
         double _solveTime;
+        double _sparsityProfileTime;
         double _updateTime;
 
         Diagnostics();
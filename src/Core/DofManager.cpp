@@ -314,6 +314,11 @@ int DofManager::giveGroupNumberFor( Dof* targetDof )
     return targetDof->_group;
 }
 // ----------------------------------------------------------------------------
+std::vector<Dof*> DofManager::giveInactiveDofsAtStage( int stg )
+{
+    return _inactiveDof[ stg ];
+}
+// ----------------------------------------------------------------------------
 int DofManager::giveIndexForCellDof( const std::string& name )
 {
     int index = -1;
@@ -764,8 +769,11 @@ void DofManager::writeConvergedDofValuesTo( Node* targetNode )
     {
         Dof* curDof = targetNode->_dof[ i ];
         
-        analysisModel().domainManager().setFieldValueAt(targetNode, _nodalDofInfo[ i ].primField, curDof->_primVarConverged );
-        analysisModel().domainManager().setFieldValueAt(targetNode, _nodalDofInfo[ i ].secField, curDof->_secVar );
+        // Field number 0 means that no field is assigned
+        if ( _nodalDofInfo[ i ].primField > 0 )
+            analysisModel().domainManager().setFieldValueAt(targetNode, _nodalDofInfo[ i ].primField, curDof->_primVarConverged );
+        if ( _nodalDofInfo[ i ].secField > 0 )
+            analysisModel().domainManager().setFieldValueAt(targetNode, _nodalDofInfo[ i ].secField, curDof->_secVar );
     }
 }
 // ----------------------------------------------------------------------------
@@ -72,6 +72,8 @@ namespace broomstyx
         std::vector<Dof*> 
                giveActiveDofsAtStage( int stg );
         static int    giveGroupNumberFor( Dof* targetDof );
+        std::vector<Dof*> 
+               giveInactiveDofsAtStage( int stg );
         int    giveIndexForCellDof( const std::string& name );
         int    giveIndexForFaceDof( const std::string& name );
         int    giveIndexForNodalDof( const std::string& name );
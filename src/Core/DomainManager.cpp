@@ -22,29 +22,173 @@
 */
 
 #include "DomainManager.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <limits>
 #include <stdexcept>
 #include <omp.h>
+#include <unistd.h>
 
 #include "AnalysisModel.hpp"
 #include "Cell.hpp"
+#include "Communicator.hpp"
 #include "DofManager.hpp"
 #include "DomainManager.hpp"
 #include "MaterialManager.hpp"
 #include "Node.hpp"
 #include "NumericsManager.hpp"
 #include "SolutionManager.hpp"
+#include "Materials/Material.hpp"
 #include "MeshReaders/MeshReader.hpp"
 #include "Numerics/Numerics.hpp"
+#include "Util/MappedFile.hpp"
+#include "Util/meshOrdering.hpp"
 #include "Util/readOperations.hpp"
 
 using namespace broomstyx;
 
+namespace
+{
+    // Layout of the binary mesh cache: a fixed header followed by a sequence
+    // of arrays, each stored as an int64 element count and the elements
+    // themselves, padded to a multiple of 8 bytes so that every array is
+    // suitably aligned within the mapped file.
+    
+    const char         meshCacheMagic[8] = {'B', 'X', 'M', 'C', 'A', 'C', 'H', 'E'};
+    const std::int32_t meshCacheVersion = 1;
+    
+    struct MeshCacheHeader
+    {
+        char          magic[8];
+        std::int32_t  version;
+        std::int32_t  headerSize;
+        std::uint64_t key;
+    };
+    
+    class MeshCacheWriter
+    {
+    public:
+        explicit MeshCacheWriter( FILE* fp ) : _fp(fp), _ok(true) {}
+        
+        template <typename T>
+        void write( const std::vector<T>& array )
+        {
+            static const char zero[8] = {};
+            std::int64_t n = array.size();
+            std::size_t nBytes = n*sizeof(T);
+            
+            _ok = _ok && std::fwrite(&n, sizeof(n), 1, _fp) == 1;
+            if ( n > 0 )
+                _ok = _ok && std::fwrite(array.data(), sizeof(T), n, _fp) == (std::size_t)n;
+            if ( nBytes % 8 != 0 )
+                _ok = _ok && std::fwrite(zero, 1, 8 - nBytes % 8, _fp) == 8 - nBytes % 8;
+        }
+        
+        bool ok() const { return _ok; }
+        
+    private:
+        FILE* _fp;
+        bool  _ok;
+    };
+    
+    class MeshCacheReader
+    {
+    public:
+        MeshCacheReader( const char* data, std::size_t size ) : _pos(data), _end(data + size) {}
+        
+        template <typename T>
+        ArraySpan<const T> read()
+        {
+            std::int64_t n;
+            if ( (std::size_t)(_end - _pos) < sizeof(n) )
+                throw std::runtime_error("truncated file");
+            std::memcpy(&n, _pos, sizeof(n));
+            _pos += sizeof(n);
+            
+            std::size_t nBytes = (std::size_t)n*sizeof(T);
+            std::size_t nPadded = (nBytes + 7)/8*8;
+            if ( n < 0 || n > std::numeric_limits<int>::max() || (std::size_t)(_end - _pos) < nPadded )
+                throw std::runtime_error("truncated file");
+            
+            const T* first = reinterpret_cast<const T*>(_pos);
+            _pos += nPadded;
+            
+            return ArraySpan<const T>(first, (int)n);
+        }
+        
+    private:
+        const char* _pos;
+        const char* _end;
+    };
+    
+    // Cell data written per cell group (domain or boundary cells)
+    struct CellArrays
+    {
+        std::vector<std::int32_t> elType, label, dim, partition;
+        std::vector<std::int32_t> nodePtr, nodeIdx, haloPtr, halo;
+    };
+    
+    struct CellSpans
+    {
+        ArraySpan<const std::int32_t> elType, label, dim, partition;
+        ArraySpan<const std::int32_t> nodePtr, nodeIdx, haloPtr, halo;
+    };
+    
+    // Compressed row arrays are valid if their offsets are nondecreasing and
+    // end at the size of the index array, and all indices are within range
+    void verifyCompressedRows( ArraySpan<const std::int32_t> ptr
+                             , ArraySpan<const std::int32_t> idx
+                             , int nRows
+                             , int minIdx
+                             , int maxIdx )
+    {
+        if ( ptr.size() != nRows + 1 || ptr[0] != 0 || ptr[nRows] != idx.size() )
+            throw std::runtime_error("inconsistent array sizes");
+        for ( int i = 0; i < nRows; i++ )
+            if ( ptr[i + 1] < ptr[i] )
+                throw std::runtime_error("invalid row offsets");
+        for ( int i = 0; i < idx.size(); i++ )
+            if ( idx[i] < minIdx || idx[i] >= maxIdx )
+                throw std::runtime_error("index out of range");
+    }
+    
+    CellSpans readCellSpans( MeshCacheReader& reader, int nNodes )
+    {
+        CellSpans cs;
+        cs.elType = reader.read<std::int32_t>();
+        cs.label = reader.read<std::int32_t>();
+        cs.dim = reader.read<std::int32_t>();
+        cs.partition = reader.read<std::int32_t>();
+        cs.nodePtr = reader.read<std::int32_t>();
+        cs.nodeIdx = reader.read<std::int32_t>();
+        cs.haloPtr = reader.read<std::int32_t>();
+        cs.halo = reader.read<std::int32_t>();
+        
+        int nCells = cs.elType.size();
+        if ( cs.label.size() != nCells || cs.dim.size() != nCells || cs.partition.size() != nCells )
+            throw std::runtime_error("inconsistent array sizes");
+        for ( int i = 0; i < nCells; i++ )
+            if ( cs.partition[i] < 0 )
+                throw std::runtime_error("invalid cell partition");
+        verifyCompressedRows(cs.nodePtr, cs.nodeIdx, nCells, 0, nNodes);
+        verifyCompressedRows(cs.haloPtr, cs.halo, nCells, std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+        
+        return cs;
+    }
+}
+
 // Constructor
 DomainManager::DomainManager()
 {
     _fieldsPerNode = -1;
     _constructFaces = false;
+    _formFaceGeometry = false;
+    _nodeOrdering = "None";
+    _cellOrdering = "None";
+    _meshCacheKey = 0;
 }
 
 // Destructor
@@ -75,6 +219,15 @@ DomainManager::~DomainManager()
         delete curDomCell;
     }
     
+    // Numerics and material status objects are released en bloc
+    for ( auto& entry : _numerics )
+        if ( entry.second )
+            entry.second->releaseStatusStorage();
+    for ( auto& entry : _materialSet )
+        for ( auto curMaterial : entry.second )
+            if ( curMaterial )
+                curMaterial->releaseStatusStorage();
+    
     for ( auto curBndCell : _bndCellList )
         delete curBndCell;
     
@@ -108,6 +261,17 @@ std::vector<Material*> DomainManager::giveMaterialSetForDomain( int label )
     return _materialSet[name];
 }
 // ----------------------------------------------------------------------------
+std::vector< std::vector<Material*> > DomainManager::giveMaterialSetsFor( Numerics* numerics )
+{
+    // Material sets of all domains assigned to the given numerics
+    std::vector< std::vector<Material*> > matSets;
+    for ( auto& entry : _numerics )
+        if ( entry.second == numerics )
+            matSets.push_back(_materialSet[entry.first]);
+    
+    return matSets;
+}
+// ----------------------------------------------------------------------------
 int DomainManager::giveNumberOfPhysicalNames()
 {
     return _physEnt.size();
@@ -162,6 +326,259 @@ int DomainManager::givePhysicalEntityNumberFor( std::string name )
     return physEntNumber;
 }
 // ----------------------------------------------------------------------------
+bool DomainManager::loadMeshCacheFor( const std::string& meshFilename )
+{
+    // Note: this method takes the place of reading the mesh and all of the
+    // topology discovery that follows (node-to-cell adjacency, reordering,
+    // placement, neighbors, faces and boundary associations). It returns
+    // false if no valid cache exists, in which case the mesh must be
+    // preprocessed as usual.
+    
+    if ( _meshCacheDir.empty() )
+        return false;
+    
+    this->resolveMeshCacheFor(meshFilename);
+    
+    MappedFile file;
+    if ( !file.open(_meshCacheFile) )
+    {
+        std::printf("  Mesh cache '%s' not found\n", _meshCacheFile.c_str());
+        return false;
+    }
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    std::printf("  %-40s", "Loading mesh cache ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+    
+    // Verify header and map all arrays before any object is created
+    ArraySpan<const std::int32_t> entDim, entNum, entNamePtr;
+    ArraySpan<const char> entName;
+    ArraySpan<const double> nodeCoor;
+    CellSpans dom, bnd;
+    ArraySpan<const std::int32_t> neighborPtr, neighborIdx, cellFaceIdx, cellFaceOrient;
+    ArraySpan<const std::int32_t> assocPtr, assocIdx;
+    ArraySpan<const std::int32_t> faceNodePtr, faceNodeIdx, faceCellIdx;
+    ArraySpan<const std::int32_t> nodeCellPtr, nodeCellIdx;
+    
+    try
+    {
+        MeshCacheHeader header;
+        if ( file.size() < sizeof(header) )
+            throw std::runtime_error("truncated file");
+        std::memcpy(&header, file.data(), sizeof(header));
+        
+        if ( std::memcmp(header.magic, meshCacheMagic, sizeof(meshCacheMagic)) != 0 )
+            throw std::runtime_error("not a mesh cache");
+        if ( header.version != meshCacheVersion || header.headerSize != (std::int32_t)sizeof(header) )
+            throw std::runtime_error("version mismatch");
+        if ( header.key != _meshCacheKey )
+            throw std::runtime_error("key mismatch");
+        
+        MeshCacheReader reader(file.data() + sizeof(header), file.size() - sizeof(header));
+        
+        entDim = reader.read<std::int32_t>();
+        entNum = reader.read<std::int32_t>();
+        entNamePtr = reader.read<std::int32_t>();
+        entName = reader.read<char>();
+        if ( entNum.size() != entDim.size() || entNamePtr.size() != entDim.size() + 1 
+                || entNamePtr[entDim.size()] != entName.size() )
+            throw std::runtime_error("inconsistent array sizes");
+        for ( int i = 0; i < entDim.size(); i++ )
+            if ( entNamePtr[i + 1] < entNamePtr[i] )
+                throw std::runtime_error("invalid row offsets");
+        
+        nodeCoor = reader.read<double>();
+        if ( nodeCoor.size() % 3 != 0 )
+            throw std::runtime_error("inconsistent array sizes");
+        int nNodes = nodeCoor.size()/3;
+        
+        dom = readCellSpans(reader, nNodes);
+        int nDomCells = dom.elType.size();
+        neighborPtr = reader.read<std::int32_t>();
+        neighborIdx = reader.read<std::int32_t>();
+        verifyCompressedRows(neighborPtr, neighborIdx, nDomCells, -1, nDomCells);
+        
+        bnd = readCellSpans(reader, nNodes);
+        int nBndCells = bnd.elType.size();
+        assocPtr = reader.read<std::int32_t>();
+        assocIdx = reader.read<std::int32_t>();
+        verifyCompressedRows(assocPtr, assocIdx, nBndCells, 0, nDomCells);
+        
+        faceNodePtr = reader.read<std::int32_t>();
+        faceNodeIdx = reader.read<std::int32_t>();
+        int nFaces = faceNodePtr.size() - 1;
+        verifyCompressedRows(faceNodePtr, faceNodeIdx, nFaces, 0, nNodes);
+        faceCellIdx = reader.read<std::int32_t>();
+        if ( faceCellIdx.size() != 2*nFaces )
+            throw std::runtime_error("inconsistent array sizes");
+        for ( int i = 0; i < faceCellIdx.size(); i++ )
+            if ( faceCellIdx[i] < -1 || faceCellIdx[i] >= nDomCells )
+                throw std::runtime_error("index out of range");
+        
+        cellFaceIdx = reader.read<std::int32_t>();
+        cellFaceOrient = reader.read<std::int32_t>();
+        if ( cellFaceOrient.size() != cellFaceIdx.size() )
+            throw std::runtime_error("inconsistent array sizes");
+        if ( nFaces > 0 )
+            verifyCompressedRows(neighborPtr, cellFaceIdx, nDomCells, 0, nFaces);
+        else if ( cellFaceIdx.size() > 0 )
+            throw std::runtime_error("inconsistent array sizes");
+        
+        nodeCellPtr = reader.read<std::int32_t>();
+        nodeCellIdx = reader.read<std::int32_t>();
+        verifyCompressedRows(nodeCellPtr, nodeCellIdx, nNodes, 0, nDomCells);
+        
+        if ( _fieldsPerNode == -1 )
+            throw std::runtime_error("Cannot create new node due to undefined number of fields per node!\nSource: DomainManager");
+    }
+    catch ( std::runtime_error& e )
+    {
+        std::printf("invalid (%s)\n", e.what());
+        return false;
+    }
+    
+    // Physical entities
+    for ( int i = 0; i < entDim.size(); i++ )
+        this->createPhysicalEntity(entDim[i], entNum[i]
+                , std::string(entName.begin() + entNamePtr[i], entName.begin() + entNamePtr[i + 1]));
+    
+    int nNodes = nodeCoor.size()/3;
+    int nDomCells = dom.elType.size();
+    int nBndCells = bnd.elType.size();
+    int nFaces = faceNodePtr.size() - 1;
+    
+    // Nodes and domain cells are created by the threads that own them under
+    // the static schedule used in the assembly loops (see
+    // placeMeshDataForThreads)
+    _node.assign(nNodes, nullptr);
+    _domCell.assign(nDomCells, nullptr);
+    
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for ( int i = 0; i < nNodes; i++ )
+        {
+            Node* curNode = new Node();
+            curNode->_id = i;
+            curNode->_coordinates = {nodeCoor[3*i], nodeCoor[3*i + 1], nodeCoor[3*i + 2]};
+            analysisModel().dofManager().createNodalDofsAt(curNode);
+            if ( _fieldsPerNode > 0 )
+                curNode->_fieldVal.init(_fieldsPerNode);
+            
+            _node[i] = curNode;
+        }
+        
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for ( int i = 0; i < nDomCells; i++ )
+        {
+            Cell* curCell = new Cell();
+            curCell->_elType = dom.elType[i];
+            curCell->_label = dom.label[i];
+            curCell->_dim = dom.dim[i];
+            curCell->_id = i;
+            curCell->_partition = dom.partition[i];
+            curCell->_isPartOfDomain = true;
+            curCell->_halo.assign(dom.halo.begin() + dom.haloPtr[i], dom.halo.begin() + dom.haloPtr[i + 1]);
+            
+            for ( int j = dom.nodePtr[i]; j < dom.nodePtr[i + 1]; j++ )
+                curCell->_node.push_back(_node[dom.nodeIdx[j]]);
+            analysisModel().dofManager().createCellDofsAt(curCell);
+            if ( _fieldsPerCell > 0 )
+                curCell->cellData.init(_fieldsPerCell);
+            
+            _domCell[i] = curCell;
+        }
+    }
+    
+    // Boundary cells
+    _bndCell.assign(nBndCells, nullptr);
+    for ( int i = 0; i < nBndCells; i++ )
+    {
+        Cell* curCell = new Cell();
+        curCell->_elType = bnd.elType[i];
+        curCell->_label = bnd.label[i];
+        curCell->_dim = bnd.dim[i];
+        curCell->_id = i;
+        curCell->_partition = bnd.partition[i];
+        curCell->_isPartOfDomain = false;
+        curCell->_halo.assign(bnd.halo.begin() + bnd.haloPtr[i], bnd.halo.begin() + bnd.haloPtr[i + 1]);
+        
+        for ( int j = bnd.nodePtr[i]; j < bnd.nodePtr[i + 1]; j++ )
+            curCell->_node.push_back(_node[bnd.nodeIdx[j]]);
+        for ( int j = assocPtr[i]; j < assocPtr[i + 1]; j++ )
+            curCell->_assocDomCell.push_back(_domCell[assocIdx[j]]);
+        
+        _bndCell[i] = curCell;
+    }
+    
+    // Faces
+    _face.assign(nFaces, nullptr);
+    for ( int i = 0; i < nFaces; i++ )
+    {
+        Cell* newFace = new Cell();
+        newFace->_id = i;
+        for ( int j = faceNodePtr[i]; j < faceNodePtr[i + 1]; j++ )
+            newFace->_node.push_back(_node[faceNodeIdx[j]]);
+        
+        int posCell = faceCellIdx[2*i];
+        int negCell = faceCellIdx[2*i + 1];
+        newFace->_neighbor.assign({posCell >= 0 ? _domCell[posCell] : nullptr, negCell >= 0 ? _domCell[negCell] : nullptr});
+        newFace->cellData.init(_fieldsPerFace);
+        
+        _face[i] = newFace;
+    }
+    
+    // Neighbors and faces of domain cells
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < nDomCells; i++ )
+    {
+        Cell* curCell = _domCell[i];
+        for ( int j = neighborPtr[i]; j < neighborPtr[i + 1]; j++ )
+            curCell->_neighbor.push_back(neighborIdx[j] >= 0 ? _domCell[neighborIdx[j]] : nullptr);
+        
+        if ( nFaces > 0 )
+            for ( int j = neighborPtr[i]; j < neighborPtr[i + 1]; j++ )
+            {
+                curCell->_face.push_back(_face[cellFaceIdx[j]]);
+                curCell->_faceOrient.push_back(cellFaceOrient[j]);
+            }
+    }
+    
+    // Node-to-cell adjacency
+    _nodeCellPtr.assign(nodeCellPtr.begin(), nodeCellPtr.end());
+    _nodeCell.assign(nodeCellIdx.size(), nullptr);
+    for ( int i = 0; i < nodeCellIdx.size(); i++ )
+        _nodeCell[i] = _domCell[nodeCellIdx[i]];
+    
+    _nodeList.assign(_node.begin(), _node.end());
+    _domCellList.assign(_domCell.begin(), _domCell.end());
+    _bndCellList.assign(_bndCell.begin(), _bndCell.end());
+    _faceList.assign(_face.begin(), _face.end());
+    this->formDomainPartitions();
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+    std::printf("    %s\n", _meshCacheFile.c_str());
+    this->reportStatus();
+    if ( _constructFaces )
+        std::printf("\n    Domain cell faces = %d\n", nFaces);
+    std::printf("\n");
+    
+    return true;
+}
+// ----------------------------------------------------------------------------
 void DomainManager::readDomainAssignmentsFrom( FILE* fp )
 {
     std::string key, src = "DomainManager";
@@ -208,6 +625,283 @@ void DomainManager::readDomainAssignmentsFrom( FILE* fp )
     }
 }
 // ----------------------------------------------------------------------------
+void DomainManager::readMeshCacheFrom( FILE* fp )
+{
+    _meshCacheDir = getStringInputFrom(fp, "Failed to read mesh cache directory from input file!", "DomainManager");
+}
+// ----------------------------------------------------------------------------
+void DomainManager::readMeshReorderingFrom( FILE* fp )
+{
+    std::string key, src = "DomainManager";
+    
+    verifyKeyword(fp, key = "Nodes", src);
+    _nodeOrdering = getStringInputFrom(fp, "Failed to read node ordering method from input file!", src);
+    verifyKeyword(fp, key = "Cells", src);
+    _cellOrdering = getStringInputFrom(fp, "Failed to read cell ordering method from input file!", src);
+    
+    for ( const std::string& method : {_nodeOrdering, _cellOrdering} )
+        if ( method != "None" && method != "RCM" && method != "Hilbert" && method != "Morton" )
+            throw std::runtime_error("Unrecognized mesh reordering method '" + method + "' encountered in input file!\nSource: " + src);
+}
+// ----------------------------------------------------------------------------
+void DomainManager::reorderMeshEntities()
+{
+    // Note: this method must be called after the mesh has been read and
+    // before neighbors, faces and DOF equation numbers are set up, since the
+    // latter follow the order of '_node' and '_domCell'.
+    
+    if ( _nodeOrdering == "None" && _cellOrdering == "None" )
+        return;
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    std::printf("\n  %-40s", "Reordering nodes and cells ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+    
+    std::vector<int> nodeAdjPtr, nodeAdjIdx, cellAdjPtr, cellAdjIdx;
+    this->formNodeGraph(nodeAdjPtr, nodeAdjIdx);
+    this->formCellGraph(cellAdjPtr, cellAdjIdx);
+    
+    int nodeBandwidth[2], cellBandwidth[2];
+    long nodeEnvelope[2];
+    double nodeSpan[2];
+    
+    nodeBandwidth[0] = giveBandwidthOf(nodeAdjPtr, nodeAdjIdx);
+    nodeEnvelope[0] = giveEnvelopeSizeOf(nodeAdjPtr, nodeAdjIdx);
+    cellBandwidth[0] = giveBandwidthOf(cellAdjPtr, cellAdjIdx);
+    nodeSpan[0] = this->giveMeanNodeSpanOfCells();
+    
+    // Reorder nodes
+    if ( _nodeOrdering != "None" )
+    {
+        std::vector<RealVector> coor(_node.size());
+        for ( int i = 0; i < (int)_node.size(); i++ )
+            coor[i] = _node[i]->_coordinates;
+        
+        std::vector<int> perm = this->giveOrdering(_nodeOrdering, nodeAdjPtr, nodeAdjIdx, coor);
+        std::vector<Node*> reorderedNode(_node.size(), nullptr);
+        for ( int i = 0; i < (int)perm.size(); i++ )
+        {
+            reorderedNode[i] = _node[perm[i]];
+            reorderedNode[i]->_id = i;
+        }
+        _node = reorderedNode;
+    }
+    
+    // Reorder domain cells
+    if ( _cellOrdering != "None" )
+    {
+        std::vector<RealVector> centroid(_domCell.size());
+        for ( int i = 0; i < (int)_domCell.size(); i++ )
+        {
+            std::vector<Node*>& cellNode = _domCell[i]->_node;
+            centroid[i].init(3);
+            for ( Node* curNode : cellNode )
+                centroid[i] += curNode->_coordinates;
+            centroid[i] *= 1.0/(double)cellNode.size();
+        }
+        
+        std::vector<int> perm = this->giveOrdering(_cellOrdering, cellAdjPtr, cellAdjIdx, centroid);
+        std::vector<Cell*> reorderedCell(_domCell.size(), nullptr);
+        for ( int i = 0; i < (int)perm.size(); i++ )
+        {
+            reorderedCell[i] = _domCell[perm[i]];
+            reorderedCell[i]->_id = i;
+        }
+        _domCell = reorderedCell;
+        
+        // Partition cell lists follow the new cell order
+        this->formDomainPartitions();
+    }
+    
+    this->formNodeToCellAdjacency();
+    this->formNodeGraph(nodeAdjPtr, nodeAdjIdx);
+    this->formCellGraph(cellAdjPtr, cellAdjIdx);
+    nodeBandwidth[1] = giveBandwidthOf(nodeAdjPtr, nodeAdjIdx);
+    nodeEnvelope[1] = giveEnvelopeSizeOf(nodeAdjPtr, nodeAdjIdx);
+    cellBandwidth[1] = giveBandwidthOf(cellAdjPtr, cellAdjIdx);
+    nodeSpan[1] = this->giveMeanNodeSpanOfCells();
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+    
+    std::printf("\n    Node ordering = %s, cell ordering = %s\n", _nodeOrdering.c_str(), _cellOrdering.c_str());
+    std::printf("    %-28s %14s %14s\n", "", "before", "after");
+    std::printf("    %-28s %14d %14d\n", "Node graph bandwidth", nodeBandwidth[0], nodeBandwidth[1]);
+    std::printf("    %-28s %14ld %14ld\n", "Node graph envelope", nodeEnvelope[0], nodeEnvelope[1]);
+    std::printf("    %-28s %14d %14d\n", "Cell graph bandwidth", cellBandwidth[0], cellBandwidth[1]);
+    std::printf("    %-28s %14.1f %14.1f\n", "Mean node index span/cell", nodeSpan[0], nodeSpan[1]);
+}
+// ----------------------------------------------------------------------------
+void DomainManager::writeMeshCacheFor( const std::string& meshFilename )
+{
+    // Note: this method must be called once all topology discovery is
+    // complete, i.e. after boundary associations have been found.
+    
+    if ( _meshCacheDir.empty() )
+        return;
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    std::printf("  %-40s", "Writing mesh cache ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+    
+    if ( _meshCacheFile.empty() )
+        this->resolveMeshCacheFor(meshFilename);
+    
+    // Pack data into arrays
+    std::vector<std::int32_t> entDim, entNum, entNamePtr(1, 0);
+    std::vector<char> entName;
+    for ( const PhysicalEntity& curEnt : _physEnt )
+    {
+        entDim.push_back(curEnt.dimension);
+        entNum.push_back(curEnt.entityNumber);
+        entName.insert(entName.end(), curEnt.name.begin(), curEnt.name.end());
+        entNamePtr.push_back(entName.size());
+    }
+    
+    std::vector<double> nodeCoor(3*_node.size(), 0.);
+    for ( int i = 0; i < (int)_node.size(); i++ )
+        for ( int j = 0; j < _node[i]->_coordinates.dim() && j < 3; j++ )
+            nodeCoor[3*i + j] = _node[i]->_coordinates(j);
+    
+    auto packCells = []( const std::vector<Cell*>& cell )
+    {
+        CellArrays ca;
+        ca.nodePtr.push_back(0);
+        ca.haloPtr.push_back(0);
+        for ( Cell* curCell : cell )
+        {
+            ca.elType.push_back(curCell->_elType);
+            ca.label.push_back(curCell->_label);
+            ca.dim.push_back(curCell->_dim);
+            ca.partition.push_back(curCell->_partition);
+            for ( Node* curNode : curCell->_node )
+                ca.nodeIdx.push_back(curNode->_id);
+            ca.nodePtr.push_back(ca.nodeIdx.size());
+            ca.halo.insert(ca.halo.end(), curCell->_halo.begin(), curCell->_halo.end());
+            ca.haloPtr.push_back(ca.halo.size());
+        }
+        return ca;
+    };
+    
+    CellArrays dom = packCells(_domCell);
+    CellArrays bnd = packCells(_bndCell);
+    
+    std::vector<std::int32_t> neighborPtr(1, 0), neighborIdx, cellFaceIdx, cellFaceOrient;
+    for ( Cell* curCell : _domCell )
+    {
+        for ( Cell* curNeighbor : curCell->_neighbor )
+            neighborIdx.push_back(curNeighbor ? curNeighbor->_id : -1);
+        neighborPtr.push_back(neighborIdx.size());
+        
+        if ( !_face.empty() )
+            for ( int j = 0; j < (int)curCell->_face.size(); j++ )
+            {
+                cellFaceIdx.push_back(curCell->_face[j]->_id);
+                cellFaceOrient.push_back(curCell->_faceOrient[j]);
+            }
+    }
+    
+    std::vector<std::int32_t> assocPtr(1, 0), assocIdx;
+    for ( Cell* curCell : _bndCell )
+    {
+        for ( Cell* curAssoc : curCell->_assocDomCell )
+            assocIdx.push_back(curAssoc->_id);
+        assocPtr.push_back(assocIdx.size());
+    }
+    
+    std::vector<std::int32_t> faceNodePtr(1, 0), faceNodeIdx, faceCellIdx;
+    for ( Cell* curFace : _face )
+    {
+        for ( Node* curNode : curFace->_node )
+            faceNodeIdx.push_back(curNode->_id);
+        faceNodePtr.push_back(faceNodeIdx.size());
+        for ( int j = 0; j < 2; j++ )
+            faceCellIdx.push_back(curFace->_neighbor[j] ? curFace->_neighbor[j]->_id : -1);
+    }
+    
+    std::vector<std::int32_t> nodeCellPtr(_nodeCellPtr.begin(), _nodeCellPtr.end()), nodeCellIdx;
+    for ( Cell* curCell : _nodeCell )
+        nodeCellIdx.push_back(curCell->_id);
+    
+    // Write to a temporary file first so that concurrent runs never map a
+    // partially written cache
+    std::string tmpFilename = _meshCacheFile + ".tmp" + std::to_string(getpid());
+    std::error_code ec;
+    std::filesystem::create_directories(_meshCacheDir, ec);
+    
+    FILE* fp = std::fopen(tmpFilename.c_str(), "wb");
+    if ( !fp )
+    {
+        std::printf("failed (cannot open '%s')\n", tmpFilename.c_str());
+        return;
+    }
+    
+    MeshCacheHeader header;
+    std::memcpy(header.magic, meshCacheMagic, sizeof(meshCacheMagic));
+    header.version = meshCacheVersion;
+    header.headerSize = sizeof(header);
+    header.key = _meshCacheKey;
+    bool success = std::fwrite(&header, sizeof(header), 1, fp) == 1;
+    
+    MeshCacheWriter writer(fp);
+    writer.write(entDim);
+    writer.write(entNum);
+    writer.write(entNamePtr);
+    writer.write(entName);
+    writer.write(nodeCoor);
+    for ( CellArrays* ca : {&dom, &bnd} )
+    {
+        writer.write(ca->elType);
+        writer.write(ca->label);
+        writer.write(ca->dim);
+        writer.write(ca->partition);
+        writer.write(ca->nodePtr);
+        writer.write(ca->nodeIdx);
+        writer.write(ca->haloPtr);
+        writer.write(ca->halo);
+        
+        if ( ca == &dom )
+        {
+            writer.write(neighborPtr);
+            writer.write(neighborIdx);
+        }
+        else
+        {
+            writer.write(assocPtr);
+            writer.write(assocIdx);
+        }
+    }
+    writer.write(faceNodePtr);
+    writer.write(faceNodeIdx);
+    writer.write(faceCellIdx);
+    writer.write(cellFaceIdx);
+    writer.write(cellFaceOrient);
+    writer.write(nodeCellPtr);
+    writer.write(nodeCellIdx);
+    
+    success = std::fclose(fp) == 0 && success && writer.ok();
+    if ( success )
+        std::filesystem::rename(tmpFilename, _meshCacheFile, ec);
+    if ( !success || ec )
+    {
+        std::filesystem::remove(tmpFilename, ec);
+        std::printf("failed (cannot write '%s')\n", _meshCacheFile.c_str());
+        return;
+    }
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+    std::printf("    %s\n\n", _meshCacheFile.c_str());
+}
+// ----------------------------------------------------------------------------
 void DomainManager::countNodes()
 {
     // Determine number of active nodes
@@ -225,9 +919,10 @@ void DomainManager::countNodes()
                 _node[curCount++] = *curNode;
 }
 // ----------------------------------------------------------------------------
-std::set<Cell*> DomainManager::giveAttachedDomainCellsOf( Node* node )
+ArraySpan<Cell* const> DomainManager::giveAttachedDomainCellsOf( Node* node )
 {
-    return node->_attachedDomCell;
+    int first = _nodeCellPtr[node->_id];
+    return ArraySpan<Cell* const>(_nodeCell.data() + first, _nodeCellPtr[node->_id + 1] - first);
 }
 // ----------------------------------------------------------------------------
 RealVector DomainManager::giveCoordinatesOf( Node* node )
@@ -240,6 +935,11 @@ Dof* DomainManager::giveNodalDof( int dofNum, Node* node )
     return node->_dof[ dofNum ];
 }
 // ----------------------------------------------------------------------------
+std::vector<Dof*> DomainManager::giveNodalDofsOf( Node* node )
+{
+    return node->_dof;
+}
+// ----------------------------------------------------------------------------
 double DomainManager::giveFieldValueAt( Node* node, int fieldNum )
 {
     if ( fieldNum == 0 )
@@ -333,6 +1033,11 @@ void DomainManager::mustConstructFaces()
     _constructFaces = true;
 }
 // ----------------------------------------------------------------------------
+void DomainManager::mustFormFaceGeometry()
+{
+    _formFaceGeometry = true;
+}
+// ----------------------------------------------------------------------------
 void DomainManager::setCoordinatesOf( Node* targetNode, const RealVector& coor )
 {
 #ifdef _OPENMP
@@ -507,42 +1212,28 @@ void DomainManager::findDomainCellsAssociatedWith( Cell *targetCell )
     if ( targetCell->_isPartOfDomain )
         throw std::runtime_error("ERROR: Search request made for associated domain cell of a cell\nthat is already part of the domain!\nSource: DomainManager");
     
-    // Form set of all elements attached to all the nodes of the
-    // current boundary element
-    std::set<Cell*> candCell;
+    // An associated domain cell contains all the nodes of the boundary
+    // cell, so it suffices to examine the cells attached to its first node
     int nNodes = targetCell->_node.size();
     
-    for ( int i = 0; i < nNodes; i++ )
+    for ( Cell* candCell : this->giveAttachedDomainCellsOf(targetCell->_node[0]) )
     {
-        std::set<Cell*> temp = targetCell->_node[i]->_attachedDomCell;
+        std::vector<Node*>& ccNode = candCell->_node;
         
-        std::set<Cell*>::iterator it;
-        for ( it = temp.begin(); it != temp.end(); it++ )
-            candCell.insert(*it);
-    }
-    
-    std::vector<bool> hasNode;
-    std::set<Cell*>::iterator it;
-    it = candCell.begin();
-    
-    for ( it = candCell.begin(); it != candCell.end(); ++it )
-    {
-        std::vector<Node*> ccNode = (*it)->_node;
-        
-        hasNode.assign(nNodes, false);
         bool found = true;
-        for ( int i = 0; i < nNodes; i++ )
+        for ( int i = 1; i < nNodes && found; i++ )
         {
+            bool hasNode = false;
             for ( int j = 0; j < (int)ccNode.size(); j++ )
                 if ( targetCell->_node[i] == ccNode[j] )
-                    hasNode[i] = true;
+                    hasNode = true;
             
-            if ( hasNode[i] == false )
+            if ( !hasNode )
                 found = false;
         }
         
         if (found)
-            targetCell->_assocDomCell.push_back(*it);
+            targetCell->_assocDomCell.push_back(candCell);
     }
 
     if ( targetCell->_assocDomCell.size() == 0 )
@@ -557,10 +1248,10 @@ void DomainManager::findNeighborsOf( Cell* targetCell )
     for ( int j = 0; j < nFaces; j++ )
     {
         std::vector<int> faceNodes = analysisModel().meshReader().giveFaceNodeNumbersForElementType(targetCell->_elType, j);
-        std::set<Cell*> candidate = analysisModel().domainManager().giveAttachedDomainCellsOf(targetCell->_node[faceNodes[0]]);
+        ArraySpan<Cell* const> candidate = this->giveAttachedDomainCellsOf(targetCell->_node[faceNodes[0]]);
         for ( auto it = candidate.begin(); it != candidate.end(); ++it )
         {
-            std::vector<Node*> adjNode = analysisModel().domainManager().giveNodesOf(*it);
+            std::vector<Node*>& adjNode = (*it)->_node;
 
             bool isNeighbor = true;
             for ( int k = 1; k < (int)faceNodes.size(); k++ )
@@ -609,26 +1300,221 @@ void DomainManager::formDomainPartitions()
     }
 }
 // ----------------------------------------------------------------------------
+void DomainManager::formFaceGeometry()
+{
+    // Measures, normals and center-to-midpoint distances of all domain cell
+    // faces are evaluated once here, so that finite volume numerics need not
+    // rederive them from nodal coordinates during every assembly. Requires
+    // cell neighbors to be known, and must be repeated if nodes move.
+    
+    if ( !_formFaceGeometry )
+        return;
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+
+    std::printf("  %-40s", "Forming face geometry ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+    
+    int nCells = _domCell.size();
+    FaceGeometry& fg = _faceGeom;
+    
+    fg.cellFacePtr.assign(nCells + 1, 0);
+    for ( int i = 0; i < nCells; i++ )
+        fg.cellFacePtr[i + 1] = fg.cellFacePtr[i] + _domCell[i]->_neighbor.size();
+    
+    int nFaces = fg.cellFacePtr[nCells];
+    fg.cellCenter.assign(2*nCells, 0.);
+    fg.measure.assign(nFaces, 0.);
+    fg.normal.assign(2*nFaces, 0.);
+    fg.ownerDistance.assign(nFaces, 0.);
+    fg.neighborDistance.assign(nFaces, 0.);
+    fg.transFactor.assign(nFaces, 0.);
+    
+    // Cell centers, taken as the mean of the first nodes of all faces (i.e.
+    // the corner nodes for triangles and quadrilaterals)
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int i = 0; i < nCells; i++ )
+    {
+        Cell* curCell = _domCell[i];
+        int nCellFaces = fg.cellFacePtr[i + 1] - fg.cellFacePtr[i];
+        
+        double x = 0., y = 0.;
+        for ( int j = 0; j < nCellFaces; j++ )
+        {
+            std::vector<int> faceNodes = analysisModel().meshReader().giveFaceNodeNumbersForElementType(curCell->_elType, j);
+            const RealVector& coor = curCell->_node[faceNodes[0]]->_coordinates;
+            x += coor(0);
+            y += coor(1);
+        }
+        fg.cellCenter[2*i] = x/nCellFaces;
+        fg.cellCenter[2*i + 1] = y/nCellFaces;
+    }
+    
+    // Face quantities
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int i = 0; i < nCells; i++ )
+    {
+        Cell* curCell = _domCell[i];
+        for ( int k = fg.cellFacePtr[i]; k < fg.cellFacePtr[i + 1]; k++ )
+        {
+            int j = k - fg.cellFacePtr[i];
+            std::vector<int> faceNodes = analysisModel().meshReader().giveFaceNodeNumbersForElementType(curCell->_elType, j);
+            
+            // End nodes of face (intermediate nodes of quadratic faces lie
+            // between them)
+            const RealVector& coor0 = curCell->_node[faceNodes.front()]->_coordinates;
+            const RealVector& coor1 = curCell->_node[faceNodes.back()]->_coordinates;
+            
+            double dx = coor1(0) - coor0(0);
+            double dy = coor1(1) - coor0(1);
+            double length = std::sqrt(dx*dx + dy*dy);
+            double xm = 0.5*(coor0(0) + coor1(0));
+            double ym = 0.5*(coor0(1) + coor1(1));
+            
+            fg.measure[k] = length;
+            fg.normal[2*k] = dy/length;
+            fg.normal[2*k + 1] = -dx/length;
+            
+            double ox = xm - fg.cellCenter[2*i];
+            double oy = ym - fg.cellCenter[2*i + 1];
+            fg.ownerDistance[k] = std::sqrt(ox*ox + oy*oy);
+            
+            Cell* neighbor = curCell->_neighbor[j];
+            if ( neighbor )
+            {
+                int n = neighbor->_id;
+                double nx = xm - fg.cellCenter[2*n];
+                double ny = ym - fg.cellCenter[2*n + 1];
+                fg.neighborDistance[k] = std::sqrt(nx*nx + ny*ny);
+            }
+            
+            fg.transFactor[k] = length/(fg.ownerDistance[k] + fg.neighborDistance[k]);
+        }
+    }
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+}
+// ----------------------------------------------------------------------------
+void DomainManager::formNodeToCellAdjacency()
+{
+    // Domain cells attached to each node are stored contiguously, in
+    // ascending order of cell ID. Must be rebuilt whenever nodes or domain
+    // cells are renumbered or recreated.
+    
+    int nNodes = _node.size();
+    int nCells = _domCell.size();
+    
+    _nodeCellPtr.assign(nNodes + 1, 0);
+    for ( int i = 0; i < nCells; i++ )
+        for ( Node* curNode : _domCell[i]->_node )
+            _nodeCellPtr[curNode->_id + 1] += 1;
+    
+    for ( int i = 0; i < nNodes; i++ )
+        _nodeCellPtr[i + 1] += _nodeCellPtr[i];
+    
+    std::vector<int> pos(_nodeCellPtr.begin(), _nodeCellPtr.end() - 1);
+    _nodeCell.assign(_nodeCellPtr[nNodes], nullptr);
+    for ( int i = 0; i < nCells; i++ )
+        for ( Node* curNode : _domCell[i]->_node )
+            _nodeCell[pos[curNode->_id]++] = _domCell[i];
+}
+// ----------------------------------------------------------------------------
+void DomainManager::formPhysicalEntityCellLists()
+{
+    // Cells of each physical entity are stored contiguously, in ascending
+    // order of cell ID, so that boundary and field conditions need not sweep
+    // over all cells of the mesh. Must be called once cell objects are final.
+    
+    _bndCellsWithLabel.clear();
+    for ( Cell* curCell : _bndCell )
+        _bndCellsWithLabel[curCell->_label].push_back(curCell);
+    
+    _domCellsWithLabel.clear();
+    for ( Cell* curCell : _domCell )
+        _domCellsWithLabel[curCell->_label].push_back(curCell);
+}
+// ----------------------------------------------------------------------------
 Cell* DomainManager::giveBoundaryCell( int cellNum )
 {
     return _bndCell[ cellNum ];
 }
 // ----------------------------------------------------------------------------
+ArraySpan<Cell* const> DomainManager::giveBoundaryCellsWithLabel( int label )
+{
+    auto it = _bndCellsWithLabel.find(label);
+    if ( it == _bndCellsWithLabel.end() )
+        return ArraySpan<Cell* const>();
+    
+    return ArraySpan<Cell* const>(it->second.data(), (int)it->second.size());
+}
+// ----------------------------------------------------------------------------
 Dof* DomainManager::giveCellDof( int dofNum, Cell *targetCell )
 {
     return targetCell->_dof[ dofNum ];
 }
 // ----------------------------------------------------------------------------
+std::vector<Dof*> DomainManager::giveCellDofsOf( Cell *targetCell )
+{
+    return targetCell->_dof;
+}
+// ----------------------------------------------------------------------------
 Cell* DomainManager::giveDomainCell( int cellNum )
 {
     return _domCell[ cellNum ];
 }
 // ----------------------------------------------------------------------------
+ArraySpan<Cell* const> DomainManager::giveDomainCellsWithLabel( int label )
+{
+    auto it = _domCellsWithLabel.find(label);
+    if ( it == _domCellsWithLabel.end() )
+        return ArraySpan<Cell* const>();
+    
+    return ArraySpan<Cell* const>(it->second.data(), (int)it->second.size());
+}
+// ----------------------------------------------------------------------------
 Cell* DomainManager::giveDomainCellInPartition( int partNum, int cellNum )
 {
     return _partition[partNum][cellNum];
 }
 // ----------------------------------------------------------------------------
+std::vector<Cell*> DomainManager::giveDomainCellsAndHaloOfPartition( int partNum )
+{
+    // Cells of the partition, followed by cells of other partitions that
+    // belong to its halo
+    std::vector<Cell*> partCell;
+    if ( partNum < (int)_partition.size() )
+        partCell = _partition[partNum];
+    
+    for ( Cell* curCell : _domCell )
+        if ( curCell->_partition != partNum )
+            for ( int haloPart : curCell->_halo )
+                if ( haloPart == partNum )
+                {
+                    partCell.push_back(curCell);
+                    break;
+                }
+    
+    return partCell;
+}
+// ----------------------------------------------------------------------------
+std::vector<Cell*> DomainManager::giveDomainCellsOrderedByPartition()
+{
+    std::vector<Cell*> partCell;
+    partCell.reserve(_domCell.size());
+    for ( const std::vector<Cell*>& curPartition : _partition )
+        partCell.insert(partCell.end(), curPartition.begin(), curPartition.end());
+    
+    return partCell;
+}
+// ----------------------------------------------------------------------------
 std::vector<Cell*> DomainManager::giveDomainCellsAssociatedWith( Cell *targetCell )
 {
     return targetCell->_assocDomCell;
@@ -639,6 +1525,21 @@ int DomainManager::giveElementTypeOf( Cell* targetCell )
     return targetCell->_elType;
 }
 // ----------------------------------------------------------------------------
+const DomainManager::FaceGeometry& DomainManager::giveFaceGeometry()
+{
+    return _faceGeom;
+}
+// ----------------------------------------------------------------------------
+int DomainManager::giveFaceGeometryIndexOf( Cell* targetCell, int faceNum )
+{
+    return _faceGeom.cellFacePtr[targetCell->_id] + faceNum;
+}
+// ----------------------------------------------------------------------------
+std::vector<int> DomainManager::giveHaloOf( Cell *targetCell )
+{
+    return targetCell->_halo;
+}
+// ----------------------------------------------------------------------------
 int DomainManager::giveIdOf( Cell *targetCell )
 {
     return targetCell->_id;
@@ -649,6 +1550,16 @@ int DomainManager::giveLabelOf( Cell *targetCell )
     return targetCell->_label;
 }
 // ----------------------------------------------------------------------------
+std::vector<int> DomainManager::giveLabelsOfDomainCells()
+{
+    std::vector<int> label;
+    label.reserve(_domCellsWithLabel.size());
+    for ( auto it = _domCellsWithLabel.begin(); it != _domCellsWithLabel.end(); ++it )
+        label.push_back(it->first);
+    
+    return label;
+}
+// ----------------------------------------------------------------------------
 std::vector<Cell*> DomainManager::giveNeighborsOf(Cell *targetCell )
 {
     return targetCell->_neighbor;
@@ -684,6 +1595,11 @@ int DomainManager::giveNumberOfPartitions()
     return _partition.size();
 }
 // ----------------------------------------------------------------------------
+int DomainManager::givePartitionOf( Cell *targetCell )
+{
+    return targetCell->_partition;
+}
+// ----------------------------------------------------------------------------
 Numerics* DomainManager::giveNumericsFor(Cell* targetCell)
 {
     if ( targetCell->_isPartOfDomain )
@@ -702,7 +1618,7 @@ void DomainManager::initializeMaterialsAtCells()
     tic = std::chrono::high_resolution_clock::now();
 
 #ifdef _OPENMP    
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)_domCell.size(); i++)
     {
@@ -725,7 +1641,7 @@ void DomainManager::initializeNumericsAtCells()
     tic = std::chrono::high_resolution_clock::now();
     
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)_domCell.size(); i++)
     {
@@ -805,6 +1721,123 @@ void DomainManager::makeNewFaceBetween( Cell* posCell, Cell* negCell, int posFac
     newFace->cellData.init(_fieldsPerFace);
 }
 // ----------------------------------------------------------------------------
+void DomainManager::placeMeshDataForThreads()
+{
+    // Nodes and domain cells are created serially by the mesh reader, so on
+    // NUMA machines all of their memory resides near the master thread.
+    // Here every node and domain cell (together with its DOFs) is recreated
+    // by the thread that owns it under the static schedule used in the
+    // assembly loops, so that first touch places the data on the right
+    // socket. Must be called before neighbors, faces, cell numerics and DOF
+    // numbering are set up.
+    
+#ifdef _OPENMP
+    if ( omp_get_max_threads() < 2 )
+        return;
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    std::printf("\n  %-40s", "Placing mesh data for threads ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+    
+    int nNodes = _node.size();
+    int nCells = _domCell.size();
+    for ( int i = 0; i < nCells; i++ )
+        if ( !_domCell[i]->_neighbor.empty() || !_domCell[i]->_face.empty() || _domCell[i]->numericsStatus )
+            throw std::runtime_error("Mesh data can only be placed before cell neighbors, faces and numerics are set up!\nSource: DomainManager");
+    
+    // Cells are relinked to the new nodes by node ID, so every node referred
+    // to by a cell must be found at its ID in the node array
+    for ( int i = 0; i < nNodes; i++ )
+        if ( _node[i]->_id != i )
+            throw std::runtime_error("Node numbering must be contiguous before mesh data is placed!\nSource: DomainManager");
+    
+    for ( const std::vector<Cell*>* cellArray : { &_domCell, &_bndCell } )
+        for ( Cell* curCell : *cellArray )
+            for ( Node* curNode : curCell->_node )
+                if ( curNode->_id < 0 || curNode->_id >= nNodes || _node[curNode->_id] != curNode )
+                    throw std::runtime_error("Cell refers to a node outside the node array!\nSource: DomainManager");
+    
+    std::vector<Node*> newNode(nNodes, nullptr);
+    std::vector<Cell*> newCell(nCells, nullptr);
+    
+    auto relocatedNode = [ &newNode ]( Node* oldNode ) { return newNode[oldNode->_id]; };
+    
+#pragma omp parallel
+    {
+#pragma omp for schedule(static)
+        for ( int i = 0; i < nNodes; i++ )
+        {
+            Node* oldNode = _node[i];
+            Node* curNode = new Node();
+            
+            curNode->_id = oldNode->_id;
+            curNode->_coordinates = oldNode->_coordinates;
+            if ( oldNode->_fieldVal.dim() > 0 )
+                curNode->_fieldVal = oldNode->_fieldVal;
+            curNode->_isActive = oldNode->_isActive;
+            analysisModel().dofManager().createNodalDofsAt(curNode);
+            
+            newNode[i] = curNode;
+        }
+        
+#pragma omp for schedule(static)
+        for ( int i = 0; i < nCells; i++ )
+        {
+            Cell* oldCell = _domCell[i];
+            Cell* curCell = new Cell();
+            curCell->_elType = oldCell->_elType;
+            curCell->_label = oldCell->_label;
+            curCell->_dim = oldCell->_dim;
+            curCell->_id = oldCell->_id;
+            curCell->_partition = oldCell->_partition;
+            curCell->_isPartOfDomain = oldCell->_isPartOfDomain;
+            curCell->_halo = oldCell->_halo;
+            if ( oldCell->cellData.dim() > 0 )
+                curCell->cellData = oldCell->cellData;
+            
+            curCell->_node.assign(oldCell->_node.size(), nullptr);
+            for ( int j = 0; j < (int)oldCell->_node.size(); j++ )
+                curCell->_node[j] = relocatedNode(oldCell->_node[j]);
+            analysisModel().dofManager().createCellDofsAt(curCell);
+            
+            newCell[i] = curCell;
+        }
+    }
+    
+    // Boundary cells are not relocated but must refer to the new nodes
+    for ( Cell* curCell : _bndCell )
+        for ( int j = 0; j < (int)curCell->_node.size(); j++ )
+            curCell->_node[j] = relocatedNode(curCell->_node[j]);
+    
+    // Destroy old objects, including nodes of the node list that are not
+    // referred to by any cell, and update containers
+    for ( Node* oldNode : _nodeList )
+    {
+        analysisModel().dofManager().destroyNodalDofsAt(oldNode);
+        delete oldNode;
+    }
+    for ( int i = 0; i < nCells; i++ )
+    {
+        analysisModel().dofManager().destroyCellDofsAt(_domCell[i]);
+        delete _domCell[i];
+    }
+    
+    _node = newNode;
+    _nodeList.assign(_node.begin(), _node.end());
+    _domCell = newCell;
+    _domCellList.assign(_domCell.begin(), _domCell.end());
+    this->formDomainPartitions();
+    this->formNodeToCellAdjacency();
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+#endif
+}
+// ----------------------------------------------------------------------------
 void DomainManager::readNumberOfFieldsPerCellFrom( FILE* fp )
 {
     _fieldsPerCell = getIntegerInputFrom(fp, "\nFailed to read number of fields per cell in input file!", "DomainManager");
@@ -908,13 +1941,7 @@ void DomainManager::setNodesOf( Cell *targetCell, std::vector<int>& cellNodes )
     std::vector<Node*> node(cellNodes.size(), nullptr);
     
     for ( int i = 0; i < (int)cellNodes.size(); i++ ) 
-    {
         node[i] = _node[cellNodes[i]];
-        if ( targetCell->_isPartOfDomain )
-            node[i]->_attachedDomCell.insert(targetCell);
-        else
-            node[i]->_attachedBndCell.insert(targetCell);
-    }
     
     targetCell->_node = node;
 }
@@ -923,3 +1950,119 @@ void DomainManager::setPartitionOf( Cell* targetCell, int partition )
 {
     targetCell->_partition = partition;
 }
+
+// Private methods
+// ----------------------------------------------------------------------------
+void DomainManager::formCellGraph( std::vector<int>& adjPtr, std::vector<int>& adjIdx )
+{
+    // Domain cells are adjacent if they share at least one node
+    int nCells = _domCell.size();
+    adjPtr.assign(nCells + 1, 0);
+    adjIdx.clear();
+    
+    std::vector<int> nbr;
+    for ( int i = 0; i < nCells; i++ )
+    {
+        nbr.clear();
+        for ( Node* curNode : _domCell[i]->_node )
+            for ( Cell* curCell : this->giveAttachedDomainCellsOf(curNode) )
+                if ( curCell != _domCell[i] )
+                    nbr.push_back(curCell->_id);
+        
+        std::sort(nbr.begin(), nbr.end());
+        nbr.erase(std::unique(nbr.begin(), nbr.end()), nbr.end());
+        adjIdx.insert(adjIdx.end(), nbr.begin(), nbr.end());
+        adjPtr[i + 1] = adjIdx.size();
+    }
+}
+// ----------------------------------------------------------------------------
+void DomainManager::formNodeGraph( std::vector<int>& adjPtr, std::vector<int>& adjIdx )
+{
+    // Nodes are adjacent if they belong to a common domain cell
+    int nNodes = _node.size();
+    adjPtr.assign(nNodes + 1, 0);
+    adjIdx.clear();
+    
+    std::vector<int> nbr;
+    for ( int i = 0; i < nNodes; i++ )
+    {
+        nbr.clear();
+        for ( Cell* curCell : this->giveAttachedDomainCellsOf(_node[i]) )
+            for ( Node* curNode : curCell->_node )
+                if ( curNode != _node[i] )
+                    nbr.push_back(curNode->_id);
+        
+        std::sort(nbr.begin(), nbr.end());
+        nbr.erase(std::unique(nbr.begin(), nbr.end()), nbr.end());
+        adjIdx.insert(adjIdx.end(), nbr.begin(), nbr.end());
+        adjPtr[i + 1] = adjIdx.size();
+    }
+}
+// ----------------------------------------------------------------------------
+std::vector<int> DomainManager::giveOrdering( const std::string& method
+                                            , const std::vector<int>& adjPtr
+                                            , const std::vector<int>& adjIdx
+                                            , const std::vector<RealVector>& point )
+{
+    if ( method == "RCM" )
+        return reverseCuthillMcKeeOrdering(adjPtr, adjIdx);
+    else if ( method == "Hilbert" )
+        return hilbertCurveOrdering(point);
+    else if ( method == "Morton" )
+        return mortonCurveOrdering(point);
+    else
+        throw std::runtime_error("Unrecognized mesh reordering method '" + method + "'!\nSource: DomainManager");
+}
+// ----------------------------------------------------------------------------
+double DomainManager::giveMeanNodeSpanOfCells()
+{
+    if ( _domCell.empty() )
+        return 0.0;
+    
+    double span = 0.0;
+    for ( Cell* curCell : _domCell )
+    {
+        int minId = _node.size(), maxId = 0;
+        for ( Node* curNode : curCell->_node )
+        {
+            minId = std::min(minId, curNode->_id);
+            maxId = std::max(maxId, curNode->_id);
+        }
+        span += maxId - minId;
+    }
+    
+    return span/(double)_domCell.size();
+}
+// ----------------------------------------------------------------------------
+void DomainManager::resolveMeshCacheFor( const std::string& meshFilename )
+{
+    // The cache key covers the contents of the mesh file (or the mesh
+    // specification itself, for generated meshes) together with all input
+    // settings that affect the preprocessed topology. Must be called before
+    // the mesh is read, since boundary labels are added to '_numerics' once
+    // cells are created.
+    
+    MappedFile meshFile;
+    if ( meshFile.open(meshFilename) )
+        _meshCacheKey = giveHashOf(meshFile.data(), meshFile.size());
+    else
+        _meshCacheKey = giveHashOf(meshFilename.data(), meshFilename.size());
+    
+    std::string settings = std::to_string(meshCacheVersion) + "|" + _nodeOrdering + "|" + _cellOrdering 
+            + "|" + (_constructFaces ? "faces" : "nofaces");
+    
+    // Halo cells keep their owning partition only in distributed execution
+    // (see GmshReader)
+    if ( communicator().isDistributed() )
+        settings += "|distributed";
+    for ( auto& entry : _numerics )
+        if ( entry.second )
+            settings += "|" + entry.first;
+    _meshCacheKey = giveHashOf(settings.data(), settings.size(), _meshCacheKey);
+    
+    char keyStr[17];
+    std::snprintf(keyStr, sizeof(keyStr), "%016llx", (unsigned long long)_meshCacheKey);
+    
+    std::string stem = std::filesystem::path(meshFilename).stem().string();
+    _meshCacheFile = _meshCacheDir + "/" + stem + "_" + keyStr + ".bxmesh";
+}
@@ -24,13 +24,16 @@
 #ifndef DOMAINMANAGER_HPP
 #define	DOMAINMANAGER_HPP
 
+#include <cstdint>
 #include <cstdio>
 #include <map>
 #include <set>
 #include <vector>
 #include <list>
+#include <string>
 
 #include "TimeData.hpp"
+#include "Util/ArraySpan.hpp"
 #include "Util/RealVector.hpp"
 
 namespace broomstyx
@@ -57,21 +60,45 @@ namespace broomstyx
             std::string name;
         };
         
+        // Geometry of the faces of domain cells in planar meshes, stored in
+        // flat arrays with one entry per cell face. Faces of a cell are
+        // contiguous, in the local face numbering of its element type.
+        struct FaceGeometry
+        {
+            std::vector<int>    cellFacePtr;      // indexed by cell ID
+            std::vector<double> cellCenter;       // 2 per cell
+            std::vector<double> measure;
+            std::vector<double> normal;           // 2 per face, outward from cell
+            std::vector<double> ownerDistance;    // cell center to face midpoint
+            std::vector<double> neighborDistance; // zero at boundary faces
+            std::vector<double> transFactor;      // measure/(ownerDistance + neighborDistance)
+        };
+        
         void                   createPhysicalEntity( int dim, int number, std::string label );
         PhysicalEntity         giveDataForPhysicalEntity( int n );
         std::vector<Material*> giveMaterialSetForDomain( int label );
+        std::vector< std::vector<Material*> >
+                               giveMaterialSetsFor( Numerics* numerics );
         int                    giveNumberOfPhysicalNames();
         Numerics*              giveNumericsForDomain( int label );
         std::string            givePhysicalEntityNameFor( int physEntNum );
         int                    givePhysicalEntityNumberFor( std::string name );
+        bool                   loadMeshCacheFor( const std::string& meshFilename );
         void                   readDomainAssignmentsFrom( FILE* fp );
+        void                   readMeshCacheFrom( FILE* fp );
+        void                   readMeshReorderingFrom( FILE* fp );
+        void                   reorderMeshEntities();
+        void                   writeMeshCacheFor( const std::string& meshFilename );
         
         // Methods involving node access
         
         void   countNodes();
-        std::set<Cell*> giveAttachedDomainCellsOf( Node* node );
-        RealVector      giveCoordinatesOf( Node* node );
+        ArraySpan<Cell* const> 
+               giveAttachedDomainCellsOf( Node* node );
+        RealVector giveCoordinatesOf( Node* node );
         Dof*   giveNodalDof( int dofNum, Node* node );
+        std::vector<Dof*> 
+               giveNodalDofsOf( Node* node );
         double giveFieldValueAt( Node* node, int fieldNum );
         int    giveIdOf( Node* node );
         Node*  giveNode( int nodeNum );
@@ -94,15 +121,35 @@ namespace broomstyx
         void   findDomainCellsAssociatedWith( Cell* targetCell );
         void   findNeighborsOf( Cell *targetCell );
         void   formDomainPartitions();
+        void   formFaceGeometry();
+        void   formNodeToCellAdjacency();
+        void   formPhysicalEntityCellLists();
         Cell*  giveBoundaryCell( int cellNum );
+        ArraySpan<Cell* const> 
+               giveBoundaryCellsWithLabel( int label );
         Dof*   giveCellDof( int dofNum, Cell *targetCell );
+        std::vector<Dof*> 
+               giveCellDofsOf( Cell *targetCell );
         Cell*  giveDomainCell( int cellNum );
+        ArraySpan<Cell* const> 
+               giveDomainCellsWithLabel( int label );
         std::vector<Cell*> 
                giveDomainCellsAssociatedWith( Cell *targetCell );
         Cell*  giveDomainCellInPartition( int partNum, int cellNum );
+        std::vector<Cell*> 
+               giveDomainCellsAndHaloOfPartition( int partNum );
+        std::vector<Cell*> 
+               giveDomainCellsOrderedByPartition();
         int    giveElementTypeOf( Cell* targetCell );
+        const FaceGeometry& 
+               giveFaceGeometry();
+        int    giveFaceGeometryIndexOf( Cell* targetCell, int faceNum );
+        std::vector<int> 
+               giveHaloOf( Cell *targetCell );
         int    giveIdOf( Cell *targetCell );
         int    giveLabelOf( Cell *targetCell );
+        std::vector<int> 
+               giveLabelsOfDomainCells();
         
         std::vector<Cell*> giveNeighborsOf( Cell *targetCell );    
         std::vector<Node*> giveNodesOf( Cell *targetCell );
@@ -113,11 +160,14 @@ namespace broomstyx
         int   giveNumberOfNodesOf( Cell *targetCell );
         int   giveNumberOfPartitions();
         Numerics* giveNumericsFor( Cell* targetCell );
+        int   givePartitionOf( Cell *targetCell );
         void  initializeMaterialsAtCells();
         void  initializeNumericsAtCells();
         Cell* makeNewCellWithLabel( int cellLabel );
         void  makeNewFaceBetween( Cell* posCell, Cell* negCell, int posFaceNum );
         void  mustConstructFaces();
+        void  mustFormFaceGeometry();
+        void  placeMeshDataForThreads();
         void  readNumberOfFieldsPerCellFrom( FILE* fp );
         void  readNumberOfFieldsPerFaceFrom( FILE* fp );
         void  removeAllCellConstraints();
@@ -153,10 +203,41 @@ namespace broomstyx
         std::list<Cell*> _faceList;
         std::vector<Cell*> _face;
         
+        // Face geometry shared by finite volume numerics
+        bool _formFaceGeometry;
+        FaceGeometry _faceGeom;
+        
         std::vector<std::vector<Cell*> > _partition;
         
+        // Domain cells attached to each node in compressed row format, 
+        // indexed by node ID
+        std::vector<int>   _nodeCellPtr;
+        std::vector<Cell*> _nodeCell;
+        
+        // Boundary and domain cells grouped by physical entity number
+        std::map<int, std::vector<Cell*> > _bndCellsWithLabel;
+        std::map<int, std::vector<Cell*> > _domCellsWithLabel;
+        
+        // Reordering of nodes and domain cells for cache locality
+        std::string _nodeOrdering;
+        std::string _cellOrdering;
+        
+        // Binary cache of the preprocessed mesh topology
+        std::string   _meshCacheDir;
+        std::string   _meshCacheFile;
+        std::uint64_t _meshCacheKey;
+        
         DomainManager();
         virtual ~DomainManager();
+        
+        void formCellGraph( std::vector<int>& adjPtr, std::vector<int>& adjIdx );
+        void formNodeGraph( std::vector<int>& adjPtr, std::vector<int>& adjIdx );
+        std::vector<int> giveOrdering( const std::string& method
+                                     , const std::vector<int>& adjPtr
+                                     , const std::vector<int>& adjIdx
+                                     , const std::vector<RealVector>& point );
+        double giveMeanNodeSpanOfCells();
+        void   resolveMeshCacheFor( const std::string& meshFilename );
     };
 }
 
@@ -0,0 +1,200 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "ElementMatrixCache.hpp"
+#include <stdexcept>
+#include "Cell.hpp"
+#include "Diagnostics.hpp"
+#include "Numerics/Numerics.hpp"
+
+using namespace broomstyx;
+
+namespace
+{
+    const int unreservedSlot = -1;
+    const int noRevision = -1;
+}
+
+// Constructor
+ElementMatrixCache::ElementMatrixCache()
+    : _poolSize(0)
+    , _nHits(0)
+    , _nMisses(0)
+{}
+
+// Destructor
+ElementMatrixCache::~ElementMatrixCache() {}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void ElementMatrixCache::allocatePool()
+{
+    _rowDof = std::vector<Dof*, DefaultInitAllocator<Dof*> >();
+    _colDof = std::vector<Dof*, DefaultInitAllocator<Dof*> >();
+    _coefVal = std::vector<double, DefaultInitAllocator<double> >();
+    _rowDof.resize(_poolSize);
+    _colDof.resize(_poolSize);
+    _coefVal.resize(_poolSize);
+    
+    _revision.assign(_slotPtr.size(), noRevision);
+}
+// ----------------------------------------------------------------------------
+void ElementMatrixCache::giveCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                                  , Numerics*               numerics
+                                                  , int                     stage
+                                                  , int                     subsys
+                                                  , const TimeData&         time
+                                                  , CoefficientMatrixBatch& batch )
+{
+    // Cells of the span belong to a single domain using 'numerics'. Distinct
+    // cells may be processed concurrently.
+    int nCells = cell.size();
+    if ( nCells == 0 )
+        return;
+    
+    bool isTracked = numerics->tracksCoefficientMatrixChanges();
+    if ( !isTracked )
+    {
+        numerics->giveStaticCoefficientMatricesAt(cell, stage, subsys, time, batch);
+        
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        _nMisses += nCells;
+        
+        return;
+    }
+    
+    // Cells without a valid stored matrix
+    std::vector<Cell*> missCell;
+    for ( Cell* curCell : cell )
+    {
+        int id = curCell->id();
+        if ( id >= (int)_slotPtr.size() || _slotPtr[id] == unreservedSlot || _revision[id] != curCell->giveCoefficientMatrixRevision() )
+            missCell.push_back(curCell);
+    }
+    int nMisses = missCell.size();
+    
+    CoefficientMatrixBatch computed;
+    if ( nMisses > 0 )
+    {
+        numerics->giveStaticCoefficientMatricesAt(ArraySpan<Cell* const>(missCell.data(), nMisses), stage, subsys, time, computed);
+        
+        // Batched kernels skip cells outside their stage and subsystem
+        // altogether
+        if ( (int)computed.cellEnd.size() != nMisses )
+        {
+            if ( !computed.coefVal.empty() )
+                throw std::runtime_error("Coefficient matrices of batch are not delimited per cell!\nSource: ElementMatrixCache");
+            computed.cellEnd.assign(nMisses, 0);
+        }
+        
+        // Matrices are stored only if they fit the reserved slot
+        for ( int k = 0; k < nMisses; k++ )
+        {
+            int id = missCell[k]->id();
+            int first = k > 0 ? computed.cellEnd[k - 1] : 0;
+            int nEntries = computed.cellEnd[k] - first;
+            if ( id < (int)_slotPtr.size() && _slotPtr[id] != unreservedSlot && _slotSize[id] == nEntries )
+            {
+                int slot = _slotPtr[id];
+                for ( int j = 0; j < nEntries; j++ )
+                {
+                    _rowDof[slot + j] = computed.rowDof[first + j];
+                    _colDof[slot + j] = computed.colDof[first + j];
+                    _coefVal[slot + j] = computed.coefVal[first + j];
+                }
+                _revision[id] = missCell[k]->giveCoefficientMatrixRevision();
+            }
+        }
+    }
+    
+    // Matrices are appended in the order of the cells
+    int k = 0;
+    for ( Cell* curCell : cell )
+    {
+        int first, end;
+        Dof* const* rowDof;
+        Dof* const* colDof;
+        const double* coefVal;
+        
+        if ( k < nMisses && curCell == missCell[k] )
+        {
+            first = k > 0 ? computed.cellEnd[k - 1] : 0;
+            end = computed.cellEnd[k];
+            rowDof = computed.rowDof.data();
+            colDof = computed.colDof.data();
+            coefVal = computed.coefVal.data();
+            ++k;
+        }
+        else
+        {
+            int id = curCell->id();
+            first = _slotPtr[id];
+            end = first + _slotSize[id];
+            rowDof = _rowDof.data();
+            colDof = _colDof.data();
+            coefVal = _coefVal.data();
+        }
+        
+        batch.rowDof.insert(batch.rowDof.end(), rowDof + first, rowDof + end);
+        batch.colDof.insert(batch.colDof.end(), colDof + first, colDof + end);
+        batch.coefVal.insert(batch.coefVal.end(), coefVal + first, coefVal + end);
+        batch.cellEnd.push_back(batch.coefVal.size());
+    }
+    
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    _nHits += nCells - nMisses;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    _nMisses += nMisses;
+}
+// ----------------------------------------------------------------------------
+void ElementMatrixCache::initializeSlots( int nCells )
+{
+    _slotPtr.assign(nCells, unreservedSlot);
+    _slotSize.assign(nCells, 0);
+    _revision.assign(nCells, noRevision);
+    _poolSize = 0;
+}
+// ----------------------------------------------------------------------------
+void ElementMatrixCache::reportAccesses()
+{
+    diagnostics().addElementMatrixCacheAccesses(_nHits, _nMisses);
+    _nHits = 0;
+    _nMisses = 0;
+}
+// ----------------------------------------------------------------------------
+void ElementMatrixCache::reserveSlotFor( Cell* targetCell, int nEntries )
+{
+    int id = targetCell->id();
+    if ( id >= (int)_slotPtr.size() )
+        throw std::runtime_error("Slot requested for cell outside of cache range!\nSource: ElementMatrixCache");
+    
+    _slotPtr[id] = _poolSize;
+    _slotSize[id] = nEntries;
+    _poolSize += nEntries;
+}
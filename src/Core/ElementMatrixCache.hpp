@@ -0,0 +1,83 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef ELEMENTMATRIXCACHE_HPP
+#define ELEMENTMATRIXCACHE_HPP
+
+#include <vector>
+#include "TimeData.hpp"
+#include "Util/ArraySpan.hpp"
+#include "Util/DefaultInitAllocator.hpp"
+
+namespace broomstyx
+{
+    class Cell;
+    class Dof;
+    class Numerics;
+    struct CoefficientMatrixBatch;
+    
+    // Static coefficient matrices of domain cells kept between assemblies.
+    // Each cell is given a slot in a contiguous pool, reserved in the order
+    // in which cells are assembled and sized from the matrix formed when the
+    // sparsity profile is determined. A stored matrix is reused for as long
+    // as the coefficient matrix revision of its cell is unchanged (see
+    // Cell::flagCoefficientMatrixChange). Matrices of cells whose numerics
+    // do not track this revision are recomputed on every assembly.
+    class ElementMatrixCache
+    {
+    public:
+        ElementMatrixCache();
+        virtual ~ElementMatrixCache();
+        
+        void allocatePool();
+        void giveCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                      , Numerics*               numerics
+                                      , int                     stage
+                                      , int                     subsys
+                                      , const TimeData&         time
+                                      , CoefficientMatrixBatch& batch );
+        void initializeSlots( int nCells );
+        void reportAccesses();
+        void reserveSlotFor( Cell* targetCell, int nEntries );
+        
+    private:
+        // Start and number of entries of the slot of each cell, and the
+        // revision of the matrix stored in it
+        std::vector<int> _slotPtr;
+        std::vector<int> _slotSize;
+        std::vector<int> _revision;
+        int _poolSize;
+        
+        // Pool of stored entries. Pages are first touched by the threads
+        // storing the matrices.
+        std::vector<Dof*, DefaultInitAllocator<Dof*> >    _rowDof;
+        std::vector<Dof*, DefaultInitAllocator<Dof*> >    _colDof;
+        std::vector<double, DefaultInitAllocator<double> > _coefVal;
+        
+        // Reused and recomputed matrices since the last report
+        long _nHits;
+        long _nMisses;
+    };
+}
+
+#endif /* ELEMENTMATRIXCACHE_HPP */
@@ -31,7 +31,12 @@
 
 using namespace broomstyx;
 
-FieldCondition::FieldCondition() {}
+FieldCondition::FieldCondition()
+    : _specType(None)
+    , _startVal(0.)
+    , _endVal(0.)
+    , _usrFcn(nullptr)
+{}
 
 FieldCondition::~FieldCondition() {}
 
@@ -46,6 +51,11 @@ std::string FieldCondition::domainLabel() const
     return _domainLabel; 
 }
 // ----------------------------------------------------------------------------
+bool FieldCondition::hasUniformValue() const
+{
+    return _specType == Constant || _specType == Linear;
+}
+// ----------------------------------------------------------------------------
 void FieldCondition::readDataFrom( FILE* fp )
 {
     std::string str;
@@ -58,42 +68,59 @@ void FieldCondition::readDataFrom( FILE* fp )
     _cndType = getStringInputFrom(fp, "Failed to read type of field condition from input file!", src);
     
     // Specification Type
-    _specType = getStringInputFrom(fp, "Failed to read specification type for field condition from input file!", src);
+    str = getStringInputFrom(fp, "Failed to read specification type for field condition from input file!", src);
     
-    if ( _specType == "None" )
+    if ( str == "None" )
     {
         // Do nothing.
+        _specType = None;
     }
-    else if ( _specType == "Constant" )
+    else if ( str == "Constant" )
     {
         // Read starting and ending values
         _startVal = getRealInputFrom(fp, "Failed to read value for field condition from input file!", src);
         
         _endVal = _startVal;
+        _specType = Constant;
     }
-    else if ( _specType == "Linear" )
+    else if ( str == "Linear" )
     {
         // Read starting and ending values
         _startVal = getRealInputFrom(fp, "Failed to read starting value for field condition from input file!", src);
         
         _endVal = getRealInputFrom(fp, "Failed to read end value for field condition from input file!", src);
+        _specType = Linear;
     }
-    else if ( _specType == "UserFunction" )
+    else if ( str == "UserFunction" )
     {
         std::string fcnName = getStringInputFrom(fp, "Failed to read user function name for field condition from input file!", src);
         _usrFcn = analysisModel().solutionManager().makeNewUserFunction(fcnName);
         _usrFcn->readDataFrom(fp);
+        _specType = UserFunctionSpec;
     }
     else
         throw std::runtime_error("Invalid specification type '" + str + "' for field condition in input file!");
 }
 // ----------------------------------------------------------------------------
-double FieldCondition::valueAt( const RealVector& coor, const TimeData& time ) const
+void FieldCondition::setConstantValueTo( double val )
+{
+    _specType = Constant;
+    _startVal = val;
+    _endVal = val;
+}
+// ----------------------------------------------------------------------------
+double FieldCondition::uniformValueAt( const TimeData& time ) const
 {
-    if ( _specType == "Constant" )
-        return _startVal;
-    else if ( _specType == "Linear" )
+    if ( _specType == Linear )
         return _startVal + (_endVal - _startVal)*(time.giveTargetTime() - time.giveStartTime())/(time.giveEndTime() - time.giveStartTime());
-    else // has to be user function
+    
+    return _startVal;
+}
+// ----------------------------------------------------------------------------
+double FieldCondition::valueAt( const RealVector& coor, const TimeData& time ) const
+{
+    if ( _specType == UserFunctionSpec )
         return _usrFcn->at(coor,time);
+    
+    return this->uniformValueAt(time);
 }
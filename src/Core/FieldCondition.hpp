@@ -42,12 +42,23 @@ namespace broomstyx
         
         std::string conditionType() const;
         std::string domainLabel() const;
+        bool        hasUniformValue() const;
         void        readDataFrom( FILE* fp );
+        void        setConstantValueTo( double val );
+        double      uniformValueAt( const TimeData& time ) const;
         double      valueAt( const RealVector& coor, const TimeData& time ) const;
 
     private:
+        enum SpecType
+        {
+            None,
+            Constant,
+            Linear,
+            UserFunctionSpec
+        };
+        
         std::string _domainLabel;
-        std::string _specType;
+        SpecType    _specType;
         double      _startVal;
         double      _endVal;
         std::string _cndType;
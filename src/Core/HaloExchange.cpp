@@ -0,0 +1,160 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "HaloExchange.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <config.h>
+#include "Communicator.hpp"
+
+#ifdef HAVE_MPI
+#include <mpi.h>
+#endif
+
+using namespace broomstyx;
+
+// Constructor
+HaloExchange::HaloExchange()
+    : _recvPtr(1, 0)
+    , _sendPtr(1, 0)
+{}
+
+// Destructor
+HaloExchange::~HaloExchange() {}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void HaloExchange::accumulate( const std::vector<double>& ghostVal, RealVector& x )
+{
+#ifdef HAVE_MPI
+    int nRecv = _sendRank.size();
+    int nSend = _recvRank.size();
+    std::vector<MPI_Request> request(nRecv + nSend);
+    
+    // Contributions to owned components arrive from the processes that
+    // hold them as ghosts
+    for ( int i = 0; i < nRecv; i++ )
+        MPI_Irecv(_sendBuf.data() + _sendPtr[i], _sendPtr[i+1] - _sendPtr[i], MPI_DOUBLE
+                 , _sendRank[i], 1, MPI_COMM_WORLD, &request[i]);
+    
+    for ( int i = 0; i < nSend; i++ )
+        MPI_Isend(ghostVal.data() + _recvPtr[i], _recvPtr[i+1] - _recvPtr[i], MPI_DOUBLE
+                 , _recvRank[i], 1, MPI_COMM_WORLD, &request[nRecv + i]);
+    
+    MPI_Waitall(nRecv + nSend, request.data(), MPI_STATUSES_IGNORE);
+    
+    for ( int i = 0; i < (int)_sendIdx.size(); i++ )
+        x(_sendIdx[i]) += _sendBuf[i];
+#endif
+}
+// ----------------------------------------------------------------------------
+void HaloExchange::exchange( const RealVector& x, std::vector<double>& ghostVal )
+{
+    ghostVal.resize(_recvPtr.back());
+    
+#ifdef HAVE_MPI
+    int nRecv = _recvRank.size();
+    int nSend = _sendRank.size();
+    std::vector<MPI_Request> request(nRecv + nSend);
+    
+    for ( int i = 0; i < nRecv; i++ )
+        MPI_Irecv(ghostVal.data() + _recvPtr[i], _recvPtr[i+1] - _recvPtr[i], MPI_DOUBLE
+                 , _recvRank[i], 0, MPI_COMM_WORLD, &request[i]);
+    
+    for ( int i = 0; i < (int)_sendIdx.size(); i++ )
+        _sendBuf[i] = x(_sendIdx[i]);
+    
+    for ( int i = 0; i < nSend; i++ )
+        MPI_Isend(_sendBuf.data() + _sendPtr[i], _sendPtr[i+1] - _sendPtr[i], MPI_DOUBLE
+                 , _sendRank[i], 0, MPI_COMM_WORLD, &request[nRecv + i]);
+    
+    MPI_Waitall(nRecv + nSend, request.data(), MPI_STATUSES_IGNORE);
+#endif
+}
+// ----------------------------------------------------------------------------
+int HaloExchange::giveNumberOfGhosts()
+{
+    return _recvPtr.back();
+}
+// ----------------------------------------------------------------------------
+void HaloExchange::initialize( const std::vector<int>& ghostIdx, const std::vector<int>& rangeStart )
+{
+    int nProcesses = communicator().giveNumberOfProcesses();
+    int nGhosts = ghostIdx.size();
+    
+    if ( nGhosts > 0 && nProcesses == 1 )
+        throw std::runtime_error("Ghost components cannot be exchanged without other processes!\nSource: HaloExchange");
+    
+    // Group ghost components by owning process
+    std::vector<int> recvCount(nProcesses, 0);
+    for ( int i = 0; i < nGhosts; i++ )
+    {
+        int owner = std::upper_bound(rangeStart.begin(), rangeStart.end(), ghostIdx[i]) - rangeStart.begin() - 1;
+        if ( owner < 0 || owner >= nProcesses || (i > 0 && ghostIdx[i] <= ghostIdx[i-1]) )
+            throw std::runtime_error("Invalid ghost component " + std::to_string(ghostIdx[i]) + "!\nSource: HaloExchange");
+        recvCount[owner] += 1;
+    }
+    
+    _recvRank.clear();
+    _recvPtr.assign(1, 0);
+    for ( int i = 0; i < nProcesses; i++ )
+        if ( recvCount[i] > 0 )
+        {
+            _recvRank.push_back(i);
+            _recvPtr.push_back(_recvPtr.back() + recvCount[i]);
+        }
+    
+    _sendRank.clear();
+    _sendPtr.assign(1, 0);
+    _sendIdx.clear();
+    
+#ifdef HAVE_MPI
+    if ( nProcesses > 1 )
+    {
+        // Tell owners which of their components are needed here
+        std::vector<int> sendCount(nProcesses, 0);
+        MPI_Alltoall(recvCount.data(), 1, MPI_INT, sendCount.data(), 1, MPI_INT, MPI_COMM_WORLD);
+        
+        std::vector<int> recvDispl(nProcesses + 1, 0), sendDispl(nProcesses + 1, 0);
+        for ( int i = 0; i < nProcesses; i++ )
+        {
+            recvDispl[i+1] = recvDispl[i] + recvCount[i];
+            sendDispl[i+1] = sendDispl[i] + sendCount[i];
+        }
+        
+        _sendIdx.resize(sendDispl[nProcesses]);
+        MPI_Alltoallv(ghostIdx.data(), recvCount.data(), recvDispl.data(), MPI_INT
+                     , _sendIdx.data(), sendCount.data(), sendDispl.data(), MPI_INT, MPI_COMM_WORLD);
+        
+        for ( int i = 0; i < nProcesses; i++ )
+            if ( sendCount[i] > 0 )
+            {
+                _sendRank.push_back(i);
+                _sendPtr.push_back(sendDispl[i+1]);
+            }
+    }
+#endif
+    
+    _sendBuf.assign(_sendIdx.size(), 0.);
+}
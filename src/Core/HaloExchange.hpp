@@ -0,0 +1,66 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef HALOEXCHANGE_HPP
+#define HALOEXCHANGE_HPP
+
+#include <vector>
+#include "Util/RealVector.hpp"
+
+namespace broomstyx
+{
+    // Communication pattern for vectors whose components are owned by
+    // processes in contiguous ranges. Each process receives the values of
+    // the components it reads but does not own (ghost components) from their
+    // owners, using point-to-point messages between neighboring processes.
+    // In the reverse direction, contributions to ghost components are added
+    // to the components at their owners.
+    class HaloExchange
+    {
+    public:
+        HaloExchange();
+        virtual ~HaloExchange();
+
+        // Disable copy constructor and assignment operator
+        HaloExchange( const HaloExchange& ) = delete;
+        HaloExchange& operator=( const HaloExchange& ) = delete;
+
+        void accumulate( const std::vector<double>& ghostVal, RealVector& x );
+        void exchange( const RealVector& x, std::vector<double>& ghostVal );
+        int  giveNumberOfGhosts();
+        void initialize( const std::vector<int>& ghostIdx, const std::vector<int>& rangeStart );
+
+    private:
+        // Ghost components, sorted and hence grouped by owning process
+        std::vector<int> _recvRank;
+        std::vector<int> _recvPtr;
+
+        // Owned components requested by each neighboring process
+        std::vector<int> _sendRank;
+        std::vector<int> _sendPtr;
+        std::vector<int> _sendIdx;
+        std::vector<double> _sendBuf;
+    };
+}
+
+#endif /* HALOEXCHANGE_HPP */
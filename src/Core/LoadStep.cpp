@@ -22,6 +22,7 @@
 */
 
 #include "LoadStep.hpp"
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
@@ -31,6 +32,7 @@
 
 #include "AnalysisModel.hpp"
 #include "Cell.hpp"
+#include "Communicator.hpp"
 #include "Diagnostics.hpp"
 #include "DomainManager.hpp"
 #include "DofManager.hpp"
@@ -59,6 +61,10 @@ LoadStep::LoadStep( int lsNum, int nStg )
     _convDatCount.assign(nStg, 0);
     _iterDatCount.assign(nStg, 0);
     
+    // Load step data is written by the root process only
+    if ( !communicator().isRoot() )
+        return;
+    
     // Create directories
     const int dir_err = system("mkdir -p LoadStepData");
     if ( dir_err == -1 )
@@ -134,21 +140,38 @@ void LoadStep::readDataFrom( FILE *fp )
     verifyDeclaration(fp, "MAX_SUBSTEPS", _name);
     _maxSubsteps = getIntegerInputFrom(fp, "Failed to read maximum number of substeps for load step # " + std::to_string(_loadStepNum) + " from input file!", _name);
     
-    // Read boundary conditions
-    verifyDeclaration(fp, "BOUNDARY_CONDITIONS", _name);
-    int nBC = getIntegerInputFrom(fp, "Failed to read number of boundary conditions for load step # " + std::to_string(_loadStepNum) + " from input file!", _name);
-    
-    _boundaryCondition.assign(nBC, BoundaryCondition());
-    for ( int i = 0; i < nBC; i++)
-        _boundaryCondition[i].readDataFrom(fp);
-    
-    // Read field conditions
-    verifyDeclaration(fp, "FIELD_CONDITIONS", _name);
-    int nFC = getIntegerInputFrom(fp, "Failed to read number of field conditions for load step # " + std::to_string(_loadStepNum) + " from input file!", _name);
-    
-    _fieldCondition.assign(nFC, FieldCondition());
-    for ( int i = 0; i < nFC; i++)
-        _fieldCondition[i].readDataFrom(fp);
+    // Read boundary and field conditions, either for a single load case or
+    // for several load cases sharing the same coefficient matrix
+    std::string decl = getStringInputFrom(fp, "Failed to read boundary conditions for load step # " + std::to_string(_loadStepNum) + " from input file!", _name);
+    if ( decl == "BOUNDARY_CONDITIONS" )
+        this->readConditionsFrom(fp, _boundaryCondition, _fieldCondition);
+    else if ( decl == "LOAD_CASES" )
+    {
+        int nLoadCases = getIntegerInputFrom(fp, "Failed to read number of load cases for load step # " + std::to_string(_loadStepNum) + " from input file!", _name);
+        if ( nLoadCases < 1 )
+            throw std::runtime_error("Number of load cases for load step # " + std::to_string(_loadStepNum) + " must be positive!\nSource: " + _name);
+        if ( _nStages > 1 )
+            throw std::runtime_error("Multiple load cases are only supported for single-stage analyses!\nSource: " + _name);
+        
+        _loadCaseName.assign(nLoadCases, std::string());
+        _loadCaseBoundaryCondition.assign(nLoadCases, std::vector<BoundaryCondition>());
+        _loadCaseFieldCondition.assign(nLoadCases, std::vector<FieldCondition>());
+        for ( int i = 0; i < nLoadCases; i++ )
+        {
+            verifyKeyword(fp, "Case", _name);
+            _loadCaseName[i] = getStringInputFrom(fp, "Failed to read name of load case # " + std::to_string(i + 1) + " for load step # " + std::to_string(_loadStepNum), _name);
+            verifyDeclaration(fp, "BOUNDARY_CONDITIONS", _name);
+            this->readConditionsFrom(fp, _loadCaseBoundaryCondition[i], _loadCaseFieldCondition[i]);
+        }
+        
+        // Constrained DOFs and the sparsity profile are determined from the
+        // first load case
+        _boundaryCondition = _loadCaseBoundaryCondition[0];
+        _fieldCondition = _loadCaseFieldCondition[0];
+        this->verifyConstraintsOfLoadCases();
+    }
+    else
+        throw std::runtime_error("Declaration 'BOUNDARY_CONDITIONS' or 'LOAD_CASES' expected in input file,\n\tstring '" + decl + "' found.\nError source: " + _name);
     
     // Read solution methods for each stage
     verifyDeclaration(fp, "SOLUTION_METHODS", _name);
@@ -161,6 +184,12 @@ void LoadStep::readDataFrom( FILE *fp )
         
         _solutionMethod[stg] = objectFactory().instantiateSolutionMethod(methStr);
         _solutionMethod[stg]->readDataFromFile(fp);
+        
+        if ( communicator().isDistributed() && !_solutionMethod[stg]->supportsDistributedExecution() )
+            throw std::runtime_error("Solution method '" + methStr + "' does not support distributed execution!\nSource: " + _name);
+        
+        if ( !_loadCaseName.empty() && !_solutionMethod[stg]->supportsLoadCases() )
+            throw std::runtime_error("Solution method '" + methStr + "' does not support multiple load cases!\nSource: " + _name);
     }
     
     // Output frequency
@@ -221,24 +250,18 @@ void LoadStep::solveYourself()
     std::fflush(stdout);
     tic = std::chrono::high_resolution_clock::now();
     
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    for ( int i = 0; i < (int)_preProcess.size(); i++ )
+    {
+        int domainLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(_preProcess[i].domainTag);
+        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(domainLabel);
+        ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(domainLabel);
+        int nCells = domCell.size();
+        
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-    for ( int iCell = 0; iCell < nCells; iCell++ )
-    {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
-        int cellLabel = analysisModel().domainManager().giveLabelOf(curCell);
-        
-        for ( int i = 0; i < (int)_preProcess.size(); i++ )
-        {
-            int domainLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(_preProcess[i].domainTag);
-            if ( cellLabel == domainLabel )
-            {
-                Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(domainLabel);
-                numerics->performPreprocessingAt(curCell, _preProcess[i].directive);
-            }
-        }
+        for ( int iCell = 0; iCell < nCells; iCell++ )
+            numerics->performPreprocessingAt(domCell[iCell], _preProcess[i].directive);
     }
     
     toc  = std::chrono::high_resolution_clock::now();
@@ -270,7 +293,12 @@ void LoadStep::solveYourself()
     {
         // First impose constraints to allow numerics to set proper flags for cells where needed
         _solutionMethod[i]->imposeConstraintsAt(i, _boundaryCondition, _time);
+        
+        tic = std::chrono::high_resolution_clock::now();
         _solutionMethod[i]->formSparsityProfileForStage(i);    
+        toc = std::chrono::high_resolution_clock::now();
+        tictoc = toc - tic;
+        diagnostics().addSparsityProfileTime(tictoc.count());
     }
 
     setupToc = std::chrono::high_resolution_clock::now();
@@ -323,7 +351,11 @@ void LoadStep::solveYourself()
                 std::printf("\n    Stage # %d", curStage);
                 std::printf("\n  -------------------\n");
 
-                int error = _solutionMethod[curStage]->computeSolutionFor(curStage, _boundaryCondition, _fieldCondition, _time);
+                int error;
+                if ( _loadCaseName.empty() )
+                    error = _solutionMethod[curStage]->computeSolutionFor(curStage, _boundaryCondition, _fieldCondition, _time);
+                else
+                    error = _solutionMethod[curStage]->computeSolutionsForLoadCases(curStage, _loadCaseBoundaryCondition, _loadCaseFieldCondition, _time);
                 
                 if ( error  == 0 )
                     stageConverged[curStage] = true;
@@ -381,26 +413,31 @@ void LoadStep::solveYourself()
         }
         else
         {
-            std::chrono::time_point<std::chrono::system_clock> innertic, innertoc;
-
-            // Perform any needed computations at cells before finalizing data
-            innertic = std::chrono::high_resolution_clock::now();
-            this->performPrefinalCalculationsAtCells();
-            
-            // Finalize data
-            analysisModel().dofManager().finalizeDofValues();
-            innertoc = std::chrono::high_resolution_clock::now();
-            tictoc = innertoc - innertic;
-            diagnostics().addUpdateTime(tictoc.count());
-            
-            innertic = std::chrono::high_resolution_clock::now();
-            analysisModel().domainManager().finalizeCellDataAt(_time);
-            
-            // Perform post-processing for nodal field values
-            analysisModel().domainManager().performNodalPostProcessing();
-            innertoc = std::chrono::high_resolution_clock::now();
-            tictoc = innertoc - innertic;
-            diagnostics().addPostprocessingTime(tictoc.count());
+            if ( _loadCaseName.empty() )
+                this->finalizeSubstep();
+            else
+            {
+                // DOFs and cells hold one solution at a time, so each load
+                // case is finalized and written out before the next one is
+                // retrieved
+                bool writeResults = skipCount + 1 == _writeInterval 
+                        || std::fabs(_time.giveTargetTime() - _time.giveEndTime()) < 1.0e-13;
+                
+                for ( int i = 0; i < (int)_loadCaseName.size(); i++ )
+                {
+                    std::printf("\n    Load case '%s'\n", _loadCaseName[i].c_str());
+                    _solutionMethod[1]->retrieveSolutionForLoadCase(i, 1, _loadCaseBoundaryCondition[i], _loadCaseFieldCondition[i], _time);
+                    this->finalizeSubstep();
+                    
+                    analysisModel().outputManager().setLoadCaseTo(_loadCaseName[i]);
+                    if ( writeResults )
+                        analysisModel().outputManager().writeOutput(_time.giveTargetTime());
+                    analysisModel().outputManager().writeOutputQuantities(_time.giveTargetTime());
+                }
+                
+                // Output of subsequent load steps goes to the base files
+                analysisModel().outputManager().setLoadCaseTo("");
+            }
             
             // Update time and target time for next substep
             _time.advanceTime();
@@ -414,15 +451,23 @@ void LoadStep::solveYourself()
             //diagnostics().debugAddSubstepTime(tictoc.count());
 
             ++skipCount;
-            if ( skipCount == _writeInterval )
+            if ( !_loadCaseName.empty() )
             {
-                analysisModel().outputManager().writeOutput(_time.giveCurrentTime());
-                skipCount = 0;
+                if ( skipCount == _writeInterval )
+                    skipCount = 0;
             }
-            else if ( endOfLoadStep )
-                analysisModel().outputManager().writeOutput(_time.giveCurrentTime());
+            else
+            {
+                if ( skipCount == _writeInterval )
+                {
+                    analysisModel().outputManager().writeOutput(_time.giveCurrentTime());
+                    skipCount = 0;
+                }
+                else if ( endOfLoadStep )
+                    analysisModel().outputManager().writeOutput(_time.giveCurrentTime());
 
-            analysisModel().outputManager().writeOutputQuantities(_time.giveCurrentTime());
+                analysisModel().outputManager().writeOutputQuantities(_time.giveCurrentTime());
+            }
         }
     }
     
@@ -431,23 +476,18 @@ void LoadStep::solveYourself()
     std::printf("  %-40s", "Running postprocessing routines ...");
     std::fflush(stdout);
     
+    for ( int i = 0; i < (int)_postProcess.size(); i++ )
+    {
+        int domainLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(_postProcess[i].domainTag);
+        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(domainLabel);
+        ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(domainLabel);
+        int nCells = domCell.size();
+        
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-    for ( int iCell = 0; iCell < nCells; iCell++ )
-    {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
-        int cellLabel = analysisModel().domainManager().giveLabelOf(curCell);
-        
-        for ( int i = 0; i < (int)_postProcess.size(); i++ )
-        {
-            int domainLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(_postProcess[i].domainTag);
-            if ( cellLabel == domainLabel )
-            {
-                Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(domainLabel);
-                numerics->performPostprocessingAt(curCell, _postProcess[i].directive);
-            }
-        }
+        for ( int iCell = 0; iCell < nCells; iCell++ )
+            numerics->performPostprocessingAt(domCell[iCell], _postProcess[i].directive);
     }
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
@@ -460,6 +500,9 @@ void LoadStep::solveYourself()
 // -----------------------------------------------------------------------------
 void LoadStep::writeConvergenceDataForStage( int stg, RealMatrix& convDat)
 {
+    if ( !_convDatFile[stg-1] )
+        return;
+    
     int nRows = convDat.dim1();
     
     std::fprintf(_convDatFile[stg-1], "%d, ", ++_convDatCount[stg-1]);
@@ -478,6 +521,9 @@ void LoadStep::writeIterationDataForStage( int    stg
                                          , double time
                                          , int    nIter )
 {
+    if ( !_iterDatFile[stg-1] )
+        return;
+    
     std::fprintf(_iterDatFile[stg-1], "%d, ", ++_iterDatCount[stg-1]);
     std::fprintf(_iterDatFile[stg-1], "%.15e, %d\n", time, nIter);
     std::fflush(_iterDatFile[stg-1]);
@@ -497,31 +543,24 @@ void LoadStep::findConstrainedDofs()
         // Check for essential boundary condition on nodes
         if ( curBC.conditionType() == "NodalConstraint" )
         {
-            int nBCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
-            for ( int i = 0; i < nBCells; i++ )
+            for ( Cell* curCell : analysisModel().domainManager().giveBoundaryCellsWithLabel(boundaryId) )
             {
-                Cell* curCell = analysisModel().domainManager().giveBoundaryCell(i);
-                int label = analysisModel().domainManager().giveLabelOf(curCell);
+                // Retrieve nodes of boundary element
+                std::vector<Node*> node;
+                node = analysisModel().domainManager().giveNodesOf(curCell);
                 
-                if ( label == boundaryId )
-                {       
-                    // Retrieve nodes of boundary element
-                    std::vector<Node*> node;
-                    node = analysisModel().domainManager().giveNodesOf(curCell);
-                    
-                    std::vector<Cell*> domCell = analysisModel().domainManager().giveDomainCellsAssociatedWith(curCell);
-                    for ( Cell* curDomCell : domCell )
+                std::vector<Cell*> domCell = analysisModel().domainManager().giveDomainCellsAssociatedWith(curCell);
+                for ( Cell* curDomCell : domCell )
+                {
+                    Numerics* domCellNumerics = analysisModel().domainManager().giveNumericsFor(curDomCell);
+                    if ( domCellNumerics == targetNumerics )
                     {
-                        Numerics* domCellNumerics = analysisModel().domainManager().giveNumericsFor(curDomCell);
-                        if ( domCellNumerics == targetNumerics )
+                        int targetDofNum = analysisModel().dofManager().giveIndexForNodalDof(curBC.targetDof());
+                        
+                        for ( Node* curNode : node )
                         {
-                            int targetDofNum = analysisModel().dofManager().giveIndexForNodalDof(curBC.targetDof());
-                            
-                            for ( Node* curNode : node )
-                            {
-                                Dof* targetDof = analysisModel().domainManager().giveNodalDof(targetDofNum, curNode);
-                                analysisModel().dofManager().putDirichletConstraintOn(targetDof);
-                            }
+                            Dof* targetDof = analysisModel().domainManager().giveNodalDof(targetDofNum, curNode);
+                            analysisModel().dofManager().putDirichletConstraintOn(targetDof);
                         }
                     }
                 }
@@ -531,24 +570,41 @@ void LoadStep::findConstrainedDofs()
         // Check for essential boundary condition on cells
         if ( curBC.conditionType() == "CellConstraint" )
         {
-            int nDCells = analysisModel().domainManager().giveNumberOfDomainCells();
-            for ( int i = 0; i < nDCells; i++ )
+            int targetDofNum = analysisModel().dofManager().giveIndexForCellDof(curBC.targetDof());
+            for ( Cell* curCell : analysisModel().domainManager().giveDomainCellsWithLabel(boundaryId) )
             {
-                Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
-                int label = analysisModel().domainManager().giveLabelOf(curCell);
-                
-                if ( label == boundaryId )
-                {
-                    int targetDofNum = analysisModel().dofManager().giveIndexForCellDof(curBC.targetDof());
-                    
-                    Dof* targetDof = analysisModel().domainManager().giveCellDof(targetDofNum, curCell);
-                    analysisModel().dofManager().putDirichletConstraintOn(targetDof);
-                }
+                Dof* targetDof = analysisModel().domainManager().giveCellDof(targetDofNum, curCell);
+                analysisModel().dofManager().putDirichletConstraintOn(targetDof);
             }
         }
     }
 }
+// -----------------------------------------------------------------------------
+void LoadStep::finalizeSubstep()
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
 
+    // Perform any needed computations at cells before finalizing data
+    tic = std::chrono::high_resolution_clock::now();
+    this->performPrefinalCalculationsAtCells();
+    
+    // Finalize data
+    analysisModel().dofManager().finalizeDofValues();
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addUpdateTime(tictoc.count());
+    
+    tic = std::chrono::high_resolution_clock::now();
+    analysisModel().domainManager().finalizeCellDataAt(_time);
+    
+    // Perform post-processing for nodal field values
+    analysisModel().domainManager().performNodalPostProcessing();
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addPostprocessingTime(tictoc.count());
+}
+// -----------------------------------------------------------------------------
 void LoadStep::performPrefinalCalculationsAtCells()
 {
     int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
@@ -565,3 +621,47 @@ void LoadStep::performPrefinalCalculationsAtCells()
         numerics->performPrefinalizationCalculationsAt(curCell);
     }
 }
+// -----------------------------------------------------------------------------
+void LoadStep::readConditionsFrom( FILE* fp
+                                 , std::vector<BoundaryCondition>& bndCond
+                                 , std::vector<FieldCondition>& fldCond )
+{
+    // Note: 'BOUNDARY_CONDITIONS' declaration is assumed to have been read
+    int nBC = getIntegerInputFrom(fp, "Failed to read number of boundary conditions for load step # " + std::to_string(_loadStepNum) + " from input file!", _name);
+    
+    bndCond.assign(nBC, BoundaryCondition());
+    for ( int i = 0; i < nBC; i++)
+        bndCond[i].readDataFrom(fp);
+    
+    // Read field conditions
+    verifyDeclaration(fp, "FIELD_CONDITIONS", _name);
+    int nFC = getIntegerInputFrom(fp, "Failed to read number of field conditions for load step # " + std::to_string(_loadStepNum) + " from input file!", _name);
+    
+    fldCond.assign(nFC, FieldCondition());
+    for ( int i = 0; i < nFC; i++)
+        fldCond[i].readDataFrom(fp);
+}
+// -----------------------------------------------------------------------------
+void LoadStep::verifyConstraintsOfLoadCases()
+{
+    // Load cases share one coefficient matrix, so they may differ in the
+    // values of essential boundary conditions but not in their targets
+    auto giveConstraintTargets = []( const std::vector<BoundaryCondition>& bndCond )
+    {
+        std::vector<std::string> target;
+        for ( const BoundaryCondition& curBC : bndCond )
+            if ( curBC.conditionType() == "NodalConstraint" || curBC.conditionType() == "CellConstraint" )
+                target.push_back(curBC.conditionType() + " " + curBC.boundaryName() + " " 
+                        + std::to_string(curBC.targetNumerics()) + " " + curBC.targetDof());
+        
+        std::sort(target.begin(), target.end());
+        return target;
+    };
+    
+    std::vector<std::string> refTarget = giveConstraintTargets(_loadCaseBoundaryCondition[0]);
+    for ( int i = 1; i < (int)_loadCaseName.size(); i++ )
+        if ( giveConstraintTargets(_loadCaseBoundaryCondition[i]) != refTarget )
+            throw std::runtime_error("Essential boundary conditions of load case '" + _loadCaseName[i] 
+                    + "' do not act on the same DOFs as those of load case '" + _loadCaseName[0]
+                    + "' in load step # " + std::to_string(_loadStepNum) + "!\nSource: " + _name);
+}
@@ -78,6 +78,11 @@ namespace broomstyx
         
         std::vector<BoundaryCondition> _boundaryCondition;
         std::vector<FieldCondition>    _fieldCondition;
+        
+        // Load cases sharing the coefficient matrix of the load step
+        std::vector<std::string> _loadCaseName;
+        std::vector<std::vector<BoundaryCondition>> _loadCaseBoundaryCondition;
+        std::vector<std::vector<FieldCondition>>    _loadCaseFieldCondition;
         std::vector<SolutionMethod*>   _solutionMethod;
         
         std::vector<FILE*> _convDatFile;
@@ -86,7 +91,12 @@ namespace broomstyx
         std::vector<int>   _iterDatCount;
 
         void findConstrainedDofs();
+        void finalizeSubstep();
         void performPrefinalCalculationsAtCells();
+        void readConditionsFrom( FILE* fp
+                               , std::vector<BoundaryCondition>& bndCond
+                               , std::vector<FieldCondition>& fldCond );
+        void verifyConstraintsOfLoadCases();
     };
 }
 
@@ -0,0 +1,105 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "LoadVectorCache.hpp"
+#include <stdexcept>
+#include <tuple>
+#include "AnalysisModel.hpp"
+#include "DomainManager.hpp"
+#include "Numerics/Numerics.hpp"
+#include "Util/RealVector.hpp"
+
+using namespace broomstyx;
+
+LoadVectorCache::LoadVectorCache() {}
+
+LoadVectorCache::~LoadVectorCache() {}
+
+// ----------------------------------------------------------------------------
+bool LoadVectorCache::appliesTo( const FieldCondition& fldCond )
+{
+    if ( !fldCond.hasUniformValue() )
+        return false;
+    
+    int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond.domainLabel());
+    Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(fcLabel);
+    
+    return numerics->hasStateIndependentRightHandSide();
+}
+// ----------------------------------------------------------------------------
+const CachedLoadVector& LoadVectorCache::giveLoadVectorFor( const FieldCondition& fldCond, int stage, const TimeData& time )
+{
+    // Must not be called from within a parallel region, since the load
+    // vector is formed on first request
+    auto it = _loadVector.find(&fldCond);
+    if ( it == _loadVector.end() )
+    {
+        it = _loadVector.insert({&fldCond, CachedLoadVector()}).first;
+        this->formLoadVectorFor(fldCond, stage, time, it->second);
+    }
+    
+    return it->second;
+}
+
+// Private methods
+// ----------------------------------------------------------------------------
+void LoadVectorCache::formLoadVectorFor( const FieldCondition& fldCond, int stage, const TimeData& time, CachedLoadVector& loadVector )
+{
+    int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond.domainLabel());
+    Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(fcLabel);
+    ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(fcLabel);
+    int nCells = domCell.size();
+    
+    FieldCondition zeroCond = fldCond;
+    zeroCond.setConstantValueTo(0.);
+    FieldCondition unitCond = fldCond;
+    unitCond.setConstantValueTo(1.);
+    
+    std::vector<std::vector<Dof*>> cellDof(nCells);
+    std::vector<RealVector> cellBaseVal(nCells), cellUnitVal(nCells);
+    
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int iCell = 0; iCell < nCells; iCell++ )
+    {
+        std::tie(cellDof[iCell], cellBaseVal[iCell]) = numerics->giveStaticRightHandSideAt(domCell[iCell], stage, UNASSIGNED, zeroCond, time);
+        std::tie(std::ignore, cellUnitVal[iCell]) = numerics->giveStaticRightHandSideAt(domCell[iCell], stage, UNASSIGNED, unitCond, time);
+    }
+    
+    // Only entries with a DOF are kept
+    for ( int iCell = 0; iCell < nCells; iCell++ )
+    {
+        if ( cellUnitVal[iCell].dim() != cellBaseVal[iCell].dim() )
+            throw std::runtime_error("Right hand side of field condition '" + fldCond.conditionType() + "' changes in size with its value!\nSource: LoadVectorCache");
+        
+        for ( int i = 0; i < cellBaseVal[iCell].dim(); i++ )
+            if ( cellDof[iCell][i] )
+            {
+                loadVector.cell.push_back(domCell[iCell]);
+                loadVector.dof.push_back(cellDof[iCell][i]);
+                loadVector.baseVal.push_back(cellBaseVal[iCell](i));
+                loadVector.unitVal.push_back(cellUnitVal[iCell](i) - cellBaseVal[iCell](i));
+            }
+    }
+}
@@ -0,0 +1,75 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef LOADVECTORCACHE_HPP
+#define LOADVECTORCACHE_HPP
+
+#include <map>
+#include <vector>
+#include "FieldCondition.hpp"
+#include "TimeData.hpp"
+
+namespace broomstyx
+{
+    class Cell;
+    class Dof;
+    
+    // Right hand side contributions of a field condition, stored per cell
+    // entry as the contribution at zero field value plus the change per unit
+    // of field value
+    struct CachedLoadVector
+    {
+        std::vector<Cell*>  cell;
+        std::vector<Dof*>   dof;
+        std::vector<double> baseVal;
+        std::vector<double> unitVal;
+    };
+    
+    // Right hand side contributions of field conditions whose value is
+    // uniform in space (Constant and Linear specifications). Since the
+    // contributions of such a condition are affine in its value, they are
+    // formed once from evaluations at values 0 and 1 and then scaled by the
+    // value at the current time. Since this assumes that the contributions
+    // do not depend on the state of the cells, only conditions on domains
+    // whose numerics declare a state-independent right hand side are cached
+    // (see Numerics::hasStateIndependentRightHandSide). Cached contributions
+    // are kept for the lifetime of the cache, i.e. for one load step when
+    // owned by a solution method.
+    class LoadVectorCache
+    {
+    public:
+        LoadVectorCache();
+        virtual ~LoadVectorCache();
+        
+        bool appliesTo( const FieldCondition& fldCond );
+        const CachedLoadVector& 
+             giveLoadVectorFor( const FieldCondition& fldCond, int stage, const TimeData& time );
+        
+    private:
+        std::map<const FieldCondition*, CachedLoadVector> _loadVector;
+        
+        void formLoadVectorFor( const FieldCondition& fldCond, int stage, const TimeData& time, CachedLoadVector& loadVector );
+    };
+}
+
+#endif /* LOADVECTORCACHE_HPP */
@@ -24,7 +24,6 @@
 #ifndef NODE_HPP
 #define	NODE_HPP
 
-#include <set>
 #include <vector>
 #include "Util/RealVector.hpp"
 
@@ -53,9 +52,6 @@ namespace broomstyx
 
         RealVector _coordinates;
 
-        std::set<Cell*> _attachedBndCell;
-        std::set<Cell*> _attachedDomCell;
-
         RealVector _fieldVal;
         std::vector<Dof*> _dof;
 
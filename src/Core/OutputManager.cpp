@@ -24,9 +24,11 @@
 #include "OutputManager.hpp"
 #include <chrono>
 #include <filesystem>
+#include <stdexcept>
 #include <string>
 
 #include "ObjectFactory.hpp"
+#include "Communicator.hpp"
 #include "Diagnostics.hpp"
 #include "OutputQuantities/OutputQuantity.hpp"
 #include "OutputWriters/OutputWriter.hpp"
@@ -51,6 +53,8 @@ OutputManager::~OutputManager()
 
     if ( _csvFile )
         std::fclose( _csvFile );
+    for ( auto& entry : _loadCaseCsvFile )
+        std::fclose( entry.second );
     for ( int i = 0; i < _nCsvOutput; i++)
         if ( _csvOutput[ i ] )
             delete _csvOutput[ i ];
@@ -72,7 +76,8 @@ void OutputManager::createCsvOutputDirectory()
 
 void OutputManager::initializeCSVOutput()
 {
-    if ( _nCsvOutput > 0 )
+    // Output files are written by the root process only
+    if ( _nCsvOutput > 0 && communicator().isRoot() )
     {
         // Create directory
         OutputManager::createCsvOutputDirectory();
@@ -81,24 +86,17 @@ void OutputManager::initializeCSVOutput()
         _csvFile = std::fopen( _csvFilename.c_str(), "w" );
         
         // Initialize output quantities and write column labels to CSV file
-        std::fprintf( _csvFile, "Time, " );
         for ( int i = 0; i < _nCsvOutput; i++ )
-        {
             _csvOutput[ i ]->initialize();
-            
-            std::string quantityLabel = _csvOutput[ i ]->giveLabel();
-            std::fprintf( _csvFile, "%s", quantityLabel.c_str() );
-            if ( i < _nCsvOutput - 1 )
-                std::fprintf( _csvFile, ", " );
-            else
-                std::fprintf( _csvFile, "\n" );
-        }
+        
+        this->writeCsvHeaderTo( _csvFile );
     }
 }
 
 void OutputManager::initializeOutputWriter()
 {
-    _outputWriter->initialize();
+    if ( communicator().isRoot() )
+        _outputWriter->initialize();
 }
 
 void OutputManager::readOutputWriterFromFile( FILE* fp )
@@ -135,8 +133,28 @@ void OutputManager::readDataForCSVOutputFrom( FILE* fp )
     }
 }
 
+void OutputManager::setLoadCaseTo( const std::string& loadCase )
+{
+    _loadCase = loadCase;
+    _outputWriter->setLoadCaseTo( loadCase );
+    
+    if ( _nCsvOutput > 0 && communicator().isRoot() && !loadCase.empty() && _loadCaseCsvFile.count( loadCase ) == 0 )
+    {
+        std::string filename = this->giveCsvFilenameForLoadCase( loadCase );
+        FILE* csvFile = std::fopen( filename.c_str(), "w" );
+        if ( !csvFile )
+            throw std::runtime_error( "Failed to open CSV file '" + filename + "'!\nSource: OutputManager" );
+        
+        this->writeCsvHeaderTo( csvFile );
+        _loadCaseCsvFile.insert( { loadCase, csvFile } );
+    }
+}
+
 void OutputManager::writeOutput( double time )
 {
+    if ( !communicator().isRoot() )
+        return;
+    
     std::chrono::time_point<std::chrono::system_clock> tic, toc;
     std::chrono::duration<double> tictoc;
     
@@ -154,23 +172,54 @@ void OutputManager::writeOutputQuantities( double time )
     
     tic = std::chrono::high_resolution_clock::now();
 
-    if ( _nCsvOutput > 0 )
+    if ( _nCsvOutput > 0 && communicator().isRoot() )
     {
-        std::fprintf( _csvFile, "%.15e, ", time );
+        FILE* csvFile = _csvFile;
+        std::string csvFilename = _csvFilename;
+        if ( !_loadCase.empty() )
+        {
+            csvFile = _loadCaseCsvFile[ _loadCase ];
+            csvFilename = this->giveCsvFilenameForLoadCase( _loadCase );
+        }
+        
+        std::fprintf( csvFile, "%.15e, ", time );
         for ( int i = 0; i < _nCsvOutput; i++ )
         {
             double result = _csvOutput[ i ]->computeOutput();
-            std::fprintf( _csvFile, "%.15e", result );
+            std::fprintf( csvFile, "%.15e", result );
             if ( i < _nCsvOutput - 1 )
-                std::fprintf( _csvFile, ", " );
+                std::fprintf( csvFile, ", " );
             else
-                std::fprintf( _csvFile, "\n" );
+                std::fprintf( csvFile, "\n" );
         }
-        std::fflush( _csvFile );
-        std::printf( "  --> %s\n", _csvFilename.c_str() );
+        std::fflush( csvFile );
+        std::printf( "  --> %s\n", csvFilename.c_str() );
     }
 
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
     diagnostics().addOutputWriteTime( tictoc.count() );
-}
\ No newline at end of file
+}
+
+// Private methods
+std::string OutputManager::giveCsvFilenameForLoadCase( const std::string& loadCase )
+{
+    std::string filename = _csvFilename;
+    filename.insert( filename.size() - 4, "_" + loadCase );
+    
+    return filename;
+}
+
+void OutputManager::writeCsvHeaderTo( FILE* fp )
+{
+    std::fprintf( fp, "Time, " );
+    for ( int i = 0; i < _nCsvOutput; i++ )
+    {
+        std::string quantityLabel = _csvOutput[ i ]->giveLabel();
+        std::fprintf( fp, "%s", quantityLabel.c_str() );
+        if ( i < _nCsvOutput - 1 )
+            std::fprintf( fp, ", " );
+        else
+            std::fprintf( fp, "\n" );
+    }
+}
@@ -25,6 +25,7 @@
 #define	OUTPUTMANAGER_HPP
 
 #include <cstdio>
+#include <map>
 #include <vector>
 #include <string>
 
@@ -48,6 +49,7 @@ namespace broomstyx
         void initializeCSVOutput();
         void readOutputWriterFromFile( FILE* fp );
         void readDataForCSVOutputFrom( FILE* fp );
+        void setLoadCaseTo( const std::string& loadCase );
         void writeOutput( double time );
         void writeOutputQuantities(double time);
 
@@ -59,8 +61,15 @@ namespace broomstyx
         std::string _csvFilename;
         std::vector<OutputQuantity*> _csvOutput;
         
+        // Separate CSV files are written for each load case
+        std::string _loadCase;
+        std::map<std::string, FILE*> _loadCaseCsvFile;
+        
         OutputManager();
         virtual ~OutputManager();
+        
+        std::string giveCsvFilenameForLoadCase( const std::string& loadCase );
+        void        writeCsvHeaderTo( FILE* fp );
     };
 }
 
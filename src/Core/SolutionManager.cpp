@@ -122,7 +122,7 @@ void SolutionManager::imposeInitialConditions()
     {
         std::string domainLabel = _initCond[i].domainLabel();
         int domainId = analysisModel().domainManager().givePhysicalEntityNumberFor(domainLabel);
-        int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+        ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(domainId);
 
         std::string condType = _initCond[i].conditionType();
 
@@ -131,26 +131,20 @@ void SolutionManager::imposeInitialConditions()
             int nNodes = analysisModel().domainManager().giveNumberOfNodes();
             std::vector<bool> nodeIsInitialized(nNodes, false);
 
-            for ( int j = 0; j < nCells; j++ )
+            for ( Cell* curCell : domCell )
             {
-                Cell* curCell = analysisModel().domainManager().giveDomainCell(j);
-                int cellLabel = analysisModel().domainManager().giveLabelOf(curCell);
-
-                if ( cellLabel == domainId )
+                std::vector<Node*> cellNode = analysisModel().domainManager().giveNodesOf(curCell);
+                for ( auto it = cellNode.begin(); it != cellNode.end(); it++ )
                 {
-                    std::vector<Node*> cellNode = analysisModel().domainManager().giveNodesOf(curCell);
-                    for ( auto it = cellNode.begin(); it != cellNode.end(); it++ )
+                    int nodeId = analysisModel().domainManager().giveIdOf(*it);
+                    if ( !nodeIsInitialized[nodeId] )
                     {
-                        int nodeId = analysisModel().domainManager().giveIdOf(*it);
-                        if ( !nodeIsInitialized[nodeId] )
-                        {
-                            RealVector coor = analysisModel().domainManager().giveCoordinatesOf(*it);
-                            int dofNum = _initCond[i].targetDofNumber();
-                            double val = _initCond[i].valueAt(coor);
-                            
-                            Dof* targetDof = analysisModel().domainManager().giveNodalDof(dofNum, *it);
-                            analysisModel().dofManager().updatePrimaryVariableAt(targetDof, val, converged_value);
-                        }
+                        RealVector coor = analysisModel().domainManager().giveCoordinatesOf(*it);
+                        int dofNum = _initCond[i].targetDofNumber();
+                        double val = _initCond[i].valueAt(coor);
+                        
+                        Dof* targetDof = analysisModel().domainManager().giveNodalDof(dofNum, *it);
+                        analysisModel().dofManager().updatePrimaryVariableAt(targetDof, val, converged_value);
                     }
                 }
             }
@@ -159,16 +153,8 @@ void SolutionManager::imposeInitialConditions()
         {
             Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(domainId);
 
-            for ( int j = 0; j < nCells; j++ )
-            {
-                Cell* curCell = analysisModel().domainManager().giveDomainCell(j);
-                int cellLabel = analysisModel().domainManager().giveLabelOf(curCell);
-
-                if ( cellLabel == domainId )
-                {
-                    numerics->imposeInitialConditionAt(curCell, _initCond[i]);
-                }
-            }
+            for ( Cell* curCell : domCell )
+                numerics->imposeInitialConditionAt(curCell, _initCond[i]);
         }
     }
 }
@@ -0,0 +1,422 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "StaticCondensation.hpp"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <tuple>
+#include "AnalysisModel.hpp"
+#include "Diagnostics.hpp"
+#include "DofManager.hpp"
+#include "DomainManager.hpp"
+#include "ObjectFactory.hpp"
+#include "LinearSolvers/LinearSolver.hpp"
+#include "Numerics/Numerics.hpp"
+#include "SparseMatrix/SparseMatrix.hpp"
+#include "Util/readOperations.hpp"
+
+using namespace broomstyx;
+
+namespace
+{
+    // Equations reached by cells of condensed domains and by other cells
+    const char reachedByCondensedCell = 1;
+    const char reachedByRetainedCell = 2;
+    
+    // Number of interface equations whose columns of inv(K_ii)*K_ib are
+    // formed together when computing the Schur complement
+    const int nSchurColumnsPerChunk = 64;
+}
+
+// Constructor
+StaticCondensation::StaticCondensation()
+    : _solver(nullptr)
+    , _interiorMatrix(nullptr)
+    , _isCondensed(false)
+    , _nUnknowns(0)
+    , _nRetained(0)
+    , _nInterior(0)
+{}
+
+// Destructor
+StaticCondensation::~StaticCondensation()
+{
+    if ( _interiorMatrix )
+        delete _interiorMatrix;
+    if ( _solver )
+        delete _solver;
+}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void StaticCondensation::addSchurComplementTo( SparseMatrix* spMatrix )
+{
+    int nInterface = _interfaceEq.size();
+    for ( int j = 0; j < nInterface; j++ )
+        for ( int i = 0; i < nInterface; i++ )
+            spMatrix->addToComponent(_interfaceEq[i], _interfaceEq[j], _schur(i, j));
+}
+// ----------------------------------------------------------------------------
+void StaticCondensation::condenseAt( int stage, const TimeData& time )
+{
+    // Coefficient matrices of condensed domains are constant, so the Schur
+    // complement is formed only once for each sparsity profile
+    if ( _isCondensed )
+        return;
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    std::printf("\n    %-40s", "Condensing linear domains ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+    
+    int nInterface = _interfaceEq.size();
+    if ( nInterface > 0 )
+        _schur.init(nInterface, nInterface);
+    _ibRow.clear();
+    _ibCol.clear();
+    _ibVal.clear();
+    _biRow.clear();
+    _biCol.clear();
+    _biVal.clear();
+    if ( _nInterior > 0 )
+        _interiorMatrix->initializeValues();
+    
+    // Split cell contributions into K_ii, K_ib, K_bi and K_bb
+    for ( Cell* curCell : _cell )
+    {
+        Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+        
+        std::vector<Dof*> rowDof, colDof;
+        RealVector coefVal;
+        std::tie(rowDof,colDof,coefVal) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, UNASSIGNED, time);
+        
+        for ( int k = 0; k < (int)rowDof.size(); k++ )
+        {
+            if ( !rowDof[k] || !colDof[k] )
+                continue;
+            
+            int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[k]);
+            int colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[k]);
+            if ( rowNum == UNASSIGNED || colNum == UNASSIGNED )
+                continue;
+            
+            int rowIdx = _interiorIdx[rowNum];
+            int colIdx = _interiorIdx[colNum];
+            if ( rowIdx != UNASSIGNED && colIdx != UNASSIGNED )
+                _interiorMatrix->addToComponent(rowIdx, colIdx, coefVal(k));
+            else if ( rowIdx != UNASSIGNED )
+            {
+                _ibRow.push_back(rowIdx);
+                _ibCol.push_back(_interfaceIdx[colNum]);
+                _ibVal.push_back(coefVal(k));
+            }
+            else if ( colIdx != UNASSIGNED )
+            {
+                _biRow.push_back(_interfaceIdx[rowNum]);
+                _biCol.push_back(colIdx);
+                _biVal.push_back(coefVal(k));
+            }
+            else
+                _schur(_interfaceIdx[rowNum], _interfaceIdx[colNum]) += coefVal(k);
+        }
+    }
+    
+    if ( _nInterior > 0 )
+    {
+        _solver->allocateInternalMemoryFor(_interiorMatrix);
+        if ( _solver->retainsFactorization() )
+            _solver->factorize(_interiorMatrix);
+        
+        // Subtract K_bi * inv(K_ii) * K_ib, a chunk of columns at a time
+        for ( int firstCol = 0; firstCol < nInterface; firstCol += nSchurColumnsPerChunk )
+        {
+            int nCols = std::min(nSchurColumnsPerChunk, nInterface - firstCol);
+            
+            RealMatrix rhs(_nInterior, nCols);
+            for ( int k = 0; k < (int)_ibVal.size(); k++ )
+            {
+                int col = _ibCol[k] - firstCol;
+                if ( col >= 0 && col < nCols )
+                    rhs(_ibRow[k], col) += _ibVal[k];
+            }
+            
+            RealMatrix x;
+            if ( _solver->retainsFactorization() )
+            {
+                x.init(_nInterior, nCols);
+                for ( int j = 0; j < nCols; j++ )
+                {
+                    RealVector b(_nInterior);
+                    std::copy(rhs.ptr() + j*_nInterior, rhs.ptr() + (j + 1)*_nInterior, b.ptr());
+                    RealVector xj = _solver->backSubstitute(_interiorMatrix, b);
+                    std::copy(xj.ptr(), xj.ptr() + _nInterior, x.ptr() + j*_nInterior);
+                }
+            }
+            else
+                x = _solver->solveForMultipleRhs(_interiorMatrix, rhs);
+            
+            for ( int k = 0; k < (int)_biVal.size(); k++ )
+                for ( int j = 0; j < nCols; j++ )
+                    _schur(_biRow[k], firstCol + j) -= _biVal[k]*x(_biCol[k], j);
+        }
+    }
+    _isCondensed = true;
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addSolveTime(tictoc.count());
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+}
+// ----------------------------------------------------------------------------
+int StaticCondensation::giveNumberOfInterfaceEquations()
+{
+    return _interfaceEq.size();
+}
+// ----------------------------------------------------------------------------
+int StaticCondensation::giveNumberOfInteriorEquations()
+{
+    return _nInterior;
+}
+// ----------------------------------------------------------------------------
+int StaticCondensation::giveNumberOfRetainedEquations()
+{
+    return _nRetained;
+}
+// ----------------------------------------------------------------------------
+std::vector<Cell*> StaticCondensation::giveRetainedCellsOf( const std::vector<Cell*>& cell )
+{
+    std::vector<Cell*> retainedCell;
+    retainedCell.reserve(cell.size());
+    for ( Cell* curCell : cell )
+    {
+        int label = analysisModel().domainManager().giveLabelOf(curCell);
+        if ( std::find(_domainLabel.begin(), _domainLabel.end(), label) == _domainLabel.end() )
+            retainedCell.push_back(curCell);
+    }
+    
+    return retainedCell;
+}
+// ----------------------------------------------------------------------------
+RealVector StaticCondensation::giveRetainedComponentsOf( const RealVector& vec )
+{
+    RealVector retainedVec(_nRetained);
+    for ( int i = 0; i < _nUnknowns; i++ )
+        if ( _retainedIdx[i] != UNASSIGNED )
+            retainedVec(_retainedIdx[i]) = vec(i);
+    
+    return retainedVec;
+}
+// ----------------------------------------------------------------------------
+int StaticCondensation::giveRetainedEquationFor( int eqNo )
+{
+    return _retainedIdx[eqNo];
+}
+// ----------------------------------------------------------------------------
+void StaticCondensation::initializeSolver()
+{
+    _solver->initialize();
+}
+// ----------------------------------------------------------------------------
+void StaticCondensation::insertInterfaceProfileInto( SparseMatrix* spMatrix )
+{
+    // The Schur complement couples all interface equations
+    for ( int rowNum : _interfaceEq )
+        for ( int colNum : _interfaceEq )
+            spMatrix->insertNonzeroComponentAt(rowNum, colNum);
+}
+// ----------------------------------------------------------------------------
+void StaticCondensation::partitionEquationsAt( int stage, int nUnknowns )
+{
+    _nUnknowns = nUnknowns;
+    _isCondensed = false;
+    
+    _domainLabel.clear();
+    for ( const std::string& name : _domainName )
+        _domainLabel.push_back(analysisModel().domainManager().givePhysicalEntityNumberFor(name));
+    
+    // Mark equations reached by cells of condensed and retained domains
+    std::vector<char> reach(nUnknowns, 0);
+    _cell.clear();
+    
+    TimeData time;
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    for ( int i = 0; i < nCells; i++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
+        int label = analysisModel().domainManager().giveLabelOf(curCell);
+        
+        char flag = reachedByRetainedCell;
+        if ( std::find(_domainLabel.begin(), _domainLabel.end(), label) != _domainLabel.end() )
+        {
+            flag = reachedByCondensedCell;
+            _cell.push_back(curCell);
+        }
+        
+        Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+        std::vector<Dof*> rowDof, colDof;
+        std::tie(rowDof,colDof,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, UNASSIGNED, time);
+        
+        for ( int k = 0; k < (int)rowDof.size(); k++ )
+        {
+            if ( rowDof[k] )
+            {
+                int eqNo = analysisModel().dofManager().giveEquationNumberAt(rowDof[k]);
+                if ( eqNo != UNASSIGNED )
+                    reach[eqNo] |= flag;
+            }
+            if ( colDof[k] )
+            {
+                int eqNo = analysisModel().dofManager().giveEquationNumberAt(colDof[k]);
+                if ( eqNo != UNASSIGNED )
+                    reach[eqNo] |= flag;
+            }
+        }
+    }
+    
+    // Number interior, retained and interface equations
+    _retainedIdx.assign(nUnknowns, UNASSIGNED);
+    _interiorIdx.assign(nUnknowns, UNASSIGNED);
+    _interfaceIdx.assign(nUnknowns, UNASSIGNED);
+    _interfaceEq.clear();
+    _nRetained = 0;
+    _nInterior = 0;
+    
+    for ( int i = 0; i < nUnknowns; i++ )
+    {
+        if ( reach[i] == reachedByCondensedCell )
+            _interiorIdx[i] = _nInterior++;
+        else
+        {
+            _retainedIdx[i] = _nRetained++;
+            if ( reach[i] == (reachedByCondensedCell | reachedByRetainedCell) )
+            {
+                _interfaceIdx[i] = _interfaceEq.size();
+                _interfaceEq.push_back(_retainedIdx[i]);
+            }
+        }
+    }
+    
+    // Sparsity profile of interior block
+    if ( _nInterior > 0 )
+    {
+        _interiorMatrix->initializeProfile(_nInterior, _nInterior);
+        _interiorMatrix->setSymmetryTo(_solver->giveSymmetryOption());
+        
+        for ( Cell* curCell : _cell )
+        {
+            Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+            std::vector<Dof*> rowDof, colDof;
+            std::tie(rowDof,colDof,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, UNASSIGNED, time);
+            
+            for ( int k = 0; k < (int)rowDof.size(); k++ )
+            {
+                if ( rowDof[k] && colDof[k] )
+                {
+                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[k]);
+                    int colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[k]);
+                    if ( rowNum != UNASSIGNED && colNum != UNASSIGNED && _interiorIdx[rowNum] != UNASSIGNED && _interiorIdx[colNum] != UNASSIGNED )
+                        _interiorMatrix->insertNonzeroComponentAt(_interiorIdx[rowNum], _interiorIdx[colNum]);
+                }
+            }
+        }
+        _interiorMatrix->finalizeProfile();
+    }
+}
+// ----------------------------------------------------------------------------
+void StaticCondensation::readDataFrom( FILE* fp )
+{
+    std::string src = "StaticCondensation";
+    
+    int nDomains = getIntegerInputFrom(fp, "Failed to read number of condensed domains from input file!", src);
+    _domainName.assign(nDomains, std::string());
+    for ( int i = 0; i < nDomains; i++ )
+        _domainName[i] = getStringInputFrom(fp, "Failed to read label of condensed domain from input file!", src);
+    
+    // Solver for the interior block
+    verifyKeyword(fp, "LinearSolver", src);
+    std::string key = getStringInputFrom(fp, "Failed to read linear solver from input file!", src);
+    _solver = objectFactory().instantiateLinearSolver(key);
+    _solver->readDataFrom(fp);
+    
+    std::string format = _solver->giveRequiredMatrixFormat();
+    if ( format == "MatrixFree" || format == "DistributedCSR" )
+        throw std::runtime_error("ERROR: Matrix format '" + format + "' cannot be used for condensed domains!\nSource: " + src);
+    
+    _interiorMatrix = objectFactory().instantiateSparseMatrix(format);
+    _interiorMatrix->setSymmetryTo(_solver->giveSymmetryOption());
+}
+// ----------------------------------------------------------------------------
+RealVector StaticCondensation::recoverCorrection( const RealVector& dUr )
+{
+    RealVector dU(_nUnknowns);
+    for ( int i = 0; i < _nUnknowns; i++ )
+        if ( _retainedIdx[i] != UNASSIGNED )
+            dU(i) = dUr(_retainedIdx[i]);
+    
+    // Interior corrections: dU_i = inv(K_ii) * (r_i - K_ib * dU_b)
+    if ( _nInterior > 0 )
+    {
+        RealVector rhs(_interiorRhs);
+        for ( int k = 0; k < (int)_ibVal.size(); k++ )
+            rhs(_ibRow[k]) -= _ibVal[k]*dUr(_interfaceEq[_ibCol[k]]);
+        
+        RealVector dUi = this->solveInteriorSystem(rhs);
+        for ( int i = 0; i < _nUnknowns; i++ )
+            if ( _interiorIdx[i] != UNASSIGNED )
+                dU(i) = dUi(_interiorIdx[i]);
+    }
+    
+    return dU;
+}
+// ----------------------------------------------------------------------------
+RealVector StaticCondensation::reduceRightHandSide( const RealVector& resid )
+{
+    // Reduced right hand side: r_b - K_bi * inv(K_ii) * r_i
+    RealVector residR = this->giveRetainedComponentsOf(resid);
+    if ( _nInterior == 0 )
+        return residR;
+    
+    _interiorRhs.init(_nInterior);
+    for ( int i = 0; i < _nUnknowns; i++ )
+        if ( _interiorIdx[i] != UNASSIGNED )
+            _interiorRhs(_interiorIdx[i]) = resid(i);
+    
+    RealVector rhs(_interiorRhs);
+    RealVector y = this->solveInteriorSystem(rhs);
+    for ( int k = 0; k < (int)_biVal.size(); k++ )
+        residR(_interfaceEq[_biRow[k]]) -= _biVal[k]*y(_biCol[k]);
+    
+    return residR;
+}
+
+// Private methods
+// ----------------------------------------------------------------------------
+RealVector StaticCondensation::solveInteriorSystem( RealVector& rhs )
+{
+    if ( _solver->retainsFactorization() )
+        return _solver->backSubstitute(_interiorMatrix, rhs);
+    else
+        return _solver->solve(_interiorMatrix, rhs);
+}
@@ -0,0 +1,121 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef STATICCONDENSATION_HPP
+#define STATICCONDENSATION_HPP
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "TimeData.hpp"
+#include "Util/RealMatrix.hpp"
+#include "Util/RealVector.hpp"
+
+namespace broomstyx
+{
+    class Cell;
+    class LinearSolver;
+    class SparseMatrix;
+    
+    // Static condensation of domains whose coefficient matrices stay constant
+    // throughout the analysis, such as regions that remain linear elastic.
+    // Equations reached only by cells of these domains (interior equations)
+    // are eliminated from the system. All other equations are retained and
+    // renumbered consecutively. Interface equations are retained equations
+    // that are also reached by cells of the condensed domains. The interior
+    // block is factorized once, and its effect on the interface equations is
+    // formed as the dense Schur complement
+    //
+    //     S = K_bb - K_bi * inv(K_ii) * K_ib
+    //
+    // which is added to the coefficient matrix assembled from the remaining
+    // cells. After the retained system is solved, interior corrections are
+    // recovered by back-substitution.
+    class StaticCondensation
+    {
+    public:
+        StaticCondensation();
+        virtual ~StaticCondensation();
+        
+        // Disable copy constructor and assignment operator
+        StaticCondensation( const StaticCondensation& ) = delete;
+        StaticCondensation& operator=( const StaticCondensation& ) = delete;
+        
+        void       addSchurComplementTo( SparseMatrix* spMatrix );
+        void       condenseAt( int stage, const TimeData& time );
+        int        giveNumberOfInterfaceEquations();
+        int        giveNumberOfInteriorEquations();
+        int        giveNumberOfRetainedEquations();
+        std::vector<Cell*> 
+                   giveRetainedCellsOf( const std::vector<Cell*>& cell );
+        RealVector giveRetainedComponentsOf( const RealVector& vec );
+        int        giveRetainedEquationFor( int eqNo );
+        void       initializeSolver();
+        void       insertInterfaceProfileInto( SparseMatrix* spMatrix );
+        void       partitionEquationsAt( int stage, int nUnknowns );
+        void       readDataFrom( FILE* fp );
+        RealVector recoverCorrection( const RealVector& dUr );
+        RealVector reduceRightHandSide( const RealVector& resid );
+        
+    private:
+        std::vector<std::string> _domainName;
+        std::vector<int>         _domainLabel;
+        LinearSolver* _solver;
+        SparseMatrix* _interiorMatrix;
+        bool          _isCondensed;
+        
+        // Cells of the condensed domains at the current stage
+        std::vector<Cell*> _cell;
+        
+        // Retained, interior and interface index of each equation, or
+        // UNASSIGNED
+        int _nUnknowns;
+        int _nRetained;
+        int _nInterior;
+        std::vector<int> _retainedIdx;
+        std::vector<int> _interiorIdx;
+        std::vector<int> _interfaceIdx;
+        
+        // Retained equation number of each interface equation
+        std::vector<int> _interfaceEq;
+        
+        // Coupling blocks K_ib and K_bi as lists of components with their
+        // interior and interface indices
+        std::vector<int>    _ibRow;
+        std::vector<int>    _ibCol;
+        std::vector<double> _ibVal;
+        std::vector<int>    _biRow;
+        std::vector<int>    _biCol;
+        std::vector<double> _biVal;
+        
+        // Schur complement on interface equations
+        RealMatrix _schur;
+        
+        // Interior part of the last reduced right hand side
+        RealVector _interiorRhs;
+        
+        RealVector solveInteriorSystem( RealVector& rhs );
+    };
+}
+
+#endif /* STATICCONDENSATION_HPP */
@@ -0,0 +1,302 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "ConjugateGradient.hpp"
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <tuple>
+#include "Core/Communicator.hpp"
+#include "Core/ObjectFactory.hpp"
+#include "SparseMatrix/SparseMatrix.hpp"
+#include "Util/readOperations.hpp"
+
+using namespace broomstyx;
+
+registerBroomstyxObject(LinearSolver, ConjugateGradient)
+
+// Constructor
+ConjugateGradient::ConjugateGradient()
+    : LinearSolver()
+    , _tol(1.e-8)
+    , _maxIter(1000)
+    , _chebyshevDegree(0)
+    , _nPowerIter(10)
+    , _lambdaMin(0.)
+    , _lambdaMax(0.)
+    , _rowBegin(0)
+    , _rowEnd(0)
+{}
+
+// Destructor
+ConjugateGradient::~ConjugateGradient() {}
+
+// Public methods
+// ----------------------------------------------------------------------------
+std::string ConjugateGradient::giveRequiredMatrixFormat()
+{
+    return _format;
+}
+// ----------------------------------------------------------------------------
+void ConjugateGradient::readDataFrom( FILE* fp )
+{
+    std::string src = "ConjugateGradient (LinearSolver)";
+    
+    verifyKeyword(fp, "Format", src);
+    _format = getStringInputFrom(fp, "Failed to read sparse matrix format for linear solver from input file!", src);
+    if ( _format != "CSR0" && _format != "CSR1" && _format != "MatrixFree" && _format != "DistributedCSR" )
+        throw std::runtime_error("Invalid sparse matrix format '" + _format + "' encountered while reading input file!\nSource: " + src);
+    
+    _tol = getRealInputFrom(fp, "Failed to read relative tolerance for iterative linear solver from input file!", src);
+    _maxIter = getIntegerInputFrom(fp, "Failed to read max. iterations for iterative linear solver from input file!", src);
+    
+    verifyKeyword(fp, "Preconditioner", src);
+    _preconditioner = getStringInputFrom(fp, "Failed to read preconditioner for linear solver from input file!", src);
+    
+    if ( _preconditioner == "Chebyshev" )
+    {
+        _chebyshevDegree = getIntegerInputFrom(fp, "Failed to read polynomial degree for preconditioner Chebyshev from input file!", src);
+        if ( _chebyshevDegree < 1 )
+            throw std::runtime_error("Polynomial degree for preconditioner Chebyshev must be at least 1!\nSource: " + src);
+    }
+    else if ( _preconditioner == "Jacobi" || _preconditioner == "none" )
+    {
+        // Do nothing.
+    }
+    else
+    {
+        std::string errMsg = "Invalid preconditioner tag '" + _preconditioner + "' encountered while reading input file!\nSource: " + src;
+        throw std::runtime_error(errMsg);
+    }
+}
+// ----------------------------------------------------------------------------
+void ConjugateGradient::setInitialGuessTo( RealVector& initGuess )
+{
+    _initGuess = initGuess;
+}
+// ----------------------------------------------------------------------------
+RealVector ConjugateGradient::solve( SparseMatrix* coefMat, RealVector& rhs )
+{
+    int n = rhs.dim();
+    
+    // Only rows owned by the current process are updated when the
+    // coefficient matrix is distributed over processes
+    std::tie(_rowBegin, _rowEnd) = coefMat->giveOwnedRowRange();
+    
+    RealVector x(n);
+    if ( _initGuess.dim() == n )
+        for ( int i = _rowBegin; i < _rowEnd; i++ )
+            x(i) = _initGuess(i);
+    
+    double rhsNorm = std::sqrt(this->giveDotProductOf(rhs, rhs));
+    if ( rhsNorm == 0. )
+        return x;
+    
+    this->setupPreconditionerFor(coefMat);
+    
+    // Initial residual
+    RealVector r = coefMat->times(x);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = _rowBegin; i < _rowEnd; i++ )
+        r(i) = rhs(i) - r(i);
+    
+    RealVector z = this->applyPreconditionerTo(coefMat, r);
+    RealVector p = z;
+    double rz = this->giveDotProductOf(r, z);
+    double relRes = std::sqrt(this->giveDotProductOf(r, r))/rhsNorm;
+    
+    int iter = 0;
+    while ( relRes > _tol && iter < _maxIter )
+    {
+        RealVector q = coefMat->times(p);
+        double alpha = rz/this->giveDotProductOf(p, q);
+        
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for ( int i = _rowBegin; i < _rowEnd; i++ )
+        {
+            x(i) += alpha*p(i);
+            r(i) -= alpha*q(i);
+        }
+        
+        relRes = std::sqrt(this->giveDotProductOf(r, r))/rhsNorm;
+        ++iter;
+        if ( relRes <= _tol )
+            break;
+        
+        z = this->applyPreconditionerTo(coefMat, r);
+        double rzNew = this->giveDotProductOf(r, z);
+        double beta = rzNew/rz;
+        rz = rzNew;
+        
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for ( int i = _rowBegin; i < _rowEnd; i++ )
+            p(i) = z(i) + beta*p(i);
+    }
+    
+    std::printf("\n      Num iters = %d, rel. residual = %e\n", iter, relRes);
+    if ( relRes > _tol )
+        std::printf("      WARNING: Conjugate gradient solver did not converge within %d iterations!\n", _maxIter);
+    std::printf("    %-40s", "");
+    
+    return x;
+}
+// ----------------------------------------------------------------------------
+bool ConjugateGradient::takesInitialGuess()
+{
+    return true;
+}
+
+// Private methods
+// ----------------------------------------------------------------------------
+RealVector ConjugateGradient::applyPreconditionerTo( SparseMatrix* coefMat, const RealVector& r )
+{
+    int n = r.dim();
+    RealVector z(n);
+    
+    if ( _preconditioner == "none" )
+        z = r;
+    else if ( _preconditioner == "Jacobi" )
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for ( int i = _rowBegin; i < _rowEnd; i++ )
+            z(i) = _invDiag(i)*r(i);
+    }
+    else
+    {
+        // Chebyshev iteration on the Jacobi-scaled system D^(-1)*A*z = D^(-1)*r
+        // starting from z = 0. For a fixed number of iterations this is a
+        // fixed polynomial in D^(-1)*A, hence a valid preconditioner for CG.
+        double theta = 0.5*(_lambdaMax + _lambdaMin);
+        double delta = 0.5*(_lambdaMax - _lambdaMin);
+        double sigma = theta/delta;
+        double rho = 1./sigma;
+        
+        RealVector res(n), d(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for ( int i = _rowBegin; i < _rowEnd; i++ )
+        {
+            res(i) = _invDiag(i)*r(i);
+            d(i) = res(i)/theta;
+        }
+        
+        for ( int k = 0; k < _chebyshevDegree; k++ )
+        {
+            z += d;
+            if ( k == _chebyshevDegree - 1 )
+                break;
+            
+            RealVector Ad = coefMat->times(d);
+            double rhoNew = 1./(2.*sigma - rho);
+            
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for ( int i = _rowBegin; i < _rowEnd; i++ )
+            {
+                res(i) -= _invDiag(i)*Ad(i);
+                d(i) = rhoNew*rho*d(i) + 2.*rhoNew/delta*res(i);
+            }
+            rho = rhoNew;
+        }
+    }
+    
+    return z;
+}
+// ----------------------------------------------------------------------------
+double ConjugateGradient::estimateLargestEigenvalueFor( SparseMatrix* coefMat )
+{
+    // Power iteration on D^(-1)*A
+    int n = _invDiag.dim();
+    RealVector v(n);
+    for ( int i = _rowBegin; i < _rowEnd; i++ )
+        v(i) = 1. + (double)(i%7)/7.;
+    v /= std::sqrt(this->giveDotProductOf(v, v));
+    
+    double lambda = 0.;
+    for ( int k = 0; k < _nPowerIter; k++ )
+    {
+        RealVector w = coefMat->times(v);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for ( int i = _rowBegin; i < _rowEnd; i++ )
+            w(i) *= _invDiag(i);
+        
+        lambda = std::sqrt(this->giveDotProductOf(w, w));
+        if ( lambda == 0. )
+            break;
+        
+        w /= lambda;
+        v = std::move(w);
+    }
+    
+    return lambda;
+}
+// ----------------------------------------------------------------------------
+double ConjugateGradient::giveDotProductOf( const RealVector& a, const RealVector& b )
+{
+    double sum = 0.;
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+:sum)
+#endif
+    for ( int i = _rowBegin; i < _rowEnd; i++ )
+        sum += a(i)*b(i);
+    
+    return communicator().sumOverProcesses(sum);
+}
+// ----------------------------------------------------------------------------
+void ConjugateGradient::setupPreconditionerFor( SparseMatrix* coefMat )
+{
+    if ( _preconditioner == "none" )
+        return;
+    
+    // Diagonal of coefficient matrix (assembled from cell contributions when
+    // the coefficient matrix is not stored)
+    _invDiag = coefMat->giveDiagonal();
+    for ( int i = _rowBegin; i < _rowEnd; i++ )
+    {
+        if ( _invDiag(i) <= 0. )
+            throw std::runtime_error("Encountered non-positive diagonal component (row " + std::to_string(i) 
+                    + ") in coefficient matrix!\nSource: ConjugateGradient (LinearSolver)");
+        _invDiag(i) = 1./_invDiag(i);
+    }
+    
+    if ( _preconditioner == "Chebyshev" )
+    {
+        // Bound largest eigenvalue from above and target the upper part of
+        // the spectrum, leaving the smallest eigenvalues to CG.
+        _lambdaMax = 1.1*this->estimateLargestEigenvalueFor(coefMat);
+        _lambdaMin = _lambdaMax/30.;
+    }
+}
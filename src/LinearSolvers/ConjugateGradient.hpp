@@ -0,0 +1,74 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef CONJUGATEGRADIENT_HPP
+#define CONJUGATEGRADIENT_HPP
+
+#include "LinearSolver.hpp"
+#include <string>
+#include "Util/RealVector.hpp"
+
+namespace broomstyx
+{
+    // Preconditioned conjugate gradient solver for symmetric positive
+    // definite systems. Only matrix-vector products and the diagonal of the
+    // coefficient matrix are used, so the solver also works with operators
+    // that do not store their components (format 'MatrixFree') and with
+    // matrices whose rows are distributed over processes ('DistributedCSR').
+    class ConjugateGradient : public LinearSolver
+    {
+    public:
+        ConjugateGradient();
+        virtual ~ConjugateGradient();
+        
+        std::string giveRequiredMatrixFormat() override;
+        void        readDataFrom( FILE* fp ) override;
+        void        setInitialGuessTo( RealVector& initGuess ) override;
+        RealVector  solve( SparseMatrix* coefMat, RealVector& rhs ) override;
+        bool        takesInitialGuess() override;
+        
+    private:
+        std::string _format;
+        double      _tol;
+        int         _maxIter;
+        std::string _preconditioner;
+        int         _chebyshevDegree;
+        int         _nPowerIter;
+        
+        RealVector  _initGuess;
+        RealVector  _invDiag;
+        double      _lambdaMin;
+        double      _lambdaMax;
+        
+        // Range of rows owned by the current process
+        int         _rowBegin;
+        int         _rowEnd;
+        
+        RealVector applyPreconditionerTo( SparseMatrix* coefMat, const RealVector& r );
+        double     estimateLargestEigenvalueFor( SparseMatrix* coefMat );
+        double     giveDotProductOf( const RealVector& a, const RealVector& b );
+        void       setupPreconditionerFor( SparseMatrix* coefMat );
+    };
+}
+
+#endif /* CONJUGATEGRADIENT_HPP */
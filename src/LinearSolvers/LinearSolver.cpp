@@ -22,6 +22,10 @@
 */
 
 #include "LinearSolver.hpp"
+#include <algorithm>
+#include <cmath>
+#include "SparseMatrix/SparseMatrix.hpp"
+#include "Util/RealMatrix.hpp"
 #include "Util/RealVector.hpp"
 
 using namespace broomstyx;
@@ -52,9 +56,87 @@ void LinearSolver::initialize() {}
 // ----------------------------------------------------------------------------
 void LinearSolver::clearInternalMemory() {}
 // ----------------------------------------------------------------------------
+bool LinearSolver::retainsFactorization()
+{
+    // True for solvers whose factorize(...) keeps a factorization that is
+    // applied to any number of right hand sides by backSubstitute(...)
+    return false;
+}
+// ----------------------------------------------------------------------------
 void LinearSolver::setInitialGuessTo( RealVector& initGuess ) {}
 // ----------------------------------------------------------------------------
+RealMatrix LinearSolver::solveForMultipleRhs( SparseMatrix* coefMat, RealMatrix& rhs )
+{
+    // Default implementation solves for each column of the right hand side
+    // separately. Direct solvers should override this so that a single
+    // factorization is shared by all right hand sides.
+    
+    int n = rhs.dim1();
+    int nrhs = rhs.dim2();
+    RealMatrix u(n, nrhs);
+    
+    for ( int k = 0; k < nrhs; k++ )
+    {
+        RealVector b(n), x;
+        std::copy(rhs.ptr() + k*n, rhs.ptr() + (k + 1)*n, b.ptr());
+        x = this->solve(coefMat, b);
+        std::copy(x.ptr(), x.ptr() + n, u.ptr() + k*n);
+    }
+    
+    return u;
+}
+// ----------------------------------------------------------------------------
 bool LinearSolver::takesInitialGuess()
 {
     return false;
-}
\ No newline at end of file
+}
+
+// Protected methods
+// ----------------------------------------------------------------------------
+bool LinearSolver::refineSolution( SparseMatrix*                                   coefMat
+                                 , RealVector&                                     rhs
+                                 , RealVector&                                     x
+                                 , const std::function< RealVector( RealVector& ) >& correct
+                                 , int                                             maxSteps
+                                 , double                                          tol
+                                 , int&                                            nSteps
+                                 , double&                                         relRes )
+{
+    int n = rhs.dim();
+    double rhsNorm = 0.;
+    for ( int i = 0; i < n; i++ )
+        rhsNorm += rhs(i)*rhs(i);
+    rhsNorm = std::sqrt(rhsNorm);
+    
+    nSteps = 0;
+    relRes = 0.;
+    if ( rhsNorm == 0. )
+        return true;
+    
+    double prevRelRes = 0.;
+    RealVector r(n);
+    while ( true )
+    {
+        // Residual in double precision
+        RealVector Ax = coefMat->times(x);
+        double resNorm = 0.;
+        for ( int i = 0; i < n; i++ )
+        {
+            r(i) = rhs(i) - Ax(i);
+            resNorm += r(i)*r(i);
+        }
+        relRes = std::sqrt(resNorm)/rhsNorm;
+        
+        if ( relRes <= tol )
+            return true;
+        
+        // Refinement is considered to have stagnated if the residual is not
+        // at least halved by a correction step
+        if ( nSteps == maxSteps || (nSteps > 0 && relRes > 0.5*prevRelRes) )
+            return false;
+        
+        x += correct(r);
+        prevRelRes = relRes;
+        ++nSteps;
+    }
+}
@@ -25,10 +25,12 @@
 #define	LINEARSOLVER_HPP
 
 #include <cstdio>
+#include <functional>
 #include <string>
 
 namespace broomstyx
 {
+    class RealMatrix;
     class RealVector;
     class SparseMatrix;
 
@@ -48,12 +50,29 @@ namespace broomstyx
         virtual bool giveSymmetryOption();
         virtual void initialize();
         virtual void clearInternalMemory();
+        virtual bool retainsFactorization();
         virtual void setInitialGuessTo( RealVector& initGuess );
+        virtual RealMatrix solveForMultipleRhs( SparseMatrix* coefMat, RealMatrix& rhs );
         virtual bool takesInitialGuess();
         
         virtual std::string giveRequiredMatrixFormat() = 0;
         virtual void        readDataFrom( FILE* fp ) = 0;
         virtual RealVector  solve( SparseMatrix* coefMat, RealVector& rhs ) = 0;
+        
+    protected:
+        // Iterative refinement of the solution 'x' of A*x = rhs, where
+        // 'correct' gives an approximate solution of A*d = r (e.g. from a
+        // factorization in reduced precision). Residuals are evaluated in
+        // double precision from the coefficient matrix. Returns false if
+        // refinement stagnates before the tolerance is reached.
+        bool refineSolution( SparseMatrix*                                   coefMat
+                           , RealVector&                                     rhs
+                           , RealVector&                                     x
+                           , const std::function< RealVector( RealVector& ) >& correct
+                           , int                                             maxSteps
+                           , double                                          tol
+                           , int&                                            nSteps
+                           , double&                                         relRes );
     };
 }
 
@@ -25,6 +25,8 @@
 
 #ifdef HAVE_MKL
 
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
@@ -34,6 +36,7 @@
 
 #include "Core/ObjectFactory.hpp"
 #include "SparseMatrix/SparseMatrix.hpp"
+#include "Util/RealMatrix.hpp"
 #include "Util/RealVector.hpp"
 #include "Util/readOperations.hpp"
 #include "mkl.h"
@@ -51,6 +54,11 @@ MKL_Pardiso::MKL_Pardiso() : LinearSolver()
     _memoryIsAllocated = false;
     _mtype = 0;
     _symmetry = false;
+    _mixedPrecision = false;
+    _singlePrecisionActive = false;
+    _maxRefinementSteps = 10;
+    _refinementTol = 1.e-12;
+    _factorizationTime = 0.;
     
     for ( int i = 0; i < 64; i++ )
     {
@@ -90,6 +98,14 @@ void MKL_Pardiso::allocateInternalMemoryFor( SparseMatrix* coefMat )
         std::tie(ia, ja) = coefMat->giveProfileArrays();
         double* a = coefMat->giveValArray();
         
+        // Values are passed in the precision of the factorization
+        void* aVal = a;
+        if ( _singlePrecisionActive )
+        {
+            this->convertValuesToSinglePrecision(coefMat);
+            aVal = _aSingle.data();
+        }
+        
         double ddum;
         
         // ******************************************************************
@@ -100,7 +116,7 @@ void MKL_Pardiso::allocateInternalMemoryFor( SparseMatrix* coefMat )
         int error = 0;
         int phase = 11;
 
-        pardiso (_pt, &_maxfct, &_mnum, &_mtype, &phase, &dim1, a, ia, ja, &idum, &_nrhs, _iparm, &_msglvl, &ddum, &ddum, &error);
+        pardiso (_pt, &_maxfct, &_mnum, &_mtype, &phase, &dim1, aVal, ia, ja, &idum, &_nrhs, _iparm, &_msglvl, &ddum, &ddum, &error);
         if ( error != 0 )
         {
             std::printf("\nError during symbolic factorization.\n");
@@ -111,6 +127,41 @@ void MKL_Pardiso::allocateInternalMemoryFor( SparseMatrix* coefMat )
     }
 }
 // ----------------------------------------------------------------------------
+RealVector MKL_Pardiso::backSubstitute( SparseMatrix* coefMat, RealVector& rhs )
+{
+    // Solution using the factorization kept from the last call to
+    // factorize(...)
+    if ( !_memoryIsAllocated )
+        throw std::runtime_error("MKL Pardiso back-substitution called without proper memory allocation!");
+    
+    int dim1, dim2;
+    std::tie(dim1,dim2) = coefMat->giveMatrixDimensions();
+    if ( dim1 != rhs.dim() )
+    {
+        std::printf("\nCannot solve specified linear system!");
+        std::printf("\n\tSparse coefficient matrix has dimensions [ %d x %d ]", dim1, dim2);
+        std::printf("\n\tRHS vector has dimension [ %d ]\n", rhs.dim());
+
+        throw std::runtime_error("Source: Pardiso");
+    }
+    _n = dim1;
+    
+    RealVector u(_n);
+    
+    int* ia;
+    int* ja;
+    std::tie(ia,ja) = coefMat->giveProfileArrays();
+    double* a = coefMat->giveValArray();
+    
+    int idum;
+    int error = 0;
+    int phase = 33;
+    pardiso(_pt, &_maxfct, &_mnum, &_mtype, &phase, &_n, a, ia, ja, &idum, &_nrhs, _iparm, &_msglvl, rhs.ptr(), u.ptr(), &error);
+    this->giveErrorMessage(error);
+    
+    return u;
+}
+// ----------------------------------------------------------------------------
 void MKL_Pardiso::clearInternalMemory()
 {
     if ( _memoryIsAllocated )
@@ -127,6 +178,38 @@ void MKL_Pardiso::clearInternalMemory()
     }
 }
 // ----------------------------------------------------------------------------
+void MKL_Pardiso::factorize( SparseMatrix* coefMat )
+{
+#ifdef _OPENMP
+    int error = mkl_domain_set_num_threads(_nThreads, MKL_DOMAIN_PARDISO);
+#else
+    int error = mkl_domain_set_num_threads(1, MKL_DOMAIN_PARDISO);
+#endif
+    if ( error == 0 )
+        throw std::runtime_error("ERROR: Failed to set specified number of threads for MKL Pardiso!\n");
+
+    if ( !_memoryIsAllocated )
+        throw std::runtime_error("MKL Pardiso factorization called without proper memory allocation!");
+    
+    int dim1, dim2;
+    std::tie(dim1,dim2) = coefMat->giveMatrixDimensions();
+    _n = dim1;
+    
+    int* ia;
+    int* ja;
+    std::tie(ia,ja) = coefMat->giveProfileArrays();
+    double* a = coefMat->giveValArray();
+    
+    // Numerical factorization only, reusing the symbolic factorization from
+    // allocateInternalMemoryFor(...)
+    int idum;
+    double ddum;
+    error = 0;
+    int phase = 22;
+    pardiso(_pt, &_maxfct, &_mnum, &_mtype, &phase, &_n, a, ia, ja, &idum, &_nrhs, _iparm, &_msglvl, &ddum, &ddum, &error);
+    this->giveErrorMessage(error);
+}
+// ----------------------------------------------------------------------------
 void MKL_Pardiso::initialize()
 {
     // *********************************************************************
@@ -179,6 +262,18 @@ void MKL_Pardiso::initialize()
     _iparm[34] = 0; // Use Fortran-style indexing in the sparse matrix profile
     
     pardisoinit(_pt, &_mtype, _iparm);
+    
+    // Single precision factorization. Refinement is then performed here
+    // with residuals evaluated in double precision, so the internal
+    // refinement of Pardiso is switched off.
+    _singlePrecisionActive = _mixedPrecision;
+    if ( _singlePrecisionActive )
+    {
+        _iparm[0] = 1;
+        _iparm[7] = 0;
+        _iparm[17] = -1; // Report number of nonzeros in factors
+        _iparm[27] = 1;
+    }
 }
 // ----------------------------------------------------------------------------
 std::string MKL_Pardiso::giveRequiredMatrixFormat()
@@ -195,7 +290,27 @@ void MKL_Pardiso::readDataFrom( FILE* fp )
 {
     std::string key, errmsg, src = "Pardiso (LinearSolver)";
 
-    verifyKeyword(fp, key = "nThreads", src);
+    // Optional precision setting
+    key = getStringInputFrom(fp, "Failed to read input for Pardiso solver from input file!", src);
+    if ( key == "Precision" )
+    {
+        key = getStringInputFrom(fp, "Failed to read precision option for Pardiso solver from input file!", src);
+        if ( key == "Mixed" )
+        {
+            _mixedPrecision = true;
+            _refinementTol = getRealInputFrom(fp, "Failed to read relative tolerance for iterative refinement from input file!", src);
+            _maxRefinementSteps = getIntegerInputFrom(fp, "Failed to read max. iterative refinement steps from input file!", src);
+        }
+        else if ( key == "Double" )
+            _mixedPrecision = false;
+        else
+            throw std::runtime_error("Unrecognized precision option '" + key + "' for Pardiso solver encountered in input file!");
+        
+        key = getStringInputFrom(fp, "Failed to read input for Pardiso solver from input file!", src);
+    }
+    
+    if ( key != "nThreads" )
+        throw std::runtime_error("Keyword 'nThreads' expected in input file,\n\tstring '" + key + "' found.\nError source: " + src);
     _nThreads = getIntegerInputFrom(fp, errmsg = "Failed to read number of threads for Pardiso solver in input file!", src);
     
     key = getStringInputFrom(fp, "Failed to read symmetry option in input file!", src);
@@ -214,6 +329,13 @@ void MKL_Pardiso::readDataFrom( FILE* fp )
         _symmetry = true;
 }
 // ----------------------------------------------------------------------------
+bool MKL_Pardiso::retainsFactorization()
+{
+    // Factorizations in reduced precision are only used through iterative
+    // refinement in solve(...)
+    return !_mixedPrecision;
+}
+// ----------------------------------------------------------------------------
 RealVector MKL_Pardiso::solve( SparseMatrix* coefMat, RealVector& rhs )
 {
     // Reset number of threads for Pardiso
@@ -244,6 +366,15 @@ RealVector MKL_Pardiso::solve( SparseMatrix* coefMat, RealVector& rhs )
     
     // Initialize solution vector
     RealVector u(_n);
+    
+    if ( _singlePrecisionActive )
+    {
+        if ( this->solveInMixedPrecision(coefMat, rhs, u) )
+            return u;
+        
+        this->switchToDoublePrecisionFor(coefMat);
+        u.init(_n);
+    }
 
     // Matrix Data
     int* ia;
@@ -298,8 +429,183 @@ RealVector MKL_Pardiso::solve( SparseMatrix* coefMat, RealVector& rhs )
 
     return u;
 }
+// ----------------------------------------------------------------------------
+RealMatrix MKL_Pardiso::solveForMultipleRhs( SparseMatrix* coefMat, RealMatrix& rhs )
+{
+    // Reset number of threads for Pardiso
+#ifdef _OPENMP
+    int error = mkl_domain_set_num_threads(_nThreads, MKL_DOMAIN_PARDISO);
+#else
+    int error = mkl_domain_set_num_threads(1, MKL_DOMAIN_PARDISO);
+#endif
+    if ( error == 0 )
+        throw std::runtime_error("ERROR: Failed to set specified number of threads for MKL Pardiso!\n");
+
+    if ( !_memoryIsAllocated )
+        throw std::runtime_error("MKL Pardiso solve phase called without proper memory allocation!");
+    
+    int dim1, dim2;
+    std::tie(dim1,dim2) = coefMat->giveMatrixDimensions();
+
+    // Check that sparse matrix and RHS vectors have compatible dimensions
+    if ( dim1 != rhs.dim1() )
+    {
+        std::printf("\nCannot solve specified linear system!");
+        std::printf("\n\tSparse coefficient matrix has dimensions [ %d x %d ]", dim1, dim2);
+        std::printf("\n\tRHS matrix has dimensions [ %d x %d ]\n", rhs.dim1(), rhs.dim2());
+
+        throw std::runtime_error("Source: Pardiso");
+    }
+    _n = dim1;
+    
+    // Right hand sides are stored column-wise, as expected by Pardiso
+    int nrhs = rhs.dim2();
+    RealMatrix u(_n, nrhs);
+    
+    if ( _singlePrecisionActive )
+    {
+        // Single factorization shared by all right hand sides, each of which
+        // is refined separately
+        bool success = this->factorizeInSinglePrecision(coefMat);
+        for ( int k = 0; k < nrhs && success; k++ )
+        {
+            RealVector b(_n), x(_n);
+            std::copy(rhs.ptr() + (long)k*_n, rhs.ptr() + (long)(k + 1)*_n, b.ptr());
+            
+            int nSteps;
+            double relRes;
+            auto correct = [ this, coefMat ]( RealVector& r ) { return this->correctInSinglePrecision(coefMat, r); };
+            success = this->refineSolution(coefMat, b, x, correct, _maxRefinementSteps, _refinementTol, nSteps, relRes);
+            std::copy(x.ptr(), x.ptr() + _n, u.ptr() + (long)k*_n);
+        }
+        
+        if ( success )
+            return u;
+        
+        this->switchToDoublePrecisionFor(coefMat);
+    }
+
+    // Matrix Data
+    int* ia;
+    int* ja;
+    double* a;
+
+    std::tie(ia,ja) = coefMat->giveProfileArrays();
+    a  = coefMat->giveValArray();
+
+    double *b, *x;
+    b = rhs.ptr();
+    x = u.ptr();
+
+    // ***********************************************************************
+    // Numerical factorization followed by back-substitution and iterative
+    // refinement for all right hand sides at once
+    // ***********************************************************************
+
+    int idum;
+    int phase;
+    if ( SKIP_SYMBOLIC_FACTORIZATION )
+        phase = 23;
+    else
+        phase = 13;
+
+    error = 0;
+    pardiso(_pt, &_maxfct, &_mnum, &_mtype, &phase, &_n, a, ia, ja, &idum, &nrhs, _iparm, &_msglvl, b, x, &error);
+    
+    if ( error != 0 )
+    {
+        // In case of error, matrix is reanalyzed and one more attempt at solution is made
+        error = 0;
+        phase = -1;
+        pardiso(_pt, &_maxfct, &_mnum, &_mtype, &phase, &_n, a, ia, ja, &idum, &nrhs, _iparm, &_msglvl, b, x, &error);
+        this->giveErrorMessage(error);
+        
+        error = 0;
+        phase = 13;
+        pardiso(_pt, &_maxfct, &_mnum, &_mtype, &phase, &_n, a, ia, ja, &idum, &nrhs, _iparm, &_msglvl, b, x, &error);
+        this->giveErrorMessage(error);
+    }
+
+    return u;
+}
 
 // Private methods
+// ----------------------------------------------------------------------------
+RealVector MKL_Pardiso::correctInSinglePrecision( SparseMatrix* coefMat, RealVector& resid )
+{
+    int* ia;
+    int* ja;
+    std::tie(ia,ja) = coefMat->giveProfileArrays();
+    
+    std::vector<float> b(_n), x(_n);
+    for ( int i = 0; i < _n; i++ )
+        b[i] = (float)resid(i);
+    
+    int idum;
+    int error = 0;
+    int phase = 33;
+    pardiso(_pt, &_maxfct, &_mnum, &_mtype, &phase, &_n, _aSingle.data(), ia, ja, &idum, &_nrhs, _iparm, &_msglvl, b.data(), x.data(), &error);
+    this->giveErrorMessage(error);
+    
+    RealVector d(_n);
+    for ( int i = 0; i < _n; i++ )
+        d(i) = x[i];
+    
+    return d;
+}
+// ----------------------------------------------------------------------------
+void MKL_Pardiso::convertValuesToSinglePrecision( SparseMatrix* coefMat )
+{
+    int nnz = coefMat->giveNumberOfNonzeros();
+    double* a = coefMat->giveValArray();
+    
+    _aSingle.resize(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < nnz; i++ )
+        _aSingle[i] = (float)a[i];
+}
+// ----------------------------------------------------------------------------
+bool MKL_Pardiso::factorizeInSinglePrecision( SparseMatrix* coefMat )
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    tic = std::chrono::high_resolution_clock::now();
+    
+    this->convertValuesToSinglePrecision(coefMat);
+    
+    int* ia;
+    int* ja;
+    std::tie(ia,ja) = coefMat->giveProfileArrays();
+    
+    double ddum;
+    int idum;
+    int error = 0;
+    int phase = 22;
+    pardiso(_pt, &_maxfct, &_mnum, &_mtype, &phase, &_n, _aSingle.data(), ia, ja, &idum, &_nrhs, _iparm, &_msglvl, &ddum, &ddum, &error);
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    _factorizationTime = tictoc.count();
+    
+    if ( error != 0 )
+    {
+        std::printf("\n      Single precision factorization failed (error %d).", error);
+        return false;
+    }
+    
+    // Factor values are stored in 4 instead of 8 bytes (iparm[17] reports
+    // the number of nonzeros in the factors)
+    double nnzFactors = (double)std::abs(_iparm[17]);
+    double factorMemory = nnzFactors*sizeof(float)/1048576.;
+    double savedMemory = nnzFactors*(sizeof(double) - sizeof(float))/1048576.;
+    std::printf("\n      Single precision factors: %.0f nonzeros, %.1f MB (%.1f MB less than in double precision)", 
+            nnzFactors, factorMemory, savedMemory);
+    
+    return true;
+}
+// ----------------------------------------------------------------------------
 void MKL_Pardiso::giveErrorMessage( int error )
 {
     std::string msg;
@@ -339,4 +645,46 @@ void MKL_Pardiso::giveErrorMessage( int error )
     }
 }
 
+// ----------------------------------------------------------------------------
+bool MKL_Pardiso::solveInMixedPrecision( SparseMatrix* coefMat, RealVector& rhs, RealVector& u )
+{
+    if ( !this->factorizeInSinglePrecision(coefMat) )
+        return false;
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    tic = std::chrono::high_resolution_clock::now();
+    
+    int nSteps;
+    double relRes;
+    auto correct = [ this, coefMat ]( RealVector& r ) { return this->correctInSinglePrecision(coefMat, r); };
+    bool success = this->refineSolution(coefMat, rhs, u, correct, _maxRefinementSteps, _refinementTol, nSteps, relRes);
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("\n      Refinement: %d steps, rel. residual = %e", nSteps, relRes);
+    std::printf("\n      Mixed precision time: factorization = %f sec., refinement = %f sec., total = %f sec.\n", 
+            _factorizationTime, tictoc.count(), _factorizationTime + tictoc.count());
+    std::printf("    %-40s", "");
+    
+    return success;
+}
+// ----------------------------------------------------------------------------
+void MKL_Pardiso::switchToDoublePrecisionFor( SparseMatrix* coefMat )
+{
+    std::printf("\n      Iterative refinement stagnated. Switching to double precision factorization.\n");
+    std::printf("    %-40s", "");
+    
+    // Factorization is redone in double precision starting from the
+    // reordering phase, and is used for all subsequent solves
+    this->clearInternalMemory();
+    _singlePrecisionActive = false;
+    _iparm[7] = 2;
+    _iparm[27] = 0;
+    _aSingle.clear();
+    _aSingle.shrink_to_fit();
+    
+    this->allocateInternalMemoryFor(coefMat);
+}
+
 #endif
\ No newline at end of file
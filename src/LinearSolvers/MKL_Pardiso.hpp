@@ -29,6 +29,7 @@
 #ifdef HAVE_MKL
 
 #include "LinearSolver.hpp"
+#include <vector>
 #include "mkl_pardiso.h"
 #include "mkl_types.h"
 
@@ -43,12 +44,16 @@ namespace broomstyx
         ~MKL_Pardiso();
 
         void        allocateInternalMemoryFor( SparseMatrix* coefMat ) override;
+        RealVector  backSubstitute( SparseMatrix* coefMat, RealVector& rhs ) override;
         void        initialize() override;
         void        clearInternalMemory() override;
+        void        factorize( SparseMatrix* coefMat ) override;
         std::string giveRequiredMatrixFormat() override;
         bool        giveSymmetryOption() override;
         void        readDataFrom( FILE* fp ) override;
+        bool        retainsFactorization() override;
         RealVector  solve( SparseMatrix* coefMat, RealVector& rhs ) override;
+        RealMatrix  solveForMultipleRhs( SparseMatrix* coefMat, RealMatrix& rhs ) override;
 
     private:
         int  _nThreads;
@@ -65,7 +70,22 @@ namespace broomstyx
         int _msglvl;
         int _nrhs;
         
-        void giveErrorMessage( int error );
+        // Mixed precision: factorization in single precision with iterative
+        // refinement driven by double precision residuals
+        bool   _mixedPrecision;
+        bool   _singlePrecisionActive;
+        int    _maxRefinementSteps;
+        double _refinementTol;
+        double _factorizationTime;
+        
+        std::vector<float> _aSingle;
+        
+        RealVector correctInSinglePrecision( SparseMatrix* coefMat, RealVector& resid );
+        void       convertValuesToSinglePrecision( SparseMatrix* coefMat );
+        bool       factorizeInSinglePrecision( SparseMatrix* coefMat );
+        void       giveErrorMessage( int error );
+        bool       solveInMixedPrecision( SparseMatrix* coefMat, RealVector& rhs, RealVector& u );
+        void       switchToDoublePrecisionFor( SparseMatrix* coefMat );
     };
 }
     
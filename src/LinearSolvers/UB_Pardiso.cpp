@@ -25,6 +25,8 @@
 
 #include "UB_Pardiso.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
@@ -35,6 +37,7 @@
 
 #include "Core/ObjectFactory.hpp"
 #include "SparseMatrix/SparseMatrix.hpp"
+#include "Util/RealMatrix.hpp"
 #include "Util/RealVector.hpp"
 #include "Util/readOperations.hpp"
 
@@ -50,6 +53,11 @@ UB_Pardiso::UB_Pardiso() : LinearSolver()
     _memoryIsAllocated = false;
     _mtype = 0;
     _symmetry = false;
+    _mixedPrecision = false;
+    _singlePrecisionActive = false;
+    _maxRefinementSteps = 10;
+    _refinementTol = 1.e-12;
+    _factorizationTime = 0.;
     
     for ( int i = 0; i < 64; i++ )
     {
@@ -287,6 +295,16 @@ void UB_Pardiso::initialize()
     _iparm[7] = 100;     // Max number of iterative refinement
     _iparm[23] = 1;      // Parallel factorization algorithm
     _iparm[27] = 1;      // Parallel METIS reordering
+    
+    // Single precision (32-bit) factorization. Refinement is then performed
+    // here with residuals evaluated in double precision, so the internal
+    // refinement of Pardiso is switched off.
+    _singlePrecisionActive = _mixedPrecision;
+    if ( _singlePrecisionActive )
+    {
+        _iparm[7] = 0;
+        _iparm[28] = 1;
+    }
 
     pardisoinit(_pt, &_mtype, &_solver, _iparm, dparm, &error);
     if ( error != 0 )
@@ -308,7 +326,27 @@ void UB_Pardiso::readDataFrom( FILE* fp )
 {
     std::string key, errmsg, src = "Pardiso (LinearSolver)";
 
-    verifyKeyword(fp, key = "nThreads", src);
+    // Optional precision setting
+    key = getStringInputFrom(fp, "Failed to read input for Pardiso solver from input file!", src);
+    if ( key == "Precision" )
+    {
+        key = getStringInputFrom(fp, "Failed to read precision option for Pardiso solver from input file!", src);
+        if ( key == "Mixed" )
+        {
+            _mixedPrecision = true;
+            _refinementTol = getRealInputFrom(fp, "Failed to read relative tolerance for iterative refinement from input file!", src);
+            _maxRefinementSteps = getIntegerInputFrom(fp, "Failed to read max. iterative refinement steps from input file!", src);
+        }
+        else if ( key == "Double" )
+            _mixedPrecision = false;
+        else
+            throw std::runtime_error("Unrecognized precision option '" + key + "' for Pardiso solver encountered in input file!");
+        
+        key = getStringInputFrom(fp, "Failed to read input for Pardiso solver from input file!", src);
+    }
+    
+    if ( key != "nThreads" )
+        throw std::runtime_error("Keyword 'nThreads' expected in input file,\n\tstring '" + key + "' found.\nError source: " + src);
     _nThreads = getIntegerInputFrom(fp, errmsg = "Failed to read number of threads for Pardiso solver in input file!", src);
     
     key = getStringInputFrom(fp, "Failed to read symmetry option in input file!", src);
@@ -337,6 +375,13 @@ bool UB_Pardiso::giveSymmetryOption()
     return _symmetry;
 }
 // ----------------------------------------------------------------------------
+bool UB_Pardiso::retainsFactorization()
+{
+    // Factorizations in reduced precision are only used through iterative
+    // refinement in solve(...)
+    return !_mixedPrecision;
+}
+// ----------------------------------------------------------------------------
 RealVector UB_Pardiso::solve( SparseMatrix* coefMat, RealVector&   rhs )
 {
     // Pardiso control parameters
@@ -389,6 +434,10 @@ RealVector UB_Pardiso::solve( SparseMatrix* coefMat, RealVector&   rhs )
 /* .. Numerical factorization. */
 /* -------------------------------------------------------------------- */
 
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    tic = std::chrono::high_resolution_clock::now();
+    
     phase = 22;
     pardiso (_pt, &maxfct, &mnum, &_mtype, &phase, &n, a, ia, ja, &idum, &nrhs, _iparm, &msglvl, &ddum, &ddum, &error, dparm);
 
@@ -406,9 +455,105 @@ RealVector UB_Pardiso::solve( SparseMatrix* coefMat, RealVector&   rhs )
             throw std::runtime_error("\n");
         }
     }
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    _factorizationTime = tictoc.count();
 
 /* -------------------------------------------------------------------- */
 /* .. Back substitution and iterative refinement. */
+/* -------------------------------------------------------------------- */
+    if ( _singlePrecisionActive )
+    {
+        if ( this->solveInMixedPrecision(coefMat, rhs, u) )
+            return u;
+        
+        this->switchToDoublePrecisionFor(coefMat);
+        this->factorize(coefMat);
+        u.init(n);
+    }
+    
+    phase = 33;
+    pardiso (_pt, &maxfct, &mnum, &_mtype, &phase, &n, a, ia, ja, &idum, &nrhs, _iparm, &msglvl, b, x, &error, dparm);
+
+    if (error != 0)
+    {
+        std::printf("\nPardiso ERROR during solution: %d", error);
+        throw std::runtime_error("\n");
+    }
+
+    return u;
+}
+// ----------------------------------------------------------------------------
+RealMatrix UB_Pardiso::solveForMultipleRhs( SparseMatrix* coefMat, RealMatrix& rhs )
+{
+    // Pardiso control parameters
+    double dparm[64];
+    int    maxfct, mnum, phase, error, msglvl;
+
+    int dim1, dim2;
+    std::tie(dim1,dim2) = coefMat->giveMatrixDimensions();
+
+    // Check that sparse matrix and RHS vectors have compatible dimensions
+    if ( dim1 != rhs.dim1() )
+    {
+        std::printf("\nCannot solve specified linear system!");
+        std::printf("\n\tSparse coefficient matrix has dimensions [ %d x %d ]", dim1, dim2);
+        std::printf("\n\tRHS matrix has dimensions [ %d x %d ]\n", rhs.dim1(), rhs.dim2());
+
+        throw std::runtime_error("Source: Pardiso");
+    }
+
+    // Numerical factorization is shared by all right hand sides
+    this->factorize(coefMat);
+
+    // Right hand sides are stored column-wise, as expected by Pardiso
+    int nrhs = rhs.dim2();
+    RealMatrix u(dim1, nrhs);
+    
+    if ( _singlePrecisionActive )
+    {
+        // Each right hand side is refined separately
+        bool success = true;
+        for ( int k = 0; k < nrhs && success; k++ )
+        {
+            RealVector b(dim1), x(dim1);
+            std::copy(rhs.ptr() + (long)k*dim1, rhs.ptr() + (long)(k + 1)*dim1, b.ptr());
+            success = this->solveInMixedPrecision(coefMat, b, x);
+            std::copy(x.ptr(), x.ptr() + dim1, u.ptr() + (long)k*dim1);
+        }
+        
+        if ( success )
+            return u;
+        
+        this->switchToDoublePrecisionFor(coefMat);
+        this->factorize(coefMat);
+    }
+
+    // Matrix Data
+    int n = dim1;
+    int* ia;
+    int* ja;
+    double* a;
+
+    std::tie(ia,ja) = coefMat->giveProfileArrays();
+    a  = coefMat->giveValArray();
+
+    double *b, *x;
+    b = rhs.ptr();
+    x = u.ptr();
+
+    // Auxiliary variables
+    int    idum;   // dummy variable
+
+    maxfct = 1; /* Maximum number of numerical factorizations.  */
+    mnum   = 1; /* Which factorization to use. */
+
+    msglvl = 0; /* Print statistical information  */
+    error  = 0; /* Initialize error flag */
+
+/* -------------------------------------------------------------------- */
+/* .. Back substitution and iterative refinement for all RHS vectors. */
 /* -------------------------------------------------------------------- */
     phase = 33;
     pardiso (_pt, &maxfct, &mnum, &_mtype, &phase, &n, a, ia, ja, &idum, &nrhs, _iparm, &msglvl, b, x, &error, dparm);
@@ -422,4 +567,44 @@ RealVector UB_Pardiso::solve( SparseMatrix* coefMat, RealVector&   rhs )
     return u;
 }
 
+// Private methods
+// ----------------------------------------------------------------------------
+bool UB_Pardiso::solveInMixedPrecision( SparseMatrix* coefMat, RealVector& rhs, RealVector& u )
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    tic = std::chrono::high_resolution_clock::now();
+    
+    int nSteps;
+    double relRes;
+    // Corrections use the single precision factors, while input and output
+    // vectors remain in double precision
+    auto correct = [ this, coefMat ]( RealVector& r ) { return this->backSubstitute(coefMat, r); };
+    bool success = this->refineSolution(coefMat, rhs, u, correct, _maxRefinementSteps, _refinementTol, nSteps, relRes);
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("\n      Single precision factorization, refinement: %d steps, rel. residual = %e", nSteps, relRes);
+    std::printf("\n      Mixed precision time: factorization = %f sec., refinement = %f sec., total = %f sec.\n", 
+            _factorizationTime, tictoc.count(), _factorizationTime + tictoc.count());
+    std::printf("    %-40s", "");
+    
+    return success;
+}
+// ----------------------------------------------------------------------------
+void UB_Pardiso::switchToDoublePrecisionFor( SparseMatrix* coefMat )
+{
+    std::printf("\n      Iterative refinement stagnated. Switching to double precision factorization.\n");
+    std::printf("    %-40s", "");
+    
+    // Factorization is redone in double precision starting from the
+    // reordering phase, and is used for all subsequent solves
+    this->clearInternalMemory();
+    _singlePrecisionActive = false;
+    _iparm[7] = 100;
+    _iparm[28] = 0;
+    
+    this->allocateInternalMemoryFor(coefMat);
+}
+
 #endif
\ No newline at end of file
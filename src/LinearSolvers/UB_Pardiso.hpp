@@ -54,7 +54,9 @@ namespace broomstyx
         std::string giveRequiredMatrixFormat() override;
         bool        giveSymmetryOption() override;
         void        readDataFrom( FILE* fp ) override;
+        bool        retainsFactorization() override;
         RealVector  solve( SparseMatrix* coefMat, RealVector& rhs ) override;
+        RealMatrix  solveForMultipleRhs( SparseMatrix* coefMat, RealMatrix& rhs ) override;
 
     private:
         int   _solver;
@@ -64,6 +66,17 @@ namespace broomstyx
         bool  _memoryIsAllocated;
         int   _mtype;
         bool  _symmetry;
+        
+        // Mixed precision: factorization in single precision with iterative
+        // refinement driven by double precision residuals
+        bool   _mixedPrecision;
+        bool   _singlePrecisionActive;
+        int    _maxRefinementSteps;
+        double _refinementTol;
+        double _factorizationTime;
+        
+        bool       solveInMixedPrecision( SparseMatrix* coefMat, RealVector& rhs, RealVector& u );
+        void       switchToDoublePrecisionFor( SparseMatrix* coefMat );
     };
 }
 
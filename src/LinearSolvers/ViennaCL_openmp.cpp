@@ -0,0 +1,240 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "ViennaCL_openmp.hpp"
+
+#ifdef HAVE_VIENNACL
+
+#include <cstdio>
+#include <stdexcept>
+#include <tuple>
+
+#include "Core/ObjectFactory.hpp"
+#include "Util/readOperations.hpp"
+#include "Util/RealVector.hpp"
+#include "SparseMatrix/SparseMatrix.hpp"
+
+// The OpenMP backend is enabled for all translation units through
+// VIENNACL_WITH_OPENMP (see CMakeLists.txt)
+#include "viennacl/context.hpp"
+#include "viennacl/scalar.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/ilu_operations.hpp"
+#include "viennacl/linalg/ilu.hpp"
+#include "viennacl/linalg/bicgstab.hpp"
+#include "viennacl/linalg/gmres.hpp"
+
+namespace
+{
+    typedef viennacl::compressed_matrix<double> HostMatrix;
+    typedef viennacl::vector<double>            HostVector;
+    
+    // ------------------------------------------------------------------------
+    void copyCsr0Matrix( broomstyx::SparseMatrix* coefMat, HostMatrix& hostMatrix )
+    {
+        int* csr_rows;
+        int* csr_cols;
+        double* csr_elements;
+        int num_rows, num_cols, num_nnz;
+        
+        std::tie(csr_rows, csr_cols) = coefMat->giveProfileArrays();
+        csr_elements = coefMat->giveValArray();
+        std::tie(num_rows, num_cols) = coefMat->giveMatrixDimensions();
+        num_nnz = coefMat->giveNumberOfNonzeros();
+        
+        if ( num_rows > 0 && num_cols > 0 && num_nnz > 0 )
+        {
+            viennacl::backend::typesafe_host_array<unsigned int> row_buffer(hostMatrix.handle1(), num_rows + 1);
+            
+            // Index arrays are converted only if ViennaCL uses indices of a
+            // different size
+            if ( sizeof(int) != row_buffer.element_size() )
+            {
+                viennacl::backend::typesafe_host_array<unsigned int> col_buffer(hostMatrix.handle2(), num_nnz);
+                
+                for ( int i = 0; i <= num_rows; ++i )
+                    row_buffer.set(i, csr_rows[i]);
+                for ( int i = 0; i < num_nnz; ++i )
+                    col_buffer.set(i, csr_cols[i]);
+                
+                hostMatrix.set(row_buffer.get(), col_buffer.get(), csr_elements, num_rows, num_cols, num_nnz);
+            }
+            else
+                hostMatrix.set(static_cast<const void*>(csr_rows), static_cast<const void*>(csr_cols), csr_elements, num_rows, num_cols, num_nnz);
+        }
+    }
+    // ------------------------------------------------------------------------
+    template<class SolverType>
+    HostVector solveWithPreconditioner( SolverType&        iterSolver
+                                      , const HostMatrix&  hostMatrix
+                                      , const HostVector&  hostRhs
+                                      , const std::string& preconditioner
+                                      , int                chowPatel_sweep
+                                      , int                chowPatel_nJacIter )
+    {
+        if ( preconditioner == "Chow_Patel_ILU0" )
+        {
+            // Fine-grained parallel ILU0: factors are computed by fixed-point
+            // sweeps and triangular solves by Jacobi iterations
+            viennacl::linalg::chow_patel_tag pcConfig;
+            pcConfig.sweeps(chowPatel_sweep);
+            pcConfig.jacobi_iters(chowPatel_nJacIter);
+            viennacl::linalg::chow_patel_ilu_precond<HostMatrix> pcObject(hostMatrix, pcConfig);
+            std::printf("\n      Preconditioner setup completed.");
+            std::fflush(stdout);
+            return iterSolver(hostMatrix, hostRhs, pcObject);
+        }
+        else if ( preconditioner == "ILU0" )
+        {
+            viennacl::linalg::ilu0_tag pcConfig;
+            viennacl::linalg::ilu0_precond<HostMatrix> pcObject(hostMatrix, pcConfig);
+            std::printf("\n      Preconditioner setup completed.");
+            std::fflush(stdout);
+            return iterSolver(hostMatrix, hostRhs, pcObject);
+        }
+        else if ( preconditioner == "none" )
+            return iterSolver(hostMatrix, hostRhs);
+        
+        throw std::runtime_error("Preconditioner '" + preconditioner + "' is not yet programmed!\nSource: ViennaCL_openmp (LinearSolver)");
+    }
+}
+
+using namespace broomstyx;
+
+registerBroomstyxObject(LinearSolver, ViennaCL_openmp)
+
+// Constructor
+ViennaCL_openmp::ViennaCL_openmp()
+    : LinearSolver()
+    , _tol(1.e-8)
+    , _maxIter(0)
+    , _restart(0)
+    , _chowPatel_sweep(0)
+    , _chowPatel_nJacIter(0)
+{}
+
+// Destructor
+ViennaCL_openmp::~ViennaCL_openmp() {}
+
+// Public methods
+// ---------------------------------------------------------------------------
+std::string ViennaCL_openmp::giveRequiredMatrixFormat()
+{
+    return std::string("CSR0");
+}
+// ---------------------------------------------------------------------------
+void ViennaCL_openmp::readDataFrom( FILE* fp )
+{
+    std::string src = "ViennaCL_openmp (LinearSolver)";
+    
+    verifyKeyword(fp, "Algorithm", src);
+    _algorithm = getStringInputFrom(fp, "Failed to read iterative algorithm for linear solver from input file!", src);
+    if ( _algorithm != "BiCGStab" && _algorithm != "GMRES" )
+        throw std::runtime_error("Invalid iterative algorithm '" + _algorithm + "' encountered while reading input file!\nSource: " + src);
+    
+    _tol = getRealInputFrom(fp, "Failed to read relative tolerance for iterative linear solver from input file!", src);
+    _maxIter = getIntegerInputFrom(fp, "Failed to read max. iterations for iterative linear solver from input file!", src);
+    
+    if ( _algorithm == "GMRES" )
+        _restart = getIntegerInputFrom(fp, "Failed to read number of iterations before restarting GMRES solver from input file!", src);
+    
+    verifyKeyword(fp, "Preconditioner", src);
+    _preconditioner = getStringInputFrom(fp, "Failed to read preconditioner for linear solver from input file!", src);
+    
+    if ( _preconditioner == "Chow_Patel_ILU0" )
+    {
+        _chowPatel_sweep = getIntegerInputFrom(fp, "Failed to read number of sweeps for preconditioner Chow_Patel_ILU0 from input file!", src);
+        _chowPatel_nJacIter = getIntegerInputFrom(fp, "Failed to read number of Jacobi iterations for preconditioner Chow_Patel_ILU0 from input file!", src);
+    }
+    else if ( _preconditioner != "ILU0" && _preconditioner != "none" )
+        throw std::runtime_error("Invalid preconditioner tag '" + _preconditioner + "' encountered while reading input file!\nSource: " + src);
+}
+// ---------------------------------------------------------------------------
+void ViennaCL_openmp::setInitialGuessTo( RealVector& initGuess )
+{
+    _initGuess = initGuess;
+}
+// ---------------------------------------------------------------------------
+RealVector ViennaCL_openmp::solve( SparseMatrix* coefMat, RealVector& rhs )
+{
+    int nUnknowns = rhs.dim();
+    RealVector soln(nUnknowns);
+    
+    // All objects are kept in main memory, also in builds where ViennaCL
+    // has other backends enabled
+    viennacl::context hostContext(viennacl::MAIN_MEMORY);
+    HostMatrix hostMatrix(hostContext);
+    HostVector hostRhs(nUnknowns, hostContext);
+    HostVector hostResult(nUnknowns, hostContext);
+    HostVector hostInitGuess(nUnknowns, hostContext);
+    
+    copyCsr0Matrix(coefMat, hostMatrix);
+    viennacl::copy(rhs.ptr(), rhs.ptr() + nUnknowns, hostRhs.begin());
+    
+    // Initial guess of different size (e.g. from another stage) is ignored
+    if ( _initGuess.dim() == nUnknowns )
+        viennacl::copy(_initGuess.ptr(), _initGuess.ptr() + nUnknowns, hostInitGuess.begin());
+    else
+        hostInitGuess.clear();
+    
+    int nIter;
+    double error;
+    if ( _algorithm == "BiCGStab" )
+    {
+        viennacl::linalg::bicgstab_tag solverTag(_tol, _maxIter);
+        viennacl::linalg::bicgstab_solver<HostVector> iterSolver(solverTag);
+        iterSolver.set_initial_guess(hostInitGuess);
+        hostResult = solveWithPreconditioner(iterSolver, hostMatrix, hostRhs, _preconditioner, _chowPatel_sweep, _chowPatel_nJacIter);
+        
+        nIter = (int)iterSolver.tag().iters();
+        error = iterSolver.tag().error();
+    }
+    else if ( _algorithm == "GMRES" )
+    {
+        viennacl::linalg::gmres_tag solverTag(_tol, _maxIter, _restart);
+        viennacl::linalg::gmres_solver<HostVector> iterSolver(solverTag);
+        iterSolver.set_initial_guess(hostInitGuess);
+        hostResult = solveWithPreconditioner(iterSolver, hostMatrix, hostRhs, _preconditioner, _chowPatel_sweep, _chowPatel_nJacIter);
+        
+        nIter = (int)iterSolver.tag().iters();
+        error = iterSolver.tag().error();
+    }
+    else
+        throw std::runtime_error("Iterative algorithm '" + _algorithm + "' is not yet programmed!\nSource: ViennaCL_openmp (LinearSolver)");
+    
+    std::printf("\n      System solved.");
+    std::printf("\n      Num iters = %d, est. error = %e\n", nIter, error);
+    
+    viennacl::copy(hostResult.begin(), hostResult.end(), soln.ptr());
+    
+    return soln;
+}
+// ---------------------------------------------------------------------------
+bool ViennaCL_openmp::takesInitialGuess()
+{
+    return true;
+}
+
+#endif /* HAVE_VIENNACL */
@@ -45,6 +45,11 @@ double Density::giveMaterialVariable( const std::string& str, const MaterialStat
         throw std::runtime_error("Request for unrecognized material variable '" + str + "' made to material class " + _name);
 }
 
+bool Density::hasMaterialVariable( const std::string& str )
+{
+    return str == "Density";
+}
+
 double Density::giveParameter( const std::string& str )
 {
     if ( str == "Density" )
@@ -45,6 +45,7 @@ namespace broomstyx
         virtual ~Density();
 
         double giveMaterialVariable( const std::string& str, const MaterialStatus* matStatus ) override;
+        bool   hasMaterialVariable( const std::string& str ) override;
         double giveParameter( const std::string& str ) override;
         void   readParamatersFrom( FILE* fp ) override;
         
@@ -45,6 +45,11 @@ double HeatCapacity::giveMaterialVariable( const std::string& str, const Materia
         throw std::runtime_error("Request for unrecognized material variable '" + str + "' made to material class " + _name);
 }
 
+bool HeatCapacity::hasMaterialVariable( const std::string& str )
+{
+    return str == "HeatCapacity";
+}
+
 double HeatCapacity::giveParameter( const std::string& str )
 {
     if ( str == "HeatCapacity" )
@@ -22,6 +22,7 @@ namespace broomstyx
         virtual ~HeatCapacity();
 
         double giveMaterialVariable( const std::string& str, const MaterialStatus* matStatus ) override;
+        bool   hasMaterialVariable( const std::string& str ) override;
         double giveParameter( const std::string& str ) override;
         void   readParamatersFrom( FILE* fp ) override;
         
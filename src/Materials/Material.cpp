@@ -40,12 +40,35 @@ Material::~Material() {}
 // ----------------------------------------------------------------------------
 MaterialStatus* Material::createMaterialStatus() { return nullptr; }
 // ----------------------------------------------------------------------------
-void Material::destroy( MaterialStatus*& matStatus ) {}
+void Material::destroy( MaterialStatus*& matStatus )
+{
+    // Status objects are owned by the status arena and released en bloc
+    matStatus = nullptr;
+}
+// ----------------------------------------------------------------------------
+bool Material::hasConstantModulus()
+{
+    // Modulus is assumed to depend on the constitutive state and status
+    // unless stated otherwise by the derived class
+    return false;
+}
+// ----------------------------------------------------------------------------
+bool Material::hasMaterialVariable( const std::string& label )
+{
+    // Derived classes that implement giveMaterialVariable() list the labels
+    // it accepts, so that callers can check them before querying each cell
+    return false;
+}
 // ----------------------------------------------------------------------------
 void Material::initialize() {}
 // ----------------------------------------------------------------------------
 void Material::readParamatersFrom( FILE* fp ) {}
 // ----------------------------------------------------------------------------
+void Material::releaseStatusStorage()
+{
+    _statusArena.clear();
+}
+// ----------------------------------------------------------------------------
 void Material::updateStatusFrom( const RealVector& conState, MaterialStatus* matStatus ) {}
 // ----------------------------------------------------------------------------
 void Material::updateStatusFrom( const RealVector& conState, MaterialStatus* matStatus, const std::string& label ) {}
@@ -27,6 +27,7 @@
 #include <cstdio>
 #include "Util/RealMatrix.hpp"
 #include "Util/RealVector.hpp"
+#include "Util/ObjectArena.hpp"
 
 namespace broomstyx
 {
@@ -51,8 +52,11 @@ namespace broomstyx
 
         virtual MaterialStatus* createMaterialStatus();
         virtual void destroy( MaterialStatus*& matStatus );
+        virtual bool hasConstantModulus();
+        virtual bool hasMaterialVariable( const std::string& label );
         virtual void initialize();
         virtual void readParamatersFrom( FILE* fp );
+        void releaseStatusStorage();
         virtual void updateStatusFrom( const RealVector& conState, MaterialStatus* matStatus );
         virtual void updateStatusFrom( const RealVector& conState, MaterialStatus* matStatus, const std::string& label );
         
@@ -84,6 +88,9 @@ namespace broomstyx
     protected:
         std::string _name;
         
+        // Storage for material status objects
+        ObjectArena _statusArena;
+        
         void error_unimplemented( const std::string& method );
     };
 }
@@ -85,6 +85,11 @@ RealMatrix CubicElasticity::giveModulusFrom( const RealVector& conState, const M
     return conMod;
 }
 // -------------------------------------------------------------------------------------
+bool CubicElasticity::hasConstantModulus()
+{
+    return true;
+}
+// -------------------------------------------------------------------------------------
 void CubicElasticity::readParamatersFrom( FILE* fp )
 {
     std::string mode = getStringInputFrom( fp, "Failed to read analysis mode from input file!", _name );
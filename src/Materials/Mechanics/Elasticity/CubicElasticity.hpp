@@ -55,6 +55,7 @@ namespace broomstyx
         double     givePotentialFrom( const RealVector& conState, const MaterialStatus* matStatus ) override;
         RealVector giveForceFrom( const RealVector& conState, const MaterialStatus* matStatus ) override;
         RealMatrix giveModulusFrom( const RealVector& conState, const MaterialStatus* matStatus ) override;
+        bool       hasConstantModulus() override;
         void       readParamatersFrom( FILE* fp ) override;
 
     private:
@@ -183,6 +183,11 @@ double LinearIsotropicElasticity::giveParameter( const std::string& str )
         throw std::runtime_error( "Request for unrecognized parameter '" + str + "' made to material class " + _name );
 }
 // -------------------------------------------------------------------------------------
+bool LinearIsotropicElasticity::hasConstantModulus()
+{
+    return true;
+}
+// -------------------------------------------------------------------------------------
 void LinearIsotropicElasticity::readParamatersFrom( FILE* fp )
 {
     std::string mode = getStringInputFrom( fp, "Failed to read analysis mode from input file!", _name );
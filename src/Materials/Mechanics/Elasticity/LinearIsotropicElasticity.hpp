@@ -68,6 +68,7 @@ namespace broomstyx
         RealMatrix giveModulusFrom( const RealVector& conState, const MaterialStatus* matStatus ) override;
         RealMatrix giveModulusFrom( const RealVector& conState, const MaterialStatus* matStatus, const std::string& label ) override;
         double     giveParameter( const std::string& str ) override;
+        bool       hasConstantModulus() override;
         void       readParamatersFrom( FILE* fp ) override;
 
     private:
@@ -51,7 +51,7 @@ AmorDamageModel::AmorDamageModel()
 // ----------------------------------------------------------------------------
 MaterialStatus* AmorDamageModel::createMaterialStatus()
 {
-    MaterialStatus* matStatus = new MaterialStatus_AmorDamageModel();
+    MaterialStatus* matStatus = _statusArena.create<MaterialStatus_AmorDamageModel>();
     auto mst = this->accessMaterialStatus( matStatus );
     
     mst->_materialStatus[ 0 ] = _elasticityModel->createMaterialStatus();
@@ -63,8 +63,9 @@ MaterialStatus* AmorDamageModel::createMaterialStatus()
 void AmorDamageModel::destroy( MaterialStatus*& matStatus )
 {
     auto mst = this->accessMaterialStatus( matStatus );
-    delete mst->_materialStatus[ 0 ];
-    delete mst->_materialStatus[ 1 ];
+    _elasticityModel->destroy( mst->_materialStatus[ 0 ] );
+    _degradationFunction->destroy( mst->_materialStatus[ 1 ] );
+    matStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 double AmorDamageModel::givePotentialFrom( const RealVector& conState, const MaterialStatus* matStatus )
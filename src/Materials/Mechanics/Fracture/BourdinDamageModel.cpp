@@ -46,7 +46,7 @@ BourdinDamageModel::BourdinDamageModel()
 // ----------------------------------------------------------------------------
 MaterialStatus* BourdinDamageModel::createMaterialStatus()
 {
-    MaterialStatus* matStatus = new MaterialStatus_BourdinDamageModel();
+    MaterialStatus* matStatus = _statusArena.create<MaterialStatus_BourdinDamageModel>();
     auto mst = this->accessMaterialStatus( matStatus );
     
     mst->_materialStatus[ 0 ] = _elasticityModel->createMaterialStatus();
@@ -58,8 +58,9 @@ MaterialStatus* BourdinDamageModel::createMaterialStatus()
 void BourdinDamageModel::destroy( MaterialStatus*& matStatus )
 {
     auto mst = this->accessMaterialStatus( matStatus );
-    delete mst->_materialStatus[ 0 ];
-    delete mst->_materialStatus[ 1 ];
+    _elasticityModel->destroy( mst->_materialStatus[ 0 ] );
+    _degradationFunction->destroy( mst->_materialStatus[ 1 ] );
+    matStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 double BourdinDamageModel::givePotentialFrom( const RealVector& conState, const MaterialStatus* matStatus )
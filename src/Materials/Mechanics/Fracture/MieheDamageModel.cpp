@@ -59,7 +59,7 @@ MieheDamageModel::MieheDamageModel()
 // ----------------------------------------------------------------------------
 MaterialStatus* MieheDamageModel::createMaterialStatus()
 {
-    MaterialStatus* matStatus = new MaterialStatus_MieheDamageModel();
+    MaterialStatus* matStatus = _statusArena.create<MaterialStatus_MieheDamageModel>();
     auto mst = this->accessMaterialStatus( matStatus );
     mst->_materialStatus = _degradationFunction->createMaterialStatus();
     return matStatus;
@@ -68,7 +68,8 @@ MaterialStatus* MieheDamageModel::createMaterialStatus()
 void MieheDamageModel::destroy( MaterialStatus*& matStatus )
 {
     auto mst = this->accessMaterialStatus( matStatus );
-    delete mst->_materialStatus;
+    _degradationFunction->destroy( mst->_materialStatus );
+    matStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 double MieheDamageModel::givePotentialFrom( const RealVector& conState, const MaterialStatus* matStatus )
@@ -466,6 +467,11 @@ RealMatrix MieheDamageModel::giveModulusFrom( const RealVector&     conState
     return conMod;
 }
 // ----------------------------------------------------------------------------
+bool MieheDamageModel::hasMaterialVariable( const std::string& label )
+{
+    return label == "eigVec1_1" || label == "eigVec1_2" || label == "eigVec2_1" || label == "eigVec2_2";
+}
+// ----------------------------------------------------------------------------
 void MieheDamageModel::readParamatersFrom( FILE* fp )
 {
     if ( _analysisMode == Unset )
@@ -58,6 +58,7 @@ namespace broomstyx
         RealVector giveForceFrom( const RealVector& conState, const MaterialStatus* matStatus, const std::string& label ) override;
         double     giveMaterialVariable( const std::string& label, const MaterialStatus* matStatus ) override;
         RealMatrix giveModulusFrom( const RealVector& conState, const MaterialStatus* matStatus, const std::string& label ) override;
+        bool       hasMaterialVariable( const std::string& label ) override;
         void       readParamatersFrom( FILE* fp ) override;
         void       updateStatusFrom( const RealVector& conState, MaterialStatus* matStatus ) override;
 
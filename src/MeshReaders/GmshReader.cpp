@@ -30,6 +30,7 @@
 #include <omp.h>
 
 #include "Core/AnalysisModel.hpp"
+#include "Core/Communicator.hpp"
 #include "Core/DomainManager.hpp"
 #include "Core/DomainManager.hpp"
 #include "Core/ObjectFactory.hpp"
@@ -158,7 +159,14 @@ void GmshReader::readMeshFile( std::string filename ) {
                 analysisModel().domainManager().setPartitionOf(curCell, elemPartition);
             else
             {
-                analysisModel().domainManager().setPartitionOf(curCell, 0);
+                // In distributed execution, halo cells keep their owning
+                // partition (first tag), since it decides which process
+                // assembles them. Remaining (negative) tags list the
+                // partitions in whose halo the cell is.
+                if ( communicator().isDistributed() )
+                    analysisModel().domainManager().setPartitionOf(curCell, elemPartition);
+                else
+                    analysisModel().domainManager().setPartitionOf(curCell, 0);
             
                 std::vector<int> halo;
                 halo.assign(nPartitionTags - 1, 0);
@@ -0,0 +1,303 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "StructuredMeshGenerator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Core/AnalysisModel.hpp"
+#include "Core/DomainManager.hpp"
+#include "Core/ObjectFactory.hpp"
+#include "Util/RealVector.hpp"
+
+using namespace broomstyx;
+
+registerBroomstyxObject(MeshReader, StructuredMeshGenerator)
+
+// Constructor
+StructuredMeshGenerator::StructuredMeshGenerator() {}
+
+// Destructor
+StructuredMeshGenerator::~StructuredMeshGenerator() {}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void StructuredMeshGenerator::readMeshFile( std::string spec )
+{
+    std::string src = "StructuredMeshGenerator (MeshReader)";
+    
+    // Parse mesh specification, e.g. "Tri3:64x64"
+    std::size_t colon = spec.find(':');
+    if ( colon == std::string::npos )
+        throw std::runtime_error("Invalid mesh specification '" + spec + "'! Expected <ElementType>:<nx>x<ny>[x<nz>]\nSource: " + src);
+    
+    std::string elType = spec.substr(0, colon);
+    std::vector<int> nDiv;
+    std::size_t pos = colon + 1;
+    while ( pos <= spec.size() )
+    {
+        std::size_t next = spec.find('x', pos);
+        if ( next == std::string::npos )
+            next = spec.size();
+        
+        int n = 0;
+        try
+        {
+            n = std::stoi(spec.substr(pos, next - pos));
+        }
+        catch ( std::exception& e )
+        {
+            throw std::runtime_error("Invalid number of subdivisions in mesh specification '" + spec + "'!\nSource: " + src);
+        }
+        if ( n < 1 )
+            throw std::runtime_error("Number of subdivisions must be positive in mesh specification '" + spec + "'!\nSource: " + src);
+        
+        nDiv.push_back(n);
+        pos = next + 1;
+    }
+    
+    std::printf("  %-40s", "Generating structured mesh ...");
+    std::fflush(stdout);
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    tic = std::chrono::high_resolution_clock::now();
+    
+    if ( (elType == "Tri3" || elType == "Tri6" || elType == "Quad8") && nDiv.size() == 2 )
+        this->generatePlanarMesh(elType, nDiv[0], nDiv[1]);
+    else if ( elType == "Tet4" && nDiv.size() == 3 )
+        this->generateTetrahedralMesh(nDiv[0], nDiv[1], nDiv[2]);
+    else
+        throw std::runtime_error("Unsupported mesh specification '" + spec + "'! Valid element types are Tri3, Tri6 and Quad8\n"
+                + "with 2 subdivisions, or Tet4 with 3 subdivisions.\nSource: " + src);
+    
+    analysisModel().domainManager().countBoundaryCells();
+    analysisModel().domainManager().countDomainCells();
+    analysisModel().domainManager().formDomainPartitions();
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n\n", tictoc.count());
+    
+    std::printf("    Mesh specification = %s\n\n", spec.c_str());
+    
+    analysisModel().domainManager().reportStatus();
+    
+    std::printf("\n");
+}
+
+// Private methods
+// ----------------------------------------------------------------------------
+void StructuredMeshGenerator::generatePlanarMesh( const std::string& elType, int nx, int ny )
+{
+    DomainManager& domainManager = analysisModel().domainManager();
+    
+    domainManager.createPhysicalEntity(1, 1, "\"bottom\"");
+    domainManager.createPhysicalEntity(1, 2, "\"right\"");
+    domainManager.createPhysicalEntity(1, 3, "\"top\"");
+    domainManager.createPhysicalEntity(1, 4, "\"left\"");
+    domainManager.createPhysicalEntity(2, 5, "\"domain\"");
+    
+    // Higher order elements are generated on a grid with twice the number of
+    // subdivisions, where the corners of the coarse grid are the element
+    // vertices. Quad8 elements do not use the cell centers of the coarse grid.
+    bool isQuadratic = ( elType != "Tri3" );
+    int f = isQuadratic ? 2 : 1;
+    int mx = f*nx + 1;
+    int my = f*ny + 1;
+    
+    std::vector<int> nodeNum(mx*my, -1);
+    RealVector coor(3);
+    int nNodes = 0;
+    for ( int j = 0; j < my; j++ )
+        for ( int i = 0; i < mx; i++ )
+        {
+            if ( elType == "Quad8" && i%2 == 1 && j%2 == 1 )
+                continue;
+            
+            coor(0) = (double)i/(double)(mx - 1);
+            coor(1) = (double)j/(double)(my - 1);
+            coor(2) = 0.;
+            domainManager.makeNewNodeAt(coor);
+            nodeNum[j*mx + i] = nNodes++;
+        }
+    domainManager.countNodes();
+    
+    auto node = [&]( int i, int j ) { return nodeNum[j*mx + i]; };
+    
+    // Domain cells
+    std::vector<int> cellNodes;
+    for ( int j = 0; j < ny; j++ )
+        for ( int i = 0; i < nx; i++ )
+        {
+            int i0 = f*i, i1 = f*(i + 1), j0 = f*j, j1 = f*(j + 1);
+            
+            if ( elType == "Tri3" )
+            {
+                cellNodes = {node(i0,j0), node(i1,j0), node(i1,j1)};
+                this->makeCell(5, 2, cellNodes);
+                cellNodes = {node(i0,j0), node(i1,j1), node(i0,j1)};
+                this->makeCell(5, 2, cellNodes);
+            }
+            else if ( elType == "Tri6" )
+            {
+                cellNodes = {node(i0,j0), node(i1,j0), node(i1,j1), node(i0+1,j0), node(i1,j0+1), node(i0+1,j0+1)};
+                this->makeCell(5, 9, cellNodes);
+                cellNodes = {node(i0,j0), node(i1,j1), node(i0,j1), node(i0+1,j0+1), node(i0+1,j1), node(i0,j0+1)};
+                this->makeCell(5, 9, cellNodes);
+            }
+            else
+            {
+                cellNodes = {node(i0,j0), node(i1,j0), node(i1,j1), node(i0,j1), 
+                             node(i0+1,j0), node(i1,j0+1), node(i0+1,j1), node(i0,j0+1)};
+                this->makeCell(5, 16, cellNodes);
+            }
+        }
+    
+    // Boundary cells, oriented counterclockwise around the domain
+    int bndType = isQuadratic ? 8 : 1;
+    auto makeEdge = [&]( int label, int ia, int ja, int ib, int jb )
+    {
+        if ( isQuadratic )
+            cellNodes = {node(ia,ja), node(ib,jb), node((ia + ib)/2,(ja + jb)/2)};
+        else
+            cellNodes = {node(ia,ja), node(ib,jb)};
+        this->makeCell(label, bndType, cellNodes);
+    };
+    
+    for ( int i = 0; i < nx; i++ )
+        makeEdge(1, f*i, 0, f*(i + 1), 0);
+    for ( int j = 0; j < ny; j++ )
+        makeEdge(2, f*nx, f*j, f*nx, f*(j + 1));
+    for ( int i = nx - 1; i >= 0; i-- )
+        makeEdge(3, f*(i + 1), f*ny, f*i, f*ny);
+    for ( int j = ny - 1; j >= 0; j-- )
+        makeEdge(4, 0, f*(j + 1), 0, f*j);
+}
+// ----------------------------------------------------------------------------
+void StructuredMeshGenerator::generateTetrahedralMesh( int nx, int ny, int nz )
+{
+    DomainManager& domainManager = analysisModel().domainManager();
+    
+    domainManager.createPhysicalEntity(2, 1, "\"left\"");
+    domainManager.createPhysicalEntity(2, 2, "\"right\"");
+    domainManager.createPhysicalEntity(2, 3, "\"bottom\"");
+    domainManager.createPhysicalEntity(2, 4, "\"top\"");
+    domainManager.createPhysicalEntity(2, 5, "\"back\"");
+    domainManager.createPhysicalEntity(2, 6, "\"front\"");
+    domainManager.createPhysicalEntity(3, 7, "\"domain\"");
+    
+    RealVector coor(3);
+    for ( int k = 0; k <= nz; k++ )
+        for ( int j = 0; j <= ny; j++ )
+            for ( int i = 0; i <= nx; i++ )
+            {
+                coor(0) = (double)i/(double)nx;
+                coor(1) = (double)j/(double)ny;
+                coor(2) = (double)k/(double)nz;
+                domainManager.makeNewNodeAt(coor);
+            }
+    domainManager.countNodes();
+    
+    auto node = [&]( int i, int j, int k ) { return (k*(ny + 1) + j)*(nx + 1) + i; };
+    
+    // Each hexahedron is split into the 6 tetrahedra of the Kuhn
+    // subdivision, which all share the diagonal from its lowest to its highest
+    // corner. This gives a conforming mesh in which every quadrilateral face
+    // is cut along the diagonal through its lowest corner.
+    const int perm[6][3] = {{0,1,2}, {0,2,1}, {1,0,2}, {1,2,0}, {2,0,1}, {2,1,0}};
+    const int parity[6] = {1, -1, -1, 1, 1, -1};
+    
+    std::vector<int> cellNodes(4, 0);
+    for ( int k = 0; k < nz; k++ )
+        for ( int j = 0; j < ny; j++ )
+            for ( int i = 0; i < nx; i++ )
+                for ( int p = 0; p < 6; p++ )
+                {
+                    int idx[3] = {i, j, k};
+                    cellNodes[0] = node(idx[0], idx[1], idx[2]);
+                    for ( int v = 0; v < 3; v++ )
+                    {
+                        idx[perm[p][v]] += 1;
+                        cellNodes[v + 1] = node(idx[0], idx[1], idx[2]);
+                    }
+                    
+                    // Ensure positive orientation
+                    if ( parity[p] < 0 )
+                        std::swap(cellNodes[1], cellNodes[2]);
+                    
+                    this->makeCell(7, 4, cellNodes);
+                }
+    
+    // Boundary cells, with normals pointing out of the domain. (a, b) are the
+    // in-plane directions of the face and c = 0 or 1 selects the face.
+    auto makeFaces = [&]( int label, int dirA, int dirB, int dirC, int nA, int nB, int c, bool flip )
+    {
+        std::vector<int> faceNodes(3, 0);
+        for ( int b = 0; b < nB; b++ )
+            for ( int a = 0; a < nA; a++ )
+            {
+                int corner[4][2] = {{a, b}, {a + 1, b}, {a + 1, b + 1}, {a, b + 1}};
+                int vertex[4];
+                for ( int v = 0; v < 4; v++ )
+                {
+                    int idx[3];
+                    idx[dirA] = corner[v][0];
+                    idx[dirB] = corner[v][1];
+                    idx[dirC] = c;
+                    vertex[v] = node(idx[0], idx[1], idx[2]);
+                }
+                
+                faceNodes = {vertex[0], vertex[1], vertex[2]};
+                if ( flip )
+                    std::swap(faceNodes[1], faceNodes[2]);
+                this->makeCell(label, 2, faceNodes);
+                
+                faceNodes = {vertex[0], vertex[2], vertex[3]};
+                if ( flip )
+                    std::swap(faceNodes[1], faceNodes[2]);
+                this->makeCell(label, 2, faceNodes);
+            }
+    };
+    
+    // With (a, b, c) a right-handed permutation of (x, y, z), the face
+    // triangles as constructed have normals along +c
+    makeFaces(1, 1, 2, 0, ny, nz, 0, true);
+    makeFaces(2, 1, 2, 0, ny, nz, nx, false);
+    makeFaces(3, 2, 0, 1, nz, nx, 0, true);
+    makeFaces(4, 2, 0, 1, nz, nx, ny, false);
+    makeFaces(5, 0, 1, 2, nx, ny, 0, true);
+    makeFaces(6, 0, 1, 2, nx, ny, nz, false);
+}
+// ----------------------------------------------------------------------------
+void StructuredMeshGenerator::makeCell( int label, int elType, std::vector<int>& cellNodes )
+{
+    Cell* curCell = analysisModel().domainManager().makeNewCellWithLabel(label);
+    analysisModel().domainManager().setElementTypeOf(curCell, elType);
+    analysisModel().domainManager().setPartitionOf(curCell, 0);
+    analysisModel().domainManager().setNodesOf(curCell, cellNodes);
+}
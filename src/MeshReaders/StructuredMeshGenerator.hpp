@@ -0,0 +1,59 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef STRUCTUREDMESHGENERATOR_HPP
+#define	STRUCTUREDMESHGENERATOR_HPP
+
+#include "GmshReader.hpp"
+
+namespace broomstyx 
+{
+    // Generates structured meshes of the unit square/cube in memory, which
+    // is convenient for benchmarking without an external mesher. The string
+    // given in *MESH_FILE specifies the element type and number of
+    // subdivisions, e.g. "Tri3:64x64", "Tri6:32x32", "Quad8:32x32" or
+    // "Tet4:16x16x16". Element types, node ordering and face numbering
+    // follow the Gmsh conventions of GmshReader.
+    //
+    // Physical entities for 2D meshes:
+    //   1 "bottom", 2 "right", 3 "top", 4 "left", 5 "domain"
+    // Physical entities for 3D meshes:
+    //   1 "left" (x = 0), 2 "right" (x = 1), 3 "bottom" (y = 0),
+    //   4 "top" (y = 1), 5 "back" (z = 0), 6 "front" (z = 1), 7 "domain"
+
+    class StructuredMeshGenerator final : public GmshReader
+    {
+    public:
+        StructuredMeshGenerator();
+        virtual ~StructuredMeshGenerator();
+
+        void readMeshFile( std::string spec ) override;
+
+    private:
+        void generatePlanarMesh( const std::string& elType, int nx, int ny );
+        void generateTetrahedralMesh( int nx, int ny, int nz );
+        void makeCell( int label, int elType, std::vector<int>& cellNodes );
+    };
+}
+
+#endif	/* STRUCTUREDMESHGENERATOR_HPP */
@@ -73,7 +73,7 @@ void DarcyFlow_2D_1Phase_Fv_Tri::deleteNumericsAt( Cell* targetCell )
     auto material = this->giveMaterialSetFor(targetCell);
     
     material[0]->destroy(cns->_materialStatus);
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // -------------------------------------------------------------------------
 void DarcyFlow_2D_1Phase_Fv_Tri::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -91,9 +91,9 @@ void DarcyFlow_2D_1Phase_Fv_Tri::finalizeDataAt( Cell* targetCell, const TimeDat
     // Retrieve material set for cell
     std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
     
-    // Get cell vertex nodes and faces
+    // Get cell vertex nodes and face geometry
     std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(targetCell);
-    std::vector< std::vector<Node*> > face = this->giveFaceNodesOf(targetCell);
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
     
     // Get cell neighbors
     std::vector<Cell*> neighbor = analysisModel().domainManager().giveNeighborsOf(targetCell);
@@ -115,12 +115,13 @@ void DarcyFlow_2D_1Phase_Fv_Tri::finalizeDataAt( Cell* targetCell, const TimeDat
     // Cycle through faces
     for ( int i = 0; i < 3; i++ )
     {
-        double length = this->giveLengthOf(face[i]);
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+        double length = fg.measure[k];
         double normalFlux;
         if ( cns->_headIsPrescribedOnFace[i] )
         {
-            RealVector nhat = giveOutwardUnitNormalOf(face[i]);
-            double d1 = this->giveDistanceToMidpointOf(face[i], cellCoor);
+            RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+            double d1 = fg.ownerDistance[k];
 
             RealVector kvec;
             kvec = kmat_cell*nhat;
@@ -136,7 +137,7 @@ void DarcyFlow_2D_1Phase_Fv_Tri::finalizeDataAt( Cell* targetCell, const TimeDat
             Dof* dof2 = analysisModel().domainManager().giveCellDof(_cellDof[0], neighbor[i]);
             double h2 = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof2, converged_value);
 
-            double transCoef = this->giveTransmissibilityCoefficientAt(face[i], targetCell, neighbor[i]);
+            double transCoef = this->giveTransmissibilityCoefficientAt(targetCell, i, neighbor[i]);
             normalFlux = transCoef*(h1 - h2)/length;
         }
         cns->_fluxOnFace[i] = normalFlux;
@@ -151,8 +152,8 @@ void DarcyFlow_2D_1Phase_Fv_Tri::finalizeDataAt( Cell* targetCell, const TimeDat
     RealVector centerFlux(3);
     for ( int i = 0; i < 3; i++ )
     {
-        RealVector temp = this->giveOutwardUnitNormalOf(face[i]);
-        RealVector nhat({temp(0), temp(1), 0.});
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+        RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1], 0.});
         
         RealVector x = analysisModel().domainManager().giveCoordinatesOf(node[i]);
         RealVector x0 = analysisModel().domainManager().giveCoordinatesOf(vertexNode[i]);
@@ -170,14 +171,7 @@ double DarcyFlow_2D_1Phase_Fv_Tri::giveCellFieldValueAt( Cell* targetCell, int f
     RealVector val, wt;
     std::string fieldTag;
     
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch ( std::exception& e )
-    {
-        fieldTag = "unassigned";
-    }
+    fieldTag = this->giveCellFieldTagFor(fieldNum);
     std::tie(val,wt) = this->giveFieldOutputAt(targetCell, fieldTag);
     
     return val(0);
@@ -252,7 +246,7 @@ DarcyFlow_2D_1Phase_Fv_Tri::giveStaticCoefficientMatrixAt
     
     if ( stage == _stage[0] && ( subsys == _subsystem[0] || subsys == UNASSIGNED ) )
     {
-        std::vector< std::vector<Node*> > face = this->giveFaceNodesOf(targetCell);
+        const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
         auto cns = this->getNumericsStatusAt(targetCell);
         
         // Get cell neighbors
@@ -278,15 +272,10 @@ DarcyFlow_2D_1Phase_Fv_Tri::giveStaticCoefficientMatrixAt
         {
             if ( !neighbor[i] && cns->_headIsPrescribedOnFace[i] )
             {
-                double length = this->giveLengthOf(face[i]);
-                RealVector nhat = this->giveOutwardUnitNormalOf(face[i]);
-                
-                // Get coordinate of cell center
-                std::vector<RealVector> epCoor;
-                epCoor = giveEvaluationPointsFor(targetCell);
-                RealVector cellCoor({epCoor[0](0), epCoor[0](1), 0.});
-                
-                double d1 = this->giveDistanceToMidpointOf(face[i], cellCoor);
+                int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+                double length = fg.measure[k];
+                RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+                double d1 = fg.ownerDistance[k];
 
                 // Permeability tensor for cell
                 std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
@@ -309,7 +298,7 @@ DarcyFlow_2D_1Phase_Fv_Tri::giveStaticCoefficientMatrixAt
                 rowDof[counter] = rowDof[0];
                 colDof[counter] = analysisModel().domainManager().giveCellDof(_cellDof[0], neighbor[i]);
                 
-                double transCoef = this->giveTransmissibilityCoefficientAt(face[i], targetCell, neighbor[i]);
+                double transCoef = this->giveTransmissibilityCoefficientAt(targetCell, i, neighbor[i]);
                 coefVal(0) += transCoef;
                 coefVal(counter) = -transCoef;
             }
@@ -338,13 +327,10 @@ DarcyFlow_2D_1Phase_Fv_Tri::giveStaticLeftHandSideAt
         // Material set
         std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
         
-        // Cell faces and neighbors
-        std::vector< std::vector<Node*> > face = this->giveFaceNodesOf(targetCell);
+        // Cell face geometry and neighbors
+        const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
         std::vector<Cell*> neighbor = analysisModel().domainManager().giveNeighborsOf(targetCell);
         
-        // Cell area, Cell center coordinates
-        std::vector<RealVector> epCoor = this->giveEvaluationPointsFor(targetCell);
-        
         // Retrieve hydraulic head
         Dof* dof_h = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
         double h = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof_h, current_value);
@@ -372,11 +358,12 @@ DarcyFlow_2D_1Phase_Fv_Tri::giveStaticLeftHandSideAt
                 if ( cns->_headIsPrescribedOnFace[i] ) // Hydraulic head is specified at cell face
                 {
                     // Length of face
-                    double length = this->giveLengthOf(face[i]);
+                    int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+                    double length = fg.measure[k];
                     
                     // Hydraulic conductivity component normal to face
-                    RealVector nhat = giveOutwardUnitNormalOf(face[i]);
-                    double d1 = this->giveDistanceToMidpointOf(face[i], epCoor[0]);
+                    RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+                    double d1 = fg.ownerDistance[k];
                     RealVector kvec;
                     kvec = kmat_cell*nhat;
                     double K1 = std::sqrt(kvec.dot(kvec))*_rhoF*_gAccel/_mu;
@@ -389,7 +376,7 @@ DarcyFlow_2D_1Phase_Fv_Tri::giveStaticLeftHandSideAt
                     Dof* dof_h2 = analysisModel().domainManager().giveCellDof(_cellDof[0], neighbor[i]);
                     double h2 = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof_h2, current_value);
                     
-                    double transCoef = this->giveTransmissibilityCoefficientAt(face[i], targetCell, neighbor[i]);
+                    double transCoef = this->giveTransmissibilityCoefficientAt(targetCell, i, neighbor[i]);
                     outflow(i) = transCoef*(h - h2);
                 }
             }
@@ -443,7 +430,9 @@ DarcyFlow_2D_1Phase_Fv_Tri::giveStaticRightHandSideAt
                         if ( (bndCellNode[0] == face[i][0] && bndCellNode[1] == face[i][1]) || 
                              (bndCellNode[1] == face[i][0] && bndCellNode[0] == face[i][1]) )
                         {
-                            double length = this->giveLengthOf(bndCellNode);
+                            const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
+                            int k = analysisModel().domainManager().giveFaceGeometryIndexOf(curDomCell, i);
+                            double length = fg.measure[k];
                             RealVector coor0 = analysisModel().domainManager().giveCoordinatesOf(bndCellNode[0]);
                             RealVector coor1 = analysisModel().domainManager().giveCoordinatesOf(bndCellNode[1]);
                             RealVector midpt;
@@ -458,9 +447,8 @@ DarcyFlow_2D_1Phase_Fv_Tri::giveStaticRightHandSideAt
                                 cns->_headOnFace[i] = bcVal;
                                 
                                 // Hydraulic conductivity component normal to face
-                                RealVector nhat = giveOutwardUnitNormalOf(face[i]);
-                                std::vector<RealVector> epCoor = this->giveEvaluationPointsFor(curDomCell);
-                                double d = this->giveDistanceToMidpointOf(face[i], epCoor[0]);
+                                RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+                                double d = fg.ownerDistance[k];
                                 
                                 std::vector<Material*> material = this->giveMaterialSetFor(curDomCell);
                                 double k_xx, k_yy, k_xy;
@@ -602,11 +590,13 @@ void DarcyFlow_2D_1Phase_Fv_Tri::initializeMaterialsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void DarcyFlow_2D_1Phase_Fv_Tri::initializeNumericsAt( Cell* targetCell )
 {
-    targetCell->numericsStatus = new NumericsStatus_DarcyFlow_2D_1Phase_Fv_Tri();
+    targetCell->numericsStatus = _statusArena.create<NumericsStatus_DarcyFlow_2D_1Phase_Fv_Tri>();
 }
 // ----------------------------------------------------------------------------
 void DarcyFlow_2D_1Phase_Fv_Tri::readAdditionalDataFrom( FILE* fp )
 {
+    analysisModel().domainManager().mustFormFaceGeometry();
+    
     std::string key;
     verifyKeyword(fp, key = "SpecificStorage", _name);
     _S = getRealInputFrom(fp, "Failed to read fluid specific storage from input file!", _name);
@@ -701,19 +691,6 @@ double DarcyFlow_2D_1Phase_Fv_Tri::giveAreaOf( Cell* targetCell )
     return area;
 }
 // ----------------------------------------------------------------------------
-double DarcyFlow_2D_1Phase_Fv_Tri::giveDistanceToMidpointOf( const std::vector<Node*>& face
-                                                           , const RealVector&   coor )
-{
-    RealVector coor0, coor1;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf(face[0]);
-    coor1 = analysisModel().domainManager().giveCoordinatesOf(face[1]);
-    
-    RealVector dx;
-    dx = 0.5*(coor0 + coor1) - coor;
-    
-    return std::sqrt(dx.dot(dx));
-}
-// ----------------------------------------------------------------------------
 std::vector<std::vector<Node*> >
 DarcyFlow_2D_1Phase_Fv_Tri::giveFaceNodesOf( Cell* targetCell )
 {
@@ -730,84 +707,39 @@ DarcyFlow_2D_1Phase_Fv_Tri::giveFaceNodesOf( Cell* targetCell )
     return face;
 }
 // ----------------------------------------------------------------------------
-double DarcyFlow_2D_1Phase_Fv_Tri::giveLengthOf( const std::vector<Node*>& face )
-{
-    RealVector coor0, coor1;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf(face[0]);
-    coor1 = analysisModel().domainManager().giveCoordinatesOf(face[1]);
-    
-    RealVector dx = coor1 - coor0;
-    
-    return std::sqrt(dx.dot(dx));
-}
-// ----------------------------------------------------------------------------
-RealVector DarcyFlow_2D_1Phase_Fv_Tri::giveOutwardUnitNormalOf( const std::vector<Node*>& face )
-{
-    RealVector coor0, coor1;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf(face[0]);
-    coor1 = analysisModel().domainManager().giveCoordinatesOf(face[1]);
-    
-    RealVector dx;
-    dx = coor1 - coor0;
-    double dist = std::sqrt(dx.dot(dx));
-    
-    RealVector normVec({dx(1)/dist, -dx(0)/dist});
-    
-    return normVec;
-}
-// ----------------------------------------------------------------------------
 double DarcyFlow_2D_1Phase_Fv_Tri::giveTransmissibilityCoefficientAt
-    ( const std::vector<Node*>& face
-    , Cell* targetCell
+    ( Cell* targetCell
+    , int   faceNum
     , Cell* neighborCell )
 {
-    // Unit outward normal of face
-    RealVector nhat;
-    nhat = this->giveOutwardUnitNormalOf(face);
+    // Face geometry
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
+    int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, faceNum);
     
-    double length = this->giveLengthOf(face);
-
-    // A. Target cell
-    // Coordinates of cell center
-    std::vector<RealVector> ep = this->giveEvaluationPointsFor(targetCell);
-    RealVector coor1 = ep[0];
-    
-    // Distance from cell center to midpoint of face
-    double d1 = this->giveDistanceToMidpointOf(face, coor1);
+    double nx = fg.normal[2*k];
+    double ny = fg.normal[2*k + 1];
+    double length = fg.measure[k];
+    double d1 = fg.ownerDistance[k];
+    double d2 = fg.neighborDistance[k];
     
+    // A. Target cell
     // Permeability tensor for cell
     std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
     double k_xx, k_yy, k_xy;
     k_xx = material[0]->giveParameter("Permeability_xx");
     k_yy = material[0]->giveParameter("Permeability_yy");
     k_xy = material[0]->giveParameter("Permeability_xy");
-
-    RealMatrix kmat({{k_xx, k_xy},
-                     {k_xy, k_yy}});
-                                 
-    RealVector kvec;
-    kvec = kmat*nhat;
-    double k1 = std::sqrt(kvec.dot(kvec));
-    
-    // B. Neighbor cell
-    // Coordinates of cell center
-    ep = this->giveEvaluationPointsFor(neighborCell);
-    RealVector coor2 = ep[0];
     
-    // Distance from cell center to midpoint of face
-    double d2 = this->giveDistanceToMidpointOf(face, coor2);
+    double k1 = std::sqrt((k_xx*nx + k_xy*ny)*(k_xx*nx + k_xy*ny) + (k_xy*nx + k_yy*ny)*(k_xy*nx + k_yy*ny));
     
+    // B. Neighbor cell
     // Permeability tensor for neigbor cell
     material = this->giveMaterialSetFor(neighborCell);
     k_xx = material[0]->giveParameter("Permeability_xx");
     k_yy = material[0]->giveParameter("Permeability_yy");
     k_xy = material[0]->giveParameter("Permeability_xy");
-
-    kmat = {{k_xx, k_xy},
-            {k_xy, k_yy}};
-                     
-    kvec = kmat*nhat;
-    double k2 = std::sqrt(kvec.dot(kvec));
+    
+    double k2 = std::sqrt((k_xx*nx + k_xy*ny)*(k_xx*nx + k_xy*ny) + (k_xy*nx + k_yy*ny)*(k_xy*nx + k_yy*ny));
     
     return length/(_mu*d1/k1 + _mu*d2/k2);
 }
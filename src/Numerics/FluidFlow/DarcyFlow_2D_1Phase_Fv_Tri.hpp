@@ -147,13 +147,10 @@ namespace broomstyx
         NumericsStatus_DarcyFlow_2D_1Phase_Fv_Tri*
                    getNumericsStatusAt( Cell* targetCell );        
         double     giveAreaOf( Cell* targetCell );
-        double     giveDistanceToMidpointOf( const std::vector<Node*>& face, const RealVector& coor );
         std::vector< std::vector<Node*> > 
                    giveFaceNodesOf( Cell* targetCell );
-        double     giveLengthOf( const std::vector<Node*>& face );
-        RealVector giveOutwardUnitNormalOf( const std::vector<Node*>& face );
-        double     giveTransmissibilityCoefficientAt( const std::vector<Node*>& face
-                                                , Cell* targetCell
+        double     giveTransmissibilityCoefficientAt( Cell* targetCell
+                                                , int   faceNum
                                                 , Cell* neighborCell );
         double     giveVerticalCoordinateAt( Cell* targetCell );
     };
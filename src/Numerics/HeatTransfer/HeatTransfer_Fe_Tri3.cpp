@@ -1,4 +1,5 @@
 #include "HeatTransfer_Fe_Tri3.hpp"
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <vector>
@@ -7,6 +8,7 @@
 #include "Core/ObjectFactory.hpp"
 #include "Core/DomainManager.hpp"
 #include "Materials/Material.hpp"
+#include "Util/batchLinearAlgebra.hpp"
 #include "Util/linearAlgebra.hpp"
 #include "BasisFunctions/Triangle_P1.hpp"
 
@@ -63,8 +65,7 @@ HeatTransfer_Fe_Tri3::~HeatTransfer_Fe_Tri3()
 // ----------------------------------------------------------------------------
 void HeatTransfer_Fe_Tri3::deleteNumericsAt(Cell* targetCell)
 {
-    auto cns = this->getNumericsStatusAt(targetCell);
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void HeatTransfer_Fe_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -88,21 +89,8 @@ void HeatTransfer_Fe_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& tim
 // ----------------------------------------------------------------------------
 double HeatTransfer_Fe_Tri3::giveCellFieldValueAt( Cell* targetCell, int fieldNum )
 {
-    RealVector val;
-    std::string fieldTag;
-    
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch (std::exception& e)
-    {
-        fieldTag = "unassigned";
-    }
-    
-    std::tie(val, std::ignore) = this->giveFieldOutputAt(targetCell, fieldTag);
-    
-    return val(0);
+    int outputId = this->giveFieldOutputIdFor(this->giveCellFieldTagFor(fieldNum));
+    return this->giveFieldOutputValueAt(targetCell, outputId);
 }
 // ----------------------------------------------------------------------------
 RealVector HeatTransfer_Fe_Tri3::giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum )
@@ -142,19 +130,36 @@ HeatTransfer_Fe_Tri3::giveFieldOutputAt( Cell* targetCell, const std::string& fi
     
     auto cns = this->getNumericsStatusAt(targetCell);
     weight(0) = _wt*cns->_Jdet;
+    fieldVal(0) = this->giveFieldOutputValueAt(targetCell, this->giveFieldOutputIdFor(fieldTag));
     
-    std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
-    
+    return std::make_tuple(std::move(fieldVal), std::move(weight));
+}
+// ----------------------------------------------------------------------------
+int HeatTransfer_Fe_Tri3::giveFieldOutputIdFor( const std::string& fieldTag )
+{
     if ( fieldTag == "unassigned" )
-        fieldVal(0) = 0.;
+        return fo_unassigned;
     else if ( fieldTag == "T_x" )
-        fieldVal(0) = cns->_gradT(0);
+        return fo_T_x;
     else if ( fieldTag == "T_y" )
-        fieldVal(0) = cns->_gradT(1);
+        return fo_T_y;
     else
         throw std::runtime_error("Invalid tag '" + fieldTag + "' supplied in field output request made to numerics '" + _name + "'!");
+}
+// ----------------------------------------------------------------------------
+double HeatTransfer_Fe_Tri3::giveFieldOutputValueAt( Cell* targetCell, int outputId )
+{
+    auto cns = this->getNumericsStatusAt(targetCell);
     
-    return std::make_tuple(std::move(fieldVal), std::move(weight));
+    switch ( outputId )
+    {
+        case fo_T_x:
+            return cns->_gradT(0);
+        case fo_T_y:
+            return cns->_gradT(1);
+        default:
+            return 0.;
+    }
 }
 // ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>
@@ -203,6 +208,56 @@ HeatTransfer_Fe_Tri3::giveStaticCoefficientMatrixAt( Cell*           targetCell
     return std::make_tuple(std::move(rowDof), std::move(colDof), std::move(coefVal));
 }
 // ----------------------------------------------------------------------------
+void HeatTransfer_Fe_Tri3::giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                                          , int                     stage
+                                                          , int                     subsys
+                                                          , const TimeData&         time
+                                                          , CoefficientMatrixBatch& batch )
+{
+    if ( cell.empty() || stage != _stage[0] || (subsys != _subsystem[0] && subsys != UNASSIGNED) )
+        return;
+    
+    // Element conductance matrices of up to simdBatchWidth cells are
+    // computed together, vectorized over the cells
+    double bmatBatch[2*3*simdBatchWidth], cmatBatch[2*2*simdBatchWidth], weight[simdBatchWidth];
+    double kmatBatch[3*3*simdBatchWidth], work[2*3*simdBatchWidth];
+    
+    // All cells of a batch belong to the same domain
+    std::vector<Material*> material = this->giveMaterialSetFor(cell[0]);
+    
+    int nCells = cell.size();
+    for ( int first = 0; first < nCells; first += simdBatchWidth )
+    {
+        int nLanes = std::min(simdBatchWidth, nCells - first);
+        if ( nLanes < simdBatchWidth )
+        {
+            // Unused lanes of the last batch contribute zero
+            std::fill(bmatBatch, bmatBatch + 2*3*simdBatchWidth, 0.);
+            std::fill(cmatBatch, cmatBatch + 2*2*simdBatchWidth, 0.);
+            std::fill(weight, weight + simdBatchWidth, 0.);
+        }
+        std::fill(kmatBatch, kmatBatch + 3*3*simdBatchWidth, 0.);
+        
+        for ( int lane = 0; lane < nLanes; lane++ )
+        {
+            auto cns = this->getNumericsStatusAt(cell[first + lane]);
+            
+            // Conductivity and Bmat
+            RealMatrix cmat = material[2]->giveModulusFrom(cns->_T, cns->_materialStatus);
+            RealMatrix bmat = this->giveBmatAt(cell[first + lane]);
+            
+            gatherIntoLane(bmat, lane, bmatBatch);
+            gatherIntoLane(cmat, lane, cmatBatch);
+            weight[lane] = _wt*cns->_Jdet;
+        }
+        
+        addBatchedBtCB(2, 3, bmatBatch, cmatBatch, weight, kmatBatch, work);
+        
+        for ( int lane = 0; lane < nLanes; lane++ )
+            this->appendBatchedMatrixTo(batch, this->giveNodalDofsAt(cell[first + lane]), kmatBatch, lane);
+    }
+}
+// ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>
           , RealVector >
 HeatTransfer_Fe_Tri3::giveStaticLeftHandSideAt(Cell*            targetCell
@@ -455,7 +510,7 @@ void HeatTransfer_Fe_Tri3::imposeConstraintAt( Cell*                    targetCe
 // ----------------------------------------------------------------------------
 void HeatTransfer_Fe_Tri3::initializeNumericsAt( Cell* targetCell )
 {
-    targetCell->numericsStatus = new NumericsStatus_HeatTransfer_Fe_Tri3();
+    targetCell->numericsStatus = _statusArena.create<NumericsStatus_HeatTransfer_Fe_Tri3>();
     auto cns = this->getNumericsStatusAt(targetCell);
     
     // Pre-calculate det(J) and inv(J);
@@ -70,6 +70,9 @@ namespace broomstyx
         std::tuple< RealVector,RealVector > 
             giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag ) override;
         
+        int    giveFieldOutputIdFor( const std::string& fieldTag ) override;
+        double giveFieldOutputValueAt( Cell* targetCell, int outputId ) override;
+        
         std::tuple< std::vector<Dof*>
                   , std::vector<Dof*>
                   , RealVector >
@@ -78,6 +81,13 @@ namespace broomstyx
                                          , int             subsys
                                          , const TimeData& time ) override;
         
+        void
+            giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                           , int                     stage
+                                           , int                     subsys
+                                           , const TimeData&         time
+                                           , CoefficientMatrixBatch& batch ) override;
+        
         std::tuple< std::vector<Dof*>, RealVector >
             giveStaticLeftHandSideAt( Cell*           targetCell
                                     , int             stage
@@ -120,6 +130,13 @@ namespace broomstyx
         void setDofStagesAt( Cell* targetCell ) override;
 
     private:
+        enum FieldOutput
+        {
+            fo_unassigned,
+            fo_T_x,
+            fo_T_y
+        };
+        
         Triangle_P1 _basisFunction;
         RealVector  _basisFunctionValues;
         RealMatrix  _basisFunctionDerivatives;
@@ -22,7 +22,9 @@
 */
 
 #include "Mech_Fe_Tet4.hpp"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <string>
 #include <vector>
 #include "Core/AnalysisModel.hpp"
@@ -30,6 +32,7 @@
 #include "Core/ObjectFactory.hpp"
 #include "Core/DomainManager.hpp"
 #include "Materials/Material.hpp"
+#include "Util/batchLinearAlgebra.hpp"
 #include "Util/linearAlgebra.hpp"
 #include "BasisFunctions/Triangle_P1.hpp"
 
@@ -41,8 +44,8 @@ registerBroomstyxObject(Numerics, Mech_Fe_Tet4)
 NumericsStatus_Mech_Fe_Tet4::NumericsStatus_Mech_Fe_Tet4()
     : _strain(RealVector(6))
     , _stress(RealVector(6))
-    , _gradU(RealMatrix(3,3))
     , _materialStatus {nullptr, nullptr}
+    , _cmatRevision(-1)
 {}
 
 NumericsStatus_Mech_Fe_Tet4::~NumericsStatus_Mech_Fe_Tet4()
@@ -89,7 +92,7 @@ void Mech_Fe_Tet4::deleteNumericsAt(Cell* targetCell)
     material[0]->destroy(cns->_materialStatus[0]);
     material[1]->destroy(cns->_materialStatus[1]);
     
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void Mech_Fe_Tet4::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -122,25 +125,16 @@ void Mech_Fe_Tet4::finalizeDataAt( Cell* targetCell, const TimeData& time )
 
     // Get stress
     cns->_stress = material[1]->giveForceFrom(cns->_strain, cns->_materialStatus[1]);
+    
+    // Tangent modulus of a nonlinear material follows the strain
+    if ( !material[1]->hasConstantModulus() )
+        targetCell->flagCoefficientMatrixChange();
 }
 // ----------------------------------------------------------------------------
 double Mech_Fe_Tet4::giveCellFieldValueAt( Cell* targetCell, int fieldNum )
 {
-    RealVector val;
-    std::string fieldTag;
-    
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch (std::exception& e)
-    {
-        fieldTag = "unassigned";
-    }
-    
-    std::tie(val, std::ignore) = this->giveFieldOutputAt(targetCell, fieldTag);
-    
-    return val(0);
+    int outputId = this->giveFieldOutputIdFor(this->giveCellFieldTagFor(fieldNum));
+    return this->giveFieldOutputValueAt(targetCell, outputId);
 }
 // ----------------------------------------------------------------------------
 RealVector Mech_Fe_Tet4::giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum )
@@ -149,6 +143,35 @@ RealVector Mech_Fe_Tet4::giveCellNodeFieldValuesAt( Cell* targetCell, int fieldN
     return RealVector({val, val, val, val});
 }
 // ----------------------------------------------------------------------------
+double Mech_Fe_Tet4::giveCriticalTimeStepAt( Cell* targetCell, int stage )
+{
+    double dt = std::numeric_limits<double>::max();
+    
+    if ( stage == _stage[0] )
+    {
+        auto cns = this->getNumericsStatusAt(targetCell);
+        
+        // Upper bound of wave speed from density and tangent modulus
+        std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
+        double rho = material[0]->giveMaterialVariable("Density", cns->_materialStatus[0]);
+        RealMatrix cmat = material[1]->giveModulusFrom(cns->_strain, cns->_materialStatus[1]);
+        double c = this->giveMaximumWaveSpeedFrom(cmat, rho);
+        
+        // The smallest altitude of the tetrahedron is the reciprocal of the
+        // largest basis function gradient. The factor 1/sqrt(3) accounts for
+        // the element shape and keeps the estimate below the stability limit
+        // of the lumped mass element.
+        RealMatrix dpsi = this->giveGradBmatAt(targetCell);
+        double maxGradSq = 0.;
+        for ( int i = 0; i < 4; i++ )
+            maxGradSq = std::max(maxGradSq, dpsi(0,i)*dpsi(0,i) + dpsi(1,i)*dpsi(1,i) + dpsi(2,i)*dpsi(2,i));
+        
+        dt = 1./(c*std::sqrt(3.*maxGradSq));
+    }
+    
+    return dt;
+}
+// ----------------------------------------------------------------------------
 std::vector<RealVector> Mech_Fe_Tet4::giveEvaluationPointsFor( Cell *targetCell)
 {
     std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(targetCell);
@@ -174,124 +197,156 @@ Mech_Fe_Tet4::giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag )
     
     auto cns = this->getNumericsStatusAt(targetCell);
     weight(0) = _wt*cns->_Jdet;
+    fieldVal(0) = this->giveFieldOutputValueAt(targetCell, this->giveFieldOutputIdFor(fieldTag));
     
-    std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
-    
+    return std::make_tuple(std::move(fieldVal), std::move(weight));
+}
+// ----------------------------------------------------------------------------
+int Mech_Fe_Tet4::giveFieldOutputIdFor( const std::string& fieldTag )
+{
     if ( fieldTag == "unassigned" )
-        fieldVal(0) = 0.;
+        return fo_unassigned;
     else if ( fieldTag == "s_xx" )
-        fieldVal(0) = cns->_stress(0);
+        return fo_s_xx;
     else if ( fieldTag == "s_yy" )
-        fieldVal(0) = cns->_stress(1);
+        return fo_s_yy;
     else if ( fieldTag == "s_zz" )
-        fieldVal(0) = cns->_stress(2);
+        return fo_s_zz;
     else if ( fieldTag == "s_yz" )
-        fieldVal(0) = cns->_stress(3);
+        return fo_s_yz;
     else if ( fieldTag == "s_xz" )
-        fieldVal(0) = cns->_stress(4);
+        return fo_s_xz;
     else if ( fieldTag == "s_xy" )
-        fieldVal(0) = cns->_stress(5);
+        return fo_s_xy;
     else if ( fieldTag == "ux_x" )
-        fieldVal(0) = cns->_gradU(0,0);
+        return fo_ux_x;
     else if ( fieldTag == "uy_x" )
-        fieldVal(0) = cns->_gradU(0,1);
+        return fo_uy_x;
     else if ( fieldTag == "uz_x" )
-        fieldVal(0) = cns->_gradU(0,2);
+        return fo_uz_x;
     else if ( fieldTag == "ux_y" )
-        fieldVal(0) = cns->_gradU(1,0);
+        return fo_ux_y;
     else if ( fieldTag == "uy_y" )
-        fieldVal(0) = cns->_gradU(1,1);
+        return fo_uy_y;
     else if ( fieldTag == "uz_y" )
-        fieldVal(0) = cns->_gradU(1,2);
+        return fo_uz_y;
     else if ( fieldTag == "ux_z" )
-        fieldVal(0) = cns->_gradU(2,0);
+        return fo_ux_z;
     else if ( fieldTag == "uy_z" )
-        fieldVal(0) = cns->_gradU(2,1);
+        return fo_uy_z;
     else if ( fieldTag == "uz_z" )
-        fieldVal(0) = cns->_gradU(2,2);
+        return fo_uz_z;
     else if ( fieldTag == "g_yz" )
-        fieldVal(0) = cns->_gradU(1,2) + cns->_gradU(2,1);
+        return fo_g_yz;
     else if ( fieldTag == "g_xz" )
-        fieldVal(0) = cns->_gradU(2,0) + cns->_gradU(0,2);
+        return fo_g_xz;
     else if ( fieldTag == "g_xy" )
-        fieldVal(0) = cns->_gradU(1,0) + cns->_gradU(0,1);
+        return fo_g_xy;
     else if ( fieldTag == "ep_xx" )
-    {
-        try
-        {
-            fieldVal(0) = material[1]->giveMaterialVariable("plasticStrain_xx", cns->_materialStatus[1]);
-        }
-        catch (...)
-        {
-            fieldVal(0) = 0.;
-        }
-    }
+        return this->hasMaterialVariable(1, "plasticStrain_xx") ? fo_ep_xx : fo_unassigned;
     else if ( fieldTag == "ep_yy" )
-    {
-        try
-        {
-            fieldVal(0) = material[1]->giveMaterialVariable("plasticStrain_yy", cns->_materialStatus[1]);
-        }
-        catch (...)
-        {
-            fieldVal(0) = 0.;
-        }
-    }
+        return this->hasMaterialVariable(1, "plasticStrain_yy") ? fo_ep_yy : fo_unassigned;
     else if ( fieldTag == "ep_zz" )
-    {
-        try
-        {
-            fieldVal(0) = material[1]->giveMaterialVariable("plasticStrain_zz", cns->_materialStatus[1]);
-        }
-        catch (...)
-        {
-            fieldVal(0) = 0.;
-        }
-    }
+        return this->hasMaterialVariable(1, "plasticStrain_zz") ? fo_ep_zz : fo_unassigned;
     else if ( fieldTag == "gp_yz" )
-    {
-        try
-        {
-            fieldVal(0) = material[1]->giveMaterialVariable("plasticStrain_yz", cns->_materialStatus[1]);
-        }
-        catch (...)
-        {
-            fieldVal(0) = 0.;
-        }
-    }
+        return this->hasMaterialVariable(1, "plasticStrain_yz") ? fo_ep_yz : fo_unassigned;
     else if ( fieldTag == "ep_xz" )
+        return this->hasMaterialVariable(1, "plasticStrain_xz") ? fo_ep_xz : fo_unassigned;
+    else if ( fieldTag == "ep_xy" )
+        return this->hasMaterialVariable(1, "plasticStrain_xy") ? fo_ep_xy : fo_unassigned;
+    else if ( fieldTag == "ene" )
+        return fo_ene;
+    else
+        throw std::runtime_error("Invalid tag '" + fieldTag + "' supplied in field output request made to numerics '" + _name + "'!");
+}
+// ----------------------------------------------------------------------------
+double Mech_Fe_Tet4::giveFieldOutputValueAt( Cell* targetCell, int outputId )
+{
+    auto cns = this->getNumericsStatusAt(targetCell);
+    
+    switch ( outputId )
     {
-        try
-        {
-            fieldVal(0) = material[1]->giveMaterialVariable("plasticStrain_xz", cns->_materialStatus[1]);
-        }
-        catch (...)
+        case fo_s_xx:
+            return cns->_stress(0);
+        case fo_s_yy:
+            return cns->_stress(1);
+        case fo_s_zz:
+            return cns->_stress(2);
+        case fo_s_yz:
+            return cns->_stress(3);
+        case fo_s_xz:
+            return cns->_stress(4);
+        case fo_s_xy:
+            return cns->_stress(5);
+        case fo_ux_x:
+            return cns->_gradU(0,0);
+        case fo_uy_x:
+            return cns->_gradU(0,1);
+        case fo_uz_x:
+            return cns->_gradU(0,2);
+        case fo_ux_y:
+            return cns->_gradU(1,0);
+        case fo_uy_y:
+            return cns->_gradU(1,1);
+        case fo_uz_y:
+            return cns->_gradU(1,2);
+        case fo_ux_z:
+            return cns->_gradU(2,0);
+        case fo_uy_z:
+            return cns->_gradU(2,1);
+        case fo_uz_z:
+            return cns->_gradU(2,2);
+        case fo_g_yz:
+            return cns->_gradU(1,2) + cns->_gradU(2,1);
+        case fo_g_xz:
+            return cns->_gradU(2,0) + cns->_gradU(0,2);
+        case fo_g_xy:
+            return cns->_gradU(1,0) + cns->_gradU(0,1);
+        case fo_ep_xx:
+        case fo_ep_yy:
+        case fo_ep_zz:
+        case fo_ep_yz:
+        case fo_ep_xz:
+        case fo_ep_xy:
         {
-            fieldVal(0) = 0.;
+            // Only reached if the materials provide plastic strains (see giveFieldOutputIdFor)
+            const char* varName[] = {"plasticStrain_xx", "plasticStrain_yy", "plasticStrain_zz", "plasticStrain_yz", "plasticStrain_xz", "plasticStrain_xy"};
+            std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
+            return material[1]->giveMaterialVariable(varName[outputId - fo_ep_xx], cns->_materialStatus[1]);
         }
+        case fo_ene:
+            return 0.5*(cns->_stress(0)*cns->_gradU(0,0) +
+                        cns->_stress(1)*cns->_gradU(1,1) +
+                        cns->_stress(2)*cns->_gradU(2,2) +
+                        cns->_stress(3)*(cns->_gradU(1,2) + cns->_gradU(2,1)) +
+                        cns->_stress(3)*(cns->_gradU(0,2) + cns->_gradU(2,0)) +
+                        cns->_stress(3)*(cns->_gradU(0,1) + cns->_gradU(1,0)));
+        default:
+            return 0.;
     }
-    else if ( fieldTag == "ep_xy" )
+}
+// ----------------------------------------------------------------------------
+std::tuple< std::vector<Dof*>, RealVector >
+Mech_Fe_Tet4::giveLumpedMassAt( Cell* targetCell, int stage, int subsys )
+{
+    std::vector<Dof*> rowDof;
+    RealVector mass;
+    
+    if ( stage == _stage[0] && (subsys == _subsystem[0] || subsys == UNASSIGNED) )
     {
-        try
-        {
-            fieldVal(0) = material[1]->giveMaterialVariable("plasticStrain_xy", cns->_materialStatus[1]);
-        }
-        catch (...)
-        {
-            fieldVal(0) = 0.;
-        }
+        auto cns = this->getNumericsStatusAt(targetCell);
+        
+        std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
+        double rho = material[0]->giveMaterialVariable("Density", cns->_materialStatus[0]);
+        
+        // Element mass is distributed equally among the nodes
+        rowDof = this->giveNodalDofsAt(targetCell);
+        mass.init(12);
+        for ( int i = 0; i < 12; i++ )
+            mass(i) = rho*_wt*cns->_Jdet/4.0;
     }
-    else if ( fieldTag == "ene" )
-        fieldVal(0) = 0.5*(cns->_stress(0)*cns->_gradU(0,0) +
-                           cns->_stress(1)*cns->_gradU(1,1) +
-                           cns->_stress(2)*cns->_gradU(2,2) +
-                           cns->_stress(3)*(cns->_gradU(1,2) + cns->_gradU(2,1)) +
-                           cns->_stress(3)*(cns->_gradU(0,2) + cns->_gradU(2,0)) +
-                           cns->_stress(3)*(cns->_gradU(0,1) + cns->_gradU(1,0)));
-    else
-        throw std::runtime_error("Invalid tag '" + fieldTag + "' supplied in field output request made to numerics '" + _name + "'!");
     
-    return std::make_tuple(std::move(fieldVal), std::move(weight));
+    return std::make_tuple(std::move(rowDof), std::move(mass));
 }
 // ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>
@@ -341,6 +396,94 @@ Mech_Fe_Tet4::giveStaticCoefficientMatrixAt( Cell*           targetCell
     return std::make_tuple(std::move(rowDof), std::move(colDof), std::move(coefVal));
 }
 // ----------------------------------------------------------------------------
+void Mech_Fe_Tet4::giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                                  , int                     stage
+                                                  , int                     subsys
+                                                  , const TimeData&         time
+                                                  , CoefficientMatrixBatch& batch )
+{
+    if ( cell.empty() || stage != _stage[0] || (subsys != _subsystem[0] && subsys != UNASSIGNED) )
+        return;
+    
+    // Element stiffness matrices of up to simdBatchWidth cells are computed
+    // together, with the integrand trp(B)*C*B vectorized over the cells
+    double bmatBatch[6*12*simdBatchWidth], cmatBatch[6*6*simdBatchWidth], weight[simdBatchWidth];
+    double kmatBatch[12*12*simdBatchWidth], work[6*12*simdBatchWidth];
+    
+    // All cells of a batch belong to the same domain
+    std::vector<Material*> material = this->giveMaterialSetFor(cell[0]);
+    
+    int nCells = cell.size();
+    for ( int first = 0; first < nCells; first += simdBatchWidth )
+    {
+        int nLanes = std::min(simdBatchWidth, nCells - first);
+        if ( nLanes < simdBatchWidth )
+        {
+            // Unused lanes of the last batch contribute zero
+            std::fill(bmatBatch, bmatBatch + 6*12*simdBatchWidth, 0.);
+            std::fill(cmatBatch, cmatBatch + 6*6*simdBatchWidth, 0.);
+            std::fill(weight, weight + simdBatchWidth, 0.);
+        }
+        std::fill(kmatBatch, kmatBatch + 12*12*simdBatchWidth, 0.);
+        
+        for ( int lane = 0; lane < nLanes; lane++ )
+        {
+            auto cns = this->getNumericsStatusAt(cell[first + lane]);
+            
+            // Tangent modulus and Bmat
+            RealMatrix cmat = material[1]->giveModulusFrom(cns->_strain, cns->_materialStatus[1]);
+            RealMatrix bmat = this->giveBmatAt(cell[first + lane]);
+            
+            gatherIntoLane(bmat, lane, bmatBatch);
+            gatherIntoLane(cmat, lane, cmatBatch);
+            weight[lane] = _wt*cns->_Jdet;
+        }
+        
+        addBatchedBtCB(6, 12, bmatBatch, cmatBatch, weight, kmatBatch, work);
+        
+        for ( int lane = 0; lane < nLanes; lane++ )
+            this->appendBatchedMatrixTo(batch, this->giveNodalDofsAt(cell[first + lane]), kmatBatch, lane);
+    }
+}
+// ----------------------------------------------------------------------------
+std::tuple< std::vector<Dof*>, RealVector >
+Mech_Fe_Tet4::giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                                  , int               stage
+                                                  , int               subsys
+                                                  , const TimeData&   time
+                                                  , const RealVector& x )
+{
+    std::vector<Dof*> rowDof;
+    RealVector product;
+    
+    if ( stage == _stage[0] && ( subsys == _subsystem[0] || subsys == UNASSIGNED ) )
+    {
+        // Retrieve nodal DOFs local to element
+        rowDof = this->giveNodalDofsAt(targetCell);
+        
+        // Gather local values of global vector (constrained DOFs contribute
+        // nothing to the product)
+        RealVector xloc(12);
+        for ( int i = 0; i < 12; i++ )
+        {
+            int eqNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+            if ( eqNum != UNASSIGNED )
+                xloc(i) = x(eqNum);
+        }
+        
+        // Retrieve numerics status
+        auto cns = this->getNumericsStatusAt(targetCell);
+        if ( cns->_cmatRevision != targetCell->giveCoefficientMatrixRevision() )
+            this->updateProductDataAt(targetCell);
+        
+        // Apply stiffness without forming it
+        product.init(12);
+        addBtCBx(6, 12, cns->_bmat.ptr(), cns->_cmat.ptr(), _wt*cns->_Jdet, xloc.ptr(), product.ptr());
+    }
+    
+    return std::make_tuple(std::move(rowDof), std::move(product));
+}
+// ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>
           , RealVector >
 Mech_Fe_Tet4::giveStaticLeftHandSideAt(Cell*            targetCell
@@ -368,6 +511,8 @@ Mech_Fe_Tet4::giveStaticLeftHandSideAt(Cell*            targetCell
         std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
         material[1]->updateStatusFrom(cns->_strain, cns->_materialStatus[1]);
         cns->_stress = material[1]->giveForceFrom(cns->_strain, cns->_materialStatus[1]);
+        if ( !material[1]->hasConstantModulus() )
+            targetCell->flagCoefficientMatrixChange();
 
         // Calculate lhs
         lhs = _wt*cns->_Jdet*trp(bmat)*cns->_stress;
@@ -565,7 +710,7 @@ void Mech_Fe_Tet4::initializeNumericsAt( Cell* targetCell )
     if ( nNodes != 4 )
         throw std::runtime_error("ERROR: Domain cell with " + std::to_string(nNodes) + " nodes detected! 'Mech_Fe_Tet4' requires 4-node tetrahedra.\n");
 
-    targetCell->numericsStatus = new NumericsStatus_Mech_Fe_Tet4();
+    targetCell->numericsStatus = _statusArena.create<NumericsStatus_Mech_Fe_Tet4>();
     auto cns = this->getNumericsStatusAt(targetCell);
     
     // Pre-calculate det(J) and inv(J);
@@ -599,6 +744,17 @@ void Mech_Fe_Tet4::setDofStagesAt( Cell* targetCell )
         analysisModel().dofManager().setStageFor(dof_z, _stage[0]);
     }
 }
+// ----------------------------------------------------------------------------
+bool Mech_Fe_Tet4::tracksCoefficientMatrixChanges()
+{
+    return true;
+}
+// ----------------------------------------------------------------------------
+bool Mech_Fe_Tet4::hasStateIndependentRightHandSide()
+{
+    // Body forces depend only on the cell geometry and the density
+    return true;
+}
 
 // Private methods
 // ---------------------------------------------------------------------------
@@ -678,3 +834,22 @@ std::vector<Dof*> Mech_Fe_Tet4::giveNodalDofsAt( Cell* targetCell )
     }
     return dof;
 }
+// ----------------------------------------------------------------------------
+void Mech_Fe_Tet4::updateProductDataAt( Cell* targetCell )
+{
+    // The strain-displacement matrix is computed once, whereas the tangent
+    // modulus is renewed whenever the coefficient matrix revision of the
+    // cell has changed
+    auto cns = this->getNumericsStatusAt(targetCell);
+    std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
+    
+    if ( cns->_bmat.dim1() == 0 )
+    {
+        cns->_bmat = this->giveBmatAt(targetCell);
+        cns->_bmat.simplify();
+    }
+    
+    cns->_cmat = material[1]->giveModulusFrom(cns->_strain, cns->_materialStatus[1]);
+    cns->_cmat.simplify();
+    cns->_cmatRevision = targetCell->giveCoefficientMatrixRevision();
+}
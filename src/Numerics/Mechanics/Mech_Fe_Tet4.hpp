@@ -68,6 +68,7 @@
 #define	MECH_FE_TET4_HPP
 
 #include "Numerics/Numerics.hpp"
+#include "Util/StackRealMatrix.hpp"
 #include "Core/DofManager.hpp"
 #include "Core/NumericsManager.hpp"
 #include "BasisFunctions/Tetrahedron_P1.hpp"
@@ -87,10 +88,15 @@ namespace broomstyx
     private:
         RealVector _strain;
         RealVector _stress;
-        RealMatrix _gradU;
+        StackRealMatrix<3,3> _gradU;
         RealMatrix _JmatInv;
         double     _Jdet;
         MaterialStatus* _materialStatus[2];
+        
+        // Data cached for matrix-free products and revision of the tangent
+        RealMatrix _bmat;
+        RealMatrix _cmat;
+        int        _cmatRevision;
     };
     
     class Mech_Fe_Tet4 final : public Numerics 
@@ -106,12 +112,20 @@ namespace broomstyx
         RealVector 
             giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum ) override;
         
+        double giveCriticalTimeStepAt( Cell* targetCell, int stage ) override;
+        
         std::vector<RealVector> 
             giveEvaluationPointsFor( Cell* targetCell ) override;
         
         std::tuple< RealVector,RealVector > 
             giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag ) override;
         
+        int    giveFieldOutputIdFor( const std::string& fieldTag ) override;
+        double giveFieldOutputValueAt( Cell* targetCell, int outputId ) override;
+        
+        std::tuple< std::vector<Dof*>, RealVector >
+            giveLumpedMassAt( Cell* targetCell, int stage, int subsys ) override;
+        
         std::tuple< std::vector<Dof*>
                   , std::vector<Dof*>
                   , RealVector >
@@ -120,6 +134,20 @@ namespace broomstyx
                                          , int             subsys
                                          , const TimeData& time ) override;
         
+        void
+            giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                           , int                     stage
+                                           , int                     subsys
+                                           , const TimeData&         time
+                                           , CoefficientMatrixBatch& batch ) override;
+        
+        std::tuple< std::vector<Dof*>, RealVector >
+            giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                                , int               stage
+                                                , int               subsys
+                                                , const TimeData&   time
+                                                , const RealVector& x ) override;
+        
         std::tuple< std::vector<Dof*>, RealVector >
             giveStaticLeftHandSideAt( Cell*           targetCell
                                     , int             stage
@@ -148,8 +176,40 @@ namespace broomstyx
         void initializeMaterialsAt( Cell* targetCell ) override;
         void initializeNumericsAt( Cell* targetCell ) override;
         void setDofStagesAt( Cell* targetCell ) override;
+        bool tracksCoefficientMatrixChanges() override;
+        bool hasStateIndependentRightHandSide() override;
 
     private:
+        enum FieldOutput
+        {
+            fo_unassigned,
+            fo_s_xx,
+            fo_s_yy,
+            fo_s_zz,
+            fo_s_yz,
+            fo_s_xz,
+            fo_s_xy,
+            fo_ux_x,
+            fo_uy_x,
+            fo_uz_x,
+            fo_ux_y,
+            fo_uy_y,
+            fo_uz_y,
+            fo_ux_z,
+            fo_uy_z,
+            fo_uz_z,
+            fo_g_yz,
+            fo_g_xz,
+            fo_g_xy,
+            fo_ep_xx,
+            fo_ep_yy,
+            fo_ep_zz,
+            fo_ep_yz,
+            fo_ep_xz,
+            fo_ep_xy,
+            fo_ene
+        };
+        
         Tetrahedron_P1 _basisFunction;
         RealVector  _basisFunctionValues;
         RealMatrix  _basisFunctionDerivatives;
@@ -164,6 +224,7 @@ namespace broomstyx
         RealMatrix giveJacobianMatrixAt( Cell* targetCell, const RealVector& natCoor );
         RealVector giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType );
         std::vector<Dof*> giveNodalDofsAt( Cell* targetCell );
+        void       updateProductDataAt( Cell* targetCell );
     };
 }
 
@@ -45,11 +45,9 @@ NumericsStatus_PhaseFieldFracture_FeFv_Tri3::NumericsStatus_PhaseFieldFracture_F
     , _phiOld( 0. )
     , _strain( RealVector( 4 ) )
     , _stress( RealVector( 4 ) )
-    , _gradU( RealMatrix( 2,2 ) )
     , _crackDensity( 0. )
     , _surfEgy( 0. )
     , _bulkEgy( 0. )
-    , _gradPhi( RealVector( 2 ) )
     , _Gc( 0. )
     , _Gbulk( 0. )
     , _histFld( 0. )
@@ -111,7 +109,7 @@ void PhaseFieldFracture_FeFv_Tri3::deleteNumericsAt( Cell* targetCell )
     material[ 1 ]->destroy( cns->_materialStatus[ 1 ] );
     material[ 2 ]->destroy( cns->_materialStatus[ 2 ] );
 
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void PhaseFieldFracture_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -134,7 +132,7 @@ void PhaseFieldFracture_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeD
     // A. Calculate phase-field flux at faces
     std::vector<Node*> node;
     node = analysisModel().domainManager().giveNodesOf( targetCell );
-    std::vector<std::vector<Node*> > face = giveFaceNodesOf( targetCell );
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
     
     // Get cell neighbors
     std::vector<Cell*> neighbor = analysisModel().domainManager().giveNeighborsOf( targetCell );
@@ -142,8 +140,10 @@ void PhaseFieldFracture_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeD
     // Cycle through faces
     for ( int i = 0; i < 3; i++ )
     {
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf( targetCell, i );
+        
         // Length of face
-        double length = giveLengthOf( face[ i ] );
+        double length = fg.measure[k];
         
         // Phase-field gradient calculation
         double d_pf_n;
@@ -151,7 +151,7 @@ void PhaseFieldFracture_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeD
         if ( cns->_hasPhsFldPrescribedOnFace[ i ] )
         {
             // Distance from cell center to face midpoint
-            double d1 = giveDistanceToMidpointOf( face[ i ], cellCoor );
+            double d1 = fg.ownerDistance[k];
 
             d_pf_n = ( cns->_valueOnFace[ i ] - cns->_phi ) / d1;
         }
@@ -179,7 +179,8 @@ void PhaseFieldFracture_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeD
 
     for ( int i = 0; i < 3; i++ )
     {
-        double length = this->giveLengthOf( face[ i ] );
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf( targetCell, i );
+        double length = fg.measure[k];
         RealVector vtxNodeCoor = analysisModel().domainManager().giveCoordinatesOf( vertexNode[ i ] );
         d_pf = d_pf + cns->_valueOnFace[ i ] * length / ( 2. * cns->_area ) * ( cellCoor - vtxNodeCoor );
     }
@@ -243,21 +244,8 @@ void PhaseFieldFracture_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeD
 // ----------------------------------------------------------------------------
 double PhaseFieldFracture_FeFv_Tri3::giveCellFieldValueAt( Cell* targetCell, int fieldNum )
 {
-    RealVector val, wt;
-    std::string fieldTag;
-    
-    try
-    {
-        fieldTag = _cellFieldOutput.at( fieldNum );
-    }
-    catch ( std::exception& e )
-    {
-        fieldTag = "unassigned";
-    }
-    
-    std::tie( val,wt ) = this->giveFieldOutputAt( targetCell, fieldTag );
-    
-    return val( 0 );
+    int outputId = this->giveFieldOutputIdFor( this->giveCellFieldTagFor( fieldNum ) );
+    return this->giveFieldOutputValueAt( targetCell, outputId );
 }
 // ----------------------------------------------------------------------------
 RealVector PhaseFieldFracture_FeFv_Tri3::giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum )
@@ -293,52 +281,103 @@ PhaseFieldFracture_FeFv_Tri3::giveFieldOutputAt( Cell* targetCell, const std::st
     
     auto cns = this->getNumericsStatusAt( targetCell );
     weight( 0 ) = cns->_area;
+    fieldVal( 0 ) = this->giveFieldOutputValueAt( targetCell, this->giveFieldOutputIdFor( fieldTag ) );
     
+    return std::make_tuple(std::move( fieldVal ), std::move( weight ) );
+}
+// ----------------------------------------------------------------------------
+int PhaseFieldFracture_FeFv_Tri3::giveFieldOutputIdFor( const std::string& fieldTag )
+{
     if ( fieldTag == "unassigned" )
-        fieldVal( 0 ) = 0.;
+        return fo_unassigned;
     else if ( fieldTag == "s_xx" )
-        fieldVal( 0 ) = cns->_stress( 0 );
+        return fo_s_xx;
     else if ( fieldTag == "s_yy" )
-        fieldVal( 0 ) = cns->_stress( 1 );
+        return fo_s_yy;
     else if ( fieldTag == "s_zz" )
-        fieldVal( 0 ) = cns->_stress( 2 );
+        return fo_s_zz;
     else if ( fieldTag == "s_xy" )
-        fieldVal( 0 ) = cns->_stress( 3 );
+        return fo_s_xy;
     else if ( fieldTag == "ux_x" )
-        fieldVal( 0 ) = cns->_gradU( 0,0 );
+        return fo_ux_x;
     else if ( fieldTag == "uy_x" )
-        fieldVal( 0 ) = cns->_gradU( 0,1 );
+        return fo_uy_x;
     else if ( fieldTag == "ux_y" )
-        fieldVal( 0 ) = cns->_gradU( 1,0 );
+        return fo_ux_y;
     else if ( fieldTag == "uy_y" )
-        fieldVal( 0 ) = cns->_gradU( 1,1 );
+        return fo_uy_y;
     else if ( fieldTag == "g_xy" )
-        fieldVal( 0 ) = cns->_strain( 3 );
+        return fo_g_xy;
     else if ( fieldTag == "pf" )
-        fieldVal( 0 ) = cns->_phi;
+        return fo_pf;
     else if ( fieldTag == "ene_s" )
-        fieldVal( 0 ) = cns->_surfEgy;
+        return fo_ene_s;
     else if ( fieldTag == "ene_b" )
-        fieldVal( 0 ) = cns->_bulkEgy;
+        return fo_ene_b;
     else if ( fieldTag == "cr_len" )
-        fieldVal( 0 ) = cns->_crackDensity;
+        return fo_cr_len;
     else if ( fieldTag == "Gc" )
-        fieldVal(0) = cns->_Gc;
+        return fo_Gc;
     else if ( fieldTag == "Gbulk" )
-        fieldVal(0) = cns->_Gbulk;
+        return fo_Gbulk;
     else if ( fieldTag == "pf_x" )
-        fieldVal( 0 ) = cns->_gradPhi( 0 );
+        return fo_pf_x;
     else if ( fieldTag == "pf_y" )
-        fieldVal( 0 ) = cns->_gradPhi( 1 );
+        return fo_pf_y;
     else if ( fieldTag == "pfEq_resid" )
-    {
-        Dof* dof_phi = analysisModel().domainManager().giveCellDof( _cellDof[ 0 ], targetCell );
-        fieldVal( 0 ) = DofManager::giveValueOfResidualAt( dof_phi );
-    }
+        return fo_pfEq_resid;
     else
         throw std::runtime_error( "Invalid tag '" + fieldTag + "' supplied in field output request!\nSource: " + _name );
+}
+// ----------------------------------------------------------------------------
+double PhaseFieldFracture_FeFv_Tri3::giveFieldOutputValueAt( Cell* targetCell, int outputId )
+{
+    auto cns = this->getNumericsStatusAt( targetCell );
     
-    return std::make_tuple(std::move( fieldVal ), std::move( weight ) );
+    switch ( outputId )
+    {
+        case fo_s_xx:
+            return cns->_stress( 0 );
+        case fo_s_yy:
+            return cns->_stress( 1 );
+        case fo_s_zz:
+            return cns->_stress( 2 );
+        case fo_s_xy:
+            return cns->_stress( 3 );
+        case fo_ux_x:
+            return cns->_gradU( 0,0 );
+        case fo_uy_x:
+            return cns->_gradU( 0,1 );
+        case fo_ux_y:
+            return cns->_gradU( 1,0 );
+        case fo_uy_y:
+            return cns->_gradU( 1,1 );
+        case fo_g_xy:
+            return cns->_strain( 3 );
+        case fo_pf:
+            return cns->_phi;
+        case fo_ene_s:
+            return cns->_surfEgy;
+        case fo_ene_b:
+            return cns->_bulkEgy;
+        case fo_cr_len:
+            return cns->_crackDensity;
+        case fo_Gc:
+            return cns->_Gc;
+        case fo_Gbulk:
+            return cns->_Gbulk;
+        case fo_pf_x:
+            return cns->_gradPhi( 0 );
+        case fo_pf_y:
+            return cns->_gradPhi( 1 );
+        case fo_pfEq_resid:
+        {
+            Dof* dof_phi = analysisModel().domainManager().giveCellDof( _cellDof[ 0 ], targetCell );
+            return DofManager::giveValueOfResidualAt( dof_phi );
+        }
+        default:
+            return 0.;
+    }
 }
 // ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>, std::vector<Dof*>, RealVector >
@@ -425,21 +464,17 @@ PhaseFieldFracture_FeFv_Tri3::giveStaticCoefficientMatrixAt( Cell*           tar
             colDof[ startIdx ] = dof_phi;
             coefVal( startIdx ) = coef;
             
-            std::vector<std::vector<Node*> > face = giveFaceNodesOf( targetCell );
+            const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
             
             // Cycle through faces
             for ( int i = 0; i < 3; i++ )
             {
-                double length = giveLengthOf( face[ i ] );
                 if ( cns->_hasPhsFldPrescribedOnFace[ i ] )
                 {
-                    // Get coordinate of cell center
-                    std::vector<RealVector> epCoor;
-                    epCoor = this->giveEvaluationPointsFor( targetCell );
-                    RealVector cellCoor = epCoor[ 0 ];
-                    
-                    // Distance from cell to face midpoint
-                    double d1 = giveDistanceToMidpointOf( face[ i ], cellCoor );
+                    // Face length and distance from cell to face midpoint
+                    int k = analysisModel().domainManager().giveFaceGeometryIndexOf( targetCell, i );
+                    double length = fg.measure[ k ];
+                    double d1 = fg.ownerDistance[ k ];
                     
                     coefVal( startIdx ) += length * _l * _l / d1;
                 }
@@ -538,17 +573,10 @@ PhaseFieldFracture_FeFv_Tri3::giveStaticLeftHandSideAt( Cell*           targetCe
         
         if ( subsys == _subsystem[ 1 ] || subsys == UNASSIGNED )
         {
-            // Get coordinate of cell center and cell area
-            std::vector<RealVector> epCoor = this->giveEvaluationPointsFor( targetCell );
-            RealVector cellCoor = epCoor[ 0 ];
-
             // normal phase-field flux on edges
             RealVector normFlux( 3 );
 
-            std::vector<Node*> node;
-            node = analysisModel().domainManager().giveNodesOf( targetCell );
-
-            std::vector<std::vector<Node*> > face = giveFaceNodesOf( targetCell );
+            const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
 
             // Get cell neighbors
             std::vector<Cell*> neighbor = analysisModel().domainManager().giveNeighborsOf( targetCell );
@@ -558,7 +586,7 @@ PhaseFieldFracture_FeFv_Tri3::giveStaticLeftHandSideAt( Cell*           targetCe
             {
                 for ( int i = 0; i < 3; i++ )
                     if ( !cns->_hasPhsFldPrescribedOnFace[ i ] && !cns->_hasPhsFldGradientPrescribedOnFace[ i ] )
-                        cns->_transmissibility[ i ] = this->giveTransmissibilityCoefficientAt( face[ i ], targetCell, neighbor[ i ] );
+                        cns->_transmissibility[ i ] = this->giveTransmissibilityCoefficientAt( targetCell, i );
                 
                 cns->_hasNotComputedTransmissibilities = false;
             }
@@ -567,8 +595,9 @@ PhaseFieldFracture_FeFv_Tri3::giveStaticLeftHandSideAt( Cell*           targetCe
             {
                 if ( cns->_hasPhsFldPrescribedOnFace[ i ] ) // Cell face is a boundary where phase-field is specified
                 {
-                    double length = giveLengthOf( face[ i ] );
-                    double d1 = giveDistanceToMidpointOf( face[ i ], cellCoor );
+                    int k = analysisModel().domainManager().giveFaceGeometryIndexOf( targetCell, i );
+                    double length = fg.measure[ k ];
+                    double d1 = fg.ownerDistance[ k ];
 
                     normFlux( i ) = length * _l * _l * cns->_phi / d1;
                 }
@@ -706,7 +735,6 @@ PhaseFieldFracture_FeFv_Tri3::giveStaticRightHandSideAt( Cell*
                 {
                     auto cns = this->getNumericsStatusAt( curDomCell );
                     
-                    std::vector<RealVector> cellCoor = this->giveEvaluationPointsFor( curDomCell );
                     std::vector<Node*> bndCellNode;
 
                     // Retrieve nodes of boundary cell
@@ -716,6 +744,7 @@ PhaseFieldFracture_FeFv_Tri3::giveStaticRightHandSideAt( Cell*
                         throw std::runtime_error( "Numerics type '" + _name + "' only accepts boundary cells with two nodes for phase-field BCs!" );
 
                     std::vector<std::vector<Node*> > face = this->giveFaceNodesOf( curDomCell );
+                    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
 
                     // Initialize rowDof and rhs vector
                     rowDof.assign( 1, nullptr );
@@ -738,8 +767,9 @@ PhaseFieldFracture_FeFv_Tri3::giveStaticRightHandSideAt( Cell*
                             cns->_hasPhsFldPrescribedOnFace[ i ] = true;
                             cns->_valueOnFace[ i ] = bcVal;
                                 
-                            double length = giveLengthOf( face[ i ] );
-                            double d = giveDistanceToMidpointOf( face[ i ], cellCoor[ 0 ] );
+                            int k = analysisModel().domainManager().giveFaceGeometryIndexOf( curDomCell, i );
+                            double length = fg.measure[k];
+                            double d = fg.ownerDistance[k];
                             rhs( 0 ) = length * _l * _l * bcVal / d;
                         }
                     }
@@ -992,7 +1022,7 @@ void PhaseFieldFracture_FeFv_Tri3::initializeMaterialsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void PhaseFieldFracture_FeFv_Tri3::initializeNumericsAt( Cell* targetCell )
 {
-    targetCell->numericsStatus = new NumericsStatus_PhaseFieldFracture_FeFv_Tri3();
+    targetCell->numericsStatus = _statusArena.create<NumericsStatus_PhaseFieldFracture_FeFv_Tri3>();
     auto cns = this->getNumericsStatusAt( targetCell );
     
     // Pre-calculate det(J) and inv(J);
@@ -1040,6 +1070,8 @@ void PhaseFieldFracture_FeFv_Tri3::printPostIterationMessage( int stage )
 // ----------------------------------------------------------------------------
 void PhaseFieldFracture_FeFv_Tri3::readAdditionalDataFrom( FILE* fp )
 {
+    analysisModel().domainManager().mustFormFaceGeometry();
+
     verifyKeyword( fp, "CharacteristicLength", _name );
     _l = getRealInputFrom( fp, "Failed to read characteristic length from input file!", _name );
 
@@ -1135,17 +1167,6 @@ std::vector<std::vector<Node*> > PhaseFieldFracture_FeFv_Tri3::giveFaceNodesOf(
     return face;
 }
 // ----------------------------------------------------------------------------
-double PhaseFieldFracture_FeFv_Tri3::giveDistanceToMidpointOf( std::vector<Node*>& face
-                                                             , RealVector&         coor )
-{
-    RealVector coor0, coor1, dx;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf( face[ 0 ] );
-    coor1 = analysisModel().domainManager().giveCoordinatesOf( face[ 1 ] );
-    dx = 0.5 * ( coor0 + coor1 ) - coor;
-    
-    return std::sqrt( dx.dot( dx ) );
-}
-// ----------------------------------------------------------------------------
 RealMatrix PhaseFieldFracture_FeFv_Tri3::giveJacobianMatrixAt( Cell* targetCell, const RealVector& natCoor )
 {
     std::vector<Node*> node = analysisModel().domainManager().giveNodesOf( targetCell );
@@ -1167,16 +1188,6 @@ RealMatrix PhaseFieldFracture_FeFv_Tri3::giveJacobianMatrixAt( Cell* targetCell,
    return _basisFunctionDerivatives * coorMat;
 }
 // ----------------------------------------------------------------------------
-double PhaseFieldFracture_FeFv_Tri3::giveLengthOf( std::vector<Node*>& face )
-{
-    RealVector coor0, coor1, dx;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf( face[ 0 ] );
-    coor1 = analysisModel().domainManager().giveCoordinatesOf( face[ 1 ] );
-    dx = coor1 - coor0;
-    
-    return std::sqrt( dx.dot( dx ) );
-}
-// ----------------------------------------------------------------------------
 RealVector PhaseFieldFracture_FeFv_Tri3::giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType )
 {
     // Displacements
@@ -1206,41 +1217,10 @@ std::vector<Dof*> PhaseFieldFracture_FeFv_Tri3::giveNodalDofsAt( Cell* targetCel
     return dof;
 }
 // ----------------------------------------------------------------------------
-RealVector PhaseFieldFracture_FeFv_Tri3::giveOutwardUnitNormalOf( std::vector<Node*>& face )
+double PhaseFieldFracture_FeFv_Tri3::giveTransmissibilityCoefficientAt( Cell* targetCell, int faceNum )
 {
-    RealVector coor0, coor1, dx, normVec;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf( face[ 0 ] );
-    coor1 = analysisModel().domainManager().giveCoordinatesOf( face[ 1 ] );
-    dx = coor1 - coor0;
-    double dist = std::sqrt(dx.dot( dx ) );
-    
-    normVec = { dx( 1 ) / dist, -dx( 0 ) / dist };
-    
-    return normVec;
-}
-// ----------------------------------------------------------------------------
-double PhaseFieldFracture_FeFv_Tri3::giveTransmissibilityCoefficientAt( std::vector<Node*>& face
-                                                                      , Cell*               targetCell
-                                                                      , Cell*               neighborCell )
-{
-    // A. Target cell
-    // Coordinates of cell center
-    std::vector<RealVector> ep = this->giveEvaluationPointsFor( targetCell );
-    RealVector coor1 = ep[ 0 ];
-
-    // length of face
-    double length = this->giveLengthOf( face );
-
-    // Distance from cell center to midpoint of face
-    double d1 = this->giveDistanceToMidpointOf( face, coor1 );
-
-    // B. Neighbor cell
-    // Coordinates of cell center
-    ep = this->giveEvaluationPointsFor( neighborCell );
-    RealVector coor2 = ep[ 0 ];
-
-    // Distance from cell center to midpoint of face
-    double d2 = this->giveDistanceToMidpointOf( face, coor2 );
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
+    int k = analysisModel().domainManager().giveFaceGeometryIndexOf( targetCell, faceNum );
 
-    return _l * _l * length / ( d1 + d2 );
+    return _l * _l * fg.transFactor[ k ];
 }
\ No newline at end of file
@@ -73,6 +73,8 @@
 #define PHASEFIELDFRACTURE_FEFV_TRI3_HPP
 
 #include "Numerics/Numerics.hpp"
+#include "Util/StackRealMatrix.hpp"
+#include "Util/StackRealVector.hpp"
 #include "Core/DofManager.hpp"
 #include "Core/NumericsManager.hpp"
 #include "BasisFunctions/Triangle_P1.hpp"
@@ -95,11 +97,11 @@ namespace broomstyx
         double     _phiOld;
         RealVector _strain;
         RealVector _stress;
-        RealMatrix _gradU;
+        StackRealMatrix<2,2> _gradU;
         double     _crackDensity;
         double     _surfEgy;
         double     _bulkEgy;
-        RealVector _gradPhi;
+        StackRealVector<2> _gradPhi;
         RealMatrix _dPsi;
         double     _Gc;
         double     _Gbulk;
@@ -134,6 +136,9 @@ namespace broomstyx
         std::tuple< RealVector,RealVector > 
             giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag ) override;
         
+        int    giveFieldOutputIdFor( const std::string& fieldTag ) override;
+        double giveFieldOutputValueAt( Cell* targetCell, int outputId ) override;
+        
         std::tuple< std::vector<Dof*>
                   , std::vector<Dof*>
                   , RealVector >
@@ -190,6 +195,29 @@ namespace broomstyx
         void setDofStagesAt( Cell* targetCell ) override;
 
     private:
+        enum FieldOutput
+        {
+            fo_unassigned,
+            fo_s_xx,
+            fo_s_yy,
+            fo_s_zz,
+            fo_s_xy,
+            fo_ux_x,
+            fo_uy_x,
+            fo_ux_y,
+            fo_uy_y,
+            fo_g_xy,
+            fo_pf,
+            fo_ene_s,
+            fo_ene_b,
+            fo_cr_len,
+            fo_Gc,
+            fo_Gbulk,
+            fo_pf_x,
+            fo_pf_y,
+            fo_pfEq_resid
+        };
+        
         Triangle_P1 _basisFunction;
         RealVector  _basisFunctionValues;
         RealMatrix  _basisFunctionDerivatives;
@@ -206,15 +234,10 @@ namespace broomstyx
         NumericsStatus_PhaseFieldFracture_FeFv_Tri3* getNumericsStatusAt( Cell* targetCell );
         RealMatrix        giveBmatAt( Cell* targetCell );
         static std::vector< std::vector<Node*> > giveFaceNodesOf( Cell* targetCell );
-        static double     giveDistanceToMidpointOf( std::vector<Node*>& face, RealVector& coor);
         RealMatrix        giveJacobianMatrixAt( Cell* targetCell, const RealVector& natCoor );
-        static double     giveLengthOf( std::vector<Node*>& face );
         static RealVector giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType );
         std::vector<Dof*> giveNodalDofsAt( Cell* targetCell );
-        static RealVector giveOutwardUnitNormalOf( std::vector<Node*>& face );
-        double            giveTransmissibilityCoefficientAt( std::vector<Node*>& face
-                                                           , Cell*               targetCell
-                                                           , Cell*               neighborCell );
+        double            giveTransmissibilityCoefficientAt( Cell* targetCell, int faceNum );
     };
 }
 
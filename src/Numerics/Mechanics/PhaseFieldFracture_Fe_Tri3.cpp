@@ -30,6 +30,7 @@
 #include "Core/DomainManager.hpp"
 #include "Core/ObjectFactory.hpp"
 #include "Materials/Material.hpp"
+#include "Util/batchLinearAlgebra.hpp"
 #include "Util/linearAlgebra.hpp"
 #include "Util/readOperations.hpp"
 
@@ -46,11 +47,12 @@ NumericsStatus_PhaseFieldFracture_Fe_Tri3::NumericsStatus_PhaseFieldFracture_Fe_
     , _phiOld( 0. )
 	, _strain( RealVector( 4 ) )
     , _stress( RealVector( 4 ) )
-    , _gradU( RealMatrix( 2,2 ) )
     , _surfEgy( 0. )
     , _bulkEgy( 0. )
     , _Gc( 0. )
     , _histFld( 0. )
+    , _cmatRevisionU( -1 )
+    , _cmatRevisionPhi( -1 )
     , _materialStatus { nullptr, nullptr, nullptr }
 {}
 
@@ -164,25 +166,15 @@ void PhaseFieldFracture_Fe_Tri3::finalizeDataAt( Cell* targetCell, const TimeDat
     RealMatrix Gc = material[ 2 ]->giveModulusFrom( conState2, cns->_materialStatus[ 2 ] );
     cns->_Gc = Gc( 0,0 );
     cns->_surfEgy = cns->_Gc / 2.0 * ( _lc * dphi.dot( dphi ) + phiVec.dot( _massMatrix * phiVec ) / _lc );
+    
+    // Tangents depend on the updated state and history field
+    targetCell->flagCoefficientMatrixChange();
 }
 // ----------------------------------------------------------------------------
 double PhaseFieldFracture_Fe_Tri3::giveCellFieldValueAt( Cell* targetCell, int fieldNum )
 {
-    RealVector val, wt;
-    std::string fieldTag;
-    
-    try
-    {
-        fieldTag = _cellFieldOutput.at( fieldNum );
-    }
-    catch ( std::exception& e )
-    {
-        fieldTag = "unassigned";
-    }
-    
-    std::tie( val,wt ) = this->giveFieldOutputAt( targetCell, fieldTag );
-    
-    return val( 0 );
+    int outputId = this->giveFieldOutputIdFor( this->giveCellFieldTagFor( fieldNum ) );
+    return this->giveFieldOutputValueAt( targetCell, outputId );
 }
 // ----------------------------------------------------------------------------
 RealVector PhaseFieldFracture_Fe_Tri3::giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum )
@@ -221,57 +213,102 @@ PhaseFieldFracture_Fe_Tri3::giveFieldOutputAt( Cell* targetCell, const std::stri
     RealVector fieldVal(1), weight(1);
     
     auto cns = this->getNumericsStatusAt( targetCell );
-    std::vector<Material*> material = this->giveMaterialSetFor( targetCell );
-
     weight( 0 ) = cns->_area;
+    fieldVal( 0 ) = this->giveFieldOutputValueAt( targetCell, this->giveFieldOutputIdFor( fieldTag ) );
     
+    return std::make_tuple( std::move( fieldVal ), std::move( weight ) );
+}
+// ----------------------------------------------------------------------------
+int PhaseFieldFracture_Fe_Tri3::giveFieldOutputIdFor( const std::string& fieldTag )
+{
     if ( fieldTag == "unassigned" )
-        fieldVal( 0 ) = 0.;
+        return fo_unassigned;
     else if ( fieldTag == "s_xx" )
-        fieldVal( 0 ) = cns->_stress( 0 );
+        return fo_s_xx;
     else if ( fieldTag == "s_yy" )
-        fieldVal( 0 ) = cns->_stress( 1 );
+        return fo_s_yy;
     else if ( fieldTag == "s_zz" )
-    {
-        if ( _analysisMode == PlaneStrain )
-            fieldVal( 0 ) = cns->_stress( 2 );
-        else
-            fieldVal( 0 ) = 0.;
-    }
+        return fo_s_zz;
     else if ( fieldTag == "s_xy" )
-        fieldVal( 0 ) = cns->_stress( 3 );
+        return fo_s_xy;
     else if ( fieldTag == "ux_x" || fieldTag == "e_xx" )
-        fieldVal( 0 ) = cns->_gradU( 0,0 );
+        return fo_ux_x;
     else if ( fieldTag == "uy_x" )
-        fieldVal( 0 ) = cns->_gradU( 0,1 );
+        return fo_uy_x;
     else if ( fieldTag == "ux_y" )
-        fieldVal( 0 ) = cns->_gradU( 1,0 );
+        return fo_ux_y;
     else if ( fieldTag == "uy_y" || fieldTag == "e_yy" )
-        fieldVal( 0 ) = cns->_gradU( 1,1 );
+        return fo_uy_y;
     else if ( fieldTag == "g_xy" )
-        fieldVal( 0 ) = cns->_strain( 3 );
+        return fo_g_xy;
     else if ( fieldTag == "pf" )
-        fieldVal( 0 ) = cns->_phi;
+        return fo_pf;
     else if ( fieldTag == "ene_s" )
-        fieldVal( 0 ) = cns->_surfEgy;
+        return fo_ene_s;
     else if ( fieldTag == "ene_b" )
-        fieldVal( 0 ) = cns->_bulkEgy;
+        return fo_ene_b;
     else if ( fieldTag == "cr_len" )
-    {
-        if ( cns->_phi < CRACKLENGTH_CUTOFF )
-            fieldVal( 0 ) = cns->_surfEgy / cns->_Gc;
-        else
-            fieldVal( 0 ) = 0.;
-    }
+        return fo_cr_len;
     else if ( fieldTag == "Gc" )
-        fieldVal( 0 ) = cns->_Gc;
-        
-    else if ( fieldTag == "eigVec1_1" || fieldTag == "eigVec1_2" || fieldTag == "eigVec2_1" || fieldTag == "eigVec2_2" )
-        fieldVal( 0 ) = material[ 1 ]->giveMaterialVariable( fieldTag, cns->_materialStatus[ 1 ] );
+        return fo_Gc;
+    else if ( fieldTag == "eigVec1_1" )
+        return fo_eigVec1_1;
+    else if ( fieldTag == "eigVec1_2" )
+        return fo_eigVec1_2;
+    else if ( fieldTag == "eigVec2_1" )
+        return fo_eigVec2_1;
+    else if ( fieldTag == "eigVec2_2" )
+        return fo_eigVec2_2;
     else
         throw std::runtime_error( "Invalid tag '" + fieldTag + "' supplied in field output request made to numerics '" + _name + "'!" );
+}
+// ----------------------------------------------------------------------------
+double PhaseFieldFracture_Fe_Tri3::giveFieldOutputValueAt( Cell* targetCell, int outputId )
+{
+    auto cns = this->getNumericsStatusAt( targetCell );
     
-    return std::make_tuple( std::move( fieldVal ), std::move( weight ) );
+    switch ( outputId )
+    {
+        case fo_s_xx:
+            return cns->_stress( 0 );
+        case fo_s_yy:
+            return cns->_stress( 1 );
+        case fo_s_zz:
+            return _analysisMode == PlaneStrain ? cns->_stress( 2 ) : 0.;
+        case fo_s_xy:
+            return cns->_stress( 3 );
+        case fo_ux_x:
+            return cns->_gradU( 0,0 );
+        case fo_uy_x:
+            return cns->_gradU( 0,1 );
+        case fo_ux_y:
+            return cns->_gradU( 1,0 );
+        case fo_uy_y:
+            return cns->_gradU( 1,1 );
+        case fo_g_xy:
+            return cns->_strain( 3 );
+        case fo_pf:
+            return cns->_phi;
+        case fo_ene_s:
+            return cns->_surfEgy;
+        case fo_ene_b:
+            return cns->_bulkEgy;
+        case fo_cr_len:
+            return cns->_phi < CRACKLENGTH_CUTOFF ? cns->_surfEgy / cns->_Gc : 0.;
+        case fo_Gc:
+            return cns->_Gc;
+        case fo_eigVec1_1:
+        case fo_eigVec1_2:
+        case fo_eigVec2_1:
+        case fo_eigVec2_2:
+        {
+            const char* varName[] = { "eigVec1_1", "eigVec1_2", "eigVec2_1", "eigVec2_2" };
+            std::vector<Material*> material = this->giveMaterialSetFor( targetCell );
+            return material[ 1 ]->giveMaterialVariable( varName[ outputId - fo_eigVec1_1 ], cns->_materialStatus[ 1 ] );
+        }
+        default:
+            return 0.;
+    }
 }
 // ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>
@@ -360,6 +397,73 @@ PhaseFieldFracture_Fe_Tri3::giveStaticCoefficientMatrixAt( Cell*           targe
     return std::make_tuple(std::move(rowDof), std::move(colDof), std::move(coefVal));
 }
 // ----------------------------------------------------------------------------
+std::tuple< std::vector<Dof*>, RealVector >
+PhaseFieldFracture_Fe_Tri3::giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                                                , int               stage
+                                                                , int               subsys
+                                                                , const TimeData&   time
+                                                                , const RealVector& x )
+{
+    std::vector<Dof*> rowDof;
+    RealVector product;
+    
+    if ( stage == _stage[ 0 ] )
+    {
+        // Retrieve nodal DOFs local to element
+        std::vector<Dof*> dof = this->giveNodalDofsAt( targetCell );
+        
+        int rowBegin = 0, rowEnd = 9; // Default rows for unassigned subsystems
+        if ( subsys == _subsystem[ 0 ] )
+            rowEnd = 6;
+        else if ( subsys == _subsystem[ 1 ] )
+            rowBegin = 6;
+        
+        // Gather local values of global vector (constrained DOFs and DOFs of
+        // other subsystems contribute nothing to the product)
+        RealVector xloc( 9 );
+        for ( int i = rowBegin; i < rowEnd; i++ )
+        {
+            int eqNum = analysisModel().dofManager().giveEquationNumberAt( dof[ i ] );
+            if ( eqNum != UNASSIGNED )
+                xloc( i ) = x( eqNum );
+        }
+        
+        // Retrieve numerics status
+        auto cns = this->getNumericsStatusAt( targetCell );
+        
+        product.init( 9 );
+        if ( rowBegin == 0 )
+        {
+            // Apply KmatUU without forming it
+            if ( cns->_cmatRevisionU != targetCell->giveCoefficientMatrixRevision() )
+                this->updateProductDataAt( targetCell, _subsystem[ 0 ] );
+            
+            addBtCBx( cns->_bmatU.dim1(), 6, cns->_bmatU.ptr(), cns->_cmatU.ptr(), cns->_area, xloc.ptr(), product.ptr() );
+        }
+        if ( rowEnd == 9 )
+        {
+            // Apply cached KmatPhiPhi
+            if ( cns->_cmatRevisionPhi != targetCell->giveCoefficientMatrixRevision() )
+                this->updateProductDataAt( targetCell, _subsystem[ 1 ] );
+            
+            for ( int i = 0; i < 3; i++ )
+                for ( int j = 0; j < 3; j++ )
+                    product( 6+i ) += cns->_kmatPhiPhi( i,j ) * xloc( 6+j );
+        }
+        
+        rowDof.assign( dof.begin() + rowBegin, dof.begin() + rowEnd );
+        if ( rowBegin > 0 || rowEnd < 9 )
+        {
+            RealVector subProduct( rowEnd - rowBegin );
+            for ( int i = rowBegin; i < rowEnd; i++ )
+                subProduct( i - rowBegin ) = product( i );
+            product = std::move( subProduct );
+        }
+    }
+    
+    return std::make_tuple( std::move( rowDof ), std::move( product ) );
+}
+// ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>
           , RealVector >
 PhaseFieldFracture_Fe_Tri3::giveStaticLeftHandSideAt( Cell*           targetCell
@@ -409,6 +513,7 @@ PhaseFieldFracture_Fe_Tri3::giveStaticLeftHandSideAt( Cell*           targetCell
         std::vector<Material*> material = this->giveMaterialSetFor( targetCell );
         
         material[ 1 ]->updateStatusFrom( conState, cns->_materialStatus[ 1 ] );
+        targetCell->flagCoefficientMatrixChange();
 
         int offset = 0;
         if ( subsys == _subsystem[ 0 ] || subsys == UNASSIGNED )
@@ -652,7 +757,7 @@ void PhaseFieldFracture_Fe_Tri3::initializeMaterialsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void PhaseFieldFracture_Fe_Tri3::initializeNumericsAt( Cell* targetCell )
 {
-    targetCell->numericsStatus = new NumericsStatus_PhaseFieldFracture_Fe_Tri3();
+    targetCell->numericsStatus = _statusArena.create<NumericsStatus_PhaseFieldFracture_Fe_Tri3>();
     auto cns = this->getNumericsStatusAt( targetCell );
     
     // Pre-calculate det(J) and inv(J);
@@ -839,3 +944,44 @@ std::vector< Dof* > PhaseFieldFracture_Fe_Tri3::giveNodalDofsAt( Cell* targetCel
 
     return dof;
 }
+// ----------------------------------------------------------------------------
+void PhaseFieldFracture_Fe_Tri3::updateProductDataAt( Cell* targetCell, int subsys )
+{
+    // Only the tangent of the requested subsystem is renewed, since the
+    // alternating solution treats each subsystem separately
+    auto cns = this->getNumericsStatusAt( targetCell );
+    std::vector<Material*> material = this->giveMaterialSetFor( targetCell );
+    
+    RealVector conState( { cns->_strain( 0 ),
+                           cns->_strain( 1 ),
+                           cns->_strain( 2 ),
+                           cns->_strain( 3 ),
+                           cns->_phi } );
+    
+    if ( subsys == _subsystem[ 0 ] )
+    {
+        if ( cns->_bmatU.dim1() == 0 )
+        {
+            cns->_bmatU = this->giveBmatUAt( targetCell );
+            cns->_bmatU.simplify();
+        }
+        
+        cns->_cmatU = material[ 1 ]->giveModulusFrom( conState, cns->_materialStatus[ 1 ], "Mechanics" );
+        cns->_cmatU.simplify();
+        cns->_cmatRevisionU = targetCell->giveCoefficientMatrixRevision();
+    }
+    else
+    {
+        RealMatrix conMod = material[ 1 ]->giveModulusFrom( conState, cns->_materialStatus[ 1 ], "PhaseField" );
+        double dd_degFcn = conMod( 0,0 );
+        double drvForce = conMod( 1,1 );
+        
+        if ( cns->_phi > _phiIrrev && drvForce < cns->_histFld )
+            drvForce = cns->_histFld;
+        
+        cns->_kmatPhiPhi = cns->_area * cns->_Gc * _lc * trp( cns->_dPsi ) * cns->_dPsi
+                         + cns->_area * ( cns->_Gc / _lc + dd_degFcn * drvForce ) * _massMatrix;
+        cns->_kmatPhiPhi.simplify();
+        cns->_cmatRevisionPhi = targetCell->giveCoefficientMatrixRevision();
+    }
+}
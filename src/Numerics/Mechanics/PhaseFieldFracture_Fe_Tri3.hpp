@@ -70,6 +70,7 @@
 #define PHASEFIELDFRACTURE_FE_TRI3_HPP
 
 #include "Numerics/Numerics.hpp"
+#include "Util/StackRealMatrix.hpp"
 #include "Core/DofManager.hpp"
 #include "Core/NumericsManager.hpp"
 #include "BasisFunctions/Triangle_P1.hpp"
@@ -92,13 +93,20 @@ namespace broomstyx
         double     _phiOld;
         RealVector _strain;
         RealVector _stress;
-        RealMatrix _gradU;
+        StackRealMatrix<2,2> _gradU;
         double     _surfEgy;
         double     _bulkEgy;
         RealMatrix _dPsi;
         double     _Gc;
         double     _histFld;
         
+        // Data cached for matrix-free products and revisions of the tangents
+        RealMatrix _bmatU;
+        RealMatrix _cmatU;
+        RealMatrix _kmatPhiPhi;
+        int        _cmatRevisionU;
+        int        _cmatRevisionPhi;
+        
         MaterialStatus* _materialStatus[3];
     };
     
@@ -121,6 +129,9 @@ namespace broomstyx
         std::tuple< RealVector,RealVector > 
             giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag ) override;
         
+        int    giveFieldOutputIdFor( const std::string& fieldTag ) override;
+        double giveFieldOutputValueAt( Cell* targetCell, int outputId ) override;
+        
         std::tuple< std::vector<Dof*>
                   , std::vector<Dof*>
                   , RealVector >
@@ -129,6 +140,13 @@ namespace broomstyx
                                          , int             subsys
                                          , const TimeData& time ) override;
         
+        std::tuple< std::vector<Dof*>, RealVector >
+            giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                                , int               stage
+                                                , int               subsys
+                                                , const TimeData&   time
+                                                , const RealVector& x ) override;
+        
         std::tuple< std::vector<Dof*>, RealVector >
             giveStaticLeftHandSideAt( Cell*           targetCell
                                     , int             stage
@@ -161,6 +179,29 @@ namespace broomstyx
         void setDofStagesAt( Cell* targetCell ) override;
         
     private:
+        enum FieldOutput
+        {
+            fo_unassigned,
+            fo_s_xx,
+            fo_s_yy,
+            fo_s_zz,
+            fo_s_xy,
+            fo_ux_x,
+            fo_uy_x,
+            fo_ux_y,
+            fo_uy_y,
+            fo_g_xy,
+            fo_pf,
+            fo_ene_s,
+            fo_ene_b,
+            fo_cr_len,
+            fo_Gc,
+            fo_eigVec1_1,
+            fo_eigVec1_2,
+            fo_eigVec2_1,
+            fo_eigVec2_2
+        };
+        
         enum AnalysisMode
         {
             Unset,
@@ -189,6 +230,7 @@ namespace broomstyx
         static std::tuple< RealVector, RealVector >
                    giveLocalVariablesAt( std::vector<Dof*>& dof, ValueType valType );
         std::vector<Dof*> giveNodalDofsAt( Cell* targetCell );
+        void       updateProductDataAt( Cell* targetCell, int subsys );
     };
 }
 
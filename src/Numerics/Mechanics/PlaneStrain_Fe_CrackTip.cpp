@@ -60,7 +60,6 @@ PlaneStrain_Fe_CrackTip::CellNumericsStatus::~CellNumericsStatus()
 PlaneStrain_Fe_CrackTip::EvalPtNumericsStatus::EvalPtNumericsStatus()
     : _strain( RealVector( 4 ) )
     , _stress( RealVector( 4 ) )
-    , _gradU( RealMatrix( 2,2 ) )
     , _materialStatus { nullptr, nullptr }
 {}
 
@@ -111,7 +110,7 @@ void PlaneStrain_Fe_CrackTip::deleteNumericsAt( Cell* targetCell )
         material[ 1 ]->destroy( gpns->_materialStatus[ 1 ] );
     }
     
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void PlaneStrain_Fe_CrackTip::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -176,14 +175,7 @@ RealVector PlaneStrain_Fe_CrackTip::giveCellNodeFieldValuesAt( Cell* targetCell,
     RealVector gpVals, wt, nodeVals(6);
     std::string fieldTag;
     
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch (std::exception& e)
-    {
-        fieldTag = "unassigned";
-    }
+    fieldTag = this->giveCellFieldTagFor(fieldNum);
     
     // // We need a special method for calculating the elastic strain energy
     // // which has quadratic behavior within the element
@@ -653,7 +645,7 @@ void PlaneStrain_Fe_CrackTip::initializeNumericsAt( Cell* targetCell )
     int nGaussPts = _integrationRule->giveNumberOfIntegrationPoints();
     std::tie( gpCoor, gpWt ) = _integrationRule->giveIntegrationPointsAndWeights();
     
-    targetCell->numericsStatus = new CellNumericsStatus( nGaussPts );
+    targetCell->numericsStatus = _statusArena.create<CellNumericsStatus>( nGaussPts );
     auto cns = this->getNumericsStatusAt( targetCell );
     for ( int i = 0; i < nGaussPts; i++ )
     {
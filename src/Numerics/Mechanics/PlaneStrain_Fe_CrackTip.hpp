@@ -68,6 +68,7 @@
 #define	PLANESTRAIN_FE_CRACKTIP_HPP
 
 #include "Numerics/Numerics.hpp"
+#include "Util/StackRealMatrix.hpp"
 
 namespace broomstyx
 {
@@ -153,7 +154,7 @@ namespace broomstyx
 
             RealVector _strain;
             RealVector _stress;
-            RealMatrix _gradU;
+            StackRealMatrix<2,2> _gradU;
             MaterialStatus* _materialStatus[2];
         };
 
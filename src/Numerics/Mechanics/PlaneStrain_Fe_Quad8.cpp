@@ -22,6 +22,7 @@
 */
 
 #include "PlaneStrain_Fe_Quad8.hpp"
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 #include <string>
@@ -31,6 +32,7 @@
 #include "Core/ObjectFactory.hpp"
 #include "Materials/Material.hpp"
 #include "User/UserFunction.hpp"
+#include "Util/batchLinearAlgebra.hpp"
 #include "Util/linearAlgebra.hpp"
 
 #include "IntegrationRules/Legendre_1D.hpp"
@@ -47,6 +49,7 @@ registerBroomstyxObject(Numerics, PlaneStrain_Fe_Quad8)
 CellNumericsStatus_PlaneStrain_Fe_Quad8::CellNumericsStatus_PlaneStrain_Fe_Quad8( int nGaussPts )
 {
     _nGaussPts = nGaussPts;
+    _cmatRevision = -1;
     _gp.assign(_nGaussPts, EvalPoint());
     
     for ( int i = 0; i < _nGaussPts; i++ )
@@ -63,8 +66,8 @@ CellNumericsStatus_PlaneStrain_Fe_Quad8::~CellNumericsStatus_PlaneStrain_Fe_Quad
 EvalPtNumericsStatus_PlaneStrain_Fe_Quad8::EvalPtNumericsStatus_PlaneStrain_Fe_Quad8()
     : _strain(RealVector(4))
     , _stress(RealVector(4))
-    , _gradU(RealMatrix(2,2))
     , _materialStatus {nullptr, nullptr}
+    , _dV(0.)
 {}
     
 EvalPtNumericsStatus_PlaneStrain_Fe_Quad8::~EvalPtNumericsStatus_PlaneStrain_Fe_Quad8()
@@ -115,7 +118,7 @@ void PlaneStrain_Fe_Quad8::deleteNumericsAt( Cell* targetCell )
         material[1]->destroy(gpns->_materialStatus[1]);
     }
     
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void PlaneStrain_Fe_Quad8::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -175,6 +178,10 @@ void PlaneStrain_Fe_Quad8::finalizeDataAt( Cell* targetCell, const TimeData& tim
         // Stress
         gpns->_stress = material[1]->giveForceFrom(gpns->_strain, gpns->_materialStatus[1]);
     }
+    
+    // Tangent modulus of a nonlinear material follows the strain
+    if ( !material[1]->hasConstantModulus() )
+        targetCell->flagCoefficientMatrixChange();
 }
 // ---------------------------------------------------------------------------
 RealVector PlaneStrain_Fe_Quad8::giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum )
@@ -182,14 +189,7 @@ RealVector PlaneStrain_Fe_Quad8::giveCellNodeFieldValuesAt( Cell* targetCell, in
     RealVector gpVals, wt, nodeVals(8);
     std::string fieldTag;
     
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch (std::exception& e)
-    {
-        fieldTag = "unassigned";
-    }
+    fieldTag = this->giveCellFieldTagFor(fieldNum);
     
     std::tie(gpVals,wt) = this->giveFieldOutputAt(targetCell, fieldTag);
     RealVector linVals = _extrapolationMatrix*gpVals;
@@ -248,47 +248,12 @@ PlaneStrain_Fe_Quad8::giveFieldOutputAt( Cell* targetCell, const std::string& fi
 {
     auto cns = this->getNumericsStatusAt(targetCell);
     std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
+    int outputId = this->giveFieldOutputIdFor(fieldTag);
     
     RealVector fieldVal(cns->_nGaussPts), weight(cns->_nGaussPts);
     for ( int i = 0; i < cns->_nGaussPts; i++)
     {
-        auto gpns = this->getNumericsStatusAt(cns->_gp[i]);
-        
-        if ( fieldTag == "unassigned" )
-            fieldVal(i) = 0.;
-        else if ( fieldTag == "s_xx" )
-            fieldVal(i) = gpns->_stress(0);
-        else if ( fieldTag == "s_yy" )
-            fieldVal(i) = gpns->_stress(1);
-        else if ( fieldTag == "s_zz" )
-            fieldVal(i) = gpns->_stress(2);
-        else if ( fieldTag == "s_xy" )
-            fieldVal(i) = gpns->_stress(3);
-        else if ( fieldTag == "ux_x" )
-            fieldVal(i) = gpns->_gradU(0,0);
-        else if ( fieldTag == "uy_x" )
-            fieldVal(i) = gpns->_gradU(0,1);
-        else if ( fieldTag == "ux_y" )
-            fieldVal(i) = gpns->_gradU(1,0);
-        else if ( fieldTag == "uy_y" )
-            fieldVal(i) = gpns->_gradU(1,1);
-        else if ( fieldTag == "g_xy" )
-            fieldVal(i) = gpns->_strain(3);
-        else if ( fieldTag == "ep_xx" || fieldTag == "ep_yy" || fieldTag == "ep_zz" || fieldTag == "ep_xy" )
-        {
-            try
-            {
-                fieldVal(i) = material[1]->giveMaterialVariable(fieldTag, gpns->_materialStatus[1]);
-            }
-            catch (...)
-            {
-                fieldVal(i) = 0.;
-            }
-        }
-        else if ( fieldTag == "ene" )
-            fieldVal(i) = 0.5*gpns->_stress.dot(gpns->_strain);
-        else
-            throw std::runtime_error("Invalid tag '" + fieldTag + "' supplied in field output request made to " + _name + ".");
+        fieldVal(i) = this->giveGaussPointOutputValueAt(cns->_gp[i], material[1], outputId);
         
         // Jacobian matrix and determinant
         RealMatrix Jmat = this->giveJacobianMatrixAt(targetCell, cns->_gp[i].coordinates);
@@ -299,6 +264,42 @@ PlaneStrain_Fe_Quad8::giveFieldOutputAt( Cell* targetCell, const std::string& fi
     
     return std::make_tuple(std::move(fieldVal), std::move(weight));
 }
+// ----------------------------------------------------------------------------
+int PlaneStrain_Fe_Quad8::giveFieldOutputIdFor( const std::string& fieldTag )
+{
+    if ( fieldTag == "unassigned" )
+        return fo_unassigned;
+    else if ( fieldTag == "s_xx" )
+        return fo_s_xx;
+    else if ( fieldTag == "s_yy" )
+        return fo_s_yy;
+    else if ( fieldTag == "s_zz" )
+        return fo_s_zz;
+    else if ( fieldTag == "s_xy" )
+        return fo_s_xy;
+    else if ( fieldTag == "ux_x" )
+        return fo_ux_x;
+    else if ( fieldTag == "uy_x" )
+        return fo_uy_x;
+    else if ( fieldTag == "ux_y" )
+        return fo_ux_y;
+    else if ( fieldTag == "uy_y" )
+        return fo_uy_y;
+    else if ( fieldTag == "g_xy" )
+        return fo_g_xy;
+    else if ( fieldTag == "ep_xx" )
+        return this->hasMaterialVariable(1, "ep_xx") ? fo_ep_xx : fo_unassigned;
+    else if ( fieldTag == "ep_yy" )
+        return this->hasMaterialVariable(1, "ep_yy") ? fo_ep_yy : fo_unassigned;
+    else if ( fieldTag == "ep_zz" )
+        return this->hasMaterialVariable(1, "ep_zz") ? fo_ep_zz : fo_unassigned;
+    else if ( fieldTag == "ep_xy" )
+        return this->hasMaterialVariable(1, "ep_xy") ? fo_ep_xy : fo_unassigned;
+    else if ( fieldTag == "ene" )
+        return fo_ene;
+    else
+        throw std::runtime_error("Invalid tag '" + fieldTag + "' supplied in field output request made to " + _name + ".");
+}
 // ---------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>
           , std::vector<Dof*>
@@ -357,6 +358,109 @@ PlaneStrain_Fe_Quad8::giveStaticCoefficientMatrixAt( Cell*           targetCell
     
     return std::make_tuple(std::move(rowDof), std::move(colDof), std::move(coefVal));
 }
+// ----------------------------------------------------------------------------
+void PlaneStrain_Fe_Quad8::giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                                          , int                     stage
+                                                          , int                     subsys
+                                                          , const TimeData&         time
+                                                          , CoefficientMatrixBatch& batch )
+{
+    if ( cell.empty() || stage != _stage[0] || (subsys != _subsystem[0] && subsys != UNASSIGNED) )
+        return;
+    
+    // Element stiffness matrices of up to simdBatchWidth cells are computed
+    // together, with the integrand trp(B)*C*B vectorized over the cells
+    double bmatBatch[4*16*simdBatchWidth], cmatBatch[4*4*simdBatchWidth], weight[simdBatchWidth];
+    double kmatBatch[16*16*simdBatchWidth], work[4*16*simdBatchWidth];
+    
+    // All cells of a batch belong to the same domain and share the same
+    // integration rule
+    std::vector<Material*> material = this->giveMaterialSetFor(cell[0]);
+    int nGaussPts = this->getNumericsStatusAt(cell[0])->_nGaussPts;
+    
+    int nCells = cell.size();
+    for ( int first = 0; first < nCells; first += simdBatchWidth )
+    {
+        int nLanes = std::min(simdBatchWidth, nCells - first);
+        if ( nLanes < simdBatchWidth )
+        {
+            // Unused lanes of the last batch contribute zero
+            std::fill(bmatBatch, bmatBatch + 4*16*simdBatchWidth, 0.);
+            std::fill(cmatBatch, cmatBatch + 4*4*simdBatchWidth, 0.);
+            std::fill(weight, weight + simdBatchWidth, 0.);
+        }
+        std::fill(kmatBatch, kmatBatch + 16*16*simdBatchWidth, 0.);
+        
+        for ( int i = 0; i < nGaussPts; i++ )
+        {
+            for ( int lane = 0; lane < nLanes; lane++ )
+            {
+                auto cns = this->getNumericsStatusAt(cell[first + lane]);
+                
+                // Jacobian determinant
+                RealMatrix Jmat = this->giveJacobianMatrixAt(cell[first + lane], cns->_gp[i].coordinates);
+                double J = Jmat(0,0)*Jmat(1,1) - Jmat(1,0)*Jmat(0,1);
+                
+                // Bmat and tangent modulus
+                RealMatrix bmat = this->giveBmatAt(cell[first + lane], cns->_gp[i].coordinates);
+                auto gpns = this->getNumericsStatusAt(cns->_gp[i]);
+                RealMatrix cmat = material[1]->giveModulusFrom(gpns->_strain, gpns->_materialStatus[1]);
+                
+                gatherIntoLane(bmat, lane, bmatBatch);
+                gatherIntoLane(cmat, lane, cmatBatch);
+                weight[lane] = J*cns->_gp[i].weight;
+            }
+            
+            // Add kmat contributions from Gauss point
+            addBatchedBtCB(4, 16, bmatBatch, cmatBatch, weight, kmatBatch, work);
+        }
+        
+        for ( int lane = 0; lane < nLanes; lane++ )
+            this->appendBatchedMatrixTo(batch, this->giveNodalDofsAt(cell[first + lane]), kmatBatch, lane);
+    }
+}
+// ---------------------------------------------------------------------------
+std::tuple< std::vector<Dof*>, RealVector >
+PlaneStrain_Fe_Quad8::giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                                          , int               stage
+                                                          , int               subsys
+                                                          , const TimeData&   time
+                                                          , const RealVector& x )
+{
+    std::vector<Dof*> rowDof;
+    RealVector product;
+    
+    if ( stage == _stage[0] && (subsys == _subsystem[0] || subsys == UNASSIGNED) )
+    {
+        // Retrieve nodal DOFs local to element
+        rowDof = this->giveNodalDofsAt(targetCell);
+        
+        // Gather local values of global vector (constrained DOFs contribute
+        // nothing to the product)
+        RealVector xloc(16);
+        for ( int i = 0; i < 16; i++ )
+        {
+            int eqNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+            if ( eqNum != UNASSIGNED )
+                xloc(i) = x(eqNum);
+        }
+        
+        // Cell numerics status
+        auto cns = this->getNumericsStatusAt(targetCell);
+        if ( cns->_cmatRevision != targetCell->giveCoefficientMatrixRevision() )
+            this->updateProductDataAt(targetCell);
+        
+        // Add contributions from Gauss points without forming kmat
+        product.init(16);
+        for ( int i = 0; i < cns->_nGaussPts; i++ )
+        {
+            auto gpns = this->getNumericsStatusAt(cns->_gp[i]);
+            addBtCBx(4, 16, gpns->_bmat.ptr(), gpns->_cmat.ptr(), gpns->_dV, xloc.ptr(), product.ptr());
+        }
+    }
+    
+    return std::make_tuple(std::move(rowDof), std::move(product));
+}
 // ---------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>
           , RealVector >
@@ -406,6 +510,9 @@ PlaneStrain_Fe_Quad8::giveStaticLeftHandSideAt( Cell*           targetCell
             // Add lhs contribution from Gauss point
             lhs = lhs + trp(bmat)*(gpns->_stress*(J*cns->_gp[i].weight));
         }
+        
+        if ( !material[1]->hasConstantModulus() )
+            targetCell->flagCoefficientMatrixChange();
     }
     
     return std::make_tuple(std::move(rowDof), std::move(lhs));
@@ -630,7 +737,7 @@ void PlaneStrain_Fe_Quad8::initializeNumericsAt( Cell* targetCell )
     int nGaussPts = _integrationRule->giveNumberOfIntegrationPoints();
     std::tie(gpCoor, gpWt) = _integrationRule->giveIntegrationPointsAndWeights();
     
-    targetCell->numericsStatus = new CellNumericsStatus_PlaneStrain_Fe_Quad8(nGaussPts);
+    targetCell->numericsStatus = _statusArena.create<CellNumericsStatus_PlaneStrain_Fe_Quad8>(nGaussPts);
     auto cns = this->getNumericsStatusAt(targetCell);
     for ( int i = 0; i < nGaussPts; i++ )
     {
@@ -665,6 +772,17 @@ void PlaneStrain_Fe_Quad8::setDofStagesAt( Cell* targetCell )
     // B. Element DOFs
     // This element doesn't use elemental degrees of freedom    
 }
+// ---------------------------------------------------------------------------
+bool PlaneStrain_Fe_Quad8::tracksCoefficientMatrixChanges()
+{
+    return true;
+}
+// ---------------------------------------------------------------------------
+bool PlaneStrain_Fe_Quad8::hasStateIndependentRightHandSide()
+{
+    // Body forces depend only on the cell geometry and the density
+    return true;
+}
 
 // Private methods
 // ---------------------------------------------------------------------------
@@ -708,6 +826,45 @@ PlaneStrain_Fe_Quad8::getNumericsStatusAt( EvalPoint& gp )
     return gpns;
 }
 // ---------------------------------------------------------------------------
+double PlaneStrain_Fe_Quad8::giveGaussPointOutputValueAt( EvalPoint& gp, Material* material, int outputId )
+{
+    auto gpns = this->getNumericsStatusAt(gp);
+    
+    switch ( outputId )
+    {
+        case fo_s_xx:
+            return gpns->_stress(0);
+        case fo_s_yy:
+            return gpns->_stress(1);
+        case fo_s_zz:
+            return gpns->_stress(2);
+        case fo_s_xy:
+            return gpns->_stress(3);
+        case fo_ux_x:
+            return gpns->_gradU(0,0);
+        case fo_uy_x:
+            return gpns->_gradU(0,1);
+        case fo_ux_y:
+            return gpns->_gradU(1,0);
+        case fo_uy_y:
+            return gpns->_gradU(1,1);
+        case fo_g_xy:
+            return gpns->_strain(3);
+        case fo_ep_xx:
+        case fo_ep_yy:
+        case fo_ep_zz:
+        case fo_ep_xy:
+        {
+            const char* varName[] = {"ep_xx", "ep_yy", "ep_zz", "ep_xy"};
+            return material->giveMaterialVariable(varName[outputId - fo_ep_xx], gpns->_materialStatus[1]);
+        }
+        case fo_ene:
+            return 0.5*gpns->_stress.dot(gpns->_strain);
+        default:
+            return 0.;
+    }
+}
+// ----------------------------------------------------------------------------
 RealMatrix PlaneStrain_Fe_Quad8::giveJacobianMatrixAt( Cell* targetCell, const RealVector& natCoor )
 {
     std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(targetCell);
@@ -763,6 +920,32 @@ RealMatrix PlaneStrain_Fe_Quad8::giveBmatAt( Cell* targetCell, const RealVector&
     return bmat;
 }
 // ----------------------------------------------------------------------------
+void PlaneStrain_Fe_Quad8::updateProductDataAt( Cell* targetCell )
+{
+    // Geometric data is computed once, whereas the tangent modulus is renewed
+    // whenever the coefficient matrix revision of the cell has changed
+    auto cns = this->getNumericsStatusAt(targetCell);
+    std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
+    
+    for ( int i = 0; i < cns->_nGaussPts; i++ )
+    {
+        auto gpns = this->getNumericsStatusAt(cns->_gp[i]);
+        
+        if ( gpns->_bmat.dim1() == 0 )
+        {
+            RealMatrix Jmat = this->giveJacobianMatrixAt(targetCell, cns->_gp[i].coordinates);
+            gpns->_dV = (Jmat(0,0)*Jmat(1,1) - Jmat(1,0)*Jmat(0,1))*cns->_gp[i].weight;
+            gpns->_bmat = this->giveBmatAt(targetCell, cns->_gp[i].coordinates);
+            gpns->_bmat.simplify();
+        }
+        
+        gpns->_cmat = material[1]->giveModulusFrom(gpns->_strain, gpns->_materialStatus[1]);
+        gpns->_cmat.simplify();
+    }
+    
+    cns->_cmatRevision = targetCell->giveCoefficientMatrixRevision();
+}
+// ----------------------------------------------------------------------------
 RealVector PlaneStrain_Fe_Quad8::giveLocalDisplacementsAt( Cell* targetCell, ValueType valType )
 {    
     std::vector<Dof*> dof = this->giveNodalDofsAt(targetCell);
@@ -68,6 +68,7 @@
 #define	PLANESTRAIN_FE_QUAD8_HPP
 
 #include "Numerics/Numerics.hpp"
+#include "Util/StackRealMatrix.hpp"
 
 namespace broomstyx
 {
@@ -88,6 +89,9 @@ namespace broomstyx
     private:
         std::vector<EvalPoint> _gp;
         int _nGaussPts;
+        
+        // Revision of the tangent moduli cached at the Gauss points
+        int _cmatRevision;
     };
     
     // Integration point numerics status
@@ -102,8 +106,13 @@ namespace broomstyx
     private:
         RealVector _strain;
         RealVector _stress;
-        RealMatrix _gradU;
+        StackRealMatrix<2,2> _gradU;
         MaterialStatus* _materialStatus[2];
+        
+        // Data cached for matrix-free products
+        RealMatrix _bmat;
+        RealMatrix _cmat;
+        double     _dV;
     };
     
     class PlaneStrain_Fe_Quad8 final : public Numerics
@@ -124,6 +133,8 @@ namespace broomstyx
         std::tuple< RealVector,RealVector > 
             giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag ) override;
         
+        int giveFieldOutputIdFor( const std::string& fieldTag ) override;
+        
         std::tuple< std::vector<Dof*>
                   , std::vector<Dof*>
                   , RealVector >
@@ -132,6 +143,20 @@ namespace broomstyx
                                          , int             subsys
                                          , const TimeData& time ) override;
         
+        void
+            giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                           , int                     stage
+                                           , int                     subsys
+                                           , const TimeData&         time
+                                           , CoefficientMatrixBatch& batch ) override;
+        
+        std::tuple< std::vector<Dof*>, RealVector >
+            giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                                , int               stage
+                                                , int               subsys
+                                                , const TimeData&   time
+                                                , const RealVector& x ) override;
+        
         std::tuple< std::vector<Dof*>, RealVector >
             giveStaticLeftHandSideAt( Cell*           targetCell
                                     , int             stage
@@ -160,8 +185,29 @@ namespace broomstyx
         void initializeMaterialsAt( Cell* targetCell ) override;
         void initializeNumericsAt( Cell* targetCell ) override;
         void setDofStagesAt( Cell* targetCell ) override;
+        bool tracksCoefficientMatrixChanges() override;
+        bool hasStateIndependentRightHandSide() override;
 
     private:
+        enum FieldOutput
+        {
+            fo_unassigned,
+            fo_s_xx,
+            fo_s_yy,
+            fo_s_zz,
+            fo_s_xy,
+            fo_ux_x,
+            fo_uy_x,
+            fo_ux_y,
+            fo_uy_y,
+            fo_g_xy,
+            fo_ep_xx,
+            fo_ep_yy,
+            fo_ep_zz,
+            fo_ep_xy,
+            fo_ene
+        };
+        
         ScalarBasisFunction* _basisFunction;
         ScalarBasisFunction* _edgeBasisFunction;
         
@@ -174,10 +220,12 @@ namespace broomstyx
                    getNumericsStatusAt( Cell* targetCell );
         EvalPtNumericsStatus_PlaneStrain_Fe_Quad8*
                    getNumericsStatusAt( EvalPoint& gp );
+        double     giveGaussPointOutputValueAt( EvalPoint& gp, Material* material, int outputId );
         RealMatrix giveJacobianMatrixAt( Cell* targetCell, const RealVector& natCoor );
         RealMatrix giveBmatAt( Cell* targetCell, const RealVector& natCoor );
         RealVector giveLocalDisplacementsAt( Cell* targetCell, ValueType valType );
         std::vector<Dof*> giveNodalDofsAt( Cell* targetCell );
+        void       updateProductDataAt( Cell* targetCell );
     };
 }
 
@@ -20,7 +20,9 @@
 */
 
 #include "PlaneStrain_Fe_Tri3.hpp"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <string>
 #include <vector>
 #include "Core/AnalysisModel.hpp"
@@ -29,6 +31,7 @@
 #include "Core/DofManager.hpp"
 #include "Core/DomainManager.hpp"
 #include "Materials/Material.hpp"
+#include "Util/batchLinearAlgebra.hpp"
 #include "Util/linearAlgebra.hpp"
 
 using namespace broomstyx;
@@ -39,9 +42,9 @@ registerBroomstyxObject( Numerics, PlaneStrain_Fe_Tri3 )
 NumericsStatus_PlaneStrain_Fe_Tri3::NumericsStatus_PlaneStrain_Fe_Tri3()
     : _strain( RealVector( 4 ) )
     , _stress( RealVector( 4 ) )
-    , _gradU( RealMatrix( 2,2 ) )
     , _Jdet( 0. )
     , _materialStatus{ nullptr, nullptr }
+    , _cmatRevision( -1 )
 {}
 
 NumericsStatus_PlaneStrain_Fe_Tri3::~NumericsStatus_PlaneStrain_Fe_Tri3() = default;
@@ -85,7 +88,7 @@ void PlaneStrain_Fe_Tri3::deleteNumericsAt(Cell* targetCell)
     material[ 0 ]->destroy( cns->_materialStatus[ 0 ] );
     material[ 1 ]->destroy( cns->_materialStatus[ 1 ] );
     
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void PlaneStrain_Fe_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -116,25 +119,16 @@ void PlaneStrain_Fe_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time
 
     // Get stress
     cns->_stress = material[ 1 ]->giveForceFrom( cns->_strain, cns->_materialStatus[ 1 ] );
+    
+    // Tangent modulus of a nonlinear material follows the strain
+    if ( !material[ 1 ]->hasConstantModulus() )
+        targetCell->flagCoefficientMatrixChange();
 }
 // ----------------------------------------------------------------------------
 double PlaneStrain_Fe_Tri3::giveCellFieldValueAt( Cell* targetCell, int fieldNum )
 {
-    RealVector val;
-    std::string fieldTag;
-    
-    try
-    {
-        fieldTag = _cellFieldOutput.at( fieldNum );
-    }
-    catch ( std::exception& e )
-    {
-        fieldTag = "unassigned";
-    }
-    
-    std::tie( val, std::ignore ) = this->giveFieldOutputAt( targetCell, fieldTag );
-    
-    return val( 0 );
+    int outputId = this->giveFieldOutputIdFor( this->giveCellFieldTagFor( fieldNum ) );
+    return this->giveFieldOutputValueAt( targetCell, outputId );
 }
 // ----------------------------------------------------------------------------
 RealVector PlaneStrain_Fe_Tri3::giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum )
@@ -149,6 +143,35 @@ RealVector PlaneStrain_Fe_Tri3::giveCellNodeFieldValuesAt( Cell* targetCell, int
     return cellNodeValues;
 }
 // ----------------------------------------------------------------------------
+double PlaneStrain_Fe_Tri3::giveCriticalTimeStepAt( Cell* targetCell, int stage )
+{
+    double dt = std::numeric_limits<double>::max();
+    
+    if ( stage == _stage[ 0 ] )
+    {
+        auto cns = this->getNumericsStatusAt( targetCell );
+        
+        // Upper bound of wave speed from density and tangent modulus
+        std::vector< Material* > material = this->giveMaterialSetFor( targetCell );
+        double rho = material[ 0 ]->giveMaterialVariable( "Density", cns->_materialStatus[ 0 ] );
+        RealMatrix cmat = material[ 1 ]->giveModulusFrom( cns->_strain, cns->_materialStatus[ 1 ] );
+        double c = this->giveMaximumWaveSpeedFrom( cmat, rho );
+        
+        // The smallest altitude of the triangle is the reciprocal of the
+        // largest basis function gradient. The factor 1/sqrt(2) accounts for
+        // the element shape and keeps the estimate below the stability limit
+        // of the lumped mass element.
+        RealMatrix dpsi = this->giveGradBmatAt( targetCell );
+        double maxGradSq = 0.;
+        for ( int i = 0; i < 3; i++ )
+            maxGradSq = std::max( maxGradSq, dpsi( 0,i ) * dpsi( 0,i ) + dpsi( 1,i ) * dpsi( 1,i ) );
+        
+        dt = 1. / ( c * std::sqrt( 2. * maxGradSq ) );
+    }
+    
+    return dt;
+}
+// ----------------------------------------------------------------------------
 std::vector< RealVector > PlaneStrain_Fe_Tri3::giveEvaluationPointsFor( Cell *targetCell )
 {
     std::vector< Node* > node = analysisModel().domainManager().giveNodesOf( targetCell );
@@ -174,81 +197,111 @@ PlaneStrain_Fe_Tri3::giveFieldOutputAt( Cell* targetCell, const std::string& fie
     
     auto cns = this->getNumericsStatusAt( targetCell );
     weight( 0 ) = _wt * cns->_Jdet;
+    fieldVal( 0 ) = this->giveFieldOutputValueAt( targetCell, this->giveFieldOutputIdFor( fieldTag ) );
     
-    std::vector<Material*> material = this->giveMaterialSetFor( targetCell );
-    
+    return std::make_tuple( std::move( fieldVal ), std::move( weight ) );
+}
+// ----------------------------------------------------------------------------
+int PlaneStrain_Fe_Tri3::giveFieldOutputIdFor( const std::string& fieldTag )
+{
     if ( fieldTag == "unassigned" )
-        fieldVal( 0 ) = 0.;
+        return fo_unassigned;
     else if ( fieldTag == "s_xx" )
-        fieldVal( 0 ) = cns->_stress( 0 );
+        return fo_s_xx;
     else if ( fieldTag == "s_yy" )
-        fieldVal( 0 ) = cns->_stress( 1 );
+        return fo_s_yy;
     else if ( fieldTag == "s_zz" )
-        fieldVal( 0 ) = cns->_stress( 2 );
+        return fo_s_zz;
     else if ( fieldTag == "s_xy" )
-        fieldVal( 0 ) = cns->_stress( 3 );
+        return fo_s_xy;
     else if ( fieldTag == "ux_x" )
-        fieldVal( 0 ) = cns->_gradU( 0,0 );
+        return fo_ux_x;
     else if ( fieldTag == "uy_x" )
-        fieldVal( 0 ) = cns->_gradU( 0,1 );
+        return fo_uy_x;
     else if ( fieldTag == "ux_y" )
-        fieldVal( 0 ) = cns->_gradU( 1,0 );
+        return fo_ux_y;
     else if ( fieldTag == "uy_y" )
-        fieldVal( 0 ) = cns->_gradU( 1,1 );
+        return fo_uy_y;
     else if ( fieldTag == "g_xy" )
-        fieldVal( 0 ) = cns->_gradU( 1,0 ) + cns->_gradU( 0,1 );
+        return fo_g_xy;
     else if ( fieldTag == "ep_xx" )
-    {
-        try
-        {
-            fieldVal( 0 ) = material[ 1 ]->giveMaterialVariable( "plasticStrain_xx", cns->_materialStatus[ 1 ] );
-        }
-        catch ( ... )
-        {
-            fieldVal( 0 ) = 0.;
-        }
-    }
+        return this->hasMaterialVariable( 1, "plasticStrain_xx" ) ? fo_ep_xx : fo_unassigned;
     else if ( fieldTag == "ep_yy" )
-    {
-        try
-        {
-            fieldVal(0) = material[1]->giveMaterialVariable( "plasticStrain_yy", cns->_materialStatus[ 1 ] );
-        }
-        catch ( ... )
-        {
-            fieldVal( 0 ) = 0.;
-        }
-    }
+        return this->hasMaterialVariable( 1, "plasticStrain_yy" ) ? fo_ep_yy : fo_unassigned;
     else if ( fieldTag == "ep_zz" )
+        return this->hasMaterialVariable( 1, "plasticStrain_zz" ) ? fo_ep_zz : fo_unassigned;
+    else if ( fieldTag == "ep_xy" )
+        return this->hasMaterialVariable( 1, "plasticStrain_xy" ) ? fo_ep_xy : fo_unassigned;
+    else if ( fieldTag == "ene" )
+        return fo_ene;
+    else
+        throw std::runtime_error( "Invalid tag '" + fieldTag + "' supplied in field output request made to numerics '" + _name + "'!" );
+}
+// ----------------------------------------------------------------------------
+double PlaneStrain_Fe_Tri3::giveFieldOutputValueAt( Cell* targetCell, int outputId )
+{
+    auto cns = this->getNumericsStatusAt( targetCell );
+    
+    switch ( outputId )
     {
-        try
-        {
-            fieldVal( 0 ) = material[ 1 ]->giveMaterialVariable( "plasticStrain_zz", cns->_materialStatus[ 1 ] );
-        }
-        catch ( ... )
+        case fo_s_xx:
+            return cns->_stress( 0 );
+        case fo_s_yy:
+            return cns->_stress( 1 );
+        case fo_s_zz:
+            return cns->_stress( 2 );
+        case fo_s_xy:
+            return cns->_stress( 3 );
+        case fo_ux_x:
+            return cns->_gradU( 0,0 );
+        case fo_uy_x:
+            return cns->_gradU( 0,1 );
+        case fo_ux_y:
+            return cns->_gradU( 1,0 );
+        case fo_uy_y:
+            return cns->_gradU( 1,1 );
+        case fo_g_xy:
+            return cns->_gradU( 1,0 ) + cns->_gradU( 0,1 );
+        case fo_ep_xx:
+        case fo_ep_yy:
+        case fo_ep_zz:
+        case fo_ep_xy:
         {
-            fieldVal( 0 ) = 0.;
+            // Only reached if the materials provide plastic strains (see giveFieldOutputIdFor)
+            const char* varName[] = { "plasticStrain_xx", "plasticStrain_yy", "plasticStrain_zz", "plasticStrain_xy" };
+            std::vector<Material*> material = this->giveMaterialSetFor( targetCell );
+            return material[ 1 ]->giveMaterialVariable( varName[ outputId - fo_ep_xx ], cns->_materialStatus[ 1 ] );
         }
+        case fo_ene:
+            return 0.5 * ( cns->_stress( 0 ) * cns->_gradU( 0,0 ) +
+                           cns->_stress( 1 ) * cns->_gradU( 1,1 ) +
+                           cns->_stress( 3 ) * ( cns->_gradU( 1,0 ) + cns->_gradU( 0,1 ) ) );
+        default:
+            return 0.;
     }
-    else if ( fieldTag == "ep_xy" )
+}
+// ----------------------------------------------------------------------------
+std::tuple< std::vector< Dof* >, RealVector >
+PlaneStrain_Fe_Tri3::giveLumpedMassAt( Cell* targetCell, int stage, int subsys )
+{
+    std::vector< Dof* > rowDof;
+    RealVector mass;
+    
+    if ( stage == _stage[ 0 ] && ( subsys == _subsystem[ 0 ] || subsys == UNASSIGNED ) )
     {
-        try
-        {
-            fieldVal( 0 ) = material[ 1 ]->giveMaterialVariable( "plasticStrain_xy", cns->_materialStatus[ 1 ] );
-        }
-        catch ( ... )
-        {
-            fieldVal( 0 ) = 0.;
-        }
+        auto cns = this->getNumericsStatusAt( targetCell );
+        
+        std::vector< Material* > material = this->giveMaterialSetFor( targetCell );
+        double rho = material[ 0 ]->giveMaterialVariable( "Density", cns->_materialStatus[ 0 ] );
+        
+        // Element mass is distributed equally among the nodes
+        rowDof = this->giveNodalDofsAt( targetCell );
+        mass.init( 6 );
+        for ( int i = 0; i < 6; i++ )
+            mass( i ) = rho * _wt * cns->_Jdet / 3.0;
     }
-    else if ( fieldTag == "ene" )
-        fieldVal( 0 ) = 0.5 * ( cns->_stress( 0 ) * cns->_gradU( 0,0 ) +
-                                cns->_stress( 1 ) * cns->_gradU( 1,1 ) +
-                                cns->_stress( 3 ) * ( cns->_gradU( 1,0 ) + cns->_gradU( 0,1 ) ) );
-    else
-        throw std::runtime_error( "Invalid tag '" + fieldTag + "' supplied in field output request made to numerics '" + _name + "'!" );
     
-    return std::make_tuple( std::move( fieldVal ), std::move( weight ) );
+    return std::make_tuple( std::move( rowDof ), std::move( mass ) );
 }
 // ----------------------------------------------------------------------------
 std::tuple< std::vector< Dof* >, std::vector< Dof* >, RealVector >
@@ -296,6 +349,94 @@ PlaneStrain_Fe_Tri3::giveStaticCoefficientMatrixAt( Cell*           targetCell
     return std::make_tuple( std::move( rowDof ), std::move( colDof ), std::move( coefVal ) );
 }
 // ----------------------------------------------------------------------------
+void PlaneStrain_Fe_Tri3::giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                                         , int                     stage
+                                                         , int                     subsys
+                                                         , const TimeData&         time
+                                                         , CoefficientMatrixBatch& batch )
+{
+    if ( cell.empty() || stage != _stage[ 0 ] || ( subsys != _subsystem[ 0 ] && subsys != UNASSIGNED ) )
+        return;
+    
+    // Element stiffness matrices of up to simdBatchWidth cells are computed
+    // together, with the integrand trp(B)*C*B vectorized over the cells
+    double bmatBatch[ 4*6*simdBatchWidth ], cmatBatch[ 4*4*simdBatchWidth ], weight[ simdBatchWidth ];
+    double kmatBatch[ 6*6*simdBatchWidth ], work[ 4*6*simdBatchWidth ];
+    
+    // All cells of a batch belong to the same domain
+    std::vector<Material*> material = this->giveMaterialSetFor( cell[ 0 ] );
+    
+    int nCells = cell.size();
+    for ( int first = 0; first < nCells; first += simdBatchWidth )
+    {
+        int nLanes = std::min( simdBatchWidth, nCells - first );
+        if ( nLanes < simdBatchWidth )
+        {
+            // Unused lanes of the last batch contribute zero
+            std::fill( bmatBatch, bmatBatch + 4*6*simdBatchWidth, 0. );
+            std::fill( cmatBatch, cmatBatch + 4*4*simdBatchWidth, 0. );
+            std::fill( weight, weight + simdBatchWidth, 0. );
+        }
+        std::fill( kmatBatch, kmatBatch + 6*6*simdBatchWidth, 0. );
+        
+        for ( int lane = 0; lane < nLanes; lane++ )
+        {
+            auto cns = this->getNumericsStatusAt( cell[ first + lane ] );
+            
+            // Tangent modulus and Bmat
+            RealMatrix cmat = material[ 1 ]->giveModulusFrom( cns->_strain, cns->_materialStatus[ 1 ] );
+            RealMatrix bmat = this->giveBmatAt( cell[ first + lane ] );
+            
+            gatherIntoLane( bmat, lane, bmatBatch );
+            gatherIntoLane( cmat, lane, cmatBatch );
+            weight[ lane ] = _wt*cns->_Jdet;
+        }
+        
+        addBatchedBtCB( 4, 6, bmatBatch, cmatBatch, weight, kmatBatch, work );
+        
+        for ( int lane = 0; lane < nLanes; lane++ )
+            this->appendBatchedMatrixTo( batch, this->giveNodalDofsAt( cell[ first + lane ] ), kmatBatch, lane );
+    }
+}
+// ----------------------------------------------------------------------------
+std::tuple< std::vector<Dof*>, RealVector >
+PlaneStrain_Fe_Tri3::giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                                         , int               stage
+                                                         , int               subsys
+                                                         , const TimeData&   time
+                                                         , const RealVector& x )
+{
+    std::vector<Dof*> rowDof;
+    RealVector product;
+    
+    if ( stage == _stage[ 0 ] && ( subsys == _subsystem[ 0 ] || subsys == UNASSIGNED ) )
+    {
+        // Retrieve nodal DOFs local to element
+        rowDof = this->giveNodalDofsAt( targetCell );
+        
+        // Gather local values of global vector (constrained DOFs contribute
+        // nothing to the product)
+        RealVector xloc( 6 );
+        for ( int i = 0; i < 6; i++ )
+        {
+            int eqNum = analysisModel().dofManager().giveEquationNumberAt( rowDof[ i ] );
+            if ( eqNum != UNASSIGNED )
+                xloc( i ) = x( eqNum );
+        }
+        
+        // Retrieve numerics status
+        auto cns = this->getNumericsStatusAt( targetCell );
+        if ( cns->_cmatRevision != targetCell->giveCoefficientMatrixRevision() )
+            this->updateProductDataAt( targetCell );
+        
+        // Apply stiffness without forming it
+        product.init( 6 );
+        addBtCBx( 4, 6, cns->_bmat.ptr(), cns->_cmat.ptr(), _wt * cns->_Jdet, xloc.ptr(), product.ptr() );
+    }
+    
+    return std::make_tuple( std::move( rowDof ), std::move( product ) );
+}
+// ----------------------------------------------------------------------------
 std::tuple< std::vector< Dof* >, RealVector >
 PlaneStrain_Fe_Tri3::giveStaticLeftHandSideAt( Cell*           targetCell
                                              , int             stage
@@ -322,6 +463,8 @@ PlaneStrain_Fe_Tri3::giveStaticLeftHandSideAt( Cell*           targetCell
         std::vector< Material* > material = this->giveMaterialSetFor( targetCell );
         material[ 1 ]->updateStatusFrom( cns->_strain, cns->_materialStatus[ 1 ] );
         cns->_stress = material[ 1 ]->giveForceFrom( cns->_strain, cns->_materialStatus[ 1 ] );
+        if ( !material[ 1 ]->hasConstantModulus() )
+            targetCell->flagCoefficientMatrixChange();
 
         // Calculate lhs
         lhs = _wt * cns->_Jdet * trp( bmat ) * cns->_stress;
@@ -495,7 +638,7 @@ void PlaneStrain_Fe_Tri3::initializeMaterialsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void PlaneStrain_Fe_Tri3::initializeNumericsAt( Cell* targetCell )
 {
-    targetCell->numericsStatus = new NumericsStatus_PlaneStrain_Fe_Tri3();
+    targetCell->numericsStatus = _statusArena.create<NumericsStatus_PlaneStrain_Fe_Tri3>();
     auto cns = this->getNumericsStatusAt( targetCell );
     
     // Pre-calculate det(J) and inv(J);
@@ -526,6 +669,17 @@ void PlaneStrain_Fe_Tri3::setDofStagesAt( Cell* targetCell )
         DofManager::setStageFor( dof_y, _stage[ 0 ] );
     }
 }
+// ----------------------------------------------------------------------------
+bool PlaneStrain_Fe_Tri3::tracksCoefficientMatrixChanges()
+{
+    return true;
+}
+// ----------------------------------------------------------------------------
+bool PlaneStrain_Fe_Tri3::hasStateIndependentRightHandSide()
+{
+    // Body forces depend only on the cell geometry and the density
+    return true;
+}
 
 // Private methods
 // ---------------------------------------------------------------------------
@@ -599,4 +753,23 @@ std::vector<Dof*> PlaneStrain_Fe_Tri3::giveNodalDofsAt( Cell* targetCell )
         dof[ 2 * i + 1 ] = analysisModel().domainManager().giveNodalDof( _nodalDof[ 1 ], node[ i ] );
     }
     return dof;
+}
+// ----------------------------------------------------------------------------
+void PlaneStrain_Fe_Tri3::updateProductDataAt( Cell* targetCell )
+{
+    // The strain-displacement matrix is computed once, whereas the tangent
+    // modulus is renewed whenever the coefficient matrix revision of the
+    // cell has changed
+    auto cns = this->getNumericsStatusAt( targetCell );
+    std::vector<Material*> material = this->giveMaterialSetFor( targetCell );
+    
+    if ( cns->_bmat.dim1() == 0 )
+    {
+        cns->_bmat = this->giveBmatAt( targetCell );
+        cns->_bmat.simplify();
+    }
+    
+    cns->_cmat = material[ 1 ]->giveModulusFrom( cns->_strain, cns->_materialStatus[ 1 ] );
+    cns->_cmat.simplify();
+    cns->_cmatRevision = targetCell->giveCoefficientMatrixRevision();
 }
\ No newline at end of file
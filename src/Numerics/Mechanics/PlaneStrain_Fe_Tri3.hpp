@@ -63,6 +63,7 @@
 #define	PLANESTRAIN_FE_TRI3_HPP
 
 #include "Numerics/Numerics.hpp"
+#include "Util/StackRealMatrix.hpp"
 #include "Core/DofManager.hpp"
 #include "Core/NumericsManager.hpp"
 #include "BasisFunctions/Triangle_P1.hpp"
@@ -82,10 +83,15 @@ namespace broomstyx
     private:
         RealVector _strain;
         RealVector _stress;
-        RealMatrix _gradU;
+        StackRealMatrix<2,2> _gradU;
         RealMatrix _JmatInv;
         double     _Jdet;
         MaterialStatus* _materialStatus[ 2 ];
+        
+        // Data cached for matrix-free products and revision of the tangent
+        RealMatrix _bmat;
+        RealMatrix _cmat;
+        int        _cmatRevision;
     };
     
     class PlaneStrain_Fe_Tri3 final : public Numerics 
@@ -101,12 +107,20 @@ namespace broomstyx
         RealVector 
             giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum ) override;
         
+        double giveCriticalTimeStepAt( Cell* targetCell, int stage ) override;
+        
         std::vector<RealVector> 
             giveEvaluationPointsFor( Cell* targetCell ) override;
         
         std::tuple< RealVector,RealVector > 
             giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag ) override;
         
+        int    giveFieldOutputIdFor( const std::string& fieldTag ) override;
+        double giveFieldOutputValueAt( Cell* targetCell, int outputId ) override;
+        
+        std::tuple< std::vector<Dof*>, RealVector >
+            giveLumpedMassAt( Cell* targetCell, int stage, int subsys ) override;
+        
         std::tuple< std::vector<Dof*>
                   , std::vector<Dof*>
                   , RealVector >
@@ -115,6 +129,20 @@ namespace broomstyx
                                          , int             subsys
                                          , const TimeData& time ) override;
         
+        void
+            giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                           , int                     stage
+                                           , int                     subsys
+                                           , const TimeData&         time
+                                           , CoefficientMatrixBatch& batch ) override;
+        
+        std::tuple< std::vector<Dof*>, RealVector >
+            giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                                , int               stage
+                                                , int               subsys
+                                                , const TimeData&   time
+                                                , const RealVector& x ) override;
+        
         std::tuple< std::vector<Dof*>, RealVector >
             giveStaticLeftHandSideAt( Cell*           targetCell
                                     , int             stage
@@ -143,8 +171,29 @@ namespace broomstyx
         void initializeMaterialsAt( Cell* targetCell ) override;
         void initializeNumericsAt( Cell* targetCell ) override;
         void setDofStagesAt( Cell* targetCell ) override;
+        bool tracksCoefficientMatrixChanges() override;
+        bool hasStateIndependentRightHandSide() override;
 
     private:
+        enum FieldOutput
+        {
+            fo_unassigned,
+            fo_s_xx,
+            fo_s_yy,
+            fo_s_zz,
+            fo_s_xy,
+            fo_ux_x,
+            fo_uy_x,
+            fo_ux_y,
+            fo_uy_y,
+            fo_g_xy,
+            fo_ep_xx,
+            fo_ep_yy,
+            fo_ep_zz,
+            fo_ep_xy,
+            fo_ene
+        };
+        
         Triangle_P1 _basisFunction;
         RealVector  _basisFunctionValues;
         RealMatrix  _basisFunctionDerivatives;
@@ -159,6 +208,7 @@ namespace broomstyx
         RealMatrix giveJacobianMatrixAt( Cell* targetCell );
         static RealVector giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType );
         std::vector<Dof*> giveNodalDofsAt( Cell* targetCell );
+        void       updateProductDataAt( Cell* targetCell );
     };
 }
 
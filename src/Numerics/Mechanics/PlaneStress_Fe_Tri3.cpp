@@ -39,7 +39,6 @@ registerBroomstyxObject( Numerics, PlaneStress_Fe_Tri3 )
 NumericsStatus_PlaneStress_Fe_Tri3::NumericsStatus_PlaneStress_Fe_Tri3()
     : _strain( RealVector( 3 ) )
     , _stress( RealVector( 3 ) )
-    , _gradU( RealMatrix( 2,2 ) )
     , _Jdet( 0. )
     , _materialStatus{ nullptr, nullptr }
 {}
@@ -85,7 +84,7 @@ void PlaneStress_Fe_Tri3::deleteNumericsAt( Cell* targetCell )
     material[ 0 ]->destroy( cns->_materialStatus[ 0 ] );
     material[ 1 ]->destroy( cns->_materialStatus[ 1 ] );
     
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void PlaneStress_Fe_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -116,25 +115,16 @@ void PlaneStress_Fe_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time
 
     // Get stress
     cns->_stress = material[ 1 ]->giveForceFrom( cns->_strain, cns->_materialStatus[ 1 ] );
+    
+    // Tangent modulus of a nonlinear material follows the strain
+    if ( !material[ 1 ]->hasConstantModulus() )
+        targetCell->flagCoefficientMatrixChange();
 }
 // ----------------------------------------------------------------------------
 double PlaneStress_Fe_Tri3::giveCellFieldValueAt( Cell* targetCell, int fieldNum )
 {
-    RealVector val;
-    std::string fieldTag;
-    
-    try
-    {
-        fieldTag = _cellFieldOutput.at( fieldNum );
-    }
-    catch ( std::exception& e )
-    {
-        fieldTag = "unassigned";
-    }
-    
-    std::tie( val, std::ignore ) = this->giveFieldOutputAt( targetCell, fieldTag );
-    
-    return val( 0 );
+    int outputId = this->giveFieldOutputIdFor( this->giveCellFieldTagFor( fieldNum ) );
+    return this->giveFieldOutputValueAt( targetCell, outputId );
 }
 // ----------------------------------------------------------------------------
 RealVector PlaneStress_Fe_Tri3::giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum )
@@ -174,81 +164,88 @@ PlaneStress_Fe_Tri3::giveFieldOutputAt( Cell* targetCell, const std::string& fie
     
     auto cns = this->getNumericsStatusAt( targetCell );
     weight( 0 ) = _wt * cns->_Jdet;
+    fieldVal( 0 ) = this->giveFieldOutputValueAt( targetCell, this->giveFieldOutputIdFor( fieldTag ) );
     
-    std::vector<Material*> material = this->giveMaterialSetFor( targetCell );
-    
+    return std::make_tuple( std::move( fieldVal ), std::move( weight ) );
+}
+// ----------------------------------------------------------------------------
+int PlaneStress_Fe_Tri3::giveFieldOutputIdFor( const std::string& fieldTag )
+{
     if ( fieldTag == "unassigned" )
-        fieldVal( 0 ) = 0.;
+        return fo_unassigned;
     else if ( fieldTag == "s_xx" )
-        fieldVal( 0 ) = cns->_stress( 0 );
+        return fo_s_xx;
     else if ( fieldTag == "s_yy" )
-        fieldVal( 0 ) = cns->_stress( 1 );
+        return fo_s_yy;
     else if ( fieldTag == "s_zz" )
-        fieldVal( 0 ) = 0.;
+        return fo_s_zz;
     else if ( fieldTag == "s_xy" )
-        fieldVal( 0 ) = cns->_stress( 2 );
+        return fo_s_xy;
     else if ( fieldTag == "ux_x" )
-        fieldVal( 0 ) = cns->_gradU( 0,0 );
+        return fo_ux_x;
     else if ( fieldTag == "uy_x" )
-        fieldVal( 0 ) = cns->_gradU( 0,1 );
+        return fo_uy_x;
     else if ( fieldTag == "ux_y" )
-        fieldVal( 0 ) = cns->_gradU( 1,0 );
+        return fo_ux_y;
     else if ( fieldTag == "uy_y" )
-        fieldVal( 0 ) = cns->_gradU( 1,1 );
+        return fo_uy_y;
     else if ( fieldTag == "g_xy" )
-        fieldVal( 0 ) = cns->_gradU( 1,0 ) + cns->_gradU( 0,1 );
+        return fo_g_xy;
     else if ( fieldTag == "ep_xx" )
-    {
-        try
-        {
-            fieldVal( 0 ) = material[ 1 ]->giveMaterialVariable( "plasticStrain_xx", cns->_materialStatus[ 1 ] );
-        }
-        catch ( ... )
-        {
-            fieldVal( 0 ) = 0.;
-        }
-    }
+        return this->hasMaterialVariable( 1, "plasticStrain_xx" ) ? fo_ep_xx : fo_unassigned;
     else if ( fieldTag == "ep_yy" )
-    {
-        try
-        {
-            fieldVal(0) = material[1]->giveMaterialVariable( "plasticStrain_yy", cns->_materialStatus[ 1 ] );
-        }
-        catch ( ... )
-        {
-            fieldVal( 0 ) = 0.;
-        }
-    }
+        return this->hasMaterialVariable( 1, "plasticStrain_yy" ) ? fo_ep_yy : fo_unassigned;
     else if ( fieldTag == "ep_zz" )
-    {
-        try
-        {
-            fieldVal( 0 ) = material[ 1 ]->giveMaterialVariable( "plasticStrain_zz", cns->_materialStatus[ 1 ] );
-        }
-        catch ( ... )
-        {
-            fieldVal( 0 ) = 0.;
-        }
-    }
+        return this->hasMaterialVariable( 1, "plasticStrain_zz" ) ? fo_ep_zz : fo_unassigned;
     else if ( fieldTag == "ep_xy" )
-    {
-        try
-        {
-            fieldVal( 0 ) = material[ 1 ]->giveMaterialVariable( "plasticStrain_xy", cns->_materialStatus[ 1 ] );
-        }
-        catch ( ... )
-        {
-            fieldVal( 0 ) = 0.;
-        }
-    }
+        return this->hasMaterialVariable( 1, "plasticStrain_xy" ) ? fo_ep_xy : fo_unassigned;
     else if ( fieldTag == "ene" )
-        fieldVal( 0 ) = 0.5 * ( cns->_stress( 0 ) * cns->_gradU( 0,0 ) +
-                                cns->_stress( 1 ) * cns->_gradU( 1,1 ) +
-                                cns->_stress( 2 ) * ( cns->_gradU( 1,0 ) + cns->_gradU( 0,1 ) ) );
+        return fo_ene;
     else
         throw std::runtime_error( "Invalid tag '" + fieldTag + "' supplied in field output request made to numerics '" + _name + "'!" );
+}
+// ----------------------------------------------------------------------------
+double PlaneStress_Fe_Tri3::giveFieldOutputValueAt( Cell* targetCell, int outputId )
+{
+    auto cns = this->getNumericsStatusAt( targetCell );
     
-    return std::make_tuple( std::move( fieldVal ), std::move( weight ) );
+    switch ( outputId )
+    {
+        case fo_s_xx:
+            return cns->_stress( 0 );
+        case fo_s_yy:
+            return cns->_stress( 1 );
+        case fo_s_zz:
+            return 0.;
+        case fo_s_xy:
+            return cns->_stress( 2 );
+        case fo_ux_x:
+            return cns->_gradU( 0,0 );
+        case fo_uy_x:
+            return cns->_gradU( 0,1 );
+        case fo_ux_y:
+            return cns->_gradU( 1,0 );
+        case fo_uy_y:
+            return cns->_gradU( 1,1 );
+        case fo_g_xy:
+            return cns->_gradU( 1,0 ) + cns->_gradU( 0,1 );
+        case fo_ep_xx:
+        case fo_ep_yy:
+        case fo_ep_zz:
+        case fo_ep_xy:
+        {
+            // Only reached if the materials provide plastic strains (see giveFieldOutputIdFor)
+            const char* varName[] = { "plasticStrain_xx", "plasticStrain_yy", "plasticStrain_zz", "plasticStrain_xy" };
+            std::vector<Material*> material = this->giveMaterialSetFor( targetCell );
+            return material[ 1 ]->giveMaterialVariable( varName[ outputId - fo_ep_xx ], cns->_materialStatus[ 1 ] );
+        }
+        case fo_ene:
+            return 0.5 * ( cns->_stress( 0 ) * cns->_gradU( 0,0 ) +
+                           cns->_stress( 1 ) * cns->_gradU( 1,1 ) +
+                           cns->_stress( 2 ) * ( cns->_gradU( 1,0 ) + cns->_gradU( 0,1 ) ) );
+        default:
+            return 0.;
+    }
 }
 // ----------------------------------------------------------------------------
 std::tuple< std::vector< Dof* >, std::vector< Dof* >, RealVector >
@@ -322,6 +319,8 @@ PlaneStress_Fe_Tri3::giveStaticLeftHandSideAt( Cell*           targetCell
         std::vector< Material* > material = this->giveMaterialSetFor( targetCell );
         material[ 1 ]->updateStatusFrom( cns->_strain, cns->_materialStatus[ 1 ] );
         cns->_stress = material[ 1 ]->giveForceFrom( cns->_strain, cns->_materialStatus[ 1 ] );
+        if ( !material[ 1 ]->hasConstantModulus() )
+            targetCell->flagCoefficientMatrixChange();
 
         // Calculate lhs
         lhs = _wt * cns->_Jdet * trp( bmat ) * cns->_stress;
@@ -494,7 +493,7 @@ void PlaneStress_Fe_Tri3::initializeMaterialsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void PlaneStress_Fe_Tri3::initializeNumericsAt( Cell* targetCell )
 {
-    targetCell->numericsStatus = new NumericsStatus_PlaneStress_Fe_Tri3();
+    targetCell->numericsStatus = _statusArena.create<NumericsStatus_PlaneStress_Fe_Tri3>();
     auto cns = this->getNumericsStatusAt( targetCell );
     
     // Pre-calculate det(J) and inv(J);
@@ -525,6 +524,17 @@ void PlaneStress_Fe_Tri3::setDofStagesAt( Cell* targetCell )
         DofManager::setStageFor( dof_y, _stage[ 0 ] );
     }
 }
+// ----------------------------------------------------------------------------
+bool PlaneStress_Fe_Tri3::tracksCoefficientMatrixChanges()
+{
+    return true;
+}
+// ----------------------------------------------------------------------------
+bool PlaneStress_Fe_Tri3::hasStateIndependentRightHandSide()
+{
+    // Body forces depend only on the cell geometry and the density
+    return true;
+}
 
 // Private methods
 // ---------------------------------------------------------------------------
@@ -61,6 +61,7 @@
 #define	PLANESTRESS_FE_TRI3_HPP
 
 #include "Numerics/Numerics.hpp"
+#include "Util/StackRealMatrix.hpp"
 #include "Core/DofManager.hpp"
 #include "Core/NumericsManager.hpp"
 #include "BasisFunctions/Triangle_P1.hpp"
@@ -80,7 +81,7 @@ namespace broomstyx
     private:
         RealVector _strain;
         RealVector _stress;
-        RealMatrix _gradU;
+        StackRealMatrix<2,2> _gradU;
         RealMatrix _JmatInv;
         double     _Jdet;
         MaterialStatus* _materialStatus[ 2 ];
@@ -105,6 +106,9 @@ namespace broomstyx
         std::tuple< RealVector,RealVector > 
             giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag ) override;
         
+        int    giveFieldOutputIdFor( const std::string& fieldTag ) override;
+        double giveFieldOutputValueAt( Cell* targetCell, int outputId ) override;
+        
         std::tuple< std::vector<Dof*>
                   , std::vector<Dof*>
                   , RealVector >
@@ -141,8 +145,29 @@ namespace broomstyx
         void initializeMaterialsAt( Cell* targetCell ) override;
         void initializeNumericsAt( Cell* targetCell ) override;
         void setDofStagesAt( Cell* targetCell ) override;
+        bool tracksCoefficientMatrixChanges() override;
+        bool hasStateIndependentRightHandSide() override;
 
     private:
+        enum FieldOutput
+        {
+            fo_unassigned,
+            fo_s_xx,
+            fo_s_yy,
+            fo_s_zz,
+            fo_s_xy,
+            fo_ux_x,
+            fo_uy_x,
+            fo_ux_y,
+            fo_uy_y,
+            fo_g_xy,
+            fo_ep_xx,
+            fo_ep_yy,
+            fo_ep_zz,
+            fo_ep_xy,
+            fo_ene
+        };
+        
         Triangle_P1 _basisFunction;
         RealVector  _basisFunctionValues;
         RealMatrix  _basisFunctionDerivatives;
@@ -104,7 +104,7 @@ StVenantTorsion_Fe_Tri6::~StVenantTorsion_Fe_Tri6()
 // ----------------------------------------------------------------------------
 void StVenantTorsion_Fe_Tri6::deleteNumericsAt( Cell* targetCell )
 {
-    delete targetCell->numericsStatus;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void StVenantTorsion_Fe_Tri6::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -197,14 +197,7 @@ RealVector StVenantTorsion_Fe_Tri6::giveCellNodeFieldValuesAt( Cell* targetCell,
     auto cns = this->getNumericsStatusAt(targetCell);
     
     std::string fieldTag;
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch (std::exception& e)
-    {
-        fieldTag = "unassigned";
-    }
+    fieldTag = this->giveCellFieldTagFor(fieldNum);
     
     if ( fieldTag == "s_zx" )
         nodeVals = cns->_nodalStress_zx;
@@ -474,7 +467,7 @@ void StVenantTorsion_Fe_Tri6::initializeNumericsAt( Cell* targetCell )
     int nGaussPts = _integrationRule.giveNumberOfIntegrationPoints();
     std::tie(gpCoor, gpWt) = _integrationRule.giveIntegrationPointsAndWeights();
     
-    targetCell->numericsStatus = new CellNumericsStatus_StVenantTorsion_Fe_Tri6(nGaussPts);
+    targetCell->numericsStatus = _statusArena.create<CellNumericsStatus_StVenantTorsion_Fe_Tri6>(nGaussPts);
 }
 // ----------------------------------------------------------------------------
 void StVenantTorsion_Fe_Tri6::readAdditionalDataFrom( FILE* fp )
@@ -99,7 +99,7 @@ void CahnHilliard_Elas_FeFv_Tri3::deleteNumericsAt( Cell* targetCell )
     material[ 2 ]->destroy( cns->_materialStatus[ 2 ] );
     material[ 3 ]->destroy( cns->_materialStatus[ 3 ] );
 
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void CahnHilliard_Elas_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -158,7 +158,7 @@ void CahnHilliard_Elas_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeDa
     // A. Calculate concentration flux at faces
     std::vector<Node*> node;
     node = analysisModel().domainManager().giveNodesOf( targetCell );
-    std::vector<std::vector<Node*> > face = giveFaceNodesOf( targetCell );
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
 
     // Get cell neighbors
     std::vector<Cell*> neighbor = analysisModel().domainManager().giveNeighborsOf( targetCell );
@@ -167,8 +167,10 @@ void CahnHilliard_Elas_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeDa
     double c_normalGradient[ 3 ];
     for ( int i = 0; i < 3; i++ )
     {
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf( targetCell, i );
+        
         // Length of face
-        double length = giveLengthOf( face[ i ] );
+        double length = fg.measure[k];
 
         if ( cns->_hasConcentrationGradientPrescribedOnFace[ i ] )
             c_normalGradient[ i ] = 0.;
@@ -196,7 +198,8 @@ void CahnHilliard_Elas_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeDa
 
     for ( int i = 0; i < 3; i++ )
     {
-        double length = giveLengthOf( face[ i ] );
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf( targetCell, i );
+        double length = fg.measure[k];
         RealVector vtxNodeCoor = analysisModel().domainManager().giveCoordinatesOf( vertexNode[ i ] );
         d_c = d_c + c_normalGradient[ i ] * length / ( 2. * cns->_area ) * ( cellCoor - vtxNodeCoor );
     }
@@ -212,14 +215,7 @@ double CahnHilliard_Elas_FeFv_Tri3::giveCellFieldValueAt( Cell* targetCell, int
     RealVector val, wt;
     std::string fieldTag;
 
-    try
-    {
-        fieldTag = _cellFieldOutput.at( fieldNum );
-    }
-    catch ( std::exception& e )
-    {
-        fieldTag = "unassigned";
-    }
+    fieldTag = this->giveCellFieldTagFor( fieldNum );
 
     std::tie( val,wt ) = this->giveFieldOutputAt( targetCell, fieldTag );
 
@@ -527,9 +523,6 @@ CahnHilliard_Elas_FeFv_Tri3::giveStaticLeftHandSideAt( Cell*           targetCel
 
         if ( subsys == _subsystem[ 1 ] || subsys == UNASSIGNED )
         {
-            // Get faces of target cell
-            std::vector<std::vector<Node*> > face = giveFaceNodesOf( targetCell );
-
             // Get cell neighbors
             std::vector<Cell*> neighbor = analysisModel().domainManager().giveNeighborsOf( targetCell );
 
@@ -538,7 +531,7 @@ CahnHilliard_Elas_FeFv_Tri3::giveStaticLeftHandSideAt( Cell*           targetCel
             {
                 for ( int i = 0; i < 3; i++ )
                     if ( !cns->_hasConcentrationGradientPrescribedOnFace[ i ] || !cns->_hasPsiGradientPrescribedOnFace[ i ] )
-                        cns->_transmissibility[ i ] = this->giveTransmissibilityCoefficientAt( face[ i ], targetCell, neighbor[ i ] );
+                        cns->_transmissibility[ i ] = this->giveTransmissibilityCoefficientAt( targetCell, i );
 
                 cns->_hasNotComputedTransmissibilities = false;
             }
@@ -831,7 +824,7 @@ void CahnHilliard_Elas_FeFv_Tri3::initializeMaterialsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void CahnHilliard_Elas_FeFv_Tri3::initializeNumericsAt( Cell* targetCell )
 {
-    targetCell->numericsStatus = new CellNumericsStatus();
+    targetCell->numericsStatus = _statusArena.create<CellNumericsStatus>();
     auto cns = this->getNumericsStatusAt( targetCell );
 
     // Pre-calculate det(J) and inv(J);
@@ -850,6 +843,8 @@ void CahnHilliard_Elas_FeFv_Tri3::initializeNumericsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void CahnHilliard_Elas_FeFv_Tri3::readAdditionalDataFrom( FILE* fp )
 {
+    analysisModel().domainManager().mustFormFaceGeometry();
+
     verifyKeyword( fp, "Mobility", _name );
     _M = getRealInputFrom( fp, "Failed to read mobility from input file!", _name );
     verifyKeyword( fp, "GradientEnergyCoef", _name );
@@ -945,17 +940,6 @@ std::vector<std::vector<Node*> > CahnHilliard_Elas_FeFv_Tri3::giveFaceNodesOf( C
     return face;
 }
 // ----------------------------------------------------------------------------
-double CahnHilliard_Elas_FeFv_Tri3::giveDistanceToMidpointOf( std::vector<Node*>& face
-                                                            , RealVector&         coor )
-{
-    RealVector coor0, coor1, dx;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf( face[ 0 ] );
-    coor1 = analysisModel().domainManager().giveCoordinatesOf( face[ 1 ] );
-    dx = 0.5 * ( coor0 + coor1 ) - coor;
-
-    return std::sqrt( dx.dot( dx ) );
-}
-// ----------------------------------------------------------------------------
 RealMatrix CahnHilliard_Elas_FeFv_Tri3::giveJacobianMatrixAt( Cell* targetCell )
 {
     std::vector<Node*> node = analysisModel().domainManager().giveNodesOf( targetCell );
@@ -971,16 +955,6 @@ RealMatrix CahnHilliard_Elas_FeFv_Tri3::giveJacobianMatrixAt( Cell* targetCell )
     return _basisFunctionDerivatives * coorMat;
 }
 // ----------------------------------------------------------------------------
-double CahnHilliard_Elas_FeFv_Tri3::giveLengthOf( std::vector<Node*>& face )
-{
-    RealVector coor0, coor1, dx;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf( face[ 0 ] );
-    coor1 = analysisModel().domainManager().giveCoordinatesOf( face[ 1 ] );
-    dx = coor1 - coor0;
-
-    return std::sqrt( dx.dot( dx ) );
-}
-// ----------------------------------------------------------------------------
 RealVector CahnHilliard_Elas_FeFv_Tri3::giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType )
 {
     // Displacements
@@ -1010,28 +984,10 @@ std::vector<Dof*> CahnHilliard_Elas_FeFv_Tri3::giveNodalDofsAt( Cell* targetCell
     return dof;
 }
 // ----------------------------------------------------------------------------
-double CahnHilliard_Elas_FeFv_Tri3::giveTransmissibilityCoefficientAt( std::vector<Node*>& face
-        , Cell*               targetCell
-        , Cell*               neighborCell )
+double CahnHilliard_Elas_FeFv_Tri3::giveTransmissibilityCoefficientAt( Cell* targetCell, int faceNum )
 {
-    // A. Target cell
-    // Coordinates of cell center
-    std::vector<RealVector> ep = this->giveEvaluationPointsFor( targetCell );
-    RealVector coor1 = ep[ 0 ];
-
-    // length of face
-    double length = giveLengthOf( face );
-
-    // Distance from cell center to midpoint of face
-    double d1 = giveDistanceToMidpointOf( face, coor1 );
-
-    // B. Neighbor cell
-    // Coordinates of cell center
-    ep = this->giveEvaluationPointsFor( neighborCell );
-    RealVector coor2 = ep[ 0 ];
-
-    // Distance from cell center to midpoint of face
-    double d2 = giveDistanceToMidpointOf( face, coor2 );
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
+    int k = analysisModel().domainManager().giveFaceGeometryIndexOf( targetCell, faceNum );
 
-    return length / ( d1 + d2 );
+    return fg.transFactor[ k ];
 }
\ No newline at end of file
@@ -133,14 +133,10 @@ namespace broomstyx
         CellNumericsStatus* getNumericsStatusAt( Cell* targetCell );
         RealMatrix        giveBmatAt( Cell* targetCell );
         static std::vector< std::vector<Node*> > giveFaceNodesOf( Cell* targetCell );
-        static double     giveDistanceToMidpointOf( std::vector<Node*>& face, RealVector& coor);
         RealMatrix        giveJacobianMatrixAt( Cell* targetCell );
-        static double     giveLengthOf( std::vector<Node*>& face );
         static RealVector giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType );
         std::vector<Dof*> giveNodalDofsAt( Cell* targetCell );
-        double            giveTransmissibilityCoefficientAt( std::vector<Node*>& face
-                                                           , Cell*               targetCell
-                                                           , Cell*               neighborCell );
+        double            giveTransmissibilityCoefficientAt( Cell* targetCell, int faceNum );
     };
 }
 
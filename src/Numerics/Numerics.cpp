@@ -22,12 +22,16 @@
 */
 
 #include "Numerics.hpp"
+#include <cmath>
 #include <cstring>
 #include <stdexcept>
 
 #include "Core/AnalysisModel.hpp"
+#include "Core/DofManager.hpp"
 #include "Core/DomainManager.hpp"
 #include "Core/SolutionManager.hpp"
+#include "Materials/Material.hpp"
+#include "Util/batchLinearAlgebra.hpp"
 #include "Util/readOperations.hpp"
 
 using namespace broomstyx;
@@ -62,18 +66,38 @@ std::string Numerics::giveName()
 std::tuple<RealVector,RealVector>
 Numerics::giveCellFieldOutputAtEvaluationPointsOf( Cell* targetCell, int fieldNum )
 {
-    std::string fieldTag;
-    try
+    auto result = this->giveFieldOutputAt(targetCell, this->giveCellFieldTagFor(fieldNum));
+    return result;
+}
+// ----------------------------------------------------------------------------
+void Numerics::giveCellFieldValuesAt( ArraySpan<Cell* const> cell, int accessorId, double* value )
+{
+    int nCells = cell.size();
+    if ( nCells == 0 )
+        return;
+    
+    const FieldAccessor& accessor = _fieldAccessor[accessorId];
+    if ( accessor.outputId != UNASSIGNED )
     {
-        fieldTag = _cellFieldOutput.at(fieldNum);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int i = 0; i < nCells; i++ )
+            value[i] = this->giveFieldOutputValueAt(cell[i], accessor.outputId);
     }
-    catch (std::exception& e)
+    else
     {
-        fieldTag = "unassigned";
+        // Numerics without compiled output IDs go through the tag-based
+        // path. The first cell is evaluated serially so that an invalid tag
+        // raises its exception outside the parallel region.
+        value[0] = this->giveCellFieldValueAt(cell[0], accessor.fieldNum);
+        
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int i = 1; i < nCells; i++ )
+            value[i] = this->giveCellFieldValueAt(cell[i], accessor.fieldNum);
     }
-    
-    auto result = this->giveFieldOutputAt(targetCell, fieldTag);
-    return result;
 }
 // // ----------------------------------------------------------------------------
 // int Numerics::giveIndexOfCellDof( int dofNum )
@@ -100,6 +124,16 @@ void Numerics::imposeConstraintAt( Cell*                    targetCell
     // Do nothing.
 }
 // ----------------------------------------------------------------------------
+int Numerics::giveFieldOutputIdFor( const std::string& fieldTag )
+{
+    /* Derived classes that can evaluate field output without string
+       comparisons override this method (together with giveFieldOutputValueAt)
+       to map each valid tag to an integer ID. Invalid tags should throw here
+       so that they are reported once, when output is resolved.
+    */
+    return UNASSIGNED;
+}
+// ----------------------------------------------------------------------------
 void Numerics::initializeMaterialsAt( Cell* targetCell ) {}
 // ----------------------------------------------------------------------------
 bool Numerics::performAdditionalConvergenceCheckAt( int stage, const TimeData& time )
@@ -138,6 +172,11 @@ void Numerics::printPostIterationMessage( int stage )
 // ----------------------------------------------------------------------------
 void Numerics::readAdditionalDataFrom( FILE* fp ) {}
 // ----------------------------------------------------------------------------
+void Numerics::releaseStatusStorage()
+{
+    _statusArena.clear();
+}
+// ----------------------------------------------------------------------------
 void Numerics::readDataFrom( FILE* fp )
 {
     std::string str;
@@ -208,6 +247,34 @@ void Numerics::removeConstraintsOn( Cell* targetCell )
     */
 }
 // ----------------------------------------------------------------------------
+bool Numerics::tracksCoefficientMatrixChanges()
+{
+    // Coefficient matrices are recomputed on every assembly unless the
+    // derived class flags changes to the state they depend on
+    return false;
+}
+// ----------------------------------------------------------------------------
+bool Numerics::hasStateIndependentRightHandSide()
+{
+    // Right hand sides are re-evaluated on every assembly unless the derived
+    // class declares that they do not depend on the state of the cells
+    return false;
+}
+// ----------------------------------------------------------------------------
+int Numerics::resolveCellFieldOutput( int fieldNum )
+{
+    for ( int i = 0; i < (int)_fieldAccessor.size(); i++ )
+        if ( _fieldAccessor[i].fieldNum == fieldNum )
+            return i;
+    
+    FieldAccessor accessor;
+    accessor.fieldNum = fieldNum;
+    accessor.outputId = this->giveFieldOutputIdFor(this->giveCellFieldTagFor(fieldNum));
+    _fieldAccessor.push_back(accessor);
+    
+    return (int)_fieldAccessor.size() - 1;
+}
+// ----------------------------------------------------------------------------
 int Numerics::requiredNumberOfDofPerCell() 
 {
     return _dofPerCell;
@@ -259,6 +326,14 @@ RealVector Numerics::giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum )
     return dummy;
 }
 // ----------------------------------------------------------------------------
+double Numerics::giveCriticalTimeStepAt( Cell* targetCell, int stage )
+{
+    this->error_unimplemented("giveCriticalTimeStepAt(...)");
+    
+    // Return statement just to suppress compilation warnings.
+    return 0.;
+}
+// ----------------------------------------------------------------------------
 std::vector<RealVector> Numerics::giveEvaluationPointsFor( Cell* targetCell )
 {
     this->error_unimplemented("giveEvaluationPointsFor(...)");
@@ -278,6 +353,25 @@ Numerics::giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag )
     return std::make_tuple(dummy, dummy);
 }
 // ----------------------------------------------------------------------------
+double Numerics::giveFieldOutputValueAt( Cell* targetCell, int outputId )
+{
+    this->error_unimplemented("giveFieldOutputValueAt(...)");
+    
+    // Return statement just to suppress compilation warnings.
+    return 0.;
+}
+// ----------------------------------------------------------------------------
+std::tuple< std::vector<Dof*>, RealVector >
+Numerics::giveLumpedMassAt( Cell* targetCell, int stage, int subsys )
+{
+    this->error_unimplemented("giveLumpedMassAt(...)");
+    
+    // Return statement just to suppress compilation warnings.
+    std::vector<Dof*> dofdummy;
+    RealVector dummy;
+    return std::make_tuple(dofdummy, dummy);
+}
+// ----------------------------------------------------------------------------
 RealVector Numerics::giveNumericsParameter( const std::string& paramTag )
 {
     throw std::runtime_error("nERROR: Unknown parameter '" + paramTag + "' requested from numerics!\n");
@@ -297,6 +391,58 @@ Numerics::giveStaticCoefficientMatrixAt( Cell*           targetCell
     return std::make_tuple(dofdummy, dofdummy, dummy);
 }
 // ----------------------------------------------------------------------------
+void Numerics::giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                              , int                     stage
+                                              , int                     subsys
+                                              , const TimeData&         time
+                                              , CoefficientMatrixBatch& batch )
+{
+    // Default implementation forms the coefficient matrices one cell at a
+    // time
+    for ( Cell* curCell : cell )
+    {
+        std::vector<Dof*> rowDof, colDof;
+        RealVector coefVal;
+        std::tie(rowDof, colDof, coefVal) = this->giveStaticCoefficientMatrixAt(curCell, stage, subsys, time);
+        
+        int lnnz = rowDof.size();
+        batch.rowDof.insert(batch.rowDof.end(), rowDof.begin(), rowDof.end());
+        batch.colDof.insert(batch.colDof.end(), colDof.begin(), colDof.end());
+        for ( int i = 0; i < lnnz; i++ )
+            batch.coefVal.push_back(coefVal(i));
+        batch.cellEnd.push_back(batch.coefVal.size());
+    }
+}
+// ----------------------------------------------------------------------------
+std::tuple< std::vector<Dof*>, RealVector >
+Numerics::giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                              , int               stage
+                                              , int               subsys
+                                              , const TimeData&   time
+                                              , const RealVector& x )
+{
+    // Default implementation forms the coefficient matrix of the cell.
+    // Numerics that cache the data needed to apply their kernels directly
+    // should override this.
+    std::vector<Dof*> rowDof, colDof;
+    RealVector coefVal;
+    std::tie(rowDof, colDof, coefVal) = this->giveStaticCoefficientMatrixAt(targetCell, stage, subsys, time);
+    
+    int lnnz = rowDof.size();
+    RealVector product(lnnz);
+    for ( int i = 0; i < lnnz; i++ )
+    {
+        if ( rowDof[i] && colDof[i] )
+        {
+            int colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[i]);
+            if ( colNum != UNASSIGNED )
+                product(i) = coefVal(i)*x(colNum);
+        }
+    }
+    
+    return std::make_tuple(std::move(rowDof), std::move(product));
+}
+// ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>, RealVector >
 Numerics::giveStaticLeftHandSideAt( Cell*           targetCell
                                   , int             stage
@@ -382,12 +528,72 @@ void Numerics::setDofStagesAt( Cell* targetCell )
 
 // Helper methods
 // ----------------------------------------------------------------------------
+void Numerics::appendBatchedMatrixTo( CoefficientMatrixBatch&  batch
+                                    , const std::vector<Dof*>& dof
+                                    , const double*            kmat
+                                    , int                      lane )
+{
+    // Entries are appended row by row from lane 'lane' of the batched
+    // element matrix 'kmat'
+    int nDof = dof.size();
+    for ( int i = 0; i < nDof; i++ )
+        for ( int j = 0; j < nDof; j++ )
+        {
+            batch.rowDof.push_back(dof[i]);
+            batch.colDof.push_back(dof[j]);
+            batch.coefVal.push_back(kmat[ (i*nDof + j)*simdBatchWidth + lane ]);
+        }
+    batch.cellEnd.push_back(batch.coefVal.size());
+}
+// ----------------------------------------------------------------------------
+std::string Numerics::giveCellFieldTagFor( int fieldNum )
+{
+    auto it = _cellFieldOutput.find(fieldNum);
+    if ( it == _cellFieldOutput.end() )
+        return "unassigned";
+    
+    return it->second;
+}
+// ----------------------------------------------------------------------------
 std::vector<Material*> Numerics::giveMaterialSetFor( Cell* targetCell )
 {
     int label = analysisModel().domainManager().giveLabelOf(targetCell);
     return analysisModel().domainManager().giveMaterialSetForDomain(label);
 }
 // ----------------------------------------------------------------------------
+double Numerics::giveMaximumWaveSpeedFrom( const RealMatrix& tangent, double density )
+{
+    // The largest absolute row sum bounds the largest eigenvalue of the
+    // tangent modulus from above, which also covers anisotropic and
+    // degraded moduli
+    double maxRowSum = 0.;
+    for ( int i = 0; i < tangent.dim1(); i++ )
+    {
+        double rowSum = 0.;
+        for ( int j = 0; j < tangent.dim2(); j++ )
+            rowSum += std::fabs(tangent(i,j));
+        if ( rowSum > maxRowSum )
+            maxRowSum = rowSum;
+    }
+    
+    return std::sqrt(maxRowSum/density);
+}
+// ----------------------------------------------------------------------------
+bool Numerics::hasMaterialVariable( int matIdx, const std::string& label )
+{
+    // True if the material at position 'matIdx' of every material set
+    // assigned with this numerics provides the variable
+    std::vector< std::vector<Material*> > matSets = analysisModel().domainManager().giveMaterialSetsFor(this);
+    if ( matSets.empty() )
+        return false;
+    
+    for ( auto& matSet : matSets )
+        if ( matIdx >= (int)matSet.size() || !matSet[ matIdx ] || !matSet[ matIdx ]->hasMaterialVariable(label) )
+            return false;
+    
+    return true;
+}
+// ----------------------------------------------------------------------------
 void Numerics::error_unimplemented( std::string method )
 {
     throw std::runtime_error("\nError: Call to unimplemented method '"
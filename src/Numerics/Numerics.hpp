@@ -36,12 +36,35 @@
 #include "Core/InitialCondition.hpp"
 #include "Core/DofManager.hpp"
 #include "Core/TimeData.hpp"
+#include "Util/ArraySpan.hpp"
+#include "Util/ObjectArena.hpp"
+#include "Util/RealMatrix.hpp"
 
 namespace broomstyx
 {
     class AnalysisModel;
     class Material;
     
+    // Coefficient matrix entries of a batch of cells, appended cell by cell
+    // in the same order as the entries of giveStaticCoefficientMatrixAt
+    struct CoefficientMatrixBatch
+    {
+        std::vector<Dof*>   rowDof;
+        std::vector<Dof*>   colDof;
+        std::vector<double> coefVal;
+        
+        // End of the entries of each cell
+        std::vector<int>    cellEnd;
+        
+        void clear()
+        {
+            rowDof.clear();
+            colDof.clear();
+            coefVal.clear();
+            cellEnd.clear();
+        }
+    };
+    
     class NumericsStatus
     {
     public:
@@ -65,10 +88,13 @@ namespace broomstyx
         
         std::tuple<RealVector,RealVector> 
              giveCellFieldOutputAtEvaluationPointsOf( Cell* targetCell, int fieldNum );
+        void giveCellFieldValuesAt( ArraySpan<Cell* const> cell, int accessorId, double* value );
         // int  giveIndexOfCellDof( int dofNum );
         // int  giveIndexOfNodalDof( int dofNum );
         int  giveSpatialDimension();
         void readDataFrom( FILE* fp );
+        void releaseStatusStorage();
+        int  resolveCellFieldOutput( int fieldNum );
 
         int requiredNumberOfDofPerCell();
         int requiredNumberOfMaterials();
@@ -76,6 +102,7 @@ namespace broomstyx
         int requiredNumberOfNodes();
         int requiredNumberOfStages();
 
+        virtual int  giveFieldOutputIdFor( const std::string& fieldTag );
         virtual void initializeMaterialsAt( Cell* targetCell );
         virtual bool performAdditionalConvergenceCheckAt( int stage, const TimeData& time );
         virtual bool performAdditionalConvergenceCheckAt( Cell* targetCell, int stage );
@@ -83,6 +110,19 @@ namespace broomstyx
         virtual void printPostIterationMessage( int stage );
         virtual void readAdditionalDataFrom( FILE* fp );
         virtual void removeConstraintsOn( Cell* targetCell );
+        
+        // Whether the numerics flags every change in the state that
+        // determines the static coefficient matrix of a cell (see
+        // Cell::flagCoefficientMatrixChange). Only then may the matrix be
+        // reused from a previous assembly.
+        virtual bool tracksCoefficientMatrixChanges();
+        
+        // Whether the static right hand side due to field conditions depends
+        // only on the geometry of a cell and on constant parameters, and not
+        // on its state. Only then may the contributions be formed once per
+        // load step and scaled by the value of the condition (see
+        // LoadVectorCache).
+        virtual bool hasStateIndependentRightHandSide();
 
         virtual void finalizeDataAt( Cell* targetCell, const TimeData& time ) = 0;
         virtual void deleteNumericsAt( Cell* targetCell ) = 0;
@@ -96,6 +136,26 @@ namespace broomstyx
                                          , int             subsys
                                          , const TimeData& time );
 
+        // Static coefficient matrices of cells of a single domain that uses
+        // this numerics, appended to 'batch'. Derived classes may override
+        // this to compute the matrices of several cells at once.
+        virtual void
+            giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                           , int                     stage
+                                           , int                     subsys
+                                           , const TimeData&         time
+                                           , CoefficientMatrixBatch& batch );
+
+        // Product of the static coefficient matrix of a cell with the global
+        // vector 'x', indexed by DOF equation numbers. Used by operators that
+        // do not store the assembled coefficient matrix.
+        virtual std::tuple< std::vector<Dof*>, RealVector >
+            giveStaticCoefficientMatrixProductAt( Cell*             targetCell
+                                                , int               stage
+                                                , int               subsys
+                                                , const TimeData&   time
+                                                , const RealVector& x );
+
         virtual std::tuple< std::vector<Dof*>, RealVector >
             giveStaticLeftHandSideAt( Cell*           targetCell
                                     , int             stage
@@ -144,12 +204,23 @@ namespace broomstyx
         virtual RealVector 
             giveCellNodeFieldValuesAt( Cell* targetCell, int fieldNum );
         
+        // Stable time step of explicit dynamics at the cell, estimated from
+        // the smallest element dimension and the largest wave speed
+        virtual double
+            giveCriticalTimeStepAt( Cell* targetCell, int stage );
+        
         virtual std::vector<RealVector> 
             giveEvaluationPointsFor( Cell* targetCell );
         
         virtual std::tuple< RealVector,RealVector > 
             giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag );
         
+        virtual double
+            giveFieldOutputValueAt( Cell* targetCell, int outputId );
+        
+        virtual std::tuple< std::vector<Dof*>, RealVector >
+            giveLumpedMassAt( Cell* targetCell, int stage, int subsys );
+        
         virtual RealVector
             giveNumericsParameter( const std::string& paramTag );
         
@@ -177,14 +248,33 @@ namespace broomstyx
         // Mapping from cell field number to field argument
         int _nCellFieldOutput;
         std::map<int,std::string> _cellFieldOutput;
+        
+        // Cell field numbers resolved for bulk output, each with the output
+        // ID compiled by the derived class (UNASSIGNED if it has none)
+        struct FieldAccessor
+        {
+            int fieldNum;
+            int outputId;
+        };
+        std::vector<FieldAccessor> _fieldAccessor;
 
         std::vector<int> _nodalDof;
         std::vector<int> _cellDof;
         std::vector<int> _stage;
         std::vector<int> _subsystem;
         
+        // Storage for numerics status objects at cells
+        ObjectArena _statusArena;
+        
         // Helper methods
+        void appendBatchedMatrixTo( CoefficientMatrixBatch&  batch
+                                  , const std::vector<Dof*>& dof
+                                  , const double*            kmat
+                                  , int                      lane );
+        std::string giveCellFieldTagFor( int fieldNum );
         std::vector<Material*> giveMaterialSetFor( Cell* targetCell );
+        double giveMaximumWaveSpeedFrom( const RealMatrix& tangent, double density );
+        bool   hasMaterialVariable( int matIdx, const std::string& label );
         void error_unimplemented( std::string method );
     };
 }
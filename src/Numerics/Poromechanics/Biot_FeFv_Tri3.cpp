@@ -38,7 +38,6 @@ registerBroomstyxObject(Numerics, Biot_FeFv_Tri3)
 NumericsStatus_Biot_FeFv_Tri3::NumericsStatus_Biot_FeFv_Tri3()
     : _strain(RealVector(4))
     , _stress(RealVector(4))
-    , _gradU(RealMatrix(2,2))
     , _head(0.)
     , _centerFlux {0., 0.}
     , _headOnFace {0., 0., 0.}
@@ -125,17 +124,18 @@ void Biot_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time )
     // A. Calculate flux at faces
     std::vector<Node*> node;
     node = analysisModel().domainManager().giveNodesOf(targetCell);
-    std::vector<std::vector<Node*> > face = this->giveFaceNodesOf(targetCell);
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
     
     // Cycle through faces
     for ( int i = 0; i < 3; i++ )
     {
-        double length = this->giveLengthOf(face[i]);
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+        double length = fg.measure[k];
         double normalFlux;
         if ( cns->_headIsPrescribedOnFace[i] )
         {
-            RealVector nhat = giveOutwardUnitNormalOf(face[i]);
-            double d1 = this->giveDistanceToMidpointOf(face[i], cellCoor);
+            RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+            double d1 = fg.ownerDistance[k];
 
             RealVector kvec;
             kvec = kmat*nhat;
@@ -165,8 +165,8 @@ void Biot_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time )
     RealVector centerFlux(3);
     for ( int i = 0; i < 3; i++ )
     {
-        RealVector nhat2d = this->giveOutwardUnitNormalOf(face[i]);
-        RealVector nhat({nhat2d(0), nhat2d(1), 0.});
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+        RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1], 0.});
         
         RealVector x = analysisModel().domainManager().giveCoordinatesOf(node[i]);
         RealVector x0 = analysisModel().domainManager().giveCoordinatesOf(vertexNode[i]);
@@ -208,21 +208,8 @@ void Biot_FeFv_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time )
 // ----------------------------------------------------------------------------
 double Biot_FeFv_Tri3::giveCellFieldValueAt( Cell* targetCell, int fieldNum )
 {
-    RealVector val;
-    std::string fieldTag;
-    
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch (std::exception& e)
-    {
-        fieldTag = "unassigned";
-    }
-    
-    std::tie(val, std::ignore) = this->giveFieldOutputAt(targetCell, fieldTag);
-    
-    return val(0);
+    int outputId = this->giveFieldOutputIdFor(this->giveCellFieldTagFor(fieldNum));
+    return this->giveFieldOutputValueAt(targetCell, outputId);
 }
 // ----------------------------------------------------------------------------
 std::vector<RealVector> Biot_FeFv_Tri3::giveEvaluationPointsFor( Cell *targetCell )
@@ -249,72 +236,105 @@ Biot_FeFv_Tri3::giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag
     RealVector fieldVal(1), weight(1);
     auto cns = this->getNumericsStatusAt(targetCell);
     weight(0) = cns->_area;
+    fieldVal(0) = this->giveFieldOutputValueAt(targetCell, this->giveFieldOutputIdFor(fieldTag));
     
+    return std::make_tuple(std::move(fieldVal), std::move(weight));
+}
+// ----------------------------------------------------------------------------
+int Biot_FeFv_Tri3::giveFieldOutputIdFor( const std::string& fieldTag )
+{
     if ( fieldTag == "unassigned" )
-        fieldVal(0) = 0.;
+        return fo_unassigned;
     else if ( fieldTag == "s_xx" )
-        fieldVal(0) = cns->_stress(0);
+        return fo_s_xx;
     else if ( fieldTag == "s_yy" )
-        fieldVal(0) = cns->_stress(1);
+        return fo_s_yy;
     else if ( fieldTag == "s_zz" )
-        fieldVal(0) = cns->_stress(2);
+        return fo_s_zz;
     else if ( fieldTag == "s_xy" )
-        fieldVal(0) = cns->_stress(3);
+        return fo_s_xy;
     else if ( fieldTag == "ux_x" )
-        fieldVal(0) = cns->_gradU(0,0);
+        return fo_ux_x;
     else if ( fieldTag == "uy_x" )
-        fieldVal(0) = cns->_gradU(1,0);
+        return fo_uy_x;
     else if ( fieldTag == "ux_y" )
-        fieldVal(0) = cns->_gradU(0,1);
+        return fo_ux_y;
     else if ( fieldTag == "uy_y" )
-        fieldVal(0) = cns->_gradU(1,1);
+        return fo_uy_y;
     else if ( fieldTag == "g_xy" )
-        fieldVal(0) = cns->_strain(3);
+        return fo_g_xy;
     else if ( fieldTag == "h" )
-    {
-        Dof* dof = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
-        fieldVal(0) = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof, current_value);
-    }
-    else if (fieldTag == "p" )
-    {
-        Dof* dof = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
-        double head = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof, current_value);
-        
-        std::vector<RealVector> coor = this->giveEvaluationPointsFor(targetCell);
-        fieldVal(0) = _rhoF*_gAccel*(head + _sgn*coor[0](_vrtIndex));
-    }
+        return fo_h;
+    else if ( fieldTag == "p" )
+        return fo_p;
     else if ( fieldTag == "q_x" )
-        fieldVal(0) = cns->_centerFlux[0];
+        return fo_q_x;
     else if ( fieldTag == "q_y" )
-        fieldVal(0) = cns->_centerFlux[1];
+        return fo_q_y;
     else if ( fieldTag == "sp_xx" )
-    {
-        Dof* dof = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
-        double head = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof, current_value);
-        
-        std::vector<RealVector> coor = this->giveEvaluationPointsFor(targetCell);
-        fieldVal(0) = cns->_stress(0) - _alpha*_rhoF*_gAccel*(head + _sgn*coor[0](_vrtIndex));
-    }
+        return fo_sp_xx;
     else if ( fieldTag == "sp_yy" )
-    {
-        Dof* dof = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
-        double head = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof, current_value);
-        
-        std::vector<RealVector> coor = this->giveEvaluationPointsFor(targetCell);
-        fieldVal(0) = cns->_stress(1) - _alpha*_rhoF*_gAccel*(head + _sgn*coor[0](_vrtIndex));
-    }
+        return fo_sp_yy;
     else if ( fieldTag == "sp_zz" )
-    {
-        Dof* dof = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
-        double head = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof, current_value);
-        
-        std::vector<RealVector> coor = this->giveEvaluationPointsFor(targetCell);
-        fieldVal(0) = cns->_stress(2) - _alpha*_rhoF*_gAccel*(head + _sgn*coor[0](_vrtIndex));
-    }
+        return fo_sp_zz;
     else
         throw std::runtime_error("Invalid tag '" + fieldTag + "' encountered in field output request!\nSource: " + _name);
+}
+// ----------------------------------------------------------------------------
+double Biot_FeFv_Tri3::giveFieldOutputValueAt( Cell* targetCell, int outputId )
+{
+    auto cns = this->getNumericsStatusAt(targetCell);
     
-    return std::make_tuple(std::move(fieldVal), std::move(weight));
+    switch ( outputId )
+    {
+        case fo_s_xx:
+            return cns->_stress(0);
+        case fo_s_yy:
+            return cns->_stress(1);
+        case fo_s_zz:
+            return cns->_stress(2);
+        case fo_s_xy:
+            return cns->_stress(3);
+        case fo_ux_x:
+            return cns->_gradU(0,0);
+        case fo_uy_x:
+            return cns->_gradU(1,0);
+        case fo_ux_y:
+            return cns->_gradU(0,1);
+        case fo_uy_y:
+            return cns->_gradU(1,1);
+        case fo_g_xy:
+            return cns->_strain(3);
+        case fo_h:
+        {
+            Dof* dof = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
+            return analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof, current_value);
+        }
+        case fo_p:
+        {
+            Dof* dof = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
+            double head = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof, current_value);
+            
+            std::vector<RealVector> coor = this->giveEvaluationPointsFor(targetCell);
+            return _rhoF*_gAccel*(head + _sgn*coor[0](_vrtIndex));
+        }
+        case fo_q_x:
+            return cns->_centerFlux[0];
+        case fo_q_y:
+            return cns->_centerFlux[1];
+        case fo_sp_xx:
+        case fo_sp_yy:
+        case fo_sp_zz:
+        {
+            Dof* dof = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
+            double head = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof, current_value);
+            
+            std::vector<RealVector> coor = this->giveEvaluationPointsFor(targetCell);
+            return cns->_stress(outputId - fo_sp_xx) - _alpha*_rhoF*_gAccel*(head + _sgn*coor[0](_vrtIndex));
+        }
+        default:
+            return 0.;
+    }
 }
 // ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>, std::vector<Dof*>, RealVector >
@@ -384,7 +404,7 @@ Biot_FeFv_Tri3::giveStaticCoefficientMatrixAt( Cell*           targetCell
         // ---------------------------------------------------
         // B. Flow part
         
-        std::vector<std::vector<Node*> > face = this->giveFaceNodesOf(targetCell);
+        const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
 
         rowDof[42] = dof_h;
         colDof[42] = dof_h;
@@ -394,18 +414,14 @@ Biot_FeFv_Tri3::giveStaticCoefficientMatrixAt( Cell*           targetCell
         {
             if ( cns->_headIsPrescribedOnFace[i] )
             {
-                // Unit outward normal of face
-                RealVector nhat = this->giveOutwardUnitNormalOf(face[i]);
-                double length = this->giveLengthOf(face[i]);
+                int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
                 
-                // Get coordinate of cell center
-                std::vector<RealVector> epCoor;
-                epCoor = giveEvaluationPointsFor(targetCell);
-                RealVector cellCoor;
-                cellCoor = epCoor[0];
+                // Unit outward normal of face
+                RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+                double length = fg.measure[k];
 
                 // Distance from cell center to face midpoint
-                double d1 = this->giveDistanceToMidpointOf(face[i], cellCoor);
+                double d1 = fg.ownerDistance[k];
 
                 // Permeability tensor for cell
                 std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
@@ -432,7 +448,7 @@ Biot_FeFv_Tri3::giveStaticCoefficientMatrixAt( Cell*           targetCell
                 {
                     for ( int i = 0; i < 3; i++ )
                         if ( !cns->_headIsPrescribedOnFace[i] && !cns->_fluxIsPrescribedOnFace[i] )
-                            cns->_transmissibility[i] = this->giveTransmissibilityCoefficientAt(face[i], targetCell, neighbor[i]);
+                            cns->_transmissibility[i] = this->giveTransmissibilityCoefficientAt(targetCell, i, neighbor[i]);
                     
                     cns->_hasNotComputedTransmissibilities = false;
                 }
@@ -462,10 +478,6 @@ Biot_FeFv_Tri3::giveStaticLeftHandSideAt( Cell*           targetCell
         
         auto cns = this->getNumericsStatusAt(targetCell);
         
-        // Get coordinate of cell center
-        std::vector<RealVector> epCoor = this->giveEvaluationPointsFor(targetCell);
-        RealVector cellCoor = epCoor[0];
-
         // Retrieve material set for cell
         std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
 
@@ -474,7 +486,7 @@ Biot_FeFv_Tri3::giveStaticLeftHandSideAt( Cell*           targetCell
         
         std::vector<Node*> node;
         node = analysisModel().domainManager().giveNodesOf(targetCell);
-        std::vector<std::vector<Node*> > face = this->giveFaceNodesOf(targetCell);
+        const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
 
         // Permeability tensor for cell
         Dof* dof1 = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
@@ -488,17 +500,19 @@ Biot_FeFv_Tri3::giveStaticLeftHandSideAt( Cell*           targetCell
         // Cycle through faces
         for ( int i = 0; i < 3; i++ )
         {
+            int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+            
             // Length of face
-            double length = this->giveLengthOf(face[i]);
+            double length = fg.measure[k];
 
             // Flux calculation
             if ( cns->_headIsPrescribedOnFace[i] )
             {
                 // Unit outward normal of face
-                RealVector nhat = giveOutwardUnitNormalOf(face[i]);
+                RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
 
                 // Distance from cell center to face midpoint
-                double d1 = this->giveDistanceToMidpointOf(face[i], cellCoor);
+                double d1 = fg.ownerDistance[k];
 
                 // Hydraulic conductivity
                 RealVector kvec;
@@ -519,7 +533,7 @@ Biot_FeFv_Tri3::giveStaticLeftHandSideAt( Cell*           targetCell
                 {
                     for ( int i = 0; i < 3; i++ )
                         if ( !cns->_headIsPrescribedOnFace[i] && !cns->_fluxIsPrescribedOnFace[i] )
-                            cns->_transmissibility[i] = this->giveTransmissibilityCoefficientAt(face[i], targetCell, neighbor[i]);
+                            cns->_transmissibility[i] = this->giveTransmissibilityCoefficientAt(targetCell, i, neighbor[i]);
                     
                     cns->_hasNotComputedTransmissibilities = false;
                 }
@@ -675,7 +689,9 @@ Biot_FeFv_Tri3::giveStaticRightHandSideAt( Cell*                    targetCell
                         if ( (bndCellNode[0] == face[i][0] && bndCellNode[1] == face[i][1]) || 
                              (bndCellNode[1] == face[i][0] && bndCellNode[0] == face[i][1]) )
                         {
-                            double length = this->giveLengthOf(bndCellNode);
+                            const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
+                            int k = analysisModel().domainManager().giveFaceGeometryIndexOf(curDomCell, i);
+                            double length = fg.measure[k];
                             RealVector coor0 = analysisModel().domainManager().giveCoordinatesOf(bndCellNode[0]);
                             RealVector coor1 = analysisModel().domainManager().giveCoordinatesOf(bndCellNode[1]);
                             RealVector midpt;
@@ -690,9 +706,8 @@ Biot_FeFv_Tri3::giveStaticRightHandSideAt( Cell*                    targetCell
                                 cns->_headOnFace[i] = bcVal;
 
                                 // Hydraulic conductivity component normal to face
-                                RealVector nhat = giveOutwardUnitNormalOf(face[i]);
-                                std::vector<RealVector> epCoor = this->giveEvaluationPointsFor(curDomCell);
-                                double d = this->giveDistanceToMidpointOf(face[i], epCoor[0]);
+                                RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+                                double d = fg.ownerDistance[k];
                                 
                                 std::vector<Material*> material = this->giveMaterialSetFor(curDomCell);
                                 RealMatrix kmat;
@@ -944,7 +959,7 @@ void Biot_FeFv_Tri3::initializeMaterialsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void Biot_FeFv_Tri3::initializeNumericsAt( Cell* targetCell )
 {
-    targetCell->numericsStatus = new NumericsStatus_Biot_FeFv_Tri3();
+    targetCell->numericsStatus = _statusArena.create<NumericsStatus_Biot_FeFv_Tri3>();
     auto cns = this->getNumericsStatusAt(targetCell);
     
     // Pre-calculate det(J) and inv(J);
@@ -963,6 +978,8 @@ void Biot_FeFv_Tri3::initializeNumericsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void Biot_FeFv_Tri3::readAdditionalDataFrom( FILE* fp )
 {
+    analysisModel().domainManager().mustFormFaceGeometry();
+    
     verifyKeyword(fp, "BiotCoefficient", _name);
     _alpha = getRealInputFrom(fp, "Failed to read Biot coefficient from input file!", _name);
     
@@ -1062,17 +1079,6 @@ std::vector<std::vector<Node*> > Biot_FeFv_Tri3::giveFaceNodesOf( Cell* targetCe
     return face;
 }
 // ----------------------------------------------------------------------------
-double Biot_FeFv_Tri3::giveDistanceToMidpointOf( std::vector<Node*>& face
-                                               , RealVector&         coor )
-{
-    RealVector coor0, coor1, dx;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf(face[0]);
-    coor1 = analysisModel().domainManager().giveCoordinatesOf(face[1]);
-    dx = 0.5*(coor0 + coor1) - coor;
-    
-    return std::sqrt(dx.dot(dx));
-}
-// ----------------------------------------------------------------------------
 RealMatrix Biot_FeFv_Tri3::giveJacobianMatrixAt( Cell* targetCell, const RealVector& natCoor )
 {
     std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(targetCell);
@@ -1094,16 +1100,6 @@ RealMatrix Biot_FeFv_Tri3::giveJacobianMatrixAt( Cell* targetCell, const RealVec
    return _basisFunctionDerivatives*coorMat;
 }
 // ----------------------------------------------------------------------------
-double Biot_FeFv_Tri3::giveLengthOf( std::vector<Node*>& face )
-{
-    RealVector coor0, coor1, dx;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf(face[0]);
-    coor1 = analysisModel().domainManager().giveCoordinatesOf(face[1]);
-    dx = coor1 - coor0;
-    
-    return std::sqrt(dx.dot(dx));
-}
-// ----------------------------------------------------------------------------
 RealVector Biot_FeFv_Tri3::giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType )
 {
     // Displacements
@@ -1133,37 +1129,24 @@ std::vector<Dof*> Biot_FeFv_Tri3::giveNodalDofsAt( Cell* targetCell )
     return dof;
 }
 // ----------------------------------------------------------------------------
-RealVector Biot_FeFv_Tri3::giveOutwardUnitNormalOf( std::vector<Node*>& face )
-{
-    RealVector coor0, coor1, dx, normVec;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf(face[0]);
-    coor1 = analysisModel().domainManager().giveCoordinatesOf(face[1]);
-    dx = coor1 - coor0;
-    double dist = std::sqrt(dx.dot(dx));
-    
-    normVec = {dx(1)/dist, -dx(0)/dist};
-    
-    return normVec;
-}
-// ----------------------------------------------------------------------------
 double Biot_FeFv_Tri3::giveTransmissibilityCoefficientAt
-    ( std::vector<Node*>& face
-    , Cell* targetCell
+    ( Cell* targetCell
+    , int   faceNum
     , Cell* neighborCell )
 {
+    // Face geometry
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
+    int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, faceNum);
+    
     // Unit outward normal of face
-    RealVector nhat;
-    nhat = this->giveOutwardUnitNormalOf(face);
-    double length = this->giveLengthOf(face);
+    RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+    double length = fg.measure[k];
+    
+    // Distances from cell centers to midpoint of face
+    double d1 = fg.ownerDistance[k];
+    double d2 = fg.neighborDistance[k];
 
     // A. Target cell
-    // Coordinates of cell center
-    std::vector<RealVector> ep = this->giveEvaluationPointsFor(targetCell);
-    RealVector coor1 = ep[0];
-    
-    // Distance from cell center to midpoint of face
-    double d1 = this->giveDistanceToMidpointOf(face, coor1);
-    
     // Permeability tensor for cell
     auto cns = this->getNumericsStatusAt(targetCell);
     std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
@@ -1178,13 +1161,6 @@ double Biot_FeFv_Tri3::giveTransmissibilityCoefficientAt
     double K1 = std::sqrt(kvec.dot(kvec))*_rhoF*_gAccel/_mu;
     
     // B. Neighbor cell
-    // Coordinates of cell center
-    ep = this->giveEvaluationPointsFor(neighborCell);
-    RealVector coor2 = ep[0];
-    
-    // Distance from cell center to midpoint of face
-    double d2 = this->giveDistanceToMidpointOf(face, coor2);
-    
     // Permeability tensor for neigbor cell
     cns = this->getNumericsStatusAt(neighborCell);
     material = this->giveMaterialSetFor(neighborCell);
@@ -25,6 +25,7 @@
 #define	BIOT_FEFV_TRI3_HPP
 
 #include "Numerics/Numerics.hpp"
+#include "Util/StackRealMatrix.hpp"
 #include "BasisFunctions/Triangle_P1.hpp"
 
 namespace broomstyx
@@ -42,7 +43,7 @@ namespace broomstyx
     private:
         RealVector _strain;
         RealVector _stress;
-        RealMatrix _gradU;
+        StackRealMatrix<2,2> _gradU;
         RealMatrix _dPsi;
         
         double _area;
@@ -74,6 +75,9 @@ namespace broomstyx
         std::tuple< RealVector,RealVector > 
             giveFieldOutputAt( Cell* targetCell, const std::string& fieldTag ) override;
         
+        int    giveFieldOutputIdFor( const std::string& fieldTag ) override;
+        double giveFieldOutputValueAt( Cell* targetCell, int outputId ) override;
+        
         std::tuple< std::vector<Dof*>
                   , std::vector<Dof*>
                   , RealVector >
@@ -130,6 +134,27 @@ namespace broomstyx
         void setDofStagesAt( Cell* targetCell ) override;
         
     private:
+        enum FieldOutput
+        {
+            fo_unassigned,
+            fo_s_xx,
+            fo_s_yy,
+            fo_s_zz,
+            fo_s_xy,
+            fo_ux_x,
+            fo_uy_x,
+            fo_ux_y,
+            fo_uy_y,
+            fo_g_xy,
+            fo_h,
+            fo_p,
+            fo_q_x,
+            fo_q_y,
+            fo_sp_xx,
+            fo_sp_yy,
+            fo_sp_zz
+        };
+        
         double _alpha;
         double _S;
         double _gAccel;
@@ -152,16 +177,13 @@ namespace broomstyx
                    giveBmatAt( Cell* targetCell );
         std::vector< std::vector<Node*> >
                    giveFaceNodesOf( Cell* targetCell );
-        double     giveDistanceToMidpointOf( std::vector<Node*>& face, RealVector& coor);
         RealMatrix giveJacobianMatrixAt( Cell* targetCell, const RealVector& natCoor );
-        double     giveLengthOf( std::vector<Node*>& face );
         RealVector giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType );
         std::vector<Dof*> 
                    giveNodalDofsAt( Cell* targetCell );
-        RealVector giveOutwardUnitNormalOf( std::vector<Node*>& face );
-        double     giveTransmissibilityCoefficientAt( std::vector<Node*>& face
-                                                    , Cell*               targetCell
-                                                    , Cell*               neighborCell );
+        double     giveTransmissibilityCoefficientAt( Cell* targetCell
+                                                    , int   faceNum
+                                                    , Cell* neighborCell );
     };
 }
 
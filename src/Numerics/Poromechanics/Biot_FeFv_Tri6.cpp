@@ -74,7 +74,6 @@ CellNumericsStatus_Biot_FeFv_Tri6::~CellNumericsStatus_Biot_FeFv_Tri6()
 EvalPtNumericsStatus_Biot_FeFv_Tri6::EvalPtNumericsStatus_Biot_FeFv_Tri6()
     : _strain(RealVector(4))
     , _stress(RealVector(4))
-    , _gradU(RealMatrix(2,2))
     , _materialStatus {nullptr, nullptr}
 {}
 
@@ -131,7 +130,7 @@ void Biot_FeFv_Tri6::deleteNumericsAt( Cell* targetCell )
     
     material[2]->destroy(cns->_materialStatus);
 
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void Biot_FeFv_Tri6::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -154,17 +153,18 @@ void Biot_FeFv_Tri6::finalizeDataAt( Cell* targetCell, const TimeData& time )
     // A. Calculate flux at faces
     std::vector<Node*> node;
     node = analysisModel().domainManager().giveNodesOf(targetCell);
-    std::vector<std::vector<Node*> > face = this->giveFaceNodesOf(targetCell);
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
     
     // Cycle through faces
     for ( int i = 0; i < 3; i++ )
     {
-        double length = this->giveLengthOf(face[i]);
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+        double length = fg.measure[k];
         double normalFlux;
         if ( cns->_headIsPrescribedOnFace[i] )
         {
-            RealVector nhat = giveOutwardUnitNormalOf(face[i]);
-            double d1 = this->giveDistanceToMidpointOf(face[i], cns->_cellCenter);
+            RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+            double d1 = fg.ownerDistance[k];
 
             RealVector kvec;
             kvec = kmat*nhat;
@@ -194,8 +194,8 @@ void Biot_FeFv_Tri6::finalizeDataAt( Cell* targetCell, const TimeData& time )
     RealVector centerFlux(3);
     for ( int i = 0; i < 3; i++ )
     {
-        RealVector nhat2d = this->giveOutwardUnitNormalOf(face[i]);
-        RealVector nhat({nhat2d(0), nhat2d(1), 0.});
+        int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+        RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1], 0.});
         
         RealVector x = analysisModel().domainManager().giveCoordinatesOf(node[i]);
         RealVector x0 = analysisModel().domainManager().giveCoordinatesOf(vertexNode[i]);
@@ -260,14 +260,7 @@ double Biot_FeFv_Tri6::giveCellFieldValueAt( Cell* targetCell, int fieldNum )
     RealVector val;
     std::string fieldTag;
     
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch (std::exception& e)
-    {
-        fieldTag = "unassigned";
-    }
+    fieldTag = this->giveCellFieldTagFor(fieldNum);
     
     std::tie(val, std::ignore) = this->giveFieldOutputAt(targetCell, fieldTag);
     
@@ -279,14 +272,7 @@ RealVector Biot_FeFv_Tri6::giveCellNodeFieldValuesAt( Cell* targetCell, int fiel
     RealVector gpVals, wt, nodeVals(6);
     std::string fieldTag;
     
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch (std::exception& e)
-    {
-        fieldTag = "unassigned";
-    }
+    fieldTag = this->giveCellFieldTagFor(fieldNum);
     
     // We need a special method for calculating the elastic strain energy
     // which has quadratic behavior within the element
@@ -532,7 +518,7 @@ Biot_FeFv_Tri6::giveStaticCoefficientMatrixAt( Cell*           targetCell
         // ---------------------------------------------------
         // B. Flow part
         
-        std::vector<std::vector<Node*> > face = this->giveFaceNodesOf(targetCell);
+        const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
 
         rowDof[156] = dof_h;
         colDof[156] = dof_h;
@@ -542,12 +528,14 @@ Biot_FeFv_Tri6::giveStaticCoefficientMatrixAt( Cell*           targetCell
         {
             if ( cns->_headIsPrescribedOnFace[i] )
             {
+                int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+                
                 // Unit outward normal of face
-                RealVector nhat = this->giveOutwardUnitNormalOf(face[i]);
-                double length = this->giveLengthOf(face[i]);
+                RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+                double length = fg.measure[k];
                 
                 // Distance from cell center to face midpoint
-                double d1 = this->giveDistanceToMidpointOf(face[i], cns->_cellCenter);
+                double d1 = fg.ownerDistance[k];
 
                 // Permeability tensor for cell
                 std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
@@ -574,7 +562,7 @@ Biot_FeFv_Tri6::giveStaticCoefficientMatrixAt( Cell*           targetCell
                 {
                     for ( int i = 0; i < 3; i++ )
                         if ( !cns->_headIsPrescribedOnFace[i] && !cns->_fluxIsPrescribedOnFace[i] )
-                            cns->_transmissibility[i] = this->giveTransmissibilityCoefficientAt(face[i], targetCell, neighbor[i]);
+                            cns->_transmissibility[i] = this->giveTransmissibilityCoefficientAt(targetCell, i, neighbor[i]);
                     
                     cns->_hasNotComputedTransmissibilities = false;
                 }
@@ -604,10 +592,6 @@ Biot_FeFv_Tri6::giveStaticLeftHandSideAt( Cell*           targetCell
         
         auto cns = this->getNumericsStatusAt(targetCell);
         
-        // Get coordinate of cell center
-        std::vector<RealVector> epCoor = this->giveEvaluationPointsFor(targetCell);
-        RealVector cellCoor = epCoor[0];
-
         // Retrieve material set for cell
         std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
 
@@ -616,7 +600,7 @@ Biot_FeFv_Tri6::giveStaticLeftHandSideAt( Cell*           targetCell
         
         std::vector<Node*> node;
         node = analysisModel().domainManager().giveNodesOf(targetCell);
-        std::vector<std::vector<Node*> > face = this->giveFaceNodesOf(targetCell);
+        const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
 
         // Permeability tensor for cell
         Dof* dof1 = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
@@ -630,17 +614,19 @@ Biot_FeFv_Tri6::giveStaticLeftHandSideAt( Cell*           targetCell
         // Cycle through faces
         for ( int i = 0; i < 3; i++ )
         {
+            int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, i);
+            
             // Length of face
-            double length = this->giveLengthOf(face[i]);
+            double length = fg.measure[k];
 
             // Flux calculation
             if ( cns->_headIsPrescribedOnFace[i] )
             {
                 // Unit outward normal of face
-                RealVector nhat = giveOutwardUnitNormalOf(face[i]);
+                RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
 
                 // Distance from cell center to face midpoint
-                double d1 = this->giveDistanceToMidpointOf(face[i], cellCoor);
+                double d1 = fg.ownerDistance[k];
 
                 // Hydraulic conductivity
                 RealVector kvec;
@@ -661,7 +647,7 @@ Biot_FeFv_Tri6::giveStaticLeftHandSideAt( Cell*           targetCell
                 {
                     for ( int i = 0; i < 3; i++ )
                         if ( !cns->_headIsPrescribedOnFace[i] && !cns->_fluxIsPrescribedOnFace[i] )
-                            cns->_transmissibility[i] = this->giveTransmissibilityCoefficientAt(face[i], targetCell, neighbor[i]);
+                            cns->_transmissibility[i] = this->giveTransmissibilityCoefficientAt(targetCell, i, neighbor[i]);
                     
                     cns->_hasNotComputedTransmissibilities = false;
                 }
@@ -831,7 +817,9 @@ Biot_FeFv_Tri6::giveStaticRightHandSideAt( Cell*                    targetCell
                         if ( (bndCellNode[0] == face[i][0] && bndCellNode[1] == face[i][1]) || 
                              (bndCellNode[1] == face[i][0] && bndCellNode[0] == face[i][1]) )
                         {
-                            double length = this->giveLengthOf(bndCellNode);
+                            const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
+                            int k = analysisModel().domainManager().giveFaceGeometryIndexOf(curDomCell, i);
+                            double length = fg.measure[k];
                             RealVector coor0 = analysisModel().domainManager().giveCoordinatesOf(bndCellNode[0]);
                             RealVector coor1 = analysisModel().domainManager().giveCoordinatesOf(bndCellNode[1]);
                             RealVector midpt;
@@ -846,9 +834,8 @@ Biot_FeFv_Tri6::giveStaticRightHandSideAt( Cell*                    targetCell
                                 cns->_headOnFace[i] = bcVal;
 
                                 // Hydraulic conductivity component normal to face
-                                RealVector nhat = giveOutwardUnitNormalOf(face[i]);
-                                // std::vector<RealVector> epCoor = this->giveEvaluationPointsFor(curDomCell);
-                                double d = this->giveDistanceToMidpointOf(face[i], cns->_cellCenter);
+                                RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+                                double d = fg.ownerDistance[k];
                                 
                                 std::vector<Material*> material = this->giveMaterialSetFor(curDomCell);
                                 RealMatrix kmat;
@@ -1158,7 +1145,7 @@ void Biot_FeFv_Tri6::initializeNumericsAt( Cell* targetCell )
     int nGaussPts = _integrationRule->giveNumberOfIntegrationPoints();
     std::tie(gpCoor, gpWt) = _integrationRule->giveIntegrationPointsAndWeights();
 
-    targetCell->numericsStatus = new CellNumericsStatus_Biot_FeFv_Tri6(nGaussPts);
+    targetCell->numericsStatus = _statusArena.create<CellNumericsStatus_Biot_FeFv_Tri6>(nGaussPts);
     auto cns = this->getNumericsStatusAt(targetCell);
     for ( int i = 0; i < nGaussPts; i++ )
     {
@@ -1178,6 +1165,8 @@ void Biot_FeFv_Tri6::initializeNumericsAt( Cell* targetCell )
 // ----------------------------------------------------------------------------
 void Biot_FeFv_Tri6::readAdditionalDataFrom( FILE* fp )
 {
+    analysisModel().domainManager().mustFormFaceGeometry();
+    
     verifyKeyword(fp, "BiotCoefficient", _name);
     _alpha = getRealInputFrom(fp, "Failed to read Biot coefficient from input file!", _name);
     
@@ -1319,17 +1308,6 @@ std::vector<std::vector<Node*> > Biot_FeFv_Tri6::giveFaceNodesOf( Cell* targetCe
     return face;
 }
 // ----------------------------------------------------------------------------
-double Biot_FeFv_Tri6::giveDistanceToMidpointOf( std::vector<Node*>& face
-                                               , RealVector&         coor )
-{
-    RealVector coor0, coor1, dx;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf(face[0]);
-    coor1 = analysisModel().domainManager().giveCoordinatesOf(face[1]);
-    dx = 0.5*(coor0 + coor1) - coor;
-    
-    return std::sqrt(dx.dot(dx));
-}
-// ----------------------------------------------------------------------------
 RealMatrix Biot_FeFv_Tri6::giveJacobianMatrixAt( Cell* targetCell, const RealVector& natCoor )
 {
     std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(targetCell);
@@ -1358,16 +1336,6 @@ RealMatrix Biot_FeFv_Tri6::giveJacobianMatrixAt( Cell* targetCell, const RealVec
     return jmat;
 }
 // ----------------------------------------------------------------------------
-double Biot_FeFv_Tri6::giveLengthOf( std::vector<Node*>& face )
-{
-    RealVector coor0, coor1, dx;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf(face[0]);
-    coor1 = analysisModel().domainManager().giveCoordinatesOf(face[1]);
-    dx = coor1 - coor0;
-    
-    return std::sqrt(dx.dot(dx));
-}
-// ----------------------------------------------------------------------------
 RealVector Biot_FeFv_Tri6::giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType )
 {
     RealVector u(12);
@@ -1394,36 +1362,26 @@ std::vector<Dof*> Biot_FeFv_Tri6::giveNodalDofsAt( Cell* targetCell )
     return dof;
 }
 // ----------------------------------------------------------------------------
-RealVector Biot_FeFv_Tri6::giveOutwardUnitNormalOf( std::vector<Node*>& face )
-{
-    RealVector coor0, coor1, dx, normVec;
-    coor0 = analysisModel().domainManager().giveCoordinatesOf(face[0]);
-    coor1 = analysisModel().domainManager().giveCoordinatesOf(face[1]);
-    dx = coor1 - coor0;
-    double dist = std::sqrt(dx.dot(dx));
-    
-    normVec = {dx(1)/dist, -dx(0)/dist};
-    
-    return normVec;
-}
-// ----------------------------------------------------------------------------
 double Biot_FeFv_Tri6::giveTransmissibilityCoefficientAt
-    ( std::vector<Node*>& face
-    , Cell* targetCell
+    ( Cell* targetCell
+    , int   faceNum
     , Cell* neighborCell )
 {
+    // Face geometry
+    const DomainManager::FaceGeometry& fg = analysisModel().domainManager().giveFaceGeometry();
+    int k = analysisModel().domainManager().giveFaceGeometryIndexOf(targetCell, faceNum);
+    
     // Unit outward normal of face
-    RealVector nhat;
-    nhat = this->giveOutwardUnitNormalOf(face);
-    double length = this->giveLengthOf(face);
+    RealVector nhat({fg.normal[2*k], fg.normal[2*k + 1]});
+    double length = fg.measure[k];
+    
+    // Distances from cell centers to midpoint of face
+    double d1 = fg.ownerDistance[k];
+    double d2 = fg.neighborDistance[k];
 
     // A. Target cell
-    
-    // Distance from cell center to midpoint of face
-    auto cns = this->getNumericsStatusAt(targetCell);
-    double d1 = this->giveDistanceToMidpointOf(face, cns->_cellCenter);
-    
     // Permeability tensor for cell
+    auto cns = this->getNumericsStatusAt(targetCell);
     std::vector<Material*> material = this->giveMaterialSetFor(targetCell);
     
     Dof* dof_h = analysisModel().domainManager().giveCellDof(_cellDof[0], targetCell);
@@ -1436,12 +1394,8 @@ double Biot_FeFv_Tri6::giveTransmissibilityCoefficientAt
     double K1 = std::sqrt(kvec.dot(kvec))*_rhoF*_gAccel/_mu;
     
     // B. Neighbor cell
-    
-    // Distance from cell center to midpoint of face
-    cns = this->getNumericsStatusAt(neighborCell);
-    double d2 = this->giveDistanceToMidpointOf(face, cns->_cellCenter);
-    
     // Permeability tensor for neigbor cell
+    cns = this->getNumericsStatusAt(neighborCell);
     material = this->giveMaterialSetFor(neighborCell);
 
     dof_h = analysisModel().domainManager().giveCellDof(_cellDof[0], neighborCell);
@@ -25,6 +25,7 @@
 #define	BIOT_FEFV_TRI6_HPP
 
 #include "Numerics/Numerics.hpp"
+#include "Util/StackRealMatrix.hpp"
 
 namespace broomstyx
 {
@@ -74,7 +75,7 @@ namespace broomstyx
     private:
         RealVector _strain;
         RealVector _stress;
-        RealMatrix _gradU;
+        StackRealMatrix<2,2> _gradU;
         RealMatrix _dPsi;
         
         MaterialStatus* _materialStatus[2];
@@ -178,16 +179,13 @@ namespace broomstyx
                    giveBmatAt( Cell* targetCell, const RealVector& natCoor );
         std::vector< std::vector<Node*> >
                    giveFaceNodesOf( Cell* targetCell );
-        double     giveDistanceToMidpointOf( std::vector<Node*>& face, RealVector& coor);
         RealMatrix giveJacobianMatrixAt( Cell* targetCell, const RealVector& natCoor );
-        double     giveLengthOf( std::vector<Node*>& face );
         RealVector giveLocalDisplacementsAt( std::vector<Dof*>& dof, ValueType valType );
         std::vector<Dof*> 
                    giveNodalDofsAt( Cell* targetCell );
-        RealVector giveOutwardUnitNormalOf( std::vector<Node*>& face );
-        double     giveTransmissibilityCoefficientAt( std::vector<Node*>& face
-                                                    , Cell*               targetCell
-                                                    , Cell*               neighborCell );
+        double     giveTransmissibilityCoefficientAt( Cell* targetCell
+                                                    , int   faceNum
+                                                    , Cell* neighborCell );
     };
 }
 
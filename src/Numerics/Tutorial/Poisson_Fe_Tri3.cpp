@@ -22,6 +22,7 @@
 */
 
 #include "Poisson_Fe_Tri3.hpp"
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <vector>
@@ -30,6 +31,7 @@
 #include "Core/ObjectFactory.hpp"
 #include "Core/DomainManager.hpp"
 #include "Materials/Material.hpp"
+#include "Util/batchLinearAlgebra.hpp"
 #include "Util/linearAlgebra.hpp"
 #include "BasisFunctions/Triangle_P1.hpp"
 
@@ -79,8 +81,7 @@ Poisson_Fe_Tri3::~Poisson_Fe_Tri3()
 // ----------------------------------------------------------------------------
 void Poisson_Fe_Tri3::deleteNumericsAt(Cell* targetCell)
 {
-    auto cns = this->getNumericsStatusAt(targetCell);
-    delete cns;
+    targetCell->numericsStatus = nullptr;
 }
 // ----------------------------------------------------------------------------
 void Poisson_Fe_Tri3::finalizeDataAt( Cell* targetCell, const TimeData& time )
@@ -104,14 +105,7 @@ double Poisson_Fe_Tri3::giveCellFieldValueAt( Cell* targetCell, int fieldNum )
     RealVector val;
     std::string fieldTag;
     
-    try
-    {
-        fieldTag = _cellFieldOutput.at(fieldNum);
-    }
-    catch (std::exception& e)
-    {
-        fieldTag = "unassigned";
-    }
+    fieldTag = this->giveCellFieldTagFor(fieldNum);
     
     std::tie(val, std::ignore) = this->giveFieldOutputAt(targetCell, fieldTag);
     
@@ -210,6 +204,54 @@ Poisson_Fe_Tri3::giveStaticCoefficientMatrixAt( Cell*           targetCell
     return std::make_tuple(std::move(rowDof), std::move(colDof), std::move(coefVal));
 }
 // ----------------------------------------------------------------------------
+void Poisson_Fe_Tri3::giveStaticCoefficientMatricesAt( ArraySpan<Cell* const>  cell
+                                                     , int                     stage
+                                                     , int                     subsys
+                                                     , const TimeData&         time
+                                                     , CoefficientMatrixBatch& batch )
+{
+    if ( cell.empty() || stage != _stage[0] || (subsys != _subsystem[0] && subsys != UNASSIGNED) )
+        return;
+    
+    // Element matrices of up to simdBatchWidth cells are computed together,
+    // vectorized over the cells
+    double bmatBatch[2*3*simdBatchWidth], cmatBatch[2*2*simdBatchWidth], weight[simdBatchWidth];
+    double kmatBatch[3*3*simdBatchWidth], work[2*3*simdBatchWidth];
+    
+    // Conductivity is the identity, identical for all lanes
+    std::fill(cmatBatch, cmatBatch + 2*2*simdBatchWidth, 0.);
+    for ( int i = 0; i < 2; i++ )
+        for ( int lane = 0; lane < simdBatchWidth; lane++ )
+            cmatBatch[(i*2 + i)*simdBatchWidth + lane] = 1.;
+    
+    int nCells = cell.size();
+    for ( int first = 0; first < nCells; first += simdBatchWidth )
+    {
+        int nLanes = std::min(simdBatchWidth, nCells - first);
+        if ( nLanes < simdBatchWidth )
+        {
+            // Unused lanes of the last batch contribute zero
+            std::fill(bmatBatch, bmatBatch + 2*3*simdBatchWidth, 0.);
+            std::fill(weight, weight + simdBatchWidth, 0.);
+        }
+        std::fill(kmatBatch, kmatBatch + 3*3*simdBatchWidth, 0.);
+        
+        for ( int lane = 0; lane < nLanes; lane++ )
+        {
+            auto cns = this->getNumericsStatusAt(cell[first + lane]);
+            RealMatrix bmat = this->giveBmatAt(cell[first + lane]);
+            
+            gatherIntoLane(bmat, lane, bmatBatch);
+            weight[lane] = _wt*cns->_Jdet;
+        }
+        
+        addBatchedBtCB(2, 3, bmatBatch, cmatBatch, weight, kmatBatch, work);
+        
+        for ( int lane = 0; lane < nLanes; lane++ )
+            this->appendBatchedMatrixTo(batch, this->giveNodalDofsAt(cell[first + lane]), kmatBatch, lane);
+    }
+}
+// ----------------------------------------------------------------------------
 std::tuple< std::vector<Dof*>
           , RealVector >
 Poisson_Fe_Tri3::giveStaticLeftHandSideAt(Cell*            targetCell
@@ -353,7 +395,7 @@ void Poisson_Fe_Tri3::imposeConstraintAt( Cell*                    targetCell
 // ----------------------------------------------------------------------------
 void Poisson_Fe_Tri3::initializeNumericsAt( Cell* targetCell )
 {
-    targetCell->numericsStatus = new NumericsStatus_Poisson_Fe_Tri3();
+    targetCell->numericsStatus = _statusArena.create<NumericsStatus_Poisson_Fe_Tri3>();
     auto cns = this->getNumericsStatusAt(targetCell);
     
     // Pre-calculate det(J) and inv(J);
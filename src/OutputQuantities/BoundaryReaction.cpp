@@ -22,6 +22,7 @@
 */
 
 #include "BoundaryReaction.hpp"
+#include <algorithm>
 #include <cstring>
 #include "Core/AnalysisModel.hpp"
 #include "Core/ObjectFactory.hpp"
@@ -47,36 +48,38 @@ BoundaryReaction::~BoundaryReaction() {}
 // Public methods
 double BoundaryReaction::computeOutput()
 {
-    // Form set of all relevant DOFs associated with boundary
+    // Calculate boundary reaction
+    int nDofs = (int)_dof.size();
+    double result = 0.0;
+    
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:result)
+#endif
+    for ( int i = 0; i < nDofs; i++ )
+        result += analysisModel().dofManager().giveValueOfSecondaryVariableAt(_dof[i]);
+    
+    return result;
+}
+
+void BoundaryReaction::initialize()
+{
+    // Form list of all relevant DOFs associated with boundary
     int physNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_physTag);
-    std::set<Dof*> dof;
+    _dof.clear();
     
-    int nBCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
-    for ( int i = 0; i < nBCells; i++)
+    for ( Cell* curCell : analysisModel().domainManager().giveBoundaryCellsWithLabel(physNum) )
     {
-        Cell* curCell = analysisModel().domainManager().giveBoundaryCell(i);
-        if ( analysisModel().domainManager().giveLabelOf(curCell) == physNum )
-        {
-            std::vector<Node*> cellNode = analysisModel().domainManager().giveNodesOf(curCell);
+        std::vector<Node*> cellNode = analysisModel().domainManager().giveNodesOf(curCell);
 
-            for ( int j = 0; j < (int)cellNode.size(); j++)
-            {
-                Dof* curDof = analysisModel().domainManager().giveNodalDof(_dofNum, cellNode[j]);
-                dof.insert(curDof);
-            }
-        }
+        for ( int j = 0; j < (int)cellNode.size(); j++)
+            _dof.push_back(analysisModel().domainManager().giveNodalDof(_dofNum, cellNode[j]));
     }
     
-    // Calculate boundary reaction
-    double result = 0.0;
-    for ( auto it = dof.begin(); it != dof.end(); ++it )
-        result += analysisModel().dofManager().giveValueOfSecondaryVariableAt(*it);
-    
-    return result;
+    // Remove duplicates arising from nodes shared by adjacent boundary cells
+    std::sort(_dof.begin(), _dof.end());
+    _dof.erase(std::unique(_dof.begin(), _dof.end()), _dof.end());
 }
 
-void BoundaryReaction::initialize() {}
-
 void BoundaryReaction::readDataFrom( FILE *fp )
 {
     // Read physical tag of boundary
@@ -25,10 +25,12 @@
 #define	BOUNDARYREACTION_HPP
 
 #include "OutputQuantity.hpp"
+#include <vector>
 
 namespace broomstyx
 {
     class AnalysisModel;
+    class Dof;
 
     class BoundaryReaction final : public OutputQuantity
     {
@@ -43,6 +45,9 @@ namespace broomstyx
     private:
         std::string _physTag;
         int _dofNum;
+        
+        // Resolved at initialization
+        std::vector<Dof*> _dof;
     };
 }
 
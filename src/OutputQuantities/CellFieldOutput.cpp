@@ -36,6 +36,9 @@ registerBroomstyxObject(OutputQuantity, CellFieldOutput)
 
 // Constructor
 CellFieldOutput::CellFieldOutput()
+    : _physNum(0)
+    , _numerics(nullptr)
+    , _accessorId(0)
 {
     _name = "CellFieldOutput";
 }
@@ -47,30 +50,23 @@ CellFieldOutput::~CellFieldOutput() {}
 double CellFieldOutput::computeOutput()
 {
     double value = 0.;
-    // Find relevant cell
-    int physNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_physTag);
-    Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(physNum);
-    
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
-    int count = 0;
-    for ( int i = 0; i < nCells; i++ )
-    {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
-
-        if ( analysisModel().domainManager().giveLabelOf(curCell) == physNum )
-        {
-            ++count;
-            if ( count > 1 )
-                throw std::runtime_error("ERROR: More than one cell detected under specified physical tag!\nSource = " + _name);
-            
-            value = numerics->giveCellFieldValueAt(curCell, _cellField);
-        }
-    }
+    ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(_physNum);
+    _numerics->giveCellFieldValuesAt(domCell, _accessorId, &value);
 
     return value;
 }
 
-void CellFieldOutput::initialize() {}
+void CellFieldOutput::initialize()
+{
+    // Find relevant cell
+    _physNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_physTag);
+    _numerics = analysisModel().domainManager().giveNumericsForDomain(_physNum);
+    
+    if ( analysisModel().domainManager().giveDomainCellsWithLabel(_physNum).size() > 1 )
+        throw std::runtime_error("ERROR: More than one cell detected under specified physical tag!\nSource = " + _name);
+    
+    _accessorId = _numerics->resolveCellFieldOutput(_cellField);
+}
 
 void CellFieldOutput::readDataFrom( FILE *fp )
 {
@@ -29,6 +29,7 @@
 namespace broomstyx
 {
     class AnalysisModel;
+    class Numerics;
     
     class CellFieldOutput final : public OutputQuantity
     {
@@ -43,6 +44,11 @@ namespace broomstyx
     private:
         std::string _physTag;
         int _cellField;
+        
+        // Resolved at initialization
+        int       _physNum;
+        Numerics* _numerics;
+        int       _accessorId;
     };    
 }
 
@@ -39,6 +39,7 @@ registerBroomstyxObject(OutputQuantity, DomainIntegral)
 
 // Constructor
 DomainIntegral::DomainIntegral()
+    : _numerics(nullptr)
 {
     _name = "DomainIntegral";
 }
@@ -49,29 +50,37 @@ DomainIntegral::~DomainIntegral() {}
 // Public methods
 double DomainIntegral::computeOutput()
 {
-    double result = 0.0;
+    int nCells = _domCell.size();
+    if ( nCells == 0 )
+        return 0.0;
     
-    // Retrieve relevant numerics
-    int physNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_physTag);
-    Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(physNum);
+    // The first cell is evaluated serially so that numerics lacking the
+    // requested cell field raise their exception outside the parallel region
+    RealVector val, wt;
+    std::tie(val,wt) = _numerics->giveCellFieldOutputAtEvaluationPointsOf(_domCell[0], _cellFieldNum);
+    double result = val.dot(wt);
     
-    // Cycle through all domain cells
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
-    for ( int i = 0; i < nCells; i++ )
+    // Cycle through remaining domain cells belonging to physical entity
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:result)
+#endif
+    for ( int i = 1; i < nCells; i++ )
     {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
-        if ( analysisModel().domainManager().giveLabelOf(curCell) == physNum )
-        {
-            RealVector val, wt;
-            std::tie(val,wt) = numerics->giveCellFieldOutputAtEvaluationPointsOf(curCell, _cellFieldNum);
-            result += val.dot(wt);
-        }
+        RealVector val, wt;
+        std::tie(val,wt) = _numerics->giveCellFieldOutputAtEvaluationPointsOf(_domCell[i], _cellFieldNum);
+        result += val.dot(wt);
     }
     
     return result;
 }
 
-void DomainIntegral::initialize() {}
+void DomainIntegral::initialize()
+{
+    // Retrieve relevant numerics and cells
+    int physNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_physTag);
+    _numerics = analysisModel().domainManager().giveNumericsForDomain(physNum);
+    _domCell = analysisModel().domainManager().giveDomainCellsWithLabel(physNum);
+}
 
 void DomainIntegral::readDataFrom( FILE* fp )
 {
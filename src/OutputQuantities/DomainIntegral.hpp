@@ -25,9 +25,13 @@
 #define	DOMAININTEGRAL_HPP
 
 #include "OutputQuantity.hpp"
+#include "Util/ArraySpan.hpp"
 
 namespace broomstyx
 {
+    class Cell;
+    class Numerics;
+    
     class DomainIntegral final : public OutputQuantity
     {
     public:
@@ -41,6 +45,10 @@ namespace broomstyx
     private:
         std::string _physTag;
         int         _cellFieldNum;
+        
+        // Resolved at initialization
+        Numerics*              _numerics;
+        ArraySpan<Cell* const> _domCell;
     };
 }
 
@@ -50,158 +50,95 @@ JIntegral::~JIntegral() {}
 // -----------------------------------------------------------------------------
 double JIntegral::computeOutput()
 {
-    double result = 0.;
-
-    int crackTipPhysNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_crackTipLabel);
+    int nPath = (int)_path.size();
+    if ( nPath == 0 )
+        return 0.;
     
-    Node* crackTipNode = nullptr;
-    bool crackTipFound = false;
-    int nBndCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
-    for ( int i = 0; i < nBndCells; i++ )
-    {
-        Cell* curBndCell = analysisModel().domainManager().giveBoundaryCell(i);
-        if ( analysisModel().domainManager().giveLabelOf(curBndCell) == crackTipPhysNum )
-        {
-            if ( crackTipFound == true )
-                throw std::runtime_error("ERROR: Multiple entities found for specified crack tip label!\nSource: " + _name);
-            else
-            {
-                crackTipFound = true;
-                std::vector<Node*> bndCellNode = analysisModel().domainManager().giveNodesOf(curBndCell);
-                int nNodes = (int)bndCellNode.size();
-                if ( nNodes != 1 )
-                    throw std::runtime_error("ERROR: Specified crack tip has more than one node!\nSource: " + _name);
-                else
-                    crackTipNode = bndCellNode[0];
-            }
-        }
-    }
-    if ( !crackTipFound )
-        throw std::runtime_error("ERROR: Failed to find node corresponding to crack tip!\nSource: " + _name);
+    // The first path cell is evaluated serially so that numerics lacking the
+    // requested nodal fields raise their exception outside the parallel region
+    double result = this->computeContributionOf(_path[0]);
     
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:result)
+#endif
+    for ( int i = 1; i < nPath; i++ )
+        result += this->computeContributionOf(_path[i]);
+    
+    return result;
+}
+// -----------------------------------------------------------------------------
+void JIntegral::initialize()
+{
+    Node* crackTipNode = this->findCrackTipNode();
     RealVector coor = analysisModel().domainManager().giveCoordinatesOf(crackTipNode);
     RealVector p_ref ({coor(0), coor(1)});
     
-    for (  int i = 0; i < (int)_path.size(); i++ )
+    // Setup calculation data for boundary cells constituting calculation path
+    int physNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_boundaryLabel);
+    ArraySpan<Cell* const> pathCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(physNum);
+    int nPath = pathCell.size();
+    _path.assign(nPath, PathInfo());
+    
+    for ( int count = 0; count < nPath; count++ )
     {
+        Cell* curCell = pathCell[count];
+        _path[count].pathCell = curCell;
+        
         // Length and orientation of segment
-        RealVector dx = this->giveOrientationOf(_path[i].pathCell);
+        RealVector dx = this->giveOrientationOf(curCell);
         double length = std::sqrt(dx.dot(dx));
-
+        
         // We need a node on the path cell
-        std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(_path[i].pathCell);
-        RealVector coor0 = analysisModel().domainManager().giveCoordinatesOf(node[0]);
-
+        std::vector<Node*> cellNode = analysisModel().domainManager().giveNodesOf(curCell);
+        RealVector coor0 = analysisModel().domainManager().giveCoordinatesOf(cellNode[0]);
+        
         // Check orientation of unit vectors for segment
         // Note: Integration direction is clockwise w.r.t. reference point
         RealVector dirVec(2), dirVecP(2);
         dirVec(0) = coor0(0) - p_ref(0);
         dirVec(1) = coor0(1) - p_ref(1);
-
         
         dirVecP(0) = -dirVec(1);
         dirVecP(1) = dirVec(0);
-
+        
         if ( dirVecP(0)*dx(0) + dirVecP(1)*dx(1) < 0 )
             dx = -1.0*dx;
-
+        
         // outward unit normal vectors to segment
-        RealVector sn(2);
-        sn(0) = dx(1)/length;
-        sn(1) = -dx(0)/length;
+        _path[count].length = length;
+        _path[count].sn = {dx(1)/length, -dx(0)/length};
         
         // Nodal weights for integration
-        RealVector wt = this->giveNodalWeightsFor(_path[i].pathCell);
+        _path[count].wt = this->giveNodalWeightsFor(curCell);
         
-        for ( int j = 0; j < (int)node.size(); j++)
-        {
-            // Node-averaged value of stress
-            RealMatrix sigma(2,2);
-            sigma(0,0) = this->computeNodalAverageOf(_stressLabel[0], _path[i].nodeInfo[j]);
-            sigma(0,1) = this->computeNodalAverageOf(_stressLabel[2], _path[i].nodeInfo[j]);
-            sigma(1,0) = sigma(0,1);
-            sigma(1,1) = this->computeNodalAverageOf(_stressLabel[1], _path[i].nodeInfo[j]);
-            
-            // Node-averaged value of displacement gradient
-            RealMatrix gradU(2,2);
-            gradU(0,0) = this->computeNodalAverageOf(_gradULabel[0], _path[i].nodeInfo[j]);
-            gradU(0,1) = this->computeNodalAverageOf(_gradULabel[1], _path[i].nodeInfo[j]);
-            gradU(1,0) = this->computeNodalAverageOf(_gradULabel[2], _path[i].nodeInfo[j]);
-            gradU(1,1) = this->computeNodalAverageOf(_gradULabel[3], _path[i].nodeInfo[j]);
-            
-            // Node-averaged elastic strain energy
-            double ene = this->computeNodalAverageOf(_strainEnergyLabel, _path[i].nodeInfo[j]);
-            
-            // Calculate surface traction
-            RealVector trac = sigma*sn;
-
-            // Calculate gradU components along tangential
-            RealVector gradU_t = trp(gradU)*_ct;
-
-            // Calculate contribution to J-integral
-            result += length*wt(j)*(ene*_ct.dot(sn) - trac.dot(gradU_t));
-        }
-    }
-    
-    return result;
-}
-// -----------------------------------------------------------------------------
-void JIntegral::initialize()
-{
-    // Determine number of boundary cells constituting calculation path
-    int physNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_boundaryLabel);
-    int nCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
-    int count = 0;
-    for ( int iCell = 0; iCell < nCells; iCell++ )
-    {
-        Cell* curCell = analysisModel().domainManager().giveBoundaryCell(iCell);
-        if ( analysisModel().domainManager().giveLabelOf(curCell) == physNum )
-            ++count;
-    }
-    int nPath = count;
-    _path.assign(nPath, PathInfo());
-    
-    // Setup calculation data
-    count = 0;
-    for (  int iCell = 0; iCell < nCells; iCell++ )
-    {
-        Cell* curCell = analysisModel().domainManager().giveBoundaryCell(iCell);
-        int cellLabel = analysisModel().domainManager().giveLabelOf(curCell);
+        int nCellNodes = cellNode.size();
+        _path[count].nodeInfo.assign(nCellNodes, NodeInfo());
         
-        if ( cellLabel  == physNum )
+        for ( int i = 0; i < nCellNodes; i++)
         {
-            _path[count].pathCell = curCell;
-            
-            std::vector<Node*> cellNode = analysisModel().domainManager().giveNodesOf(curCell);
-            int nCellNodes = cellNode.size();
+            ArraySpan<Cell* const> cellSet = analysisModel().domainManager().giveAttachedDomainCellsOf(cellNode[i]);
+            int nAdjCells = cellSet.size();
             
-            _path[count].nodeInfo.assign(nCellNodes, NodeInfo());
+            NodeInfo& nodeInfo = _path[count].nodeInfo[i];
+            nodeInfo.adjCell.assign(nAdjCells, nullptr);
+            nodeInfo.adjCellNumerics.assign(nAdjCells, nullptr);
+            nodeInfo.adjCellNodeOrder.assign(nAdjCells, -1);
             
-            for ( int i = 0; i < nCellNodes; i++)
+            int nodeCount = 0;
+            for (auto it = cellSet.begin(); it != cellSet.end(); ++it)
             {
-                std::set<Cell*> cellSet = analysisModel().domainManager().giveAttachedDomainCellsOf(cellNode[i]);
-                int nAdjCells = cellSet.size();
-                
-                _path[count].nodeInfo[i].adjCell.assign(nAdjCells, nullptr);
-                _path[count].nodeInfo[i].adjCellNodeOrder.assign(nAdjCells, -1);
+                nodeInfo.adjCell[nodeCount] = *it;
+                nodeInfo.adjCellNumerics[nodeCount] = analysisModel().domainManager().giveNumericsFor(*it);
+                std::vector<Node*> adjCellNode = analysisModel().domainManager().giveNodesOf(*it);
+                for ( int j = 0; j < (int)adjCellNode.size(); j++)
+                    if ( adjCellNode[j] == cellNode[i] )
+                    {
+                        nodeInfo.adjCellNodeOrder[nodeCount] = j;
+                        break;
+                    }
                 
-                int nodeCount = 0;
-                for (std::set<Cell*>::iterator it = cellSet.begin(); it != cellSet.end(); ++it)
-                {
-                    _path[count].nodeInfo[i].adjCell[nodeCount] = *it;
-                    std::vector<Node*> adjCellNode = analysisModel().domainManager().giveNodesOf(*it);
-                    for ( int j = 0; j < (int)adjCellNode.size(); j++)
-                        if ( adjCellNode[j] == cellNode[i] )
-                        {
-                            _path[count].nodeInfo[i].adjCellNodeOrder[nodeCount] = j;
-                            break;
-                        }
-                    
-                    ++nodeCount;
-                }
+                ++nodeCount;
             }
-            
-            ++count;
         }
     }
 }
@@ -240,6 +177,42 @@ void JIntegral::readDataFrom( FILE* fp )
     _strainEnergyLabel = getIntegerInputFrom(fp, "Failed reading nodal field for strain energy from input file.", _name);
 }
 // -----------------------------------------------------------------------------
+double JIntegral::computeContributionOf( PathInfo& path )
+{
+    double result = 0.;
+    
+    for ( int j = 0; j < (int)path.nodeInfo.size(); j++)
+    {
+        // Node-averaged value of stress
+        RealMatrix sigma(2,2);
+        sigma(0,0) = this->computeNodalAverageOf(_stressLabel[0], path.nodeInfo[j]);
+        sigma(0,1) = this->computeNodalAverageOf(_stressLabel[2], path.nodeInfo[j]);
+        sigma(1,0) = sigma(0,1);
+        sigma(1,1) = this->computeNodalAverageOf(_stressLabel[1], path.nodeInfo[j]);
+        
+        // Node-averaged value of displacement gradient
+        RealMatrix gradU(2,2);
+        gradU(0,0) = this->computeNodalAverageOf(_gradULabel[0], path.nodeInfo[j]);
+        gradU(0,1) = this->computeNodalAverageOf(_gradULabel[1], path.nodeInfo[j]);
+        gradU(1,0) = this->computeNodalAverageOf(_gradULabel[2], path.nodeInfo[j]);
+        gradU(1,1) = this->computeNodalAverageOf(_gradULabel[3], path.nodeInfo[j]);
+        
+        // Node-averaged elastic strain energy
+        double ene = this->computeNodalAverageOf(_strainEnergyLabel, path.nodeInfo[j]);
+        
+        // Calculate surface traction
+        RealVector trac = sigma*path.sn;
+        
+        // Calculate gradU components along tangential
+        RealVector gradU_t = trp(gradU)*_ct;
+        
+        // Calculate contribution to J-integral
+        result += path.length*path.wt(j)*(ene*_ct.dot(path.sn) - trac.dot(gradU_t));
+    }
+    
+    return result;
+}
+// -----------------------------------------------------------------------------
 double JIntegral::computeNodalAverageOf( int fieldNum, NodeInfo& nodeInfo )
 {
     double fieldVal = 0.;
@@ -247,10 +220,7 @@ double JIntegral::computeNodalAverageOf( int fieldNum, NodeInfo& nodeInfo )
     
     for ( int i = 0; i < nAdjCells; i++)
     {
-        int label = analysisModel().domainManager().giveLabelOf(nodeInfo.adjCell[i]);
-        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
-        
-        RealVector nodalValues = numerics->giveCellNodeFieldValuesAt(nodeInfo.adjCell[i], fieldNum);
+        RealVector nodalValues = nodeInfo.adjCellNumerics[i]->giveCellNodeFieldValuesAt(nodeInfo.adjCell[i], fieldNum);
         fieldVal += nodalValues(nodeInfo.adjCellNodeOrder[i]);
     }
     
@@ -259,6 +229,23 @@ double JIntegral::computeNodalAverageOf( int fieldNum, NodeInfo& nodeInfo )
     return fieldVal;
 }
 // ----------------------------------------------------------------------------
+Node* JIntegral::findCrackTipNode()
+{
+    int crackTipPhysNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_crackTipLabel);
+    ArraySpan<Cell* const> crackTipCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(crackTipPhysNum);
+    
+    if ( crackTipCell.empty() )
+        throw std::runtime_error("ERROR: Failed to find node corresponding to crack tip!\nSource: " + _name);
+    else if ( crackTipCell.size() > 1 )
+        throw std::runtime_error("ERROR: Multiple entities found for specified crack tip label!\nSource: " + _name);
+    
+    std::vector<Node*> bndCellNode = analysisModel().domainManager().giveNodesOf(crackTipCell[0]);
+    if ( (int)bndCellNode.size() != 1 )
+        throw std::runtime_error("ERROR: Specified crack tip has more than one node!\nSource: " + _name);
+    
+    return bndCellNode[0];
+}
+// ----------------------------------------------------------------------------
 RealVector JIntegral::giveNodalWeightsFor( Cell* targetCell )
 {
     int nNodes = analysisModel().domainManager().giveNumberOfNodesOf(targetCell);
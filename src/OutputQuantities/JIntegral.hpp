@@ -45,6 +45,8 @@
 namespace broomstyx
 {
     class Cell;
+    class Node;
+    class Numerics;
 
     class JIntegral final : public OutputQuantity {
     public:
@@ -66,19 +68,26 @@ namespace broomstyx
         
         struct NodeInfo
         {
-            std::vector<Cell*> adjCell;
-            std::vector<int>   adjCellNodeOrder;
+            std::vector<Cell*>     adjCell;
+            std::vector<Numerics*> adjCellNumerics;
+            std::vector<int>       adjCellNodeOrder;
         };
         
+        // Path geometry is resolved at initialization
         struct PathInfo
         {
             Cell* pathCell;
+            double length;
+            RealVector sn;
+            RealVector wt;
             std::vector<NodeInfo> nodeInfo;
         };
         
         std::vector<PathInfo> _path;
 
+        double computeContributionOf( PathInfo& path );
         double computeNodalAverageOf( int fieldNum, NodeInfo& nodeInfo );
+        Node*  findCrackTipNode();
         RealVector giveNodalWeightsFor( Cell* targetCell );
         RealVector giveOrientationOf( Cell* targetCell );
     };
@@ -47,28 +47,25 @@ JIntegral_Elastic::~JIntegral_Elastic() {}
 double JIntegral_Elastic::computeOutput()
 {
     double result = 0;
+    int nCells = _pathCell.size();
     
-    int nCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:result)
+#endif
     for (int i = 0; i < nCells; i++)
-    {
-        Cell* curCell = analysisModel().domainManager().giveBoundaryCell(i);
-        if (analysisModel().domainManager().giveLabelOf(curCell) == _boundaryLabel)
-        {
-            double dJ;
-            int nNodes = analysisModel().domainManager().giveNumberOfNodesOf(curCell);
-            if ( nNodes == 2 )
-                dJ = this->JIntegral_2node_line(curCell);
-            else
-                throw std::runtime_error("Output quantity 'JIntegral_Elastic' only handles 2-node line elements!");
-            
-            result += dJ;
-        }
-    }
+        result += this->JIntegral_2node_line(_pathCell[i]);
     
     return result;
 }
 
-void JIntegral_Elastic::initialize() {}
+void JIntegral_Elastic::initialize()
+{
+    _pathCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(_boundaryLabel);
+    
+    for ( Cell* curCell : _pathCell )
+        if ( analysisModel().domainManager().giveNumberOfNodesOf(curCell) != 2 )
+            throw std::runtime_error("Output quantity 'JIntegral_Elastic' only handles 2-node line elements!");
+}
 
 void JIntegral_Elastic::readDataFrom( FILE* fp )
 {
@@ -38,6 +38,7 @@
 #define	JINTEGRAL_ELASTIC_HPP
 
 #include "OutputQuantity.hpp"
+#include "Util/ArraySpan.hpp"
 #include "Util/RealVector.hpp"
 
 namespace broomstyx
@@ -61,6 +62,9 @@ namespace broomstyx
 
         int _stressLabel[3];
         int _gradULabel[4];
+        
+        // Resolved at initialization
+        ArraySpan<Cell* const> _pathCell;
 
         double JIntegral_2node_line( Cell* targetCell );
     };
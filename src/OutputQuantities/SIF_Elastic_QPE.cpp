@@ -54,7 +54,6 @@ double SIF_Elastic_QPE::computeOutput()
 {
     RealVector crackTipLoc, nodePairLoc, dX, crackNormal, crackTangent;
     RealVector posDisp, negDisp;
-    Dof* uDof[2];
     double r;
 
     double k;
@@ -72,17 +71,13 @@ double SIF_Elastic_QPE::computeOutput()
     crackTangent = {dX(0)/r, dX(1)/r};
     crackNormal = {-dX(1)/r, dX(0)/r};
     
-    uDof[0] = analysisModel().domainManager().giveNodalDof(_dispDofNum[0],_nodePairA[0]);
-    uDof[1] = analysisModel().domainManager().giveNodalDof(_dispDofNum[1],_nodePairA[0]);
-    posDisp = {analysisModel().dofManager().giveValueOfPrimaryVariableAt(uDof[0], converged_value),
-               analysisModel().dofManager().giveValueOfPrimaryVariableAt(uDof[1], converged_value)};
+    posDisp = {analysisModel().dofManager().giveValueOfPrimaryVariableAt(_dof[0][0], converged_value),
+               analysisModel().dofManager().giveValueOfPrimaryVariableAt(_dof[0][1], converged_value)};
 
     posDisp.print("Pair A pos disp", 4);
 
-    uDof[0] = analysisModel().domainManager().giveNodalDof(_dispDofNum[0],_nodePairA[1]);
-    uDof[1] = analysisModel().domainManager().giveNodalDof(_dispDofNum[1],_nodePairA[1]);
-    negDisp = {analysisModel().dofManager().giveValueOfPrimaryVariableAt(uDof[0], converged_value),
-               analysisModel().dofManager().giveValueOfPrimaryVariableAt(uDof[1], converged_value)};
+    negDisp = {analysisModel().dofManager().giveValueOfPrimaryVariableAt(_dof[1][0], converged_value),
+               analysisModel().dofManager().giveValueOfPrimaryVariableAt(_dof[1][1], converged_value)};
     
     negDisp.print("Pair A neg disp", 4);
 
@@ -100,17 +95,13 @@ double SIF_Elastic_QPE::computeOutput()
     crackTangent = {dX(0)/r, dX(1)/r};
     crackNormal = {-dX(1)/r, dX(0)/r};
     
-    uDof[0] = analysisModel().domainManager().giveNodalDof(_dispDofNum[0],_nodePairB[0]);
-    uDof[1] = analysisModel().domainManager().giveNodalDof(_dispDofNum[1],_nodePairB[0]);
-    posDisp = {analysisModel().dofManager().giveValueOfPrimaryVariableAt(uDof[0], converged_value),
-               analysisModel().dofManager().giveValueOfPrimaryVariableAt(uDof[1], converged_value)};
+    posDisp = {analysisModel().dofManager().giveValueOfPrimaryVariableAt(_dof[2][0], converged_value),
+               analysisModel().dofManager().giveValueOfPrimaryVariableAt(_dof[2][1], converged_value)};
 
     posDisp.print("Pair B pos disp", 4);
 
-    uDof[0] = analysisModel().domainManager().giveNodalDof(_dispDofNum[0],_nodePairB[1]);
-    uDof[1] = analysisModel().domainManager().giveNodalDof(_dispDofNum[1],_nodePairB[1]);
-    negDisp = {analysisModel().dofManager().giveValueOfPrimaryVariableAt(uDof[0], converged_value),
-               analysisModel().dofManager().giveValueOfPrimaryVariableAt(uDof[1], converged_value)};
+    negDisp = {analysisModel().dofManager().giveValueOfPrimaryVariableAt(_dof[3][0], converged_value),
+               analysisModel().dofManager().giveValueOfPrimaryVariableAt(_dof[3][1], converged_value)};
     
     negDisp.print("Pair B neg disp", 4);
 
@@ -142,29 +133,18 @@ void SIF_Elastic_QPE::initialize()
     // Get node associated with crack tip
     int crackTipPhysNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_crackTipLabel);
 
-    bool crackTipFound = false;
-    int nBndCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
-    for ( int i = 0; i < nBndCells; i++ )
-    {
-        Cell* curBndCell = analysisModel().domainManager().giveBoundaryCell(i);
-        if ( analysisModel().domainManager().giveLabelOf(curBndCell) == crackTipPhysNum )
-        {
-            if ( crackTipFound == true )
-                throw std::runtime_error("ERROR: Multiple entities found for specified crack tip label!\nSource: " + _name);
-            else
-            {
-                crackTipFound = true;
-                std::vector<Node*> bndCellNode = analysisModel().domainManager().giveNodesOf(curBndCell);
-                int nNodes = (int)bndCellNode.size();
-                if ( nNodes != 1 )
-                    throw std::runtime_error("ERROR: Specified crack tip has more than one node!\nSource: " + _name);
-                else
-                    _crackTipNode = bndCellNode[0];
-            }
-        }
-    }
-    if ( !crackTipFound )
+    ArraySpan<Cell* const> crackTipCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(crackTipPhysNum);
+    
+    if ( crackTipCell.empty() )
         throw std::runtime_error("ERROR: Failed to find node corresponding to crack tip!\nSource: " + _name);
+    else if ( crackTipCell.size() > 1 )
+        throw std::runtime_error("ERROR: Multiple entities found for specified crack tip label!\nSource: " + _name);
+    
+    std::vector<Node*> bndCellNode = analysisModel().domainManager().giveNodesOf(crackTipCell[0]);
+    if ( (int)bndCellNode.size() != 1 )
+        throw std::runtime_error("ERROR: Specified crack tip has more than one node!\nSource: " + _name);
+    else
+        _crackTipNode = bndCellNode[0];
 
     // ---->
     std::printf("\nCrack tip found at node # %d\n", analysisModel().domainManager().giveIdOf(_crackTipNode));
@@ -176,91 +156,88 @@ void SIF_Elastic_QPE::initialize()
     int crackFacePhysNum[2];
     crackFacePhysNum[0] = analysisModel().domainManager().givePhysicalEntityNumberFor(_crackFaceLabel[0]);
     crackFacePhysNum[1] = analysisModel().domainManager().givePhysicalEntityNumberFor(_crackFaceLabel[1]);
-    std::vector<Cell*> crackFaceCell[2];
 
     // A. "Positive" face
-    for ( int i = 0; i < nBndCells; i++ )
+    for ( Cell* curBndCell : analysisModel().domainManager().giveBoundaryCellsWithLabel(crackFacePhysNum[0]) )
     {
-        Cell* curBndCell = analysisModel().domainManager().giveBoundaryCell(i);
-        if ( analysisModel().domainManager().giveLabelOf(curBndCell) == crackFacePhysNum[0] )
-        {
-            std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(curBndCell);
-            for ( int j = 0; j < (int)node.size(); j++ )
-                if ( node[j] == _crackTipNode )
+        std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(curBndCell);
+        for ( int j = 0; j < (int)node.size(); j++ )
+            if ( node[j] == _crackTipNode )
+            {
+                // Sanity check
+                if ( (int)node.size() != 3 )
+                    throw std::runtime_error("ERROR: Boundary cell attached to crack tip must have 3 nodes!\nSource: " + _name);
+                
+                // ---->
+                std::printf("Positive boundary cell found at cell # %d.\n", analysisModel().domainManager().giveIdOf(curBndCell));
+                std::printf("Nodes: ");
+                auto bcellNode = analysisModel().domainManager().giveNodesOf(curBndCell);
+                for ( int k = 0; k < (int)bcellNode.size(); k++ )
+                    std::printf("%d ", analysisModel().domainManager().giveIdOf(bcellNode[k]));
+                std::printf("\n");
+                for ( int k = 0; k < (int)bcellNode.size(); k++ )
+                {
+                    RealVector bNodeCoor = analysisModel().domainManager().giveCoordinatesOf(bcellNode[k]);
+                    bNodeCoor.print(("Coordinates of node " + std::to_string(k)).c_str(), 4);
+                }
+                // ---->>
+
+                if ( j == 0 )
                 {
-                    // Sanity check
-                    if ( (int)node.size() != 3 )
-                        throw std::runtime_error("ERROR: Boundary cell attached to crack tip must have 3 nodes!\nSource: " + _name);
-                    
-                    // ---->
-                    std::printf("Positive boundary cell found at cell # %d.\n", analysisModel().domainManager().giveIdOf(curBndCell));
-                    std::printf("Nodes: ");
-                    auto bcellNode = analysisModel().domainManager().giveNodesOf(curBndCell);
-                    for ( int k = 0; k < (int)bcellNode.size(); k++ )
-                        std::printf("%d ", analysisModel().domainManager().giveIdOf(bcellNode[k]));
-                    std::printf("\n");
-                    for ( int k = 0; k < (int)bcellNode.size(); k++ )
-                    {
-                        RealVector bNodeCoor = analysisModel().domainManager().giveCoordinatesOf(bcellNode[k]);
-                        bNodeCoor.print(("Coordinates of node " + std::to_string(k)).c_str(), 4);
-                    }
-                    // ---->>
-
-                    if ( j == 0 )
-                    {
-                        _nodePairA[0] = node[2];
-                        _nodePairB[0] = node[1];
-                    }
-                    else // (j == 1)
-                    {
-                        _nodePairA[0] = node[2];
-                        _nodePairB[0] = node[0];
-                    }
+                    _nodePairA[0] = node[2];
+                    _nodePairB[0] = node[1];
                 }
-        }
+                else // (j == 1)
+                {
+                    _nodePairA[0] = node[2];
+                    _nodePairB[0] = node[0];
+                }
+            }
     }
 
     // B. "Negative" face
-    for ( int i = 0; i < nBndCells; i++ )
+    for ( Cell* curBndCell : analysisModel().domainManager().giveBoundaryCellsWithLabel(crackFacePhysNum[1]) )
     {
-        Cell* curBndCell = analysisModel().domainManager().giveBoundaryCell(i);
-        if ( analysisModel().domainManager().giveLabelOf(curBndCell) == crackFacePhysNum[1] )
-        {
-            std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(curBndCell);
-            for ( int j = 0; j < (int)node.size(); j++ )
-                if ( node[j] == _crackTipNode )
+        std::vector<Node*> node = analysisModel().domainManager().giveNodesOf(curBndCell);
+        for ( int j = 0; j < (int)node.size(); j++ )
+            if ( node[j] == _crackTipNode )
+            {
+                // Sanity check
+                if ( (int)node.size() != 3 )
+                    throw std::runtime_error("ERROR: Boundary cell attached to crack tip must have 3 nodes!\nSource: " + _name);
+                
+                // ---->
+                std::printf("Negative boundary cell found at cell # %d.\n", analysisModel().domainManager().giveIdOf(curBndCell));
+                std::printf("Nodes: ");
+                auto bcellNode = analysisModel().domainManager().giveNodesOf(curBndCell);
+                for ( int k = 0; k < (int)bcellNode.size(); k++ )
+                    std::printf("%d ", analysisModel().domainManager().giveIdOf(bcellNode[k]));
+                std::printf("\n");
+                for ( int k = 0; k < (int)bcellNode.size(); k++ )
+                {
+                    RealVector bNodeCoor = analysisModel().domainManager().giveCoordinatesOf(bcellNode[k]);
+                    bNodeCoor.print(("Coordinates of node " + std::to_string(k)).c_str(), 4);
+                }
+                // ---->>
+                
+                if ( j == 0 )
+                {
+                    _nodePairA[1] = node[2];
+                    _nodePairB[1] = node[1];
+                }
+                else // (j == 1)
                 {
-                    // Sanity check
-                    if ( (int)node.size() != 3 )
-                        throw std::runtime_error("ERROR: Boundary cell attached to crack tip must have 3 nodes!\nSource: " + _name);
-                    
-                    // ---->
-                    std::printf("Negative boundary cell found at cell # %d.\n", analysisModel().domainManager().giveIdOf(curBndCell));
-                    std::printf("Nodes: ");
-                    auto bcellNode = analysisModel().domainManager().giveNodesOf(curBndCell);
-                    for ( int k = 0; k < (int)bcellNode.size(); k++ )
-                        std::printf("%d ", analysisModel().domainManager().giveIdOf(bcellNode[k]));
-                    std::printf("\n");
-                    for ( int k = 0; k < (int)bcellNode.size(); k++ )
-                    {
-                        RealVector bNodeCoor = analysisModel().domainManager().giveCoordinatesOf(bcellNode[k]);
-                        bNodeCoor.print(("Coordinates of node " + std::to_string(k)).c_str(), 4);
-                    }
-                    // ---->>
-                    
-                    if ( j == 0 )
-                    {
-                        _nodePairA[1] = node[2];
-                        _nodePairB[1] = node[1];
-                    }
-                    else // (j == 1)
-                    {
-                        _nodePairA[1] = node[2];
-                        _nodePairB[1] = node[0];
-                    }
+                    _nodePairA[1] = node[2];
+                    _nodePairB[1] = node[0];
                 }
-        }
+            }
     }
+    
+    // Displacement DOFs at node pairs
+    Node* pairNode[4] = {_nodePairA[0], _nodePairA[1], _nodePairB[0], _nodePairB[1]};
+    for ( int i = 0; i < 4; i++ )
+        for ( int j = 0; j < 2; j++ )
+            _dof[i][j] = analysisModel().domainManager().giveNodalDof(_dispDofNum[j], pairNode[i]);
 }
 // -----------------------------------------------------------------------------
 void SIF_Elastic_QPE::readDataFrom( FILE* fp )
@@ -38,6 +38,7 @@ registerBroomstyxObject(OutputQuantity, SolutionAtNode)
 
 // Constructor
 SolutionAtNode::SolutionAtNode()
+    : _dof(nullptr)
 {
     _name = "SolutionAtNode";
 }
@@ -47,38 +48,35 @@ SolutionAtNode::~SolutionAtNode() {}
 
 // Public methods
 double SolutionAtNode::computeOutput()
+{
+    return analysisModel().dofManager().giveValueOfPrimaryVariableAt(_dof, converged_value);
+}
+
+void SolutionAtNode::initialize()
 {
     // Form set of all relevant DOFs associated with boundary
     int physNum = analysisModel().domainManager().givePhysicalEntityNumberFor(_physTag);
     std::set<Dof*> dof;
     
-    int nBCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
-    for ( int i = 0; i < nBCells; i++)
+    for ( Cell* curCell : analysisModel().domainManager().giveBoundaryCellsWithLabel(physNum) )
     {
-        Cell* curCell = analysisModel().domainManager().giveBoundaryCell(i);
-        if ( analysisModel().domainManager().giveLabelOf(curCell) == physNum )
-        {
-            std::vector<Node*> cellNode = analysisModel().domainManager().giveNodesOf(curCell);
+        std::vector<Node*> cellNode = analysisModel().domainManager().giveNodesOf(curCell);
 
-            for ( int j = 0; j < (int)cellNode.size(); j++)
-            {
-                Dof* curDof = analysisModel().domainManager().giveNodalDof(_dofNum, cellNode[j]);
-                dof.insert(curDof);
-            }
+        for ( int j = 0; j < (int)cellNode.size(); j++)
+        {
+            Dof* curDof = analysisModel().domainManager().giveNodalDof(_dofNum, cellNode[j]);
+            dof.insert(curDof);
         }
     }
     
-    double result;
     if ( dof.size() > 1 )
         throw std::runtime_error("Error: multiple nodes selected for nodal solution output!\nSource: " + _name);
-    else
-        result = analysisModel().dofManager().giveValueOfPrimaryVariableAt(*(dof.begin()), converged_value);
+    else if ( dof.empty() )
+        throw std::runtime_error("Error: no node found for nodal solution output!\nSource: " + _name);
     
-    return result;
+    _dof = *(dof.begin());
 }
 
-void SolutionAtNode::initialize() {}
-
 void SolutionAtNode::readDataFrom( FILE *fp )
 {
     std::string key, errmsg;
@@ -29,6 +29,7 @@
 namespace broomstyx
 {
     class AnalysisModel;
+    class Dof;
     
     class SolutionAtNode final : public OutputQuantity
     {
@@ -43,6 +44,9 @@ namespace broomstyx
     private:
         std::string _physTag;
         int _dofNum;
+        
+        // Resolved at initialization
+        Dof* _dof;
     };    
 }
 
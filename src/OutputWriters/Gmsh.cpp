@@ -65,6 +65,11 @@ void Gmsh::initialize()
     const int dir_err = system("mkdir -p Output_Gmsh");
     if ( dir_err == -1 )
         throw std::runtime_error("Error creating directory 'Output_Gmsh'!\n");
+    
+    // Resolve element field numbers to numerics-specific accessors
+    for ( int i = 0; i < _nElemData; i++ )
+        for ( int fieldNum : _elemData[i].field )
+            _elemData[i].accessor.push_back(this->resolveCellField(fieldNum));
 }
 
 void Gmsh::readDataFrom( FILE *fp )
@@ -196,7 +201,10 @@ void Gmsh::writeOutput( double time )
     // build complete string for vtu filename
     std::string mshFilename;
     
-    mshFilename = "./Output_Gmsh/" + _outputFilename + "_" + std::to_string(_writeCounter) + ".msh";
+    if ( _loadCase.empty() )
+        mshFilename = "./Output_Gmsh/" + _outputFilename + "_" + std::to_string(_writeCounter) + ".msh";
+    else
+        mshFilename = "./Output_Gmsh/" + _outputFilename + "_" + _loadCase + "_" + std::to_string(_writeCounter) + ".msh";
     
     // Write .msh file
     std::printf("\n  %-40s", "Writing results to file ...");
@@ -366,35 +374,17 @@ void Gmsh::writeOutput( double time )
             
             int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
             std::fprintf(mshFile, "%d\n", nCells);
+            
+            std::vector<std::vector<double> > cellVal(nComp);
+            for ( int k = 0; k < nComp; k++ )
+                this->giveCellFieldValues(_elemData[i].accessor[k], cellVal[k]);
+            
             for (  int j = 0; j < nCells; j++ )
             {
                 std::fprintf(mshFile, "%d ", j+1);
-                Cell* curCell = analysisModel().domainManager().giveDomainCell(j);
-                int label = analysisModel().domainManager().giveLabelOf(curCell);
-                Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
-                
-                if ( _elemData[i].dataType == scalar )
-                    std::fprintf(mshFile, "%25.15e\n", numerics->giveCellFieldValueAt(curCell, _elemData[i].field[0]));
-                else if ( _elemData[i].dataType == vector )
-                {
-                    std::fprintf(mshFile, "%25.15e%25.15e%25.15e\n",
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[0]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[1]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[2]));
-                }
-                else
-                {
-                    std::fprintf(mshFile, "%25.15e%25.15e%25.15e%25.15e%25.15e%25.15e%25.15e%25.15e%25.15e\n",
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[0]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[1]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[2]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[3]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[4]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[5]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[6]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[7]),
-                            numerics->giveCellFieldValueAt(curCell, _elemData[i].field[8]));
-                }
+                for ( int k = 0; k < nComp; k++ )
+                    std::fprintf(mshFile, "%25.15e", cellVal[k][j]);
+                std::fprintf(mshFile, "\n");
             }
             std::fprintf(mshFile, "$EndElementData\n");
         }
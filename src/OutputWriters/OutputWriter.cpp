@@ -0,0 +1,72 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "OutputWriter.hpp"
+#include <omp.h>
+
+#include "Core/AnalysisModel.hpp"
+#include "Core/DomainManager.hpp"
+#include "Numerics/Numerics.hpp"
+
+using namespace broomstyx;
+
+// Protected methods
+// ----------------------------------------------------------------------------
+void OutputWriter::giveCellFieldValues( int accessorNum, std::vector<double>& value )
+{
+    // Values are returned in domain cell order
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    value.assign(nCells, 0.);
+    
+    CellFieldAccessor& accessor = _cellFieldAccessor[accessorNum];
+    std::vector<double> labelValue;
+    for ( int i = 0; i < (int)accessor.label.size(); i++ )
+    {
+        ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(accessor.label[i]);
+        int nLabelCells = domCell.size();
+        
+        labelValue.resize(nLabelCells);
+        accessor.numerics[i]->giveCellFieldValuesAt(domCell, accessor.accessorId[i], labelValue.data());
+        
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int j = 0; j < nLabelCells; j++ )
+            value[analysisModel().domainManager().giveIdOf(domCell[j])] = labelValue[j];
+    }
+}
+// ----------------------------------------------------------------------------
+int OutputWriter::resolveCellField( int fieldNum )
+{
+    CellFieldAccessor accessor;
+    for ( int label : analysisModel().domainManager().giveLabelsOfDomainCells() )
+    {
+        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
+        accessor.label.push_back(label);
+        accessor.numerics.push_back(numerics);
+        accessor.accessorId.push_back(numerics->resolveCellFieldOutput(fieldNum));
+    }
+    
+    _cellFieldAccessor.push_back(accessor);
+    return (int)_cellFieldAccessor.size() - 1;
+}
@@ -25,10 +25,13 @@
 #define	OUTPUTWRITER_HPP
 
 #include <cstdio>
+#include <string>
+#include <vector>
 
 namespace broomstyx
 {
     class AnalysisModel;
+    class Numerics;
     
     class OutputWriter
     {
@@ -44,6 +47,27 @@ namespace broomstyx
         virtual void initialize() = 0;
         virtual void readDataFrom( FILE* fp ) = 0;
         virtual void writeOutput( double time ) = 0;
+        
+        void setLoadCaseTo( const std::string& loadCase ) { _loadCase = loadCase; }
+        
+    protected:
+        // Name of load case whose results are currently being written
+        // (empty if the load step has a single load case)
+        std::string _loadCase;
+        
+        // Cell field accessors resolved once at initialization, holding for
+        // each domain label the numerics and its accessor ID for the field
+        struct CellFieldAccessor
+        {
+            std::vector<int>       label;
+            std::vector<Numerics*> numerics;
+            std::vector<int>       accessorId;
+        };
+        
+        std::vector<CellFieldAccessor> _cellFieldAccessor;
+        
+        void giveCellFieldValues( int accessorNum, std::vector<double>& value );
+        int  resolveCellField( int fieldNum );
     };
 }
 
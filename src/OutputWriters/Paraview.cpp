@@ -81,6 +81,11 @@ void Paraview::initialize()
     std::fprintf(_pvdFile, "<?xml version=\"1.0\"?>\n");
     std::fprintf(_pvdFile, "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\">\n");
     std::fprintf(_pvdFile, "\t<Collection>\n");
+    
+    // Resolve cell field numbers to numerics-specific accessors
+    for ( int i = 0; i < _nCellData; i++ )
+        for ( int fieldNum : _cellData[i].field )
+            _cellData[i].accessor.push_back(this->resolveCellField(fieldNum));
 }
 
 void Paraview::readDataFrom(FILE* fp)
@@ -173,7 +178,10 @@ void Paraview::writeOutput( double time )
     
     // build complete string for vtu filename
     std::string vtuFilenameInPvd, vtuFilename;
-    vtuFilenameInPvd = _outputFilename + "_" + std::to_string(_vtuFileCount) + ".vtu";
+    if ( _loadCase.empty() )
+        vtuFilenameInPvd = _outputFilename + "_" + std::to_string(_vtuFileCount) + ".vtu";
+    else
+        vtuFilenameInPvd = _outputFilename + "_" + _loadCase + "_" + std::to_string(_vtuFileCount) + ".vtu";
     
     vtuFilename = "./Output_Paraview/" + vtuFilenameInPvd;
     
@@ -265,6 +273,8 @@ void Paraview::writeOutput( double time )
             cellType = 10;
         else if ( dim == 2 && nCellNodes == 6 )
 			cellType = 22;
+        else if ( dim == 2 && nCellNodes == 8 )
+            cellType = 23;
 		else
             throw std::runtime_error("Cells of dim = " + std::to_string(dim) + " and nNodes = " + std::to_string(nCellNodes) + " not yet programmed in Paraview output writer!");
         
@@ -339,6 +349,7 @@ void Paraview::writeOutput( double time )
     if ( _nCellData > 0 )
     {
         std::fprintf(vtuFile, "\t\t\t<CellData>\n");
+        std::vector<std::vector<double> > cellVal(6);
 
         // --- Individual data arrays
         for ( int i = 0; i < _nCellData; i++)
@@ -362,13 +373,9 @@ void Paraview::writeOutput( double time )
                 // Scalar data
                 std::fprintf(vtuFile, "\t\t\t\t<DataArray type=\"Float32\" ");
                 std::fprintf(vtuFile, "Name=\"%s\" format=\"ascii\">\n", _cellData[i].name.c_str());
+                this->giveCellFieldValues(_cellData[i].accessor[0], cellVal[0]);
                 for ( int j = 0; j < nCells; j++)
-                {
-                    Cell* curCell = analysisModel().domainManager().giveDomainCell(j);
-                    int label = analysisModel().domainManager().giveLabelOf(curCell);
-                    Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
-                    std::fprintf(vtuFile, "\t\t\t\t\t%25.15e\n", numerics->giveCellFieldValueAt(curCell, _cellData[i].field[0]));
-                }
+                    std::fprintf(vtuFile, "\t\t\t\t\t%25.15e\n", cellVal[0][j]);
                     
                 std::fprintf(vtuFile, "\t\t\t\t</DataArray>\n");
             }
@@ -379,15 +386,11 @@ void Paraview::writeOutput( double time )
                 std::fprintf(vtuFile, "NumberOfComponents=\"3\" Name=");
                 std::fprintf(vtuFile, "\"%s\" format=\"ascii\">\n", _cellData[i].name.c_str());
                 
-                for ( int j = 0; j < nCells; j++) {
-                    Cell* curCell = analysisModel().domainManager().giveDomainCell(j);
-                    Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
-                    
-                    std::fprintf(vtuFile, "\t\t\t\t\t%25.15e%25.15e%25.15e\n",
-                            numerics->giveCellFieldValueAt(curCell, _cellData[i].field[0]),
-                            numerics->giveCellFieldValueAt(curCell, _cellData[i].field[1]),
-                            numerics->giveCellFieldValueAt(curCell, _cellData[i].field[2]));
-                }
+                for ( int k = 0; k < 3; k++ )
+                    this->giveCellFieldValues(_cellData[i].accessor[k], cellVal[k]);
+                
+                for ( int j = 0; j < nCells; j++)
+                    std::fprintf(vtuFile, "\t\t\t\t\t%25.15e%25.15e%25.15e\n", cellVal[0][j], cellVal[1][j], cellVal[2][j]);
                 std::fprintf(vtuFile, "\t\t\t\t</DataArray>\n");
             }
             else
@@ -396,19 +399,12 @@ void Paraview::writeOutput( double time )
                 std::fprintf(vtuFile, "\t\t\t\t<DataArray type=\"Float32\" ");
                 std::fprintf(vtuFile, "NumberOfComponents=\"6\" Name=");
                 std::fprintf(vtuFile, "\"%s\" format=\"ascii\">\n", _cellData[i].name.c_str());
+                for ( int k = 0; k < 6; k++ )
+                    this->giveCellFieldValues(_cellData[i].accessor[k], cellVal[k]);
+                
                 for ( int j = 0; j < nCells; j++)
-                {
-                    Cell* curCell = analysisModel().domainManager().giveDomainCell(j);
-                    Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
-                    
                     std::fprintf(vtuFile, "\t\t\t\t\t%25.15e%25.15e%25.15e%25.15e%25.15e%25.15e\n",
-                            numerics->giveCellFieldValueAt(curCell, _cellData[i].field[0]),
-                            numerics->giveCellFieldValueAt(curCell, _cellData[i].field[1]),
-                            numerics->giveCellFieldValueAt(curCell, _cellData[i].field[2]),
-                            numerics->giveCellFieldValueAt(curCell, _cellData[i].field[3]),
-                            numerics->giveCellFieldValueAt(curCell, _cellData[i].field[4]),
-                            numerics->giveCellFieldValueAt(curCell, _cellData[i].field[5]));
-                }
+                            cellVal[0][j], cellVal[1][j], cellVal[2][j], cellVal[3][j], cellVal[4][j], cellVal[5][j]);
                 std::fprintf(vtuFile, "\t\t\t\t</DataArray>\n");
             }
         }
@@ -426,7 +422,10 @@ void Paraview::writeOutput( double time )
 
     // Write entry for .vtu file in .pvd file
     // --------------------------------------
-    std::fprintf(_pvdFile, "\t\t<DataSet timestep=\"%.15f\" file=\"%s\"/>\n", time, vtuFilenameInPvd.c_str());
+    if ( _loadCase.empty() )
+        std::fprintf(_pvdFile, "\t\t<DataSet timestep=\"%.15f\" file=\"%s\"/>\n", time, vtuFilenameInPvd.c_str());
+    else
+        std::fprintf(_pvdFile, "\t\t<DataSet timestep=\"%.15f\" group=\"%s\" file=\"%s\"/>\n", time, _loadCase.c_str(), vtuFilenameInPvd.c_str());
     std::fflush(_pvdFile);
     
     toc = std::chrono::high_resolution_clock::now();
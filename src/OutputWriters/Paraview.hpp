@@ -47,6 +47,7 @@ namespace broomstyx
         {
             DataType         dataType;
             std::vector<int> field;
+            std::vector<int> accessor;
             std::string      name;
         };
         
@@ -53,6 +53,7 @@ using namespace broomstyx;
 registerBroomstyxObject(SolutionMethod, AlternateMinimization)
 
 AlternateMinimization::AlternateMinimization()
+    : _cacheElementMatrices(false)
 {
     _name = "AlternateMinimization";
 }
@@ -239,21 +240,8 @@ int AlternateMinimization::computeSolutionFor( int stage
                     resid[i] = rhs[i] - lhs[i];
                 }
                 
-                // Assemble system Jacobian
-                _spMatrix[i]->initializeValues();
-                this->assembleJacobian(stage, _subsysNum[i], time);
-                
-                // Solve system and apply over-relaxation
-                innertic = std::chrono::high_resolution_clock::now();
-                
-                _solver[i]->allocateInternalMemoryFor(_spMatrix[i]);
-                if ( _solver[i]->takesInitialGuess() )
-                    _solver[i]->setInitialGuessTo(dU[i]);
-                dU[i] = _solver[i]->solve(_spMatrix[i], resid[i]);
-                
-                innertoc = std::chrono::high_resolution_clock::now();
-                tictoc = innertoc - innertic;
-                diagnostics().addSolveTime(tictoc.count());
+                // Assemble and solve subsystem, then apply over-relaxation
+                dU[i] = this->solveForSubsystemCorrection(stage, i, resid[i], dU[i], time);
                 
                 innertic = std::chrono::high_resolution_clock::now();
 #ifdef _OPENMP
@@ -355,16 +343,24 @@ void AlternateMinimization::formSparsityProfileForStage( int stage )
     // Determine sparsity profile for each subsystem
     for ( int i = 0; i < _nSubsystems; i++ )
     {
+        int nUnknowns = subsysEqNo[i];
+        if ( !this->assemblesGlobalMatrixFor(i) )
+        {
+            std::printf("\n    Stage %-2d, Subsystem %-2d: nUnknowns = %d (no global matrix)\n", stage, _subsysNum[i], nUnknowns);
+            continue;
+        }
+        
         std::printf("\n  %-40s", "Determining sparsity pattern ...");
         std::fflush(stdout);
         tic = std::chrono::high_resolution_clock::now();
 
         // Initialize sparsity profile
-        int nUnknowns = subsysEqNo[i];
         _spMatrix[i]->initializeProfile(nUnknowns, nUnknowns);
         _spMatrix[i]->setSymmetryTo(_symmetry[i]);
         
         int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+        if ( _cacheElementMatrices )
+            _elMatCache[i].initializeSlots(nCells);
 
         // Matrix assembly for determining sparsity profile cannot be 
         // parallelized because std::set is not thread-safe.
@@ -379,6 +375,8 @@ void AlternateMinimization::formSparsityProfileForStage( int stage )
             std::tie(rowDof,colDof,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, _subsysNum[i], time);
             
             int lnnz = rowDof.size();
+            if ( _cacheElementMatrices )
+                _elMatCache[i].reserveSlotFor(curCell, lnnz);
             for ( int k = 0; k < lnnz; k++)
             {
                 if ( rowDof[k] && colDof[k] )
@@ -394,6 +392,8 @@ void AlternateMinimization::formSparsityProfileForStage( int stage )
         }
 
         _spMatrix[i]->finalizeProfile();
+        if ( _cacheElementMatrices )
+            _elMatCache[i].allocatePool();
 
         toc = std::chrono::high_resolution_clock::now();
         tictoc = toc - tic;
@@ -442,6 +442,7 @@ void AlternateMinimization::readDataFromFile( FILE* fp )
     _spMatrix.assign(_nSubsystems, nullptr);
     _nUnknowns.assign(_nSubsystems, 0);
     _overRelaxation.init(_nSubsystems);
+    _elMatCache.assign(_nSubsystems, ElementMatrixCache());
     
     for ( int i = 0; i < _nSubsystems; i++ )
     {
@@ -473,8 +474,16 @@ void AlternateMinimization::readDataFromFile( FILE* fp )
         _spMatrix[i]->setSymmetryTo(_symmetry[i]);
     }
 
-    // Maximum number of iterations
-    verifyKeyword(fp, "MaxIterations", _name);
+    // Optional reuse of element matrices, followed by maximum number of
+    // iterations
+    std::string key = getStringInputFrom(fp, "Failed to read keyword from input file!", _name);
+    if ( key == "ElementMatrixCache" )
+    {
+        _cacheElementMatrices = true;
+        key = getStringInputFrom(fp, "Failed to read keyword from input file!", _name);
+    }
+    if ( key != "MaxIterations" )
+        throw std::runtime_error("Keyword 'MaxIterations' expected in input file,\n\tstring '" + key + "' found.\nError source: " + _name);
     _maxIter = getIntegerInputFrom(fp, "Failed to read maximum number of iterations from input file!", _name);
 
     // Directive upon reaching maximum iterations
@@ -571,6 +580,7 @@ void AlternateMinimization::assembleJacobian( int stage
     tic = std::chrono::high_resolution_clock::now();
 
     int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    int ssIdx = this->giveIndexForSubsystem(subsys);
 
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -583,7 +593,19 @@ void AlternateMinimization::assembleJacobian( int stage
         std::vector<Dof*> rowDof, colDof;
         RealVector coefVal;
 
-        std::tie(rowDof,colDof,coefVal) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, subsys, time);
+        if ( !_cacheElementMatrices )
+            std::tie(rowDof,colDof,coefVal) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, subsys, time);
+        else
+        {
+            // Stored matrix of the cell, recomputed if outdated
+            CoefficientMatrixBatch batch;
+            _elMatCache[ssIdx].giveCoefficientMatricesAt(ArraySpan<Cell* const>(&curCell, 1), numerics, stage, subsys, time, batch);
+            rowDof.swap(batch.rowDof);
+            colDof.swap(batch.colDof);
+            coefVal.init(batch.coefVal.size());
+            for ( int j = 0; j < (int)batch.coefVal.size(); j++ )
+                coefVal(j) = batch.coefVal[j];
+        }
 
         for ( int j = 0; j < (int)rowDof.size(); j++)
         {
@@ -602,6 +624,8 @@ void AlternateMinimization::assembleJacobian( int stage
             }
         }
     }
+    if ( _cacheElementMatrices )
+        _elMatCache[ssIdx].reportAccesses();
 
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
@@ -623,8 +647,6 @@ RealVector AlternateMinimization::assembleRightHandSide( int stage
     RealVector rhs(_nUnknowns[idx]);
     
     // Loop through all field conditions
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
-    
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -633,46 +655,45 @@ RealVector AlternateMinimization::assembleRightHandSide( int stage
 #ifdef _OPENMP
         threadNum = omp_get_thread_num();
 #endif
+        for ( int ifc = 0; ifc < (int)fldCond.size(); ifc++ )
+        {
+            int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond[ifc].domainLabel());
+            Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(fcLabel);
+            ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(fcLabel);
+            int nCells = domCell.size();
+
 #ifdef _OPENMP
 #pragma omp for
 #endif
-        for ( int i = 0; i < nCells; i++ )
-        {
-            Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
-            int label = analysisModel().domainManager().giveLabelOf(curCell);
-                
-            for ( int ifc = 0; ifc < (int)fldCond.size(); ifc++ )
+            for ( int i = 0; i < nCells; i++ )
             {
-                int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond[ifc].domainLabel());
-                if ( label == fcLabel )
-                {
-                    RealVector localRhs;
-                    std::vector<Dof*> rowDof;
+                Cell* curCell = domCell[i];
+
+                RealVector localRhs;
+                std::vector<Dof*> rowDof;
 
-                    Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
-                    std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, subsys, fldCond[ifc], time);
-                    
-                    for ( int j = 0; j < localRhs.dim(); j++)
+                std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, subsys, fldCond[ifc], time);
+                
+                for ( int j = 0; j < localRhs.dim(); j++)
+                {
+                    if ( rowDof[j] )
                     {
-                        if ( rowDof[j] )
+                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
+                        int ssNum = analysisModel().dofManager().giveSubsystemNumberFor(rowDof[j]);
+                        
+                        int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
+                        int idx = this->giveIndexForDofGroup(dofGrp);
+                        _convergenceCriterion[idx]->processLocalResidualContribution(localRhs(j), threadNum);
+
+                        if ( rowNum != UNASSIGNED && ssNum == subsys )
                         {
-                            int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
-                            int ssNum = analysisModel().dofManager().giveSubsystemNumberFor(rowDof[j]);
-                            
-                            int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
-                            int idx = this->giveIndexForDofGroup(dofGrp);
-                            _convergenceCriterion[idx]->processLocalResidualContribution(localRhs(j), threadNum);
-
-                            if ( rowNum != UNASSIGNED && ssNum == subsys )
-                            {
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-                                rhs(rowNum) += localRhs(j);
-                            }
-
-                            analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localRhs(j));
+                            rhs(rowNum) += localRhs(j);
                         }
+
+                        analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localRhs(j));
                     }
                 }
             }
@@ -685,7 +706,8 @@ RealVector AlternateMinimization::assembleRightHandSide( int stage
         int boundaryId = analysisModel().domainManager().givePhysicalEntityNumberFor(bndCond[ibc].boundaryName());
         Numerics* numerics = analysisModel().numericsManager().giveNumerics(bndCond[ibc].targetNumerics());
         
-        int nBCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
+        ArraySpan<Cell* const> bndCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(boundaryId);
+        int nBCells = bndCell.size();
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -700,38 +722,34 @@ RealVector AlternateMinimization::assembleRightHandSide( int stage
 #endif
             for ( int i = 0; i < nBCells; i++ ) 
             {
-                Cell* curCell = analysisModel().domainManager().giveBoundaryCell(i);
-                int label = analysisModel().domainManager().giveLabelOf(curCell);
+                Cell* curCell = bndCell[i];
 
-                if ( label == boundaryId )
-                {
-                    RealVector localRhs;
-                    std::vector<Dof*> rowDof;
+                RealVector localRhs;
+                std::vector<Dof*> rowDof;
 
-                    // Specifics of BC imposition are handled by numerics
-                    std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, subsys, bndCond[ibc], time);
+                // Specifics of BC imposition are handled by numerics
+                std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, subsys, bndCond[ibc], time);
 
-                    for ( int j = 0; j < localRhs.dim(); j++)
+                for ( int j = 0; j < localRhs.dim(); j++)
+                {
+                    if ( rowDof[j] )
                     {
-                        if ( rowDof[j] )
-                        {
-                            int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
-                            int ssNum = analysisModel().dofManager().giveSubsystemNumberFor(rowDof[j]);
+                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
+                        int ssNum = analysisModel().dofManager().giveSubsystemNumberFor(rowDof[j]);
 
-                            int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
-                            int idx = this->giveIndexForDofGroup(dofGrp);
-                            _convergenceCriterion[idx]->processLocalResidualContribution(localRhs(j), threadNum);
+                        int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
+                        int idx = this->giveIndexForDofGroup(dofGrp);
+                        _convergenceCriterion[idx]->processLocalResidualContribution(localRhs(j), threadNum);
 
-                            if ( rowNum != UNASSIGNED && ssNum == subsys )
-                            {
+                        if ( rowNum != UNASSIGNED && ssNum == subsys )
+                        {
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-                                rhs(rowNum) += localRhs(j);
-                            }
-
-                            analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localRhs(j));
+                            rhs(rowNum) += localRhs(j);
                         }
+
+                        analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localRhs(j));
                     }
                 }
             }
@@ -745,6 +763,40 @@ RealVector AlternateMinimization::assembleRightHandSide( int stage
     return rhs;
 }
 // ---------------------------------------------------------------------------
+bool AlternateMinimization::assemblesGlobalMatrixFor( int idx )
+{
+    return true;
+}
+// ---------------------------------------------------------------------------
+RealVector AlternateMinimization::solveForSubsystemCorrection( int stage
+                                                             , int idx
+                                                             , RealVector& resid
+                                                             , RealVector& prevCorrection
+                                                             , const TimeData& time )
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    // Assemble system Jacobian
+    _spMatrix[idx]->initializeValues();
+    _spMatrix[idx]->setEvaluationContextTo(stage, _subsysNum[idx], time);
+    this->assembleJacobian(stage, _subsysNum[idx], time);
+
+    // Solve system
+    tic = std::chrono::high_resolution_clock::now();
+
+    _solver[idx]->allocateInternalMemoryFor(_spMatrix[idx]);
+    if ( _solver[idx]->takesInitialGuess() )
+        _solver[idx]->setInitialGuessTo(prevCorrection);
+    RealVector dU = _solver[idx]->solve(_spMatrix[idx], resid);
+
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addSolveTime(tictoc.count());
+    
+    return dU;
+}
+// ---------------------------------------------------------------------------
 int AlternateMinimization::giveIndexForDofGroup( int dofGroupNum )
 {
     int idx = -1;
@@ -25,6 +25,7 @@
 #define	ALTERNATEMINIMIZATION_HPP
 
 #include "SolutionMethod.hpp"
+#include "Core/ElementMatrixCache.hpp"
 #include <map>
 #include <tuple>
 #include <vector>
@@ -72,6 +73,11 @@ namespace broomstyx
         int _substepCount;
         bool _abortAtMaxIter;
         
+        // Optional reuse of element matrices between assemblies, with a
+        // cache for each subsystem
+        bool _cacheElementMatrices;
+        std::vector<ElementMatrixCache> _elMatCache;
+        
         virtual RealVector assembleLeftHandSide( int stage
                                                , int subsys
                                                , const TimeData& time );
@@ -87,8 +93,19 @@ namespace broomstyx
                                   , const std::vector<FieldCondition>& fldCond
                                   , const TimeData& time );
         
+        // Whether the global coefficient matrix of a subsystem is assembled.
+        // Its sparsity profile is only formed if this is the case.
+        virtual bool assemblesGlobalMatrixFor( int idx );
+        
         int  giveIndexForDofGroup( int dofGroupNum );
         int  giveIndexForSubsystem( int subsysNum );
+        
+        virtual RealVector 
+             solveForSubsystemCorrection( int stage
+                                        , int idx
+                                        , RealVector& resid
+                                        , RealVector& prevCorrection
+                                        , const TimeData& time );
     };
 }
 
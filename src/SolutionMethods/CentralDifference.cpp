@@ -0,0 +1,417 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "CentralDifference.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "Core/AnalysisModel.hpp"
+#include "Core/ObjectFactory.hpp"
+#include "Core/Diagnostics.hpp"
+#include "Core/DofManager.hpp"
+#include "Core/DomainManager.hpp"
+#include "Core/NumericsManager.hpp"
+#include "Numerics/Numerics.hpp"
+#include "Util/readOperations.hpp"
+
+using namespace broomstyx;
+
+registerBroomstyxObject(SolutionMethod, CentralDifference)
+
+// Constructor
+CentralDifference::CentralDifference()
+    : _nUnknowns(0)
+    , _safetyFactor(0.9)
+    , _prevTimeStep(0.)
+    , _substepStartTime(std::numeric_limits<double>::lowest())
+    , _substepStartPrevTimeStep(0.)
+{
+    _name = "CentralDifference";
+}
+
+// Destructor
+CentralDifference::~CentralDifference() = default;
+
+// Public methods
+// ---------------------------------------------------------------------------
+int CentralDifference::computeSolutionFor( int stage
+                                         , const std::vector<BoundaryCondition>& bndCond
+                                         , const std::vector<FieldCondition>& fldCond
+                                         , TimeData& time )
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    std::vector<Dof*> dof = analysisModel().dofManager().giveActiveDofsAtStage(stage);
+    
+    // A repeated substep restarts from the converged state of the previous one
+    if ( time.giveCurrentTime() == _substepStartTime )
+    {
+        _velocity = _substepStartVelocity;
+        _prevTimeStep = _substepStartPrevTimeStep;
+        
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int i = 0; i < (int)dof.size(); i++ )
+        {
+            double u = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof[i], converged_value);
+            analysisModel().dofManager().updatePrimaryVariableAt(dof[i], u, current_value);
+        }
+    }
+    else
+    {
+        _substepStartTime = time.giveCurrentTime();
+        _substepStartVelocity = _velocity;
+        _substepStartPrevTimeStep = _prevTimeStep;
+    }
+    
+    // Subdivide substep into stable time steps
+    double dtCrit = _safetyFactor*this->computeCriticalTimeStep(stage);
+    double interval = time.giveTargetTime() - time.giveCurrentTime();
+    int nSteps = std::max(1, (int)std::ceil(interval/dtCrit));
+    double dt = interval/nSteps;
+    std::printf("    Critical time step = %e, time steps = %d (dt = %e)\n", dtCrit, nSteps, dt);
+    
+    std::printf("    %-40s", "Integrating equations of motion ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+    
+    TimeData stepTime = time;
+    stepTime.setTimeIncrementTo(dt);
+    for ( int n = 0; n < nSteps; n++ )
+    {
+        double t = time.giveCurrentTime() + n*dt;
+        
+        // Residual force at start of time step
+        stepTime.setCurrentTimeTo(t - dt);
+        RealVector force = this->assembleForceVector(stage, bndCond, fldCond, stepTime, false);
+        
+        // Velocities at the half step and displacements at the end of the
+        // time step. The first half step after start-up has length dt/2.
+        double dtAvg = 0.5*(_prevTimeStep + dt);
+        
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int i = 0; i < (int)dof.size(); i++ )
+        {
+            int eqNo = analysisModel().dofManager().giveEquationNumberAt(dof[i]);
+            _velocity(eqNo) += dtAvg*force(eqNo)/_mass(eqNo);
+            
+            double u = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof[i], current_value);
+            analysisModel().dofManager().updatePrimaryVariableAt(dof[i], u + dt*_velocity(eqNo), current_value);
+        }
+        _prevTimeStep = dt;
+        
+        // Prescribed values at end of time step
+        stepTime.setCurrentTimeTo(t);
+        this->imposeConstraintsAt(stage, bndCond, stepTime);
+    }
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+    diagnostics().addSolveTime(tictoc.count());
+    
+    // Secondary variables consistent with the state at the target time
+    tic = std::chrono::high_resolution_clock::now();
+    analysisModel().dofManager().resetSecondaryVariablesAtStage(stage);
+    this->assembleForceVector(stage, bndCond, fldCond, time, true);
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addUpdateTime(tictoc.count());
+    
+    return 0;
+}
+// ---------------------------------------------------------------------------
+void CentralDifference::formSparsityProfileForStage( int stage )
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+
+    // Assign DOF equation numbers
+    std::printf("\n  %-40s", "Assigning DOF equation numbers ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+
+    std::vector<Dof*> dof = analysisModel().dofManager().giveActiveDofsAtStage(stage);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int i = 0; i < (int)dof.size(); i++ )
+        analysisModel().dofManager().setEquationNumberFor(dof[i], i);
+
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)", tictoc.count());
+    
+    // Velocities carry over to subsequent load steps as long as the set of
+    // active DOFs is unchanged
+    if ( (int)dof.size() != _nUnknowns )
+    {
+        _nUnknowns = dof.size();
+        _velocity.init(_nUnknowns);
+        _prevTimeStep = 0.;
+    }
+    
+    std::printf("\n  %-40s", "Assembling lumped mass ...");
+    tic = std::chrono::high_resolution_clock::now();
+    this->assembleLumpedMass(stage);
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+    
+    std::printf("\n    Stage %-2d: nUnknowns = %d (explicit)\n", stage, _nUnknowns);
+}
+// ---------------------------------------------------------------------------
+void CentralDifference::initializeSolvers()
+{
+    // No linear systems are solved
+}
+// ---------------------------------------------------------------------------
+void CentralDifference::readDataFromFile( FILE* fp )
+{
+    verifyKeyword(fp, "SafetyFactor", _name);
+    _safetyFactor = getRealInputFrom(fp, "Failed to read time step safety factor from input file!", _name);
+    if ( _safetyFactor <= 0. || _safetyFactor > 1. )
+        throw std::runtime_error("Time step safety factor must be in (0,1]!\nSource: " + _name);
+}
+
+// Private methods
+// ---------------------------------------------------------------------------
+RealVector CentralDifference::assembleForceVector( int stage
+                                                 , const std::vector<BoundaryCondition>& bndCond
+                                                 , const std::vector<FieldCondition>& fldCond
+                                                 , const TimeData& time
+                                                 , bool updateSecondaryVariables )
+{
+    RealVector force(_nUnknowns);
+    
+    // Internal forces
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int iCell = 0; iCell < nCells; iCell++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
+        Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+
+        std::vector<Dof*> rowDof;
+        RealVector localLhs;
+        std::tie(rowDof, localLhs) = numerics->giveStaticLeftHandSideAt(curCell, stage, UNASSIGNED, time);
+
+        for ( int i = 0; i < localLhs.dim(); i++ )
+        {
+            if ( rowDof[i] )
+            {
+                int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+                if ( rowNum != UNASSIGNED )
+                {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                    force(rowNum) -= localLhs(i);
+                }
+                
+                if ( updateSecondaryVariables )
+                    analysisModel().dofManager().addToSecondaryVariableAt(rowDof[i], localLhs(i));
+            }
+        }
+    }
+    
+    // Body forces from field conditions
+    for ( int ifc = 0; ifc < (int)fldCond.size(); ifc++ )
+    {
+        // Contributions of field conditions with uniform values on domains
+        // with state-independent right hand sides are formed once and
+        // scaled by the current value
+        if ( _loadVectorCache.appliesTo(fldCond[ifc]) )
+        {
+            const CachedLoadVector& loadVector = _loadVectorCache.giveLoadVectorFor(fldCond[ifc], stage, time);
+            double fcVal = fldCond[ifc].uniformValueAt(time);
+            int nEntries = loadVector.dof.size();
+            
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for ( int i = 0; i < nEntries; i++ )
+            {
+                double localRhs = loadVector.baseVal[i] + fcVal*loadVector.unitVal[i];
+                int rowNum = analysisModel().dofManager().giveEquationNumberAt(loadVector.dof[i]);
+                if ( rowNum != UNASSIGNED )
+                {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                    force(rowNum) += localRhs;
+                }
+                
+                if ( updateSecondaryVariables )
+                    analysisModel().dofManager().addToSecondaryVariableAt(loadVector.dof[i], localRhs);
+            }
+            continue;
+        }
+        
+        int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond[ifc].domainLabel());
+        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(fcLabel);
+        ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(fcLabel);
+        int nDomCells = domCell.size();
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int iCell = 0; iCell < nDomCells; iCell++ )
+        {
+            std::vector<Dof*> rowDof;
+            RealVector localRhs;
+            std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(domCell[iCell], stage, UNASSIGNED, fldCond[ifc], time);
+
+            for ( int i = 0; i < localRhs.dim(); i++)
+            {
+                if ( rowDof[i] )
+                {
+                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+                    if ( rowNum != UNASSIGNED )
+                    {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                        force(rowNum) += localRhs(i);
+                    }
+                    
+                    if ( updateSecondaryVariables )
+                        analysisModel().dofManager().addToSecondaryVariableAt(rowDof[i], localRhs(i));
+                }
+            }
+        }
+    }
+
+    // Natural boundary conditions
+    for ( int ibc = 0; ibc < (int)bndCond.size(); ibc++ )
+    {
+        int boundaryId = analysisModel().domainManager().givePhysicalEntityNumberFor(bndCond[ibc].boundaryName());
+        Numerics* numerics = analysisModel().numericsManager().giveNumerics(bndCond[ibc].targetNumerics());
+        ArraySpan<Cell* const> bndCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(boundaryId);
+        int nBCells = bndCell.size();
+        
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int iCell = 0; iCell < nBCells; iCell++ )
+        {
+            std::vector<Dof*> rowDof;
+            RealVector localRhs;
+            std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(bndCell[iCell], stage, UNASSIGNED, bndCond[ibc], time);
+
+            for ( int i = 0; i < localRhs.dim(); i++)
+            {
+                if ( rowDof[i] )
+                {
+                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+                    if ( rowNum != UNASSIGNED )
+                    {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                        force(rowNum) += localRhs(i);
+                    }
+                    
+                    if ( updateSecondaryVariables )
+                        analysisModel().dofManager().addToSecondaryVariableAt(rowDof[i], localRhs(i));
+                }
+            }
+        }
+    }
+    
+    return force;
+}
+// ---------------------------------------------------------------------------
+void CentralDifference::assembleLumpedMass( int stage )
+{
+    _mass.init(_nUnknowns);
+    
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int iCell = 0; iCell < nCells; iCell++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
+        Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+
+        std::vector<Dof*> rowDof;
+        RealVector localMass;
+        std::tie(rowDof, localMass) = numerics->giveLumpedMassAt(curCell, stage, UNASSIGNED);
+
+        for ( int i = 0; i < localMass.dim(); i++ )
+        {
+            if ( rowDof[i] )
+            {
+                int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+                if ( rowNum != UNASSIGNED )
+                {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                    _mass(rowNum) += localMass(i);
+                }
+            }
+        }
+    }
+    
+    for ( int i = 0; i < _nUnknowns; i++ )
+        if ( _mass(i) <= 0. )
+            throw std::runtime_error("Non-positive lumped mass encountered at equation " 
+                    + std::to_string(i) + "!\nSource: " + _name);
+}
+// ---------------------------------------------------------------------------
+double CentralDifference::computeCriticalTimeStep( int stage )
+{
+    double dtCrit = std::numeric_limits<double>::max();
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    
+#ifdef _OPENMP
+#pragma omp parallel for reduction(min:dtCrit)
+#endif
+    for ( int iCell = 0; iCell < nCells; iCell++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
+        Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+        
+        double dt = numerics->giveCriticalTimeStepAt(curCell, stage);
+        if ( dt < dtCrit )
+            dtCrit = dt;
+    }
+    
+    return dtCrit;
+}
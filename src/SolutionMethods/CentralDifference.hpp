@@ -0,0 +1,77 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef CENTRALDIFFERENCE_HPP
+#define	CENTRALDIFFERENCE_HPP
+
+#include "SolutionMethod.hpp"
+
+namespace broomstyx
+{
+    // Explicit central difference time integration with lumped mass. Each
+    // substep of the load step is subdivided into time steps no larger than
+    // the critical time step reported by the numerics, scaled by a safety
+    // factor, so that output is only written at the end of substeps.
+    class CentralDifference : public SolutionMethod
+    {
+    public:
+        CentralDifference();
+        virtual ~CentralDifference();
+
+        int  computeSolutionFor( int stage
+                               , const std::vector<BoundaryCondition>& bndCond
+                               , const std::vector<FieldCondition>& fldCond
+                               , TimeData& time ) override;
+        
+        void formSparsityProfileForStage( int stage ) override;
+        void initializeSolvers() override;
+        void readDataFromFile( FILE* fp ) override;
+        
+    private:
+        int    _nUnknowns;
+        double _safetyFactor;
+        
+        // Lumped mass and velocity at the last half step, indexed by DOF
+        // equation numbers
+        RealVector _mass;
+        RealVector _velocity;
+        double     _prevTimeStep;
+        
+        // State at the start of the current substep, restored when the
+        // substep is repeated
+        RealVector _substepStartVelocity;
+        double     _substepStartTime;
+        double     _substepStartPrevTimeStep;
+        
+        RealVector assembleForceVector( int stage
+                                      , const std::vector<BoundaryCondition>& bndCond
+                                      , const std::vector<FieldCondition>& fldCond
+                                      , const TimeData& time
+                                      , bool updateSecondaryVariables );
+        
+        void   assembleLumpedMass( int stage );
+        double computeCriticalTimeStep( int stage );
+    };
+}
+
+#endif	/* CENTRALDIFFERENCE_HPP */
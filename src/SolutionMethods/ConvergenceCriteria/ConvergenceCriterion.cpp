@@ -0,0 +1,101 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "ConvergenceCriterion.hpp"
+#include <omp.h>
+#include <algorithm>
+#include <cmath>
+#include "Core/AnalysisModel.hpp"
+#include "Core/DofManager.hpp"
+
+using namespace broomstyx;
+
+// ----------------------------------------------------------------------------------------
+void DofGroupNorms::addCorrection( double corr, double inc )
+{
+    corrSumSq += corr*corr;
+    corrMaxAbs = std::max(corrMaxAbs, std::fabs(corr));
+    incSumSq += inc*inc;
+    incMaxAbs = std::max(incMaxAbs, std::fabs(inc));
+    dofCount += 1.;
+}
+// ----------------------------------------------------------------------------------------
+void DofGroupNorms::addResidual( double resid )
+{
+    residSumSq += resid*resid;
+    residMaxAbs = std::max(residMaxAbs, std::fabs(resid));
+}
+// ----------------------------------------------------------------------------------------
+void DofGroupNorms::merge( const DofGroupNorms& other )
+{
+    corrSumSq += other.corrSumSq;
+    corrMaxAbs = std::max(corrMaxAbs, other.corrMaxAbs);
+    incSumSq += other.incSumSq;
+    incMaxAbs = std::max(incMaxAbs, other.incMaxAbs);
+    residSumSq += other.residSumSq;
+    residMaxAbs = std::max(residMaxAbs, other.residMaxAbs);
+    dofCount += other.dofCount;
+}
+
+// Public methods
+// ----------------------------------------------------------------------------------------
+bool ConvergenceCriterion::checkConvergenceOf( const RealVector& resid, const std::vector<Dof*>& dof )
+{
+    int nThreads = 1;
+#ifdef _OPENMP
+    nThreads = omp_get_max_threads();
+#endif
+    std::vector<PaddedDofGroupNorms> threadNorms(nThreads);
+    
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        int threadNum = 0;
+#ifdef _OPENMP
+        threadNum = omp_get_thread_num();
+#endif
+        DofGroupNorms& norms = threadNorms[threadNum].norms;
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for ( int i = 0; i < (int)dof.size(); i++ )
+        {
+            if ( analysisModel().dofManager().giveGroupNumberFor(dof[i]) == _dofGrpNum )
+            {
+                int eqNo = analysisModel().dofManager().giveEquationNumberAt(dof[i]);
+                double corrVal = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof[i], correction);
+                double incVal = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof[i], incremental_value);
+                
+                norms.addCorrection(corrVal, incVal);
+                norms.addResidual(resid(eqNo));
+            }
+        }
+    }
+    
+    for ( int i = 1; i < nThreads; i++ )
+        threadNorms[0].norms.merge(threadNorms[i].norms);
+    
+    return this->checkConvergenceOf(threadNorms[0].norms);
+}
@@ -33,13 +33,39 @@ namespace broomstyx
 {
     class Dof;
     
+    // Norm data for a single DOF group, accumulated in one pass over the
+    // active DOFs. Sums of squares and maximum absolute values are both kept
+    // so that any criterion can be evaluated from the same data.
+    struct DofGroupNorms
+    {
+        double corrSumSq   = 0.;
+        double corrMaxAbs  = 0.;
+        double incSumSq    = 0.;
+        double incMaxAbs   = 0.;
+        double residSumSq  = 0.;
+        double residMaxAbs = 0.;
+        double dofCount    = 0.;
+        
+        void addCorrection( double corr, double inc );
+        void addResidual( double resid );
+        void merge( const DofGroupNorms& other );
+    };
+    
+    // Thread-local accumulator padded to a full cache line to avoid false
+    // sharing between threads
+    struct alignas(64) PaddedDofGroupNorms
+    {
+        DofGroupNorms norms;
+    };
+    
     class ConvergenceCriterion
     {
     public:
         ConvergenceCriterion() {}
         virtual ~ConvergenceCriterion() {}
 
-        virtual bool checkConvergenceOf( const RealVector& resid, const std::vector<Dof*>& dof ) = 0;
+        bool         checkConvergenceOf( const RealVector& resid, const std::vector<Dof*>& dof );
+        virtual bool checkConvergenceOf( const DofGroupNorms& norms ) = 0;
         virtual RealMatrix giveConvergenceData() = 0;
         virtual void initialize( int dofGrpNum ) = 0;
         virtual void processLocalResidualContribution( double contrib, int threadNum ) = 0;
@@ -51,6 +77,14 @@ namespace broomstyx
     protected:
         std::string _name;
         int _dofGrpNum;
+        
+        // Per-thread residual contributions gathered during assembly,
+        // padded to a full cache line to avoid false sharing
+        struct alignas(64) ResidualContribution
+        {
+            double crit  = 0.;
+            double count = 0.;
+        };
     };
 }
 
@@ -44,73 +44,24 @@ L2_L1::~L2_L1() {}
 
 // Public methods
 // ----------------------------------------------------------------------------------------
-bool L2_L1::checkConvergenceOf( const RealVector& resid, const std::vector<Dof*>& dof )
+bool L2_L1::checkConvergenceOf( const DofGroupNorms& norms )
 {
     std::chrono::time_point<std::chrono::system_clock> tic, toc;
     std::chrono::duration<double> tictoc;
     tic = std::chrono::high_resolution_clock::now();
 
-    _threadCorrCrit.init(_nThreads);
-    _threadCorrNorm.init(_nThreads);
-    _threadResidNorm.init(_nThreads);
-    _threadDofCount.init(_nThreads);
-
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-    {
-        int threadNum = 0;
-#ifdef _OPENMP
-        threadNum = omp_get_thread_num();
-#endif
-
-#ifdef _OPENMP
-#pragma omp for
-#endif
-        for ( int i = 0; i < (int)dof.size(); i++ )
-        {
-            // Find group number of DOF
-            int grpNum = analysisModel().dofManager().giveGroupNumberFor(dof[i]);
-            
-            if ( grpNum == _dofGrpNum )
-            {
-                // Find equation number of DOF
-                int eqNo = analysisModel().dofManager().giveEquationNumberAt(dof[i]);
-
-                // Contribution to L2-norm of corrections
-                double corrVal = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof[i], correction);
-                _threadCorrNorm(threadNum) += corrVal*corrVal;
-
-                // Contribution to L2-norm of incremental solution
-                double incVal = analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof[i], incremental_value);
-                _threadCorrCrit(threadNum) += incVal*incVal;
-                
-                // Contribution to L2-norm of residual
-                double rVal = resid(eqNo);
-                _threadResidNorm(threadNum) += rVal*rVal;
-
-                // Increase DOF count
-                _threadDofCount(threadNum) += 1.;
-            }
-        }
-    }
-
-    // Accumulate values from different threads
-    _corrNorm = 0.;
-    _corrCrit = 0.;
-    _residNorm = 0.;
+    // Accumulate residual contributions from different threads
+    _corrNorm = norms.corrSumSq;
+    _corrCrit = norms.incSumSq;
+    _residNorm = norms.residSumSq;
     _residCrit = 0.;
-    _dofCount = 0.;
+    _dofCount = norms.dofCount;
     _contribCount = 0.;
 
     for ( int i = 0; i < _nThreads; i++ )
     {
-        _corrNorm += _threadCorrNorm(i);
-        _corrCrit += _threadCorrCrit(i);
-        _residNorm += _threadResidNorm(i);
-        _residCrit += _threadResidCrit(i);
-        _dofCount += _threadDofCount(i);
-        _contribCount += _threadContribCount(i);
+        _residCrit += _threadResid[i].crit;
+        _contribCount += _threadResid[i].count;
     }
     if ( _contribCount < 1.0 )
         _contribCount = 1.0;
@@ -188,8 +139,8 @@ void L2_L1::processLocalResidualContribution( double contrib, int threadNum )
     double val = std::fabs(contrib);
     if ( val > _absTolRes )
     {
-        _threadResidCrit(threadNum) += val;
-        _threadContribCount(threadNum) += 1.;
+        _threadResid[threadNum].crit += val;
+        _threadResid[threadNum].count += 1.;
     }
 }
 // ----------------------------------------------------------------------------------------
@@ -200,8 +151,8 @@ void L2_L1::processLocalResidualContribution( const RealVector& contrib, const s
         double val = std::fabs(contrib(i));
         if ( dofGrp[i] == _dofGrpNum && val > _absTolRes )
         {
-            _threadResidCrit(threadNum) += val;
-            _threadContribCount(threadNum) += 1.;
+            _threadResid[threadNum].crit += val;
+            _threadResid[threadNum].count += 1.;
         }
     }
 }
@@ -253,6 +204,5 @@ void L2_L1::reportConvergenceStatus()
 // ----------------------------------------------------------------------------------------
 void L2_L1::resetResidualCriteria()
 {
-    _threadContribCount.init(_nThreads);
-    _threadResidCrit.init(_nThreads);
+    _threadResid.assign(_nThreads, ResidualContribution());
 }
@@ -35,7 +35,7 @@ namespace broomstyx
         LInf();
         virtual ~LInf();
 
-        bool checkConvergenceOf( const RealVector& resid, const std::vector<Dof*>& dof ) override;
+        bool checkConvergenceOf( const DofGroupNorms& norms ) override;
         RealMatrix giveConvergenceData() override;
         void initialize( int dofGrpNum ) override;
         void processLocalResidualContribution( double contrib, int threadNum ) override;
@@ -60,11 +60,7 @@ namespace broomstyx
         double _residNorm;
         double _residCrit;
         
-        RealVector _threadContribCount;
-        RealVector _threadCorrCrit;
-        RealVector _threadCorrNorm;
-        RealVector _threadResidCrit;
-        RealVector _threadResidNorm;
+        std::vector<ResidualContribution> _threadResid;
     };
 }
 
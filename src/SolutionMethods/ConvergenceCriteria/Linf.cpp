@@ -44,73 +44,22 @@ LInf::~LInf() {}
 
 // Public methods
 // ----------------------------------------------------------------------------------------
-bool LInf::checkConvergenceOf( const RealVector& resid, const std::vector<Dof*>& dof )
+bool LInf::checkConvergenceOf( const DofGroupNorms& norms )
 {
     std::chrono::time_point<std::chrono::system_clock> tic, toc;
     std::chrono::duration<double> tictoc;
     tic = std::chrono::high_resolution_clock::now();
 
-    _threadCorrCrit.init(_nThreads);
-    _threadCorrNorm.init(_nThreads);
-    _threadResidNorm.init(_nThreads);
-
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-    {
-        int threadNum = 0;
-#ifdef _OPENMP
-        threadNum = omp_get_thread_num();
-#endif
-
-#ifdef _OPENMP
-#pragma omp for
-#endif
-        for ( int i = 0; i < (int)dof.size(); i++ )
-        {
-            // Find group number of DOF
-            int grpNum = analysisModel().dofManager().giveGroupNumberFor(dof[i]);
-            // int grpIdx = this->giveIndexForDofGroup(grpNum);
-            
-            if ( grpNum == _dofGrpNum )
-            {
-                // Find equation number of DOF
-                int eqNo = analysisModel().dofManager().giveEquationNumberAt(dof[i]);
-
-                // Contribution to L2-norm of corrections
-                double corrVal = std::fabs(analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof[i], correction));
-                if ( corrVal > _threadCorrNorm(threadNum) )
-                    _threadCorrNorm(threadNum) = corrVal;
-
-                // Contribution to L2-norm of incremental solution
-                double incVal = std::fabs(analysisModel().dofManager().giveValueOfPrimaryVariableAt(dof[i], incremental_value));
-                if ( incVal > _threadCorrCrit(threadNum) )
-                    _threadCorrCrit(threadNum) = incVal;
-                
-                // Contribution to L2-norm of residual
-                double rVal = std::fabs(resid(eqNo));
-                if ( rVal > _threadResidNorm(threadNum) )
-                    _threadResidNorm(threadNum) = rVal;
-            }
-        }
-    }
-
-    // Accumulate values from different threads
-    _corrNorm = 0.;
-    _corrCrit = 0.;
-    _residNorm = 0.;
+    // Accumulate residual contributions from different threads
+    _corrNorm = norms.corrMaxAbs;
+    _corrCrit = norms.incMaxAbs;
+    _residNorm = norms.residMaxAbs;
     _residCrit = 0.;
 
     for ( int i = 0; i < _nThreads; i++ )
     {
-        if ( _corrNorm < _threadCorrNorm(i) )
-            _corrNorm = _threadCorrNorm(i);
-        if ( _corrCrit < _threadCorrCrit(i) )
-            _corrCrit = _threadCorrCrit(i);
-        if ( _residNorm < _threadResidNorm(i) )
-            _residNorm = _threadResidNorm(i);
-        if ( _residCrit < _threadResidCrit(i) )
-            _residCrit = _threadResidCrit(i);
+        if ( _residCrit < _threadResid[i].crit )
+            _residCrit = _threadResid[i].crit;
     }
 
     // Apply relative tolerances
@@ -178,8 +127,8 @@ void LInf::initialize( int dofGrpNum )
 void LInf::processLocalResidualContribution( double contrib, int threadNum )
 {
     double val = std::fabs(contrib);
-    if ( val > _absTolRes && val > _threadResidCrit(threadNum) )
-        _threadResidCrit(threadNum) = val;
+    if ( val > _absTolRes && val > _threadResid[threadNum].crit )
+        _threadResid[threadNum].crit = val;
 }
 // ----------------------------------------------------------------------------------------
 void LInf::processLocalResidualContribution( const RealVector& contrib, const std::vector<int>& dofGrp, int threadNum )
@@ -189,8 +138,8 @@ void LInf::processLocalResidualContribution( const RealVector& contrib, const st
         double val = std::fabs(contrib(i));
         if ( dofGrp[i] == _dofGrpNum && val > _absTolRes )
         {
-            if ( val > _threadResidCrit(threadNum) )
-                _threadResidCrit(threadNum) = val;
+            if ( val > _threadResid[threadNum].crit )
+                _threadResid[threadNum].crit = val;
         }
     }
 }
@@ -242,6 +191,5 @@ void LInf::reportConvergenceStatus()
 // ----------------------------------------------------------------------------------------
 void LInf::resetResidualCriteria()
 {
-    _threadContribCount.init(_nThreads );
-    _threadResidCrit.init(_nThreads );
+    _threadResid.assign(_nThreads, ResidualContribution());
 }
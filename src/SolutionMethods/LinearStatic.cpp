@@ -22,12 +22,15 @@
 */
 
 #include "LinearStatic.hpp"
+#include <algorithm>
 #include <chrono>
 #include <omp.h>
 #include <stdexcept>
 #include <tuple>
+#include <unordered_map>
 
 #include "Core/AnalysisModel.hpp"
+#include "Core/Communicator.hpp"
 #include "Core/ObjectFactory.hpp"
 #include "Core/Diagnostics.hpp"
 #include "Core/DofManager.hpp"
@@ -47,6 +50,10 @@ registerBroomstyxObject(SolutionMethod, LinearStatic)
 
 // Constructor
 LinearStatic::LinearStatic()
+    : _isDistributed(communicator().isDistributed())
+    , _rowBegin(0)
+    , _rowEnd(0)
+    , _cacheElementMatrices(false)
 {
     _name = "LinearStatic";
 }
@@ -106,6 +113,7 @@ int LinearStatic::computeSolutionFor( int stage
     if ( _solver->takesInitialGuess() )
         _solver->setInitialGuessTo(sysU);
     sysU = _solver->solve(_spMatrix, sysRHS);
+    
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
     std::printf("done (time = %f sec.)\n", tictoc.count());
@@ -115,15 +123,21 @@ int LinearStatic::computeSolutionFor( int stage
     std::printf("    %-40s", "Updating DOF values ...");
     tic = std::chrono::high_resolution_clock::now();
 
-    std::vector<Dof*> dof = analysisModel().dofManager().giveActiveDofsAtStage(stage);
+    // Each process holds the solution only at its own equations
+    if ( _isDistributed )
+        this->exchangePrimaryVariables(sysU);
+    else
+    {
+        std::vector<Dof*> dof = analysisModel().dofManager().giveActiveDofsAtStage(stage);
 
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-    for ( int i = 0; i < (int)dof.size(); i++ )
-    {
-        int eqNo = analysisModel().dofManager().giveEquationNumberAt(dof[i]);
-        analysisModel().dofManager().updatePrimaryVariableAt(dof[i], sysU(eqNo), current_value);
+        for ( int i = 0; i < (int)dof.size(); i++ )
+        {
+            int eqNo = analysisModel().dofManager().giveEquationNumberAt(dof[i]);
+            analysisModel().dofManager().updatePrimaryVariableAt(dof[i], sysU(eqNo), current_value);
+        }
     }
 
     toc = std::chrono::high_resolution_clock::now();
@@ -134,6 +148,11 @@ int LinearStatic::computeSolutionFor( int stage
     // Assemble left hand side to get correct values of secondary variables
     tic = std::chrono::high_resolution_clock::now();
     this->assembleLeftHandSide(stage, time);
+    if ( _isDistributed )
+    {
+        this->exchangeSecondaryVariables();
+        this->gatherDofValuesOnRoot();
+    }
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
     diagnostics().addUpdateTime(tictoc.count());
@@ -141,8 +160,60 @@ int LinearStatic::computeSolutionFor( int stage
     return 0;
 }
 // ---------------------------------------------------------------------------
+int LinearStatic::computeSolutionsForLoadCases( int stage
+                                              , const std::vector<std::vector<BoundaryCondition>>& bndCond
+                                              , const std::vector<std::vector<FieldCondition>>& fldCond
+                                              , TimeData& time )
+{
+    if ( _isDistributed )
+        throw std::runtime_error("Multiple load cases are not supported in distributed execution!\nSource: " + _name);
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    int nLoadCases = bndCond.size();
+    std::printf("    Load cases = %d\n", nLoadCases);
+
+    // Clear values of secondary variables at DOFs
+    analysisModel().dofManager().resetSecondaryVariablesAtStage(stage);
+    
+    // Initialize global coefficient matrix
+    _spMatrix->initializeValues();
+    
+    // Initialize global right hand sides, one column per load case
+    int nUnknowns;
+    std::tie(nUnknowns, std::ignore) = _spMatrix->giveMatrixDimensions();
+    RealMatrix sysRHS(nUnknowns, nLoadCases);
+    
+    // Assemble coefficient matrix once and right hand sides for all load cases
+    std::printf("    %-40s", "Assembling equations ...");
+    tic = std::chrono::high_resolution_clock::now();
+    this->assembleEquationsForLoadCases(stage, bndCond, fldCond, time, sysRHS);
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+    
+    // Solve system for all right hand sides with a single factorization
+    std::printf("    %-40s", "Solving system ...");
+    tic = std::chrono::high_resolution_clock::now();
+    _solver->allocateInternalMemoryFor(_spMatrix);
+    _loadCaseSolution = _solver->solveForMultipleRhs(_spMatrix, sysRHS);
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+    diagnostics().addSolveTime(tictoc.count());
+    
+    return 0;
+}
+// ---------------------------------------------------------------------------
 void LinearStatic::formSparsityProfileForStage( int stage )
 {
+    if ( _isDistributed )
+    {
+        this->formDistributedSparsityProfileForStage(stage);
+        return;
+    }
+    
     std::chrono::time_point<std::chrono::system_clock> tic, toc;
     std::chrono::duration<double> tictoc;
 
@@ -168,40 +239,59 @@ void LinearStatic::formSparsityProfileForStage( int stage )
 
     // Get sparse matrix size
     int nvar = analysisModel().dofManager().giveNumberOfActiveDofsAtStage(stage);
+    _rowBegin = 0;
+    _rowEnd = nvar;
 
     _spMatrix->initializeProfile(nvar, nvar);
     _spMatrix->setSymmetryTo(_solver->giveSymmetryOption());
 
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    // Cells are assembled in blocks following the mesh partitions. Rows
+    // reached by more than one block are identified along with the
+    // sparsity pattern.
+    _blockAssembly.formBlocksFrom(analysisModel().domainManager().giveDomainCellsOrderedByPartition());
+    _blockAssembly.initializeRowOwnership(nvar);
+    int nBlocks = _blockAssembly.giveNumberOfBlocks();
+    
+    // Cache slots follow the assembly order of cells
+    if ( _cacheElementMatrices )
+        _elMatCache.initializeSlots(analysisModel().domainManager().giveNumberOfDomainCells());
 
-    for ( int i = 0; i < nCells; i++ )
+    for ( int iBlock = 0; iBlock < nBlocks; iBlock++ )
     {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
-        int label = analysisModel().domainManager().giveLabelOf(curCell);
-        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
+        for ( Cell* curCell : _blockAssembly.giveCellsOfBlock(iBlock) )
+        {
+            int label = analysisModel().domainManager().giveLabelOf(curCell);
+            Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
 
-        // Dummy variables
-        TimeData dummyTime;
+            // Dummy variables
+            TimeData dummyTime;
 
-        std::vector<Dof*> rowDof, colDof;
-        std::tie(rowDof,colDof,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage,UNASSIGNED,dummyTime);
+            std::vector<Dof*> rowDof, colDof;
+            std::tie(rowDof,colDof,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage,UNASSIGNED,dummyTime);
 
-        int lnnz = rowDof.size();
+            int lnnz = rowDof.size();
+            if ( _cacheElementMatrices )
+                _elMatCache.reserveSlotFor(curCell, lnnz);
 
-        for ( int j = 0; j < lnnz; j++ )
-        {
-            if ( rowDof[j] && colDof[j] )
+            for ( int j = 0; j < lnnz; j++ )
             {
-                int rowNum, colNum;
-                rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
-                colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[j]);
-                if ( rowNum != UNASSIGNED && colNum != UNASSIGNED )
-                    _spMatrix->insertNonzeroComponentAt(rowNum, colNum);
+                if ( rowDof[j] && colDof[j] )
+                {
+                    int rowNum, colNum;
+                    rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
+                    colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[j]);
+                    if ( rowNum != UNASSIGNED )
+                        _blockAssembly.registerRowOfBlock(rowNum, iBlock);
+                    if ( rowNum != UNASSIGNED && colNum != UNASSIGNED )
+                        _spMatrix->insertNonzeroComponentAt(rowNum, colNum);
+                }
             }
         }
     }
 
     _spMatrix->finalizeProfile();
+    if ( _cacheElementMatrices )
+        _elMatCache.allocatePool();
     
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
@@ -211,7 +301,8 @@ void LinearStatic::formSparsityProfileForStage( int stage )
     int nnz = _spMatrix->giveNumberOfNonzeros();
     double spratio = (double)nnz/((double)nvar*(double)nvar);
     std::printf("\n    Stage %-2d: nUnknowns = %d, nnz = %d", stage, nvar, nnz);
-    std::printf("\n         Sparsity ratio = %.4e\n", spratio);
+    std::printf("\n         Sparsity ratio = %.4e", spratio);
+    std::printf("\n         Assembly blocks = %d, interface rows = %d\n", nBlocks, _blockAssembly.giveNumberOfInterfaceRows());
 }
 // ---------------------------------------------------------------------------
 void LinearStatic::initializeSolvers()
@@ -223,7 +314,15 @@ void LinearStatic::readDataFromFile( FILE* fp )
 {
     std::string key;
 
-    verifyKeyword(fp, key = "LinearSolver", _name);
+    // Optional reuse of element matrices, followed by linear solver
+    key = getStringInputFrom(fp, "Failed to read keyword from input file!", _name);
+    if ( key == "ElementMatrixCache" )
+    {
+        _cacheElementMatrices = true;
+        key = getStringInputFrom(fp, "Failed to read keyword from input file!", _name);
+    }
+    if ( key != "LinearSolver" )
+        throw std::runtime_error("Keyword 'LinearSolver' expected in input file,\n\tstring '" + key + "' found.\nError source: " + _name);
     key = getStringInputFrom(fp, "Failed to read linear solver from input file!", _name);
     _solver = objectFactory().instantiateLinearSolver(key);
     _solver->readDataFrom(fp);
@@ -231,7 +330,54 @@ void LinearStatic::readDataFromFile( FILE* fp )
     // Initialize sparse matrix
     _spMatrix = objectFactory().instantiateSparseMatrix(_solver->giveRequiredMatrixFormat());
 }
+// ---------------------------------------------------------------------------
+bool LinearStatic::supportsDistributedExecution()
+{
+    return true;
+}
+// ---------------------------------------------------------------------------
+bool LinearStatic::supportsLoadCases()
+{
+    return true;
+}
+// ---------------------------------------------------------------------------
+void LinearStatic::retrieveSolutionForLoadCase( int loadCase
+                                              , int stage
+                                              , const std::vector<BoundaryCondition>& bndCond
+                                              , const std::vector<FieldCondition>& fldCond
+                                              , TimeData& time )
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    // Restore prescribed values and secondary variables from natural boundary
+    // conditions and source terms of the load case
+    tic = std::chrono::high_resolution_clock::now();
+    analysisModel().dofManager().resetSecondaryVariablesAtStage(stage);
+    this->imposeConstraintsAt(stage, bndCond, time);
+    
+    RealVector dummyRhs(_loadCaseSolution.dim1());
+    this->assembleRightHandSide(stage, bndCond, fldCond, time, dummyRhs);
+    
+    // Update DOF values
+    std::vector<Dof*> dof = analysisModel().dofManager().giveActiveDofsAtStage(stage);
+    double* sysU = _loadCaseSolution.ptr() + (long)loadCase*_loadCaseSolution.dim1();
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int i = 0; i < (int)dof.size(); i++ )
+    {
+        int eqNo = analysisModel().dofManager().giveEquationNumberAt(dof[i]);
+        analysisModel().dofManager().updatePrimaryVariableAt(dof[i], sysU[eqNo], current_value);
+    }
 
+    // Assemble left hand side to get correct values of secondary variables
+    this->assembleLeftHandSide(stage, time);
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addUpdateTime(tictoc.count());
+}
 // Private methods
 // -----------------------------------------------------------------------------
 void LinearStatic::assembleEquations( int stage
@@ -243,7 +389,143 @@ void LinearStatic::assembleEquations( int stage
     std::chrono::time_point<std::chrono::system_clock> tic, toc;
     std::chrono::duration<double> tictoc;
     
+    _spMatrix->setEvaluationContextTo(stage, UNASSIGNED, time);
+    tic = std::chrono::high_resolution_clock::now();
+
+    // Each thread assembles a range of blocks of cells. Interior rows of a
+    // block are written directly, while contributions to interface rows are
+    // buffered and merged when the thread is done.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        int threadNum = 0, nThreads = 1;
+#ifdef _OPENMP
+        threadNum = omp_get_thread_num();
+        nThreads = omp_get_num_threads();
+#endif
+        int firstBlock, endBlock;
+        std::tie(firstBlock, endBlock) = _blockAssembly.giveBlockRangeOfThread(threadNum, nThreads);
+        
+        AssemblyBuffer buffer;
+        CoefficientMatrixBatch batch;
+        for ( int iBlock = firstBlock; iBlock < endBlock; iBlock++ )
+        {
+            _blockAssembly.startTimingOf(iBlock);
+            int firstBatch, endBatch;
+            std::tie(firstBatch, endBatch) = _blockAssembly.giveBatchRangeOfBlock(iBlock);
+            for ( int iBatch = firstBatch; iBatch < endBatch; iBatch++ )
+            {
+                // Calculate local coefficient matrices of all cells in batch
+                batch.clear();
+                Numerics* numerics = _blockAssembly.giveNumericsOfBatch(iBatch);
+                if ( _cacheElementMatrices )
+                    _elMatCache.giveCoefficientMatricesAt(_blockAssembly.giveCellsOfBatch(iBatch), numerics, stage, UNASSIGNED, time, batch);
+                else
+                    numerics->giveStaticCoefficientMatricesAt(_blockAssembly.giveCellsOfBatch(iBatch), stage, UNASSIGNED, time, batch);
+                
+                std::vector<Dof*>& rowDof = batch.rowDof;
+                std::vector<Dof*>& colDof = batch.colDof;
+                std::vector<double>& coefVal = batch.coefVal;
+                int lnnz = rowDof.size();
+
+                for ( int j = 0; j < lnnz; j++)
+                {
+                    if ( rowDof[j] && colDof[j] )
+                    {
+                        int rowNum, colNum;
+                        rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
+                        colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[j]);
+                        
+                        // Rows owned by other processes are assembled there
+                        if ( rowNum < _rowBegin || rowNum >= _rowEnd )
+                            continue;
+                        
+                        bool isInteriorRow = _blockAssembly.ownsRow(iBlock, rowNum);
+
+                        // Assembly to global coefficient matrix
+                        if ( colNum != UNASSIGNED )
+                        {
+                            if ( isInteriorRow )
+                                _spMatrix->addToComponent(rowNum, colNum, coefVal[j]);
+                            else
+                                buffer.addToMatrixComponent(rowNum, colNum, coefVal[j]);
+                        }
+                        else
+                        {
+                            // Right hand side contribution arising from constraints
+                            double fmatVal = coefVal[j]*analysisModel().dofManager().giveValueOfConstraintAt(colDof[j], current_value);
+                            if ( isInteriorRow )
+                                rhs(rowNum) -= fmatVal;
+                            else
+                                buffer.addToVectorComponent(rowNum, -fmatVal);
+                        }
+                    }
+                }
+            }
+            _blockAssembly.stopTimingOf(iBlock);
+        }
+        buffer.mergeInto(_spMatrix);
+        buffer.mergeInto(rhs);
+    }
+    _blockAssembly.finishAssemblyPass();
+    if ( _cacheElementMatrices )
+        _elMatCache.reportAccesses();
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addCoefMatAssemblyTime(tictoc.count());
+
+    // Assemble right hand side contribution of natural boundary conditions
+    // and source/sink terms
+    tic = std::chrono::high_resolution_clock::now();
+    this->assembleRightHandSide(stage, bndCond, fldCond, time, rhs);
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addRhsAssemblyTime(tictoc.count());
+}
+// ---------------------------------------------------------------------------
+void LinearStatic::assembleEquationsForLoadCases( int stage
+                                                , const std::vector<std::vector<BoundaryCondition>>& bndCond
+                                                , const std::vector<std::vector<FieldCondition>>& fldCond
+                                                , const TimeData& time
+                                                , RealMatrix& rhs )
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    int nLoadCases = rhs.dim2();
+    int nUnknowns = rhs.dim1();
+    
+    // Record prescribed values at constrained DOFs for each load case, so
+    // that the right hand side contributions arising from constraints can be
+    // assembled for all load cases from a single pass over the cells
+    tic = std::chrono::high_resolution_clock::now();
+    std::vector<Dof*> cDof = analysisModel().dofManager().giveInactiveDofsAtStage(stage);
+    int nConstrained = cDof.size();
+    
+    std::unordered_map<Dof*, int> cDofIdx;
+    cDofIdx.reserve(nConstrained);
+    for ( int i = 0; i < nConstrained; i++ )
+        cDofIdx.insert({cDof[i], i});
+    
+    std::vector<double> cDofVal((long)nConstrained*nLoadCases, 0.);
+    for ( int k = 0; k < nLoadCases; k++ )
+    {
+        this->imposeConstraintsAt(stage, bndCond[k], time);
+        
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int i = 0; i < nConstrained; i++ )
+            cDofVal[(long)k*nConstrained + i] = analysisModel().dofManager().giveValueOfConstraintAt(cDof[i], current_value);
+    }
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addSetupTime(tictoc.count());
+    
     int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    double* rhsPtr = rhs.ptr();
+    _spMatrix->setEvaluationContextTo(stage, UNASSIGNED, time);
     tic = std::chrono::high_resolution_clock::now();
 
 #ifdef _OPENMP
@@ -274,14 +556,23 @@ void LinearStatic::assembleEquations( int stage
                 if ( rowNum != UNASSIGNED && colNum != UNASSIGNED )
                     _spMatrix->atomicAddToComponent(rowNum, colNum, coefVal(j));
 
-                // Right hand side contribution arising from constraints
+                // Right hand side contributions arising from constraints
                 if ( colNum == UNASSIGNED && rowNum != UNASSIGNED )
                 {
-                    double fmatVal = coefVal(j)*analysisModel().dofManager().giveValueOfConstraintAt(colDof[j], current_value);
+                    auto it = cDofIdx.find(colDof[j]);
+                    for ( int k = 0; k < nLoadCases; k++ )
+                    {
+                        double cVal;
+                        if ( it != cDofIdx.end() )
+                            cVal = cDofVal[(long)k*nConstrained + it->second];
+                        else
+                            cVal = analysisModel().dofManager().giveValueOfConstraintAt(colDof[j], current_value);
+                        
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-                    rhs(rowNum) -= fmatVal;
+                        rhsPtr[(long)k*nUnknowns + rowNum] -= coefVal(j)*cVal;
+                    }
                 }
             }
         }
@@ -290,10 +581,20 @@ void LinearStatic::assembleEquations( int stage
     tictoc = toc - tic;
     diagnostics().addCoefMatAssemblyTime(tictoc.count());
 
-    // Assemble right hand side contribution of natural boundary conditions
-    // and source/sink terms
+    // Assemble right hand side contributions of natural boundary conditions
+    // and source/sink terms for each load case
     tic = std::chrono::high_resolution_clock::now();
-    this->assembleRightHandSide(stage, bndCond, fldCond, time, rhs);
+    for ( int k = 0; k < nLoadCases; k++ )
+    {
+        RealVector caseRhs(nUnknowns);
+        this->assembleRightHandSide(stage, bndCond[k], fldCond[k], time, caseRhs);
+        
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int i = 0; i < nUnknowns; i++ )
+            rhsPtr[(long)k*nUnknowns + i] += caseRhs(i);
+    }
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
     diagnostics().addRhsAssemblyTime(tictoc.count());
@@ -301,14 +602,17 @@ void LinearStatic::assembleEquations( int stage
 // ---------------------------------------------------------------------------
 void LinearStatic::assembleLeftHandSide( int stage, const TimeData& time )
 {
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    int nCells = _isDistributed ? (int)_localCell.size() : analysisModel().domainManager().giveNumberOfDomainCells();
 
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
     for ( int iCell = 0; iCell < nCells; iCell++ )
     {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
+        Cell* curCell = _isDistributed ? _localCell[iCell] : analysisModel().domainManager().giveDomainCell(iCell);
+        if ( !this->ownsCell(curCell) )
+            continue;
+        
         Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
 
         std::vector<Dof*> rowDof;
@@ -328,42 +632,70 @@ void LinearStatic::assembleRightHandSide( int stage
                                         , RealVector& rhs )
 {
     // Loop through all field conditions
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
-
+    for ( int ifc = 0; ifc < (int)fldCond.size(); ifc++ )
+    {
+        // Contributions of field conditions with uniform values on domains
+        // with state-independent right hand sides are formed once and
+        // scaled by the current value
+        if ( _loadVectorCache.appliesTo(fldCond[ifc]) )
+        {
+            const CachedLoadVector& loadVector = _loadVectorCache.giveLoadVectorFor(fldCond[ifc], stage, time);
+            double fcVal = fldCond[ifc].uniformValueAt(time);
+            int nEntries = loadVector.dof.size();
+            
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-    for (int iCell = 0; iCell < nCells; iCell++)
-    {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
-        int label = analysisModel().domainManager().giveLabelOf(curCell);
+            for ( int i = 0; i < nEntries; i++ )
+            {
+                double localRhs = loadVector.baseVal[i] + fcVal*loadVector.unitVal[i];
+                int rowNum = analysisModel().dofManager().giveEquationNumberAt(loadVector.dof[i]);
+                if ( rowNum >= _rowBegin && rowNum < _rowEnd )
+                {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                    rhs(rowNum) += localRhs;
+                }
+                
+                if ( this->ownsCell(loadVector.cell[i]) )
+                    analysisModel().dofManager().addToSecondaryVariableAt(loadVector.dof[i], localRhs);
+            }
+            continue;
+        }
+        
+        int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond[ifc].domainLabel());
+        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(fcLabel);
+        ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(fcLabel);
+        int nCells = domCell.size();
 
-        for (int ifc = 0; ifc < (int)fldCond.size(); ifc++)
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int iCell = 0; iCell < nCells; iCell++ )
         {
-            int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond[ifc].domainLabel());
-            if ( label == fcLabel )
-            {
-                RealVector localRhs;
-                std::vector<Dof*> rowDof;
+            Cell* curCell = domCell[iCell];
 
-                Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
-                std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, fldCond[ifc], time);
+            RealVector localRhs;
+            std::vector<Dof*> rowDof;
 
-                for ( int i = 0; i < localRhs.dim(); i++)
+            std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, fldCond[ifc], time);
+
+            for ( int i = 0; i < localRhs.dim(); i++)
+            {
+                if ( rowDof[i] )
                 {
-                    if ( rowDof[i] )
+                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+                    if ( rowNum >= _rowBegin && rowNum < _rowEnd )
                     {
-                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
-                        if ( rowNum != UNASSIGNED )
-                        {
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-                            rhs(rowNum) += localRhs(i);
-                        }
+                        rhs(rowNum) += localRhs(i);
+                    }
 
+                    if ( this->ownsCell(curCell) )
                         analysisModel().dofManager().addToSecondaryVariableAt( rowDof[i], localRhs(i));
-                    }
                 }
             }
         }
@@ -375,40 +707,369 @@ void LinearStatic::assembleRightHandSide( int stage
         int boundaryId = analysisModel().domainManager().givePhysicalEntityNumberFor(bndCond[ibc].boundaryName());
         Numerics* numerics = analysisModel().numericsManager().giveNumerics(bndCond[ibc].targetNumerics());
 
-        int nBCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
+        ArraySpan<Cell* const> bndCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(boundaryId);
+        int nBCells = bndCell.size();
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
         for ( int iCell = 0; iCell < nBCells; iCell++ )
         {
-            Cell* curCell = analysisModel().domainManager().giveBoundaryCell(iCell);
-            int label = analysisModel().domainManager().giveLabelOf(curCell);
+            Cell* curCell = bndCell[iCell];
 
-            if ( label == boundaryId )
-            {
-                RealVector localRhs;
-                std::vector<Dof*> rowDof;
+            RealVector localRhs;
+            std::vector<Dof*> rowDof;
 
-                // Specifics of boundary condition imposition are handled by numerics
-                std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, bndCond[ibc], time);
+            // Specifics of boundary condition imposition are handled by numerics
+            std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, bndCond[ibc], time);
 
-                for ( int i = 0; i < localRhs.dim(); i++)
+            for ( int i = 0; i < localRhs.dim(); i++)
+            {
+                if ( rowDof[i])
                 {
-                    if ( rowDof[i])
+                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+                    if ( rowNum >= _rowBegin && rowNum < _rowEnd )
                     {
-                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
-                        if ( rowNum != UNASSIGNED )
-                        {
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-                            rhs(rowNum) += localRhs(i);
-                        }
+                        rhs(rowNum) += localRhs(i);
+                    }
 
+                    if ( this->ownsCell(curCell) )
                         analysisModel().dofManager().addToSecondaryVariableAt( rowDof[i], localRhs(i));
-                    }
                 }
             }                
         }
     }
 }
+// ---------------------------------------------------------------------------
+void LinearStatic::exchangePrimaryVariables( const RealVector& sysU )
+{
+    // The solver gives values at the equations owned by this process, which
+    // correspond to the first values it owns
+    int rank = communicator().giveRank();
+    int nOwnedEqs = _rowEnd - _rowBegin;
+    
+    RealVector val(_valOffset.back());
+    for ( int i = 0; i < nOwnedEqs; i++ )
+    {
+        val(_valOffset[rank] + i) = sysU(_rowBegin + i);
+        analysisModel().dofManager().updatePrimaryVariableAt(_ownedDof[i], sysU(_rowBegin + i), current_value);
+    }
+    
+    // Values at ghost DOFs are received from their owners. Constrained DOFs
+    // already have their prescribed values on every process.
+    std::vector<double> ghostVal;
+    _dofHalo.exchange(val, ghostVal);
+    
+    for ( int i = 0; i < (int)_ghostDof.size(); i++ )
+    {
+        int owner = std::upper_bound(_valOffset.begin(), _valOffset.end(), _ghostIdx[i]) - _valOffset.begin() - 1;
+        if ( _ghostIdx[i] - _valOffset[owner] < _eqOffset[owner + 1] - _eqOffset[owner] )
+            analysisModel().dofManager().updatePrimaryVariableAt(_ghostDof[i], ghostVal[i], current_value);
+    }
+}
+// ---------------------------------------------------------------------------
+void LinearStatic::exchangeSecondaryVariables()
+{
+    // Each process holds the contributions of the cells it owns. Those at
+    // ghost DOFs are added to the values at their owners, which then send
+    // back the totals.
+    int rank = communicator().giveRank();
+    int nOwned = _ownedDof.size();
+    int nGhosts = _ghostDof.size();
+    
+    RealVector val(_valOffset.back());
+    for ( int i = 0; i < nOwned; i++ )
+        val(_valOffset[rank] + i) = analysisModel().dofManager().giveValueOfSecondaryVariableAt(_ownedDof[i]);
+    
+    std::vector<double> ghostVal(nGhosts);
+    for ( int i = 0; i < nGhosts; i++ )
+        ghostVal[i] = analysisModel().dofManager().giveValueOfSecondaryVariableAt(_ghostDof[i]);
+    
+    _dofHalo.accumulate(ghostVal, val);
+    for ( int i = 0; i < nOwned; i++ )
+    {
+        double curVal = analysisModel().dofManager().giveValueOfSecondaryVariableAt(_ownedDof[i]);
+        analysisModel().dofManager().addToSecondaryVariableAt(_ownedDof[i], val(_valOffset[rank] + i) - curVal);
+    }
+    
+    _dofHalo.exchange(val, ghostVal);
+    for ( int i = 0; i < nGhosts; i++ )
+    {
+        double curVal = analysisModel().dofManager().giveValueOfSecondaryVariableAt(_ghostDof[i]);
+        analysisModel().dofManager().addToSecondaryVariableAt(_ghostDof[i], ghostVal[i] - curVal);
+    }
+}
+// ---------------------------------------------------------------------------
+void LinearStatic::formDistributedSparsityProfileForStage( int stage )
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    int nProcesses = communicator().giveNumberOfProcesses();
+    int rank = communicator().giveRank();
+    int partNum = communicator().givePartitionOwnedByThisProcess();
+    if ( analysisModel().domainManager().giveNumberOfPartitions() != nProcesses + 1 )
+        throw std::runtime_error("Number of mesh partitions does not match number of processes!\nSource: " + _name);
+    
+    // Assign DOF equation numbers. DOFs follow the partitions of the cells
+    // they belong to: each is owned by the lowest ranked process among
+    // those whose partitions contain one of its cells. Every process derives
+    // the same layout from the replicated mesh, without communication.
+    std::printf("\n  %-40s", "Assigning DOF equation numbers ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+    
+    std::vector<Dof*> dof = analysisModel().dofManager().giveActiveDofsAtStage(stage);
+    int nvar = dof.size();
+    std::vector<Dof*> inactiveDof = analysisModel().dofManager().giveInactiveDofsAtStage(stage);
+    dof.insert(dof.end(), inactiveDof.begin(), inactiveDof.end());
+    int nDofs = dof.size();
+    
+    std::unordered_map<Dof*,int> dofIdx;
+    dofIdx.reserve(nDofs);
+    for ( int i = 0; i < nDofs; i++ )
+        dofIdx[dof[i]] = i;
+    
+    std::vector<int> owner(nDofs, nProcesses);
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    for ( int i = 0; i < nCells; i++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
+        int cellRank = communicator().giveRankOwningPartition(analysisModel().domainManager().givePartitionOf(curCell));
+        
+        for ( Dof* curDof : this->giveDofsAt(curCell) )
+        {
+            auto it = dofIdx.find(curDof);
+            if ( it != dofIdx.end() )
+                owner[it->second] = std::min(owner[it->second], cellRank);
+        }
+    }
+    
+    // DOFs not reached by any domain cell are kept by the root process
+    _eqOffset.assign(nProcesses + 1, 0);
+    _valOffset.assign(nProcesses + 1, 0);
+    for ( int i = 0; i < nDofs; i++ )
+    {
+        if ( owner[i] == nProcesses )
+            owner[i] = 0;
+        if ( i < nvar )
+            _eqOffset[owner[i] + 1] += 1;
+        _valOffset[owner[i] + 1] += 1;
+    }
+    for ( int i = 0; i < nProcesses; i++ )
+    {
+        _eqOffset[i + 1] += _eqOffset[i];
+        _valOffset[i + 1] += _valOffset[i];
+    }
+    
+    _rowBegin = _eqOffset[rank];
+    _rowEnd = _eqOffset[rank + 1];
+    
+    // Active DOFs precede constrained ones, so they take the first values
+    // owned by each process
+    std::vector<int> nextEq(_eqOffset.begin(), _eqOffset.end() - 1);
+    std::vector<int> nextVal(_valOffset.begin(), _valOffset.end() - 1);
+    std::vector<int> valIdx(nDofs);
+    
+    _ownedDof.assign(_valOffset[rank + 1] - _valOffset[rank], nullptr);
+    _rootDof.assign(communicator().isRoot() ? nDofs : 0, nullptr);
+    for ( int i = 0; i < nDofs; i++ )
+    {
+        if ( i < nvar )
+            analysisModel().dofManager().setEquationNumberFor(dof[i], nextEq[owner[i]]++);
+        
+        valIdx[i] = nextVal[owner[i]]++;
+        if ( owner[i] == rank )
+            _ownedDof[valIdx[i] - _valOffset[rank]] = dof[i];
+        if ( communicator().isRoot() )
+            _rootDof[valIdx[i]] = dof[i];
+    }
+    
+    // Every cell sharing a DOF owned by this process must be assembled here
+    for ( int i = 0; i < nCells; i++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
+        std::vector<int> halo = analysisModel().domainManager().giveHaloOf(curCell);
+        if ( analysisModel().domainManager().givePartitionOf(curCell) == partNum || std::count(halo.begin(), halo.end(), partNum) > 0 )
+            continue;
+        
+        for ( Dof* curDof : this->giveDofsAt(curCell) )
+        {
+            auto it = dofIdx.find(curDof);
+            if ( it != dofIdx.end() && owner[it->second] == rank )
+                throw std::runtime_error("Halo of partition " + std::to_string(partNum) 
+                        + " does not contain all cells contributing to its equations!\nSource: " + _name);
+        }
+    }
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)", tictoc.count());
+    
+    std::printf("\n  %-40s", "Determining sparsity pattern ...");
+    tic = std::chrono::high_resolution_clock::now();
+    
+    // Only cells of the partition and its halo contribute to owned rows
+    _localCell = analysisModel().domainManager().giveDomainCellsAndHaloOfPartition(partNum);
+    
+    _spMatrix->initializeProfile(nvar, nvar);
+    _spMatrix->setOwnedRowRangeTo(_rowBegin, _rowEnd);
+    _spMatrix->setSymmetryTo(_solver->giveSymmetryOption());
+    
+    _blockAssembly.formBlocksFrom(_localCell);
+    _blockAssembly.initializeRowOwnership(nvar);
+    int nBlocks = _blockAssembly.giveNumberOfBlocks();
+    
+    // Cache slots follow the assembly order of cells
+    if ( _cacheElementMatrices )
+        _elMatCache.initializeSlots(analysisModel().domainManager().giveNumberOfDomainCells());
+    
+    // DOFs reached by local cells, whose values are needed here
+    std::vector<char> isLocal(nDofs, 0);
+    TimeData dummyTime;
+    
+    for ( int iBlock = 0; iBlock < nBlocks; iBlock++ )
+    {
+        for ( Cell* curCell : _blockAssembly.giveCellsOfBlock(iBlock) )
+        {
+            Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+            
+            std::vector<Dof*> rowDof, colDof;
+            std::tie(rowDof,colDof,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, UNASSIGNED, dummyTime);
+            if ( _cacheElementMatrices )
+                _elMatCache.reserveSlotFor(curCell, rowDof.size());
+            
+            // Element matrices may also reach DOFs outside the nodes and
+            // the cell itself
+            std::vector<Dof*> cellDof = this->giveDofsAt(curCell);
+            cellDof.insert(cellDof.end(), rowDof.begin(), rowDof.end());
+            cellDof.insert(cellDof.end(), colDof.begin(), colDof.end());
+            for ( Dof* curDof : cellDof )
+            {
+                auto it = dofIdx.find(curDof);
+                if ( it != dofIdx.end() )
+                    isLocal[it->second] = 1;
+            }
+            
+            for ( int j = 0; j < (int)rowDof.size(); j++ )
+                if ( rowDof[j] && colDof[j] )
+                {
+                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
+                    int colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[j]);
+                    if ( rowNum >= _rowBegin && rowNum < _rowEnd )
+                    {
+                        _blockAssembly.registerRowOfBlock(rowNum, iBlock);
+                        if ( colNum != UNASSIGNED )
+                            _spMatrix->insertNonzeroComponentAt(rowNum, colNum);
+                    }
+                }
+        }
+    }
+    
+    // Natural boundary conditions on owned boundary cells also contribute
+    // to secondary variables
+    int nBndCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
+    for ( int i = 0; i < nBndCells; i++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveBoundaryCell(i);
+        if ( this->ownsCell(curCell) )
+            for ( Dof* curDof : this->giveDofsAt(curCell) )
+            {
+                auto it = dofIdx.find(curDof);
+                if ( it != dofIdx.end() )
+                    isLocal[it->second] = 1;
+            }
+    }
+    
+    _spMatrix->finalizeProfile();
+    if ( _cacheElementMatrices )
+        _elMatCache.allocatePool();
+    
+    // Values at local DOFs owned by other processes are exchanged with their
+    // owners, in ascending order of values
+    std::vector< std::pair<int,Dof*> > ghost;
+    for ( int i = 0; i < nDofs; i++ )
+        if ( isLocal[i] && owner[i] != rank )
+            ghost.emplace_back(valIdx[i], dof[i]);
+    std::sort(ghost.begin(), ghost.end());
+    
+    _ghostIdx.resize(ghost.size());
+    _ghostDof.resize(ghost.size());
+    for ( int i = 0; i < (int)ghost.size(); i++ )
+        std::tie(_ghostIdx[i], _ghostDof[i]) = ghost[i];
+    _dofHalo.initialize(_ghostIdx, _valOffset);
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+    
+    int nnz = (int)communicator().sumOverProcesses((double)_spMatrix->giveNumberOfNonzeros());
+    double spratio = (double)nnz/((double)nvar*(double)nvar);
+    std::printf("\n    Stage %-2d: nUnknowns = %d, nnz = %d, processes = %d", stage, nvar, nnz, nProcesses);
+    std::printf("\n         Sparsity ratio = %.4e", spratio);
+    std::printf("\n         Assembly blocks = %d, interface rows = %d, ghost DOFs = %d (root process)\n"
+               , nBlocks, _blockAssembly.giveNumberOfInterfaceRows(), (int)_ghostDof.size());
+}
+// ---------------------------------------------------------------------------
+void LinearStatic::gatherDofValuesOnRoot()
+{
+    // Output is written by the root process, which receives the primary
+    // variables at active DOFs and the secondary variables at all DOFs from
+    // their owners
+    int nOwnedEqs = _rowEnd - _rowBegin;
+    int nOwned = _ownedDof.size();
+    
+    std::vector<double> val(nOwnedEqs + nOwned);
+    for ( int i = 0; i < nOwnedEqs; i++ )
+        val[i] = analysisModel().dofManager().giveValueOfPrimaryVariableAt(_ownedDof[i], current_value);
+    for ( int i = 0; i < nOwned; i++ )
+        val[nOwnedEqs + i] = analysisModel().dofManager().giveValueOfSecondaryVariableAt(_ownedDof[i]);
+    
+    std::vector<double> gathered = communicator().gatherOnRoot(val);
+    if ( !communicator().isRoot() )
+        return;
+    
+    int pos = 0;
+    for ( int iProc = 0; iProc < communicator().giveNumberOfProcesses(); iProc++ )
+    {
+        Dof** procDof = _rootDof.data() + _valOffset[iProc];
+        int nProcEqs = _eqOffset[iProc + 1] - _eqOffset[iProc];
+        int nProcVals = _valOffset[iProc + 1] - _valOffset[iProc];
+        
+        for ( int i = 0; i < nProcEqs; i++ )
+            analysisModel().dofManager().updatePrimaryVariableAt(procDof[i], gathered[pos++], current_value);
+        
+        for ( int i = 0; i < nProcVals; i++ )
+        {
+            double curVal = analysisModel().dofManager().giveValueOfSecondaryVariableAt(procDof[i]);
+            analysisModel().dofManager().addToSecondaryVariableAt(procDof[i], gathered[pos++] - curVal);
+        }
+    }
+}
+// ---------------------------------------------------------------------------
+std::vector<Dof*> LinearStatic::giveDofsAt( Cell* targetCell )
+{
+    // Nodal DOFs of the cell followed by its own DOFs
+    std::vector<Dof*> cellDof;
+    for ( Node* curNode : analysisModel().domainManager().giveNodesOf(targetCell) )
+    {
+        std::vector<Dof*> nodalDof = analysisModel().domainManager().giveNodalDofsOf(curNode);
+        cellDof.insert(cellDof.end(), nodalDof.begin(), nodalDof.end());
+    }
+    
+    std::vector<Dof*> ownDof = analysisModel().domainManager().giveCellDofsOf(targetCell);
+    cellDof.insert(cellDof.end(), ownDof.begin(), ownDof.end());
+    
+    return cellDof;
+}
+// ---------------------------------------------------------------------------
+bool LinearStatic::ownsCell( Cell* targetCell )
+{
+    if ( !_isDistributed )
+        return true;
+    
+    int partNum = analysisModel().domainManager().givePartitionOf(targetCell);
+    return communicator().giveRankOwningPartition(partNum) == communicator().giveRank();
+}
@@ -25,9 +25,15 @@
 #define	LINEARSTATIC_HPP
 
 #include "SolutionMethod.hpp"
+#include "Core/BlockAssembly.hpp"
+#include "Core/ElementMatrixCache.hpp"
+#include "Core/HaloExchange.hpp"
+#include "Util/RealMatrix.hpp"
 
 namespace broomstyx
 {
+    class Cell;
+    class Dof;
     class LinearSolver;
     class SparseMatrix;
     
@@ -42,20 +48,71 @@ namespace broomstyx
                                , const std::vector<FieldCondition>& fldCond
                                , TimeData& time ) override;
         
+        int  computeSolutionsForLoadCases( int stage
+                                         , const std::vector<std::vector<BoundaryCondition>>& bndCond
+                                         , const std::vector<std::vector<FieldCondition>>& fldCond
+                                         , TimeData& time ) override;
+        
         void initializeSolvers() override;
         virtual void formSparsityProfileForStage( int stage ) override;
         void readDataFromFile( FILE* fp ) override;
+        bool supportsDistributedExecution() override;
+        bool supportsLoadCases() override;
+        
+        void retrieveSolutionForLoadCase( int loadCase
+                                        , int stage
+                                        , const std::vector<BoundaryCondition>& bndCond
+                                        , const std::vector<FieldCondition>& fldCond
+                                        , TimeData& time ) override;
 
     protected:
         LinearSolver* _solver;
         SparseMatrix* _spMatrix;
         
+        // Solutions for all load cases, stored column-wise
+        RealMatrix _loadCaseSolution;
+        
+        // Range of equations owned by the current process. In distributed
+        // execution, only the cells of its partition and of the partition
+        // halo are assembled by the process.
+        bool _isDistributed;
+        int  _rowBegin;
+        int  _rowEnd;
+        std::vector<Cell*> _localCell;
+        
+        // Distributed layout of all DOFs of the stage. DOF values are
+        // numbered contiguously per owning process, the active DOFs first
+        // and in the order of their equations. Values at DOFs of local cells
+        // that are owned by other processes (ghost DOFs) are exchanged with
+        // their owners only. The root process, which writes output, keeps
+        // all DOFs in the order of their values.
+        std::vector<int>  _eqOffset;
+        std::vector<int>  _valOffset;
+        std::vector<Dof*> _ownedDof;
+        std::vector<Dof*> _ghostDof;
+        std::vector<int>  _ghostIdx;
+        std::vector<Dof*> _rootDof;
+        HaloExchange      _dofHalo;
+        
+        // Blocks of cells assembled as separate tasks
+        BlockAssembly _blockAssembly;
+        
+        // Optional reuse of element matrices between assemblies
+        bool               _cacheElementMatrices;
+        ElementMatrixCache _elMatCache;
+        
         virtual void assembleEquations( int stage
                                       , const std::vector<BoundaryCondition>& bndCond
                                       , const std::vector<FieldCondition>& fldCond
                                       , const TimeData& time
                                       , RealVector& rhs );
 
+        void assembleEquationsForLoadCases( int stage
+                                          , const std::vector<std::vector<BoundaryCondition>>& bndCond
+                                          , const std::vector<std::vector<FieldCondition>>& fldCond
+                                          , const TimeData& time
+                                          , RealMatrix& rhs );
+        
         void assembleLeftHandSide( int stage, const TimeData& time );
         
         virtual void assembleRightHandSide( int stage
@@ -65,6 +122,13 @@ namespace broomstyx
                                           , RealVector& rhs );
         
         void debugPrintSystem( RealVector& rhs );
+        void exchangePrimaryVariables( const RealVector& sysU );
+        void exchangeSecondaryVariables();
+        void formDistributedSparsityProfileForStage( int stage );
+        void gatherDofValuesOnRoot();
+        std::vector<Dof*> 
+             giveDofsAt( Cell* targetCell );
+        bool ownsCell( Cell* targetCell );
     };    
 }
 
@@ -83,6 +83,8 @@ void LinearTransient::formSparsityProfileForStage( int stage )
 
     // Get sparse matrix size
     int nvar = analysisModel().dofManager().giveNumberOfActiveDofsAtStage(stage);
+    _rowBegin = 0;
+    _rowEnd = nvar;
 
     _spMatrix->initializeProfile(nvar, nvar);
     _spMatrix->setSymmetryTo(_solver->giveSymmetryOption());
@@ -144,6 +146,19 @@ void LinearTransient::formSparsityProfileForStage( int stage )
     std::printf("\n    Stage %-2d: nUnknowns = %d, nnz = %d", stage, nvar, nnz);
     std::printf("\n         Sparsity ratio = %.4e\n", spratio);
 }
+// ---------------------------------------------------------------------------
+bool LinearTransient::supportsDistributedExecution()
+{
+    // Mass and damping contributions are not yet assembled per partition
+    return false;
+}
+// ---------------------------------------------------------------------------
+bool LinearTransient::supportsLoadCases()
+{
+    // Load cases would each require their own history of DOF values, which
+    // the right hand sides assembled for load cases of LinearStatic omit
+    return false;
+}
 
 // Private methods
 // -----------------------------------------------------------------------------
@@ -296,39 +311,62 @@ void LinearTransient::assembleRightHandSide( int stage
                                            , RealVector& rhs )
 {
     // Loop through all field conditions
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
-
+    for ( int ifc = 0; ifc < (int)fldCond.size(); ifc++ )
+    {
+        // Contributions of field conditions with uniform values on domains
+        // with state-independent right hand sides are formed once and
+        // scaled by the current value
+        if ( _loadVectorCache.appliesTo(fldCond[ifc]) )
+        {
+            const CachedLoadVector& loadVector = _loadVectorCache.giveLoadVectorFor(fldCond[ifc], stage, time);
+            double fcVal = fldCond[ifc].uniformValueAt(time);
+            int nEntries = loadVector.dof.size();
+            
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-    for (int iCell = 0; iCell < nCells; iCell++)
-    {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
-        int label = analysisModel().domainManager().giveLabelOf(curCell);
+            for ( int i = 0; i < nEntries; i++ )
+            {
+                int rowNum = analysisModel().dofManager().giveEquationNumberAt(loadVector.dof[i]);
+                if ( rowNum != UNASSIGNED )
+                {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                    rhs(rowNum) += loadVector.baseVal[i] + fcVal*loadVector.unitVal[i];
+                }
+            }
+            continue;
+        }
+        
+        int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond[ifc].domainLabel());
+        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(fcLabel);
+        ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(fcLabel);
+        int nCells = domCell.size();
 
-        for (int ifc = 0; ifc < (int)fldCond.size(); ifc++)
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for ( int iCell = 0; iCell < nCells; iCell++ )
         {
-            int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond[ifc].domainLabel());
-            if ( label == fcLabel )
-            {
-                RealVector localRhs;
-                std::vector<Dof*> rowDof;
+            Cell* curCell = domCell[iCell];
+
+            RealVector localRhs;
+            std::vector<Dof*> rowDof;
 
-                Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
-                std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, fldCond[ifc], time);
+            std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, fldCond[ifc], time);
 
-                for ( int i = 0; i < localRhs.dim(); i++)
+            for ( int i = 0; i < localRhs.dim(); i++)
+            {
+                if ( rowDof[i] )
                 {
-                    if ( rowDof[i] )
+                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+                    if ( rowNum != UNASSIGNED )
                     {
-                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
-                        if ( rowNum != UNASSIGNED )
-                        {
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-                            rhs(rowNum) += localRhs(i);
-                        }
+                        rhs(rowNum) += localRhs(i);
                     }
                 }
             }
@@ -341,33 +379,30 @@ void LinearTransient::assembleRightHandSide( int stage
         int boundaryId = analysisModel().domainManager().givePhysicalEntityNumberFor(bndCond[ibc].boundaryName());
         Numerics* numerics = analysisModel().numericsManager().giveNumerics(bndCond[ibc].targetNumerics());
 
-        int nBCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
+        ArraySpan<Cell* const> bndCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(boundaryId);
+        int nBCells = bndCell.size();
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
         for ( int iCell = 0; iCell < nBCells; iCell++ )
         {
-            Cell* curCell = analysisModel().domainManager().giveBoundaryCell(iCell);
-            int label = analysisModel().domainManager().giveLabelOf(curCell);
+            Cell* curCell = bndCell[iCell];
 
-            if ( label == boundaryId )
-            {
-                RealVector localRhs;
-                std::vector<Dof*> rowDof;
+            RealVector localRhs;
+            std::vector<Dof*> rowDof;
 
-                // Specifics of boundary condition imposition are handled by numerics
-                std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, bndCond[ibc], time);
+            // Specifics of boundary condition imposition are handled by numerics
+            std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, bndCond[ibc], time);
 
-                for ( int i = 0; i < localRhs.dim(); i++)
+            for ( int i = 0; i < localRhs.dim(); i++)
+            {
+                int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+                if ( rowNum != UNASSIGNED )
                 {
-                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
-                    if ( rowNum != UNASSIGNED )
-                    {
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-                        rhs(rowNum) += localRhs(i);
-                    }
+                    rhs(rowNum) += localRhs(i);
                 }
             }                
         }
@@ -36,6 +36,8 @@ namespace broomstyx
         virtual ~LinearTransient();
 
         void formSparsityProfileForStage( int stage ) override;
+        bool supportsDistributedExecution() override;
+        bool supportsLoadCases() override;
         
     private:
         void assembleEquations( int stage
@@ -0,0 +1,377 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "LocalizedAlternateMinimization.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "Core/AnalysisModel.hpp"
+#include "Core/Cell.hpp"
+#include "Core/Diagnostics.hpp"
+#include "Core/DofManager.hpp"
+#include "Core/DomainManager.hpp"
+#include "Core/ObjectFactory.hpp"
+#include "LinearSolvers/LinearSolver.hpp"
+#include "Numerics/Numerics.hpp"
+#include "SparseMatrix/SparseMatrix.hpp"
+#include "Util/readOperations.hpp"
+
+using namespace broomstyx;
+
+registerBroomstyxObject(SolutionMethod, LocalizedAlternateMinimization)
+
+LocalizedAlternateMinimization::LocalizedAlternateMinimization()
+    : _localSubsys( UNASSIGNED )
+    , _activityThreshold( 0. )
+    , _nBufferLayers( 0 )
+    , _localMatrix( nullptr )
+{
+    _name = "LocalizedAlternateMinimization";
+}
+
+LocalizedAlternateMinimization::~LocalizedAlternateMinimization()
+{
+    if ( _localMatrix )
+        delete _localMatrix;
+}
+
+// Public methods
+// ---------------------------------------------------------------------------
+void LocalizedAlternateMinimization::formSparsityProfileForStage( int stage )
+{
+    AlternateMinimization::formSparsityProfileForStage(stage);
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    
+    std::printf("\n  %-40s", "Mapping cells to localized unknowns ...");
+    std::fflush(stdout);
+    tic = std::chrono::high_resolution_clock::now();
+    
+    // Equation numbers of the localized subsystem at each cell
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    std::vector< std::vector<int> > eqOfCell(nCells, std::vector<int>());
+    
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int i = 0; i < nCells; i++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
+        Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+        
+        TimeData time;
+        std::vector<Dof*> rowDof;
+        std::tie(rowDof,std::ignore,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, _localSubsys, time);
+        
+        for ( Dof* curDof : rowDof )
+        {
+            if ( curDof )
+            {
+                int eqNo = analysisModel().dofManager().giveEquationNumberAt(curDof);
+                int ssNum = analysisModel().dofManager().giveSubsystemNumberFor(curDof);
+                if ( eqNo != UNASSIGNED && ssNum == _localSubsys )
+                    eqOfCell[i].push_back(eqNo);
+            }
+        }
+        std::sort(eqOfCell[i].begin(), eqOfCell[i].end());
+        eqOfCell[i].erase(std::unique(eqOfCell[i].begin(), eqOfCell[i].end()), eqOfCell[i].end());
+    }
+    
+    _cellEqPtr.assign(nCells + 1, 0);
+    for ( int i = 0; i < nCells; i++ )
+        _cellEqPtr[i + 1] = _cellEqPtr[i] + eqOfCell[i].size();
+    
+    _cellEq.assign(_cellEqPtr[nCells], 0);
+    for ( int i = 0; i < nCells; i++ )
+        std::copy(eqOfCell[i].begin(), eqOfCell[i].end(), _cellEq.begin() + _cellEqPtr[i]);
+    
+    // Cells at each equation
+    int nEq = _nUnknowns[this->giveIndexForSubsystem(_localSubsys)];
+    _eqCellPtr.assign(nEq + 1, 0);
+    for ( int eqNo : _cellEq )
+        _eqCellPtr[eqNo + 1] += 1;
+    for ( int i = 0; i < nEq; i++ )
+        _eqCellPtr[i + 1] += _eqCellPtr[i];
+    
+    std::vector<int> pos(_eqCellPtr.begin(), _eqCellPtr.end() - 1);
+    _eqCell.assign(_eqCellPtr[nEq], 0);
+    for ( int i = 0; i < nCells; i++ )
+        for ( int j = _cellEqPtr[i]; j < _cellEqPtr[i + 1]; j++ )
+            _eqCell[pos[_cellEq[j]]++] = i;
+    
+    // Local profile is formed anew at the first solve
+    _localActiveCell.clear();
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    std::printf("done (time = %f sec.)\n", tictoc.count());
+}
+// ---------------------------------------------------------------------------
+void LocalizedAlternateMinimization::readDataFromFile( FILE* fp )
+{
+    AlternateMinimization::readDataFromFile(fp);
+    
+    verifyKeyword(fp, "LocalizedSubsystem", _name);
+    _localSubsys = getIntegerInputFrom(fp, "Failed to read localized subsystem number from input file!", _name);
+    
+    verifyKeyword(fp, "ActivityThreshold", _name);
+    _activityThreshold = getRealInputFrom(fp, "Failed to read activity threshold from input file!", _name);
+    
+    verifyKeyword(fp, "BufferLayers", _name);
+    _nBufferLayers = getIntegerInputFrom(fp, "Failed to read number of buffer layers from input file!", _name);
+    
+    int idx = this->giveIndexForSubsystem(_localSubsys);
+    if ( idx < 0 )
+        throw std::runtime_error("ERROR: Localized subsystem " + std::to_string(_localSubsys) + " is not solved by solution method!\nSource: " + _name);
+    
+    // The localized system is assembled explicitly over the active region
+    std::string format = _solver[idx]->giveRequiredMatrixFormat();
+    if ( format == "MatrixFree" || format == "DistributedCSR" )
+        throw std::runtime_error("ERROR: Matrix format '" + format + "' cannot be used for localized subsystem!\nSource: " + _name);
+    
+    _localMatrix = objectFactory().instantiateSparseMatrix(format);
+    _localMatrix->setSymmetryTo(_symmetry[idx]);
+}
+
+// Private methods
+// ---------------------------------------------------------------------------
+bool LocalizedAlternateMinimization::assemblesGlobalMatrixFor( int idx )
+{
+    // The localized subsystem is only assembled over the active region
+    return _subsysNum[idx] != _localSubsys;
+}
+// ---------------------------------------------------------------------------
+std::vector<int> LocalizedAlternateMinimization::findActiveCells( const RealVector& resid
+                                                                 , const RealVector& prevCorrection )
+{
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    int nEq = resid.dim();
+    
+    double maxResid = 0., maxCorrection = 0.;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(max: maxResid, maxCorrection)
+#endif
+    for ( int i = 0; i < nEq; i++ )
+    {
+        maxResid = std::max(maxResid, std::fabs(resid(i)));
+        maxCorrection = std::max(maxCorrection, std::fabs(prevCorrection(i)));
+    }
+    
+    double residTol = _activityThreshold*maxResid;
+    double correctionTol = _activityThreshold*maxCorrection;
+    
+    // Cells holding at least one unknown above threshold
+    std::vector<char> isActive(nCells, 0);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int i = 0; i < nCells; i++ )
+        for ( int j = _cellEqPtr[i]; j < _cellEqPtr[i + 1]; j++ )
+        {
+            int eqNo = _cellEq[j];
+            if ( std::fabs(resid(eqNo)) > residTol || std::fabs(prevCorrection(eqNo)) > correctionTol )
+                isActive[i] = 1;
+        }
+    
+    std::vector<int> activeCell;
+    for ( int i = 0; i < nCells; i++ )
+        if ( isActive[i] )
+            activeCell.push_back(i);
+    
+    // Buffer layers of node-adjacent cells
+    int frontBegin = 0;
+    for ( int layer = 0; layer < _nBufferLayers; layer++ )
+    {
+        int frontEnd = activeCell.size();
+        for ( int k = frontBegin; k < frontEnd; k++ )
+        {
+            Cell* curCell = analysisModel().domainManager().giveDomainCell(activeCell[k]);
+            for ( Node* curNode : analysisModel().domainManager().giveNodesOf(curCell) )
+                for ( Cell* adjCell : analysisModel().domainManager().giveAttachedDomainCellsOf(curNode) )
+                {
+                    int adjId = analysisModel().domainManager().giveIdOf(adjCell);
+                    if ( !isActive[adjId] )
+                    {
+                        isActive[adjId] = 1;
+                        activeCell.push_back(adjId);
+                    }
+                }
+        }
+        frontBegin = frontEnd;
+    }
+    
+    std::sort(activeCell.begin(), activeCell.end());
+    
+    return activeCell;
+}
+// ---------------------------------------------------------------------------
+RealVector LocalizedAlternateMinimization::solveForSubsystemCorrection( int stage
+                                                                      , int idx
+                                                                      , RealVector& resid
+                                                                      , RealVector& prevCorrection
+                                                                      , const TimeData& time )
+{
+    if ( _subsysNum[idx] != _localSubsys )
+        return AlternateMinimization::solveForSubsystemCorrection(stage, idx, resid, prevCorrection, time);
+    
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    tic = std::chrono::high_resolution_clock::now();
+    
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    int nEq = resid.dim();
+    
+    std::vector<int> activeCell = this->findActiveCells(resid, prevCorrection);
+    int nActiveCells = activeCell.size();
+    
+    std::vector<char> isActive(nCells, 0);
+    for ( int i : activeCell )
+        isActive[i] = 1;
+    
+    // Unknowns are solved for only if all cells containing them are active.
+    // The rest keep their current values, acting as Dirichlet conditions at
+    // the boundary of the active region.
+    const int frozen = -2;
+    std::vector<int> localEq(nEq, UNASSIGNED);
+    int nLocal = 0;
+    for ( int i : activeCell )
+        for ( int j = _cellEqPtr[i]; j < _cellEqPtr[i + 1]; j++ )
+        {
+            int eqNo = _cellEq[j];
+            if ( localEq[eqNo] == UNASSIGNED )
+            {
+                localEq[eqNo] = nLocal;
+                for ( int k = _eqCellPtr[eqNo]; k < _eqCellPtr[eqNo + 1]; k++ )
+                    if ( !isActive[_eqCell[k]] )
+                        localEq[eqNo] = frozen;
+                
+                if ( localEq[eqNo] != frozen )
+                    ++nLocal;
+            }
+        }
+    
+#ifdef VERBOSE_LOCALIZATION
+    std::printf("\n    Active region, subsystem %d: %d of %d cells, %d of %d unknowns\n", _localSubsys, nActiveCells, nCells, nLocal, nEq);
+#endif
+    
+    RealVector dU(nEq);
+    if ( nLocal == 0 )
+        return dU;
+    
+    // Local coefficient matrices of active cells, in local equation numbers
+    std::vector< std::vector<int> > localRow(nActiveCells), localCol(nActiveCells);
+    std::vector< std::vector<double> > localVal(nActiveCells);
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for ( int k = 0; k < nActiveCells; k++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveDomainCell(activeCell[k]);
+        Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+        
+        std::vector<Dof*> rowDof, colDof;
+        RealVector coefVal;
+        std::tie(rowDof,colDof,coefVal) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, _localSubsys, time);
+        
+        for ( int j = 0; j < (int)rowDof.size(); j++ )
+        {
+            if ( rowDof[j] && colDof[j] )
+            {
+                int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
+                int rssNum = analysisModel().dofManager().giveSubsystemNumberFor(rowDof[j]);
+                int colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[j]);
+                int cssNum = analysisModel().dofManager().giveSubsystemNumberFor(colDof[j]);
+                
+                if ( rowNum != UNASSIGNED && rssNum == _localSubsys && colNum != UNASSIGNED && cssNum == _localSubsys 
+                     && localEq[rowNum] >= 0 && localEq[colNum] >= 0 )
+                {
+                    localRow[k].push_back(localEq[rowNum]);
+                    localCol[k].push_back(localEq[colNum]);
+                    localVal[k].push_back(coefVal(j));
+                }
+            }
+        }
+    }
+    
+    // Assemble localized system. Local equation numbers depend only on the
+    // active cells, so the profile is formed only when these change.
+    bool profileChanged = ( activeCell != _localActiveCell );
+    if ( profileChanged )
+    {
+        _localMatrix->initializeProfile(nLocal, nLocal);
+        for ( int k = 0; k < nActiveCells; k++ )
+            for ( int j = 0; j < (int)localRow[k].size(); j++ )
+                _localMatrix->insertNonzeroComponentAt(localRow[k][j], localCol[k][j]);
+        _localMatrix->finalizeProfile();
+        _localActiveCell = activeCell;
+    }
+    _localMatrix->initializeValues();
+    
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int k = 0; k < nActiveCells; k++ )
+        for ( int j = 0; j < (int)localRow[k].size(); j++ )
+            _localMatrix->atomicAddToComponent(localRow[k][j], localCol[k][j], localVal[k][j]);
+    
+    RealVector localResid(nLocal), localGuess(nLocal);
+    for ( int i = 0; i < nEq; i++ )
+        if ( localEq[i] >= 0 )
+        {
+            localResid(localEq[i]) = resid(i);
+            localGuess(localEq[i]) = prevCorrection(i);
+        }
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addCoefMatAssemblyTime(tictoc.count());
+    
+    // Solve localized system. Internal memory of the solver, including any
+    // symbolic factorization, is only renewed when the profile changes.
+    tic = std::chrono::high_resolution_clock::now();
+    
+    if ( profileChanged )
+    {
+        _solver[idx]->clearInternalMemory();
+        _solver[idx]->allocateInternalMemoryFor(_localMatrix);
+    }
+    if ( _solver[idx]->takesInitialGuess() )
+        _solver[idx]->setInitialGuessTo(localGuess);
+    RealVector localDU = _solver[idx]->solve(_localMatrix, localResid);
+    
+    for ( int i = 0; i < nEq; i++ )
+        if ( localEq[i] >= 0 )
+            dU(i) = localDU(localEq[i]);
+    
+    toc = std::chrono::high_resolution_clock::now();
+    tictoc = toc - tic;
+    diagnostics().addSolveTime(tictoc.count());
+    
+    return dU;
+}
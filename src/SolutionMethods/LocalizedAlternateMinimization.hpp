@@ -0,0 +1,76 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef LOCALIZEDALTERNATEMINIMIZATION_HPP
+#define LOCALIZEDALTERNATEMINIMIZATION_HPP
+
+#include "AlternateMinimization.hpp"
+#include <vector>
+
+namespace broomstyx
+{
+    // Alternate minimization in which one subsystem (typically the phase
+    // field) is assembled and solved only over an active region of the mesh.
+    // The region consists of the cells holding unknowns whose residual or
+    // previous correction exceeds a fraction of the respective maximum,
+    // padded by layers of node-adjacent cells. Unknowns shared with cells
+    // outside the region are held fixed. The size of the region is reported
+    // at each solve when compiled with VERBOSE_LOCALIZATION.
+    class LocalizedAlternateMinimization final : public AlternateMinimization
+    {
+    public:
+        LocalizedAlternateMinimization();
+        virtual ~LocalizedAlternateMinimization();
+        
+        void formSparsityProfileForStage( int stage ) override;
+        void readDataFromFile( FILE* fp ) override;
+        
+    private:
+        int    _localSubsys;
+        double _activityThreshold;
+        int    _nBufferLayers;
+        
+        // Equation numbers of localized subsystem at each domain cell, and
+        // domain cells at each equation, in compressed row format
+        std::vector<int> _cellEqPtr;
+        std::vector<int> _cellEq;
+        std::vector<int> _eqCellPtr;
+        std::vector<int> _eqCell;
+        
+        // Localized system, whose profile and symbolic factorization are
+        // reused as long as the active region does not change
+        SparseMatrix*    _localMatrix;
+        std::vector<int> _localActiveCell;
+        
+        bool assemblesGlobalMatrixFor( int idx ) override;
+        std::vector<int> findActiveCells( const RealVector& resid, const RealVector& prevCorrection );
+        
+        RealVector solveForSubsystemCorrection( int stage
+                                              , int idx
+                                              , RealVector& resid
+                                              , RealVector& prevCorrection
+                                              , const TimeData& time ) override;
+    };
+}
+
+#endif /* LOCALIZEDALTERNATEMINIMIZATION_HPP */
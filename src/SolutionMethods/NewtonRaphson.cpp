@@ -22,6 +22,7 @@
 */
 
 #include "NewtonRaphson.hpp"
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <stdexcept>
@@ -51,6 +52,13 @@ registerBroomstyxObject(SolutionMethod, NewtonRaphson)
 
 // Constructor
 NewtonRaphson::NewtonRaphson()
+    : _overRelaxation(1.)
+    , _lineSearch(false)
+    , _maxLineSearchTrials(0)
+    , _lineSearchTolerance(0.)
+    , _damping(1.)
+    , _cacheElementMatrices(false)
+    , _condenseDomains(false)
 {
     _name = "NewtonRaphson";
 }
@@ -73,10 +81,10 @@ int NewtonRaphson::computeSolutionFor( int stage
     std::chrono::duration<double> tictoc;
 
     _substepCount += 1;
-
-    // Get all active DOFs at current stage
-    std::vector<Dof*> dof = analysisModel().dofManager().giveActiveDofsAtStage(stage);
     
+    // Damping carried over from the previous substep is relaxed
+    _damping = std::min(1., 2.*_damping);
+
     // Impose constraints on nodal DOFs
     std::printf("    %-40s", "Imposing constraints ...");
     tic = std::chrono::high_resolution_clock::now();
@@ -108,6 +116,8 @@ int NewtonRaphson::computeSolutionFor( int stage
         // methods for imposing constraints
 
         analysisModel().dofManager().resetSecondaryVariablesAtStage(stage);
+        for ( int i = 0; i < _nDofGroups; i++ )
+            _convergenceCriterion[i]->resetResidualCriteria();
         
         // Calculate residual for each subsystem
         rhs = assembleRightHandSide(stage, bndCond, fldCond, time);
@@ -129,10 +139,10 @@ int NewtonRaphson::computeSolutionFor( int stage
         else
         {
             converged = true;
+            this->computeResidualNorms(resid);
             for ( int i = 0; i < _nDofGroups; i++ )
             {
-                int idx = this->giveIndexForDofGroup(_dofGrpNum[i]);
-                bool dofGrpConverged = _convergenceCriterion[idx]->checkConvergenceOf(resid, dof);
+                bool dofGrpConverged = _convergenceCriterion[i]->checkConvergenceOf(_dofGrpNorms[i]);
                 if ( !dofGrpConverged )
                     converged = false;
             }
@@ -208,6 +218,8 @@ int NewtonRaphson::computeSolutionFor( int stage
             resid = rhs - lhs;
                 
             // Assemble system Jacobian
+            if ( _condenseDomains )
+                _condensation.condenseAt(stage, time);
             _spMatrix->initializeValues();
             this->assembleJacobian(stage, time);
                 
@@ -215,27 +227,34 @@ int NewtonRaphson::computeSolutionFor( int stage
             innertic = std::chrono::high_resolution_clock::now();
 
             _solver->allocateInternalMemoryFor(_spMatrix);
-            if ( _solver->takesInitialGuess() )
-                _solver->setInitialGuessTo(dU);
-            dU = _overRelaxation*_solver->solve(_spMatrix, resid);
+            if ( _condenseDomains )
+            {
+                // Solve for retained equations, then recover interior
+                // corrections of condensed domains
+                RealVector residR = _condensation.reduceRightHandSide(resid);
+                if ( _solver->takesInitialGuess() )
+                {
+                    RealVector dUr = _condensation.giveRetainedComponentsOf(dU);
+                    _solver->setInitialGuessTo(dUr);
+                }
+                dU = _overRelaxation*_condensation.recoverCorrection(_solver->solve(_spMatrix, residR));
+            }
+            else
+            {
+                if ( _solver->takesInitialGuess() )
+                    _solver->setInitialGuessTo(dU);
+                dU = _overRelaxation*_solver->solve(_spMatrix, resid);
+            }
 
             innertoc = std::chrono::high_resolution_clock::now();
             tictoc = innertoc - innertic;
             diagnostics().addSolveTime(tictoc.count());
 
             innertic = std::chrono::high_resolution_clock::now();
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for ( int j = 0; j < (int)dof.size(); j++ )
-            {
-                int eqNo = analysisModel().dofManager().giveEquationNumberAt(dof[j]);
-                if ( eqNo != UNASSIGNED )
-                {
-                    // Update value primary variable at DOF
-                    analysisModel().dofManager().updatePrimaryVariableAt(dof[j], dU(eqNo), correction);
-                }   
-            }
+            if ( _lineSearch )
+                this->applyCorrectionWithLineSearch(stage, time, dU, rhs, resid);
+            else
+                this->applyCorrection(dU);
             innertoc = std::chrono::high_resolution_clock::now();
             tictoc = innertoc - innertic;
             diagnostics().addUpdateTime(tictoc.count());
@@ -257,12 +276,14 @@ void NewtonRaphson::formSparsityProfileForStage( int stage )
     // Count number of DOFs belonging to each DOF group
     _dofGrpCount.init(_nDofGroups);
     
-    std::vector<Dof*> dof = analysisModel().dofManager().giveActiveDofsAtStage(stage);
-    int nActiveDof = (int)dof.size();
+    _activeDof = analysisModel().dofManager().giveActiveDofsAtStage(stage);
+    int nActiveDof = (int)_activeDof.size();
+    _activeDofGrpIdx.assign(nActiveDof, -1);
     for ( int i = 0; i < nActiveDof; i++ )
     {
-        int grpNo = analysisModel().dofManager().giveGroupNumberFor(dof[i]);
+        int grpNo = analysisModel().dofManager().giveGroupNumberFor(_activeDof[i]);
         int idx = this->giveIndexForDofGroup(grpNo);
+        _activeDofGrpIdx[i] = idx;
         if ( idx >= 0 )
             _dofGrpCount(idx) += 1.;
     }
@@ -272,16 +293,18 @@ void NewtonRaphson::formSparsityProfileForStage( int stage )
     tic = std::chrono::high_resolution_clock::now();
     
     int eqNo = 0;
+    _activeDofEqNo.assign(nActiveDof, UNASSIGNED);
     
-    for ( int i = 0; i < (int)dof.size(); i++)
+    for ( int i = 0; i < nActiveDof; i++)
     {
         // Check that DOF group is included in solution
-        int grp = analysisModel().dofManager().giveGroupNumberFor(dof[i]);
-        int idx = this->giveIndexForDofGroup(grp);
-        
-        if ( idx >= 0 )
-            analysisModel().dofManager().setEquationNumberFor(dof[i], eqNo++);
+        if ( _activeDofGrpIdx[i] >= 0 )
+        {
+            _activeDofEqNo[i] = eqNo;
+            analysisModel().dofManager().setEquationNumberFor(_activeDof[i], eqNo++);
+        }
     }
+    _dofGrpNorms.assign(_nDofGroups, DofGroupNorms());
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
     std::printf("done (time = %f sec.)", tictoc.count());
@@ -292,37 +315,101 @@ void NewtonRaphson::formSparsityProfileForStage( int stage )
     tic = std::chrono::high_resolution_clock::now();
 
     _nUnknowns = eqNo;
-    _spMatrix->initializeProfile(_nUnknowns, _nUnknowns);
+    int nSysEq = _nUnknowns;
+    if ( _condenseDomains )
+    {
+        _condensation.partitionEquationsAt(stage, _nUnknowns);
+        nSysEq = _condensation.giveNumberOfRetainedEquations();
+    }
+    _spMatrix->initializeProfile(nSysEq, nSysEq);
     _spMatrix->setSymmetryTo(_symmetry);
 
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    // Cells are assembled in blocks following the mesh partitions. Rows
+    // reached by more than one block are identified along with the
+    // sparsity pattern.
+    std::vector<Cell*> domCell = analysisModel().domainManager().giveDomainCellsOrderedByPartition();
+    _blockAssembly.formBlocksFrom(domCell);
+    _blockAssembly.initializeRowOwnership(_nUnknowns);
+    int nBlocks = _blockAssembly.giveNumberOfBlocks();
+    
+    // Cache slots follow the assembly order of cells
+    if ( _cacheElementMatrices )
+        _elMatCache.initializeSlots(analysisModel().domainManager().giveNumberOfDomainCells());
 
     // Matrix assembly for determining sparsity profile cannot be 
     // parallelized because std::set is not thread-safe.
-    for ( int j = 0; j < nCells; j++ )
+    for ( int iBlock = 0; iBlock < nBlocks; iBlock++ )
     {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(j);
-        int label = analysisModel().domainManager().giveLabelOf(curCell);
-        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
+        for ( Cell* curCell : _blockAssembly.giveCellsOfBlock(iBlock) )
+        {
+            int label = analysisModel().domainManager().giveLabelOf(curCell);
+            Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
 
-        TimeData time;
-        std::vector<Dof*> rowDof, colDof;
-        std::tie(rowDof,colDof,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, UNASSIGNED, time);
+            TimeData time;
+            std::vector<Dof*> rowDof, colDof;
+            std::tie(rowDof,colDof,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, UNASSIGNED, time);
 
-        int lnnz = rowDof.size();
-        for ( int k = 0; k < lnnz; k++)
+            int lnnz = rowDof.size();
+            if ( _cacheElementMatrices && !_condenseDomains )
+                _elMatCache.reserveSlotFor(curCell, lnnz);
+            for ( int k = 0; k < lnnz; k++)
+            {
+                if ( rowDof[k] && colDof[k] )
+                {
+                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[k]);
+                    int colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[k]);
+                    if ( rowNum != UNASSIGNED )
+                        _blockAssembly.registerRowOfBlock(rowNum, iBlock);
+                    if ( rowNum != UNASSIGNED && colNum != UNASSIGNED && !_condenseDomains )
+                        _spMatrix->insertNonzeroComponentAt(rowNum, colNum);
+                }
+            }
+        }
+    }
+    
+    // With static condensation, the Jacobian is assembled over the retained
+    // equations from cells outside the condensed domains, in separate blocks
+    if ( _condenseDomains )
+    {
+        _retainedAssembly.formBlocksFrom(_condensation.giveRetainedCellsOf(domCell));
+        _retainedAssembly.initializeRowOwnership(nSysEq);
+        
+        for ( int iBlock = 0; iBlock < _retainedAssembly.giveNumberOfBlocks(); iBlock++ )
         {
-            if ( rowDof[k] && colDof[k] )
+            for ( Cell* curCell : _retainedAssembly.giveCellsOfBlock(iBlock) )
             {
-                int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[k]);
-                int colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[k]);
-                if ( rowNum != UNASSIGNED && colNum != UNASSIGNED )
-                    _spMatrix->insertNonzeroComponentAt(rowNum, colNum);
+                Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+                
+                TimeData time;
+                std::vector<Dof*> rowDof, colDof;
+                std::tie(rowDof,colDof,std::ignore) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, UNASSIGNED, time);
+                
+                int lnnz = rowDof.size();
+                if ( _cacheElementMatrices )
+                    _elMatCache.reserveSlotFor(curCell, lnnz);
+                for ( int k = 0; k < lnnz; k++ )
+                {
+                    if ( rowDof[k] && colDof[k] )
+                    {
+                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[k]);
+                        int colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[k]);
+                        if ( rowNum != UNASSIGNED && colNum != UNASSIGNED )
+                        {
+                            rowNum = _condensation.giveRetainedEquationFor(rowNum);
+                            colNum = _condensation.giveRetainedEquationFor(colNum);
+                            _retainedAssembly.registerRowOfBlock(rowNum, iBlock);
+                            _spMatrix->insertNonzeroComponentAt(rowNum, colNum);
+                        }
+                    }
+                }
             }
         }
+        _condensation.insertInterfaceProfileInto(_spMatrix);
     }
 
     _spMatrix->finalizeProfile();
+    if ( _cacheElementMatrices )
+        _elMatCache.allocatePool();
 
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
@@ -330,14 +417,19 @@ void NewtonRaphson::formSparsityProfileForStage( int stage )
 
     // Compute storage size in bytes
     int nnz = _spMatrix->giveNumberOfNonzeros();
-    double spratio = (double)nnz/((double)_nUnknowns*(double)_nUnknowns);
+    double spratio = (double)nnz/((double)nSysEq*(double)nSysEq);
     std::printf("\n    Stage %-2d: nUnknowns = %d, nnz = %d", stage, _nUnknowns, nnz);
-    std::printf("\n         Sparsity ratio = %.4e\n", spratio);
+    std::printf("\n         Sparsity ratio = %.4e", spratio);
+    if ( _condenseDomains )
+        std::printf("\n         Condensed equations = %d, interface equations = %d", _condensation.giveNumberOfInteriorEquations(), _condensation.giveNumberOfInterfaceEquations());
+    std::printf("\n         Assembly blocks = %d, interface rows = %d\n", nBlocks, _blockAssembly.giveNumberOfInterfaceRows());
 }
 // ---------------------------------------------------------------------------
 void NewtonRaphson::initializeSolvers()
 {
     _solver->initialize();
+    if ( _condenseDomains )
+        _condensation.initializeSolver();
 }
 // ----------------------------------------------------------------------------
 void NewtonRaphson::readDataFromFile( FILE* fp )
@@ -365,31 +457,61 @@ void NewtonRaphson::readDataFromFile( FILE* fp )
     _solver->readDataFrom(fp);
     _symmetry = _solver->giveSymmetryOption();
 
-    // Read over-relaxation parameter
-    verifyKeyword(fp, "OverRelaxation", _name);
-    _overRelaxation = getRealInputFrom(fp, "Failed to read over-relaxation parameter from input file!", _name);
+    // Read step length control: constant over-relaxation, or line search
+    // with adaptive damping
+    key = getStringInputFrom(fp, "Failed to read step length control from input file!", _name);
+    if ( key == "OverRelaxation" )
+        _overRelaxation = getRealInputFrom(fp, "Failed to read over-relaxation parameter from input file!", _name);
+    else if ( key == "LineSearch" )
+    {
+        _lineSearch = true;
+        _maxLineSearchTrials = getIntegerInputFrom(fp, "Failed to read maximum number of line search trials from input file!", _name);
+        _lineSearchTolerance = getRealInputFrom(fp, "Failed to read line search tolerance from input file!", _name);
+        if ( _maxLineSearchTrials < 1 || _lineSearchTolerance <= 0. || _lineSearchTolerance >= 1. )
+            throw std::runtime_error("Line search requires at least one trial and a tolerance between 0 and 1!\nSource: " + _name);
+    }
+    else
+        throw std::runtime_error("Unrecognized step length control '" + key + "' encountered in input file!\nExpected 'OverRelaxation' or 'LineSearch'.\nSource: " + _name);
 
     // Create sparse matrices
     _spMatrix = objectFactory().instantiateSparseMatrix(_solver->giveRequiredMatrixFormat());
     _spMatrix->setSymmetryTo(_symmetry);
 
-    // Maximum number of iterations
-    verifyKeyword(fp, key = "MaxIterations", _name);
+    // Optional reuse of element matrices and static condensation, followed
+    // by maximum number of iterations
+    key = getStringInputFrom(fp, "Failed to read keyword from input file!", _name);
+    if ( key == "ElementMatrixCache" )
+    {
+        _cacheElementMatrices = true;
+        key = getStringInputFrom(fp, "Failed to read keyword from input file!", _name);
+    }
+    if ( key == "StaticCondensation" )
+    {
+        _condenseDomains = true;
+        _condensation.readDataFrom(fp);
+        
+        std::string format = _solver->giveRequiredMatrixFormat();
+        if ( format == "MatrixFree" || format == "DistributedCSR" )
+            throw std::runtime_error("ERROR: Matrix format '" + format + "' cannot be used with static condensation!\nSource: " + _name);
+        key = getStringInputFrom(fp, "Failed to read keyword from input file!", _name);
+    }
+    if ( key != "MaxIterations" )
+        throw std::runtime_error("Keyword 'MaxIterations' expected in input file,\n\tstring '" + key + "' found.\nError source: " + _name);
     _maxIter = getIntegerInputFrom(fp, "Failed to read maximum number of iterations from input file!", _name);
 }
 
 // Private methods
 // ----------------------------------------------------------------------------
-RealVector NewtonRaphson::assembleLeftHandSide( int stage, const TimeData& time )
+void NewtonRaphson::applyCorrection( const RealVector& dU )
 {
-    std::chrono::time_point<std::chrono::system_clock> tic, toc;
-    std::chrono::duration<double> tictoc;
-    tic = std::chrono::high_resolution_clock::now();
-
-    RealVector lhs(_nUnknowns);
-    
-    // Assembly of global internal force vector for current subsystem
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    // Apply corrections to active DOFs and accumulate correction and
+    // increment norms per DOF group in the same pass
+    int nThreads = 1;
+#ifdef _OPENMP
+    nThreads = omp_get_max_threads();
+#endif
+    std::vector<PaddedDofGroupNorms> threadNorms(nThreads*_nDofGroups);
+    int nActiveDof = (int)_activeDof.size();
     
 #ifdef _OPENMP
 #pragma omp parallel
@@ -399,43 +521,205 @@ RealVector NewtonRaphson::assembleLeftHandSide( int stage, const TimeData& time
 #ifdef _OPENMP
         threadNum = omp_get_thread_num();
 #endif
+        PaddedDofGroupNorms* norms = &threadNorms[threadNum*_nDofGroups];
+        
 #ifdef _OPENMP
-#pragma omp for
+#pragma omp for schedule(static)
 #endif
-        for (int i = 0; i < nCells; i++)
+        for ( int j = 0; j < nActiveDof; j++ )
         {
-            Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
-            Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
-            
-            std::vector<Dof*> rowDof;
-            RealVector localLhs;
+            int eqNo = _activeDofEqNo[j];
+            if ( eqNo != UNASSIGNED )
+            {
+                Dof* curDof = _activeDof[j];
+                analysisModel().dofManager().updatePrimaryVariableAt(curDof, dU(eqNo), correction);
+                
+                double incVal = analysisModel().dofManager().giveValueOfPrimaryVariableAt(curDof, incremental_value);
+                norms[_activeDofGrpIdx[j]].norms.addCorrection(dU(eqNo), incVal);
+            }
+        }
+    }
+    
+    for ( int i = 0; i < _nDofGroups; i++ )
+    {
+        _dofGrpNorms[i] = DofGroupNorms();
+        for ( int k = 0; k < nThreads; k++ )
+            _dofGrpNorms[i].merge(threadNorms[k*_nDofGroups + i].norms);
+    }
+}
+// ----------------------------------------------------------------------------
+void NewtonRaphson::applyCorrectionWithLineSearch( int stage
+                                                 , const TimeData& time
+                                                 , const RealVector& dU
+                                                 , const RealVector& rhs
+                                                 , const RealVector& resid )
+{
+    // Smallest admissible step length, relative to the full correction
+    const double minStepLength = 0.05;
+    
+    // Work done by the residual along the search direction. A direction
+    // that is not a descent direction (e.g. from an indefinite Jacobian) is
+    // taken with the current damping without searching.
+    double s0 = RealVector(resid).dot(dU);
+    double alpha = _damping;
+    int nTrials = 0;
+    
+    if ( s0 > 0. )
+    {
+        double curAlpha = 0.;
+        bool accepted = false;
+        while ( !accepted && nTrials < _maxLineSearchTrials )
+        {
+            // Move to trial state. Material states are recomputed from the
+            // trial DOF values during assembly, so the last trial evaluated
+            // always leaves them consistent with the accepted step.
+            this->shiftPrimaryVariables(dU, alpha - curAlpha);
+            curAlpha = alpha;
+            ++nTrials;
             
-            // Calculate cell internal forces
-            std::tie(rowDof,localLhs) = numerics->giveStaticLeftHandSideAt(curCell, stage, UNASSIGNED, time);
+            RealVector trialResid = rhs - this->assembleLeftHandSide(stage, time);
+            double s = trialResid.dot(dU);
             
-            // Assembly
-            for ( int j = 0; j < (int)rowDof.size(); j++ )
+            if ( std::fabs(s) <= _lineSearchTolerance*s0 )
+                accepted = true;
+            else if ( nTrials < _maxLineSearchTrials )
             {
-                if ( rowDof[j] )
-                {
-                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
-                    int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
-                    int idx = this->giveIndexForDofGroup(dofGrp);
-                    _convergenceCriterion[idx]->processLocalResidualContribution(localLhs(j), threadNum);
+                // Secant estimate of the zero of s(alpha), restricted to
+                // avoid excessive cutbacks
+                double newAlpha = ( s < s0 ) ? alpha*s0/(s0 - s) : 0.5*alpha;
+                newAlpha = std::min(1., std::max(newAlpha, 0.1*alpha));
+                newAlpha = std::max(newAlpha, minStepLength);
+                
+                if ( std::fabs(newAlpha - alpha) < 1.0e-3*alpha )
+                    accepted = true;
+                else
+                    alpha = newAlpha;
+            }
+        }
+        
+        // Return to the start of the iteration so that correction norms are
+        // computed for the accepted step
+        this->shiftPrimaryVariables(dU, -curAlpha);
+        
+        // Adaptive damping: the next iteration starts from the accepted
+        // step length, which grows again once full steps are accepted
+        if ( nTrials == 1 )
+            _damping = std::min(1., 2.*alpha);
+        else
+            _damping = alpha;
+    }
+    
+    RealVector step(dU);
+    step *= alpha;
+    this->applyCorrection(step);
+    std::printf("\n    Line search: step length = %.4f (%d trials)\n", alpha, nTrials);
+}
+// ----------------------------------------------------------------------------
+void NewtonRaphson::computeResidualNorms( const RealVector& resid )
+{
+    int nThreads = 1;
+#ifdef _OPENMP
+    nThreads = omp_get_max_threads();
+#endif
+    std::vector<PaddedDofGroupNorms> threadNorms(nThreads*_nDofGroups);
+    int nActiveDof = (int)_activeDof.size();
+    
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        int threadNum = 0;
+#ifdef _OPENMP
+        threadNum = omp_get_thread_num();
+#endif
+        PaddedDofGroupNorms* norms = &threadNorms[threadNum*_nDofGroups];
+        
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for ( int j = 0; j < nActiveDof; j++ )
+        {
+            int eqNo = _activeDofEqNo[j];
+            if ( eqNo != UNASSIGNED )
+                norms[_activeDofGrpIdx[j]].norms.addResidual(resid(eqNo));
+        }
+    }
+    
+    // Correction norms from the preceding update are kept
+    for ( int i = 0; i < _nDofGroups; i++ )
+    {
+        DofGroupNorms residNorms;
+        for ( int k = 0; k < nThreads; k++ )
+            residNorms.merge(threadNorms[k*_nDofGroups + i].norms);
+        
+        _dofGrpNorms[i].residSumSq = residNorms.residSumSq;
+        _dofGrpNorms[i].residMaxAbs = residNorms.residMaxAbs;
+    }
+}
+// ----------------------------------------------------------------------------
+RealVector NewtonRaphson::assembleLeftHandSide( int stage, const TimeData& time )
+{
+    std::chrono::time_point<std::chrono::system_clock> tic, toc;
+    std::chrono::duration<double> tictoc;
+    tic = std::chrono::high_resolution_clock::now();
 
-                    if ( rowNum != UNASSIGNED )
-                    {
+    RealVector lhs(_nUnknowns);
+    
+    // Assembly of global internal force vector for current subsystem, with
+    // each thread assembling a range of blocks of cells
 #ifdef _OPENMP
-#pragma omp atomic
+#pragma omp parallel
 #endif
-                        lhs(rowNum) += localLhs(j);
-                    }
+    {
+        int threadNum = 0, nThreads = 1;
+#ifdef _OPENMP
+        threadNum = omp_get_thread_num();
+        nThreads = omp_get_num_threads();
+#endif
+        int firstBlock, endBlock;
+        std::tie(firstBlock, endBlock) = _blockAssembly.giveBlockRangeOfThread(threadNum, nThreads);
+        
+        AssemblyBuffer buffer;
+        for ( int iBlock = firstBlock; iBlock < endBlock; iBlock++ )
+        {
+            _blockAssembly.startTimingOf(iBlock);
+            for ( Cell* curCell : _blockAssembly.giveCellsOfBlock(iBlock) )
+            {
+                Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+                
+                std::vector<Dof*> rowDof;
+                RealVector localLhs;
+                
+                // Calculate cell internal forces
+                std::tie(rowDof,localLhs) = numerics->giveStaticLeftHandSideAt(curCell, stage, UNASSIGNED, time);
+                
+                // Assembly
+                for ( int j = 0; j < (int)rowDof.size(); j++ )
+                {
+                    if ( rowDof[j] )
+                    {
+                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
+                        int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
+                        int idx = this->giveIndexForDofGroup(dofGrp);
+                        _convergenceCriterion[idx]->processLocalResidualContribution(localLhs(j), threadNum);
+
+                        if ( rowNum != UNASSIGNED )
+                        {
+                            if ( _blockAssembly.ownsRow(iBlock, rowNum) )
+                                lhs(rowNum) += localLhs(j);
+                            else
+                                buffer.addToVectorComponent(rowNum, localLhs(j));
+                        }
 
-                    analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localLhs(j));
+                        analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localLhs(j));
+                    }
                 }
             }
+            _blockAssembly.stopTimingOf(iBlock);
         }
+        buffer.mergeInto(lhs);
     }
+    _blockAssembly.finishAssemblyPass();
 
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
@@ -449,34 +733,73 @@ void NewtonRaphson::assembleJacobian( int stage, const TimeData& time )
     std::chrono::time_point<std::chrono::system_clock> tic, toc;
     std::chrono::duration<double> tictoc;
     tic = std::chrono::high_resolution_clock::now();
-
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    _spMatrix->setEvaluationContextTo(stage, UNASSIGNED, time);
+    
+    // Only cells outside condensed domains contribute to the Jacobian of
+    // the retained equations
+    BlockAssembly& assembly = _condenseDomains ? _retainedAssembly : _blockAssembly;
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel
 #endif
-    for ( int i = 0; i < nCells; i++ )
     {
-        Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
-        Numerics* numerics = analysisModel().domainManager().giveNumericsFor(curCell);
+        int threadNum = 0, nThreads = 1;
+#ifdef _OPENMP
+        threadNum = omp_get_thread_num();
+        nThreads = omp_get_num_threads();
+#endif
+        int firstBlock, endBlock;
+        std::tie(firstBlock, endBlock) = assembly.giveBlockRangeOfThread(threadNum, nThreads);
         
-        std::vector<Dof*> rowDof, colDof;
-        RealVector coefVal;
-
-        std::tie(rowDof,colDof,coefVal) = numerics->giveStaticCoefficientMatrixAt(curCell, stage, UNASSIGNED, time);
-
-        for ( int j = 0; j < (int)rowDof.size(); j++ )
+        AssemblyBuffer buffer;
+        CoefficientMatrixBatch batch;
+        for ( int iBlock = firstBlock; iBlock < endBlock; iBlock++ )
         {
-            if ( rowDof[j] && colDof[j] )
+            assembly.startTimingOf(iBlock);
+            int firstBatch, endBatch;
+            std::tie(firstBatch, endBatch) = assembly.giveBatchRangeOfBlock(iBlock);
+            for ( int iBatch = firstBatch; iBatch < endBatch; iBatch++ )
             {
-                int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
-                int colNum = analysisModel().dofManager().giveEquationNumberAt(colDof[j]);
+                // Coefficient matrices of all cells in the batch
+                batch.clear();
+                Numerics* numerics = assembly.giveNumericsOfBatch(iBatch);
+                if ( _cacheElementMatrices )
+                    _elMatCache.giveCoefficientMatricesAt(assembly.giveCellsOfBatch(iBatch), numerics, stage, UNASSIGNED, time, batch);
+                else
+                    numerics->giveStaticCoefficientMatricesAt(assembly.giveCellsOfBatch(iBatch), stage, UNASSIGNED, time, batch);
+
+                for ( int j = 0; j < (int)batch.rowDof.size(); j++ )
+                {
+                    if ( batch.rowDof[j] && batch.colDof[j] )
+                    {
+                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(batch.rowDof[j]);
+                        int colNum = analysisModel().dofManager().giveEquationNumberAt(batch.colDof[j]);
 
-                if ( rowNum != UNASSIGNED && colNum != UNASSIGNED )
-                    _spMatrix->atomicAddToComponent(rowNum, colNum, coefVal(j));
+                        if ( rowNum != UNASSIGNED && colNum != UNASSIGNED )
+                        {
+                            if ( _condenseDomains )
+                            {
+                                rowNum = _condensation.giveRetainedEquationFor(rowNum);
+                                colNum = _condensation.giveRetainedEquationFor(colNum);
+                            }
+                            
+                            if ( assembly.ownsRow(iBlock, rowNum) )
+                                _spMatrix->addToComponent(rowNum, colNum, batch.coefVal[j]);
+                            else
+                                buffer.addToMatrixComponent(rowNum, colNum, batch.coefVal[j]);
+                        }
+                    }
+                }
             }
+            assembly.stopTimingOf(iBlock);
         }
+        buffer.mergeInto(_spMatrix);
     }
+    assembly.finishAssemblyPass();
+    if ( _condenseDomains )
+        _condensation.addSchurComplementTo(_spMatrix);
+    if ( _cacheElementMatrices )
+        _elMatCache.reportAccesses();
 
     toc = std::chrono::high_resolution_clock::now();
     tictoc = toc - tic;
@@ -494,9 +817,15 @@ RealVector NewtonRaphson::assembleRightHandSide( int stage
 
     RealVector rhs(_nUnknowns);
     
-    // Loop through all field conditions
-    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    // Contributions of field conditions with uniform values on domains with
+    // state-independent right hand sides are formed once and scaled by the
+    // current value
+    std::vector<const CachedLoadVector*> loadVector(fldCond.size(), nullptr);
+    for ( int ifc = 0; ifc < (int)fldCond.size(); ifc++ )
+        if ( _loadVectorCache.appliesTo(fldCond[ifc]) )
+            loadVector[ifc] = &_loadVectorCache.giveLoadVectorFor(fldCond[ifc], stage, time);
     
+    // Loop through all field conditions
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -505,44 +834,74 @@ RealVector NewtonRaphson::assembleRightHandSide( int stage
 #ifdef _OPENMP
         threadNum = omp_get_thread_num();
 #endif
-#ifdef _OPENMP
-#pragma omp for
-#endif
-        for ( int i = 0; i < nCells; i++ )
+        for ( int ifc = 0; ifc < (int)fldCond.size(); ifc++ )
         {
-            Cell* curCell = analysisModel().domainManager().giveDomainCell(i);
-            int label = analysisModel().domainManager().giveLabelOf(curCell);
-                
-            for ( int ifc = 0; ifc < (int)fldCond.size(); ifc++ )
+            if ( loadVector[ifc] )
             {
-                int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond[ifc].domainLabel());
-                if ( label == fcLabel )
+                double fcVal = fldCond[ifc].uniformValueAt(time);
+                int nEntries = loadVector[ifc]->dof.size();
+                
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                for ( int i = 0; i < nEntries; i++ )
                 {
-                    RealVector localRhs;
-                    std::vector<Dof*> rowDof;
+                    Dof* rowDof = loadVector[ifc]->dof[i];
+                    double localRhs = loadVector[ifc]->baseVal[i] + fcVal*loadVector[ifc]->unitVal[i];
+                    
+                    int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof);
+                    int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof);
+                    int idx = this->giveIndexForDofGroup(dofGrp);
+                    _convergenceCriterion[idx]->processLocalResidualContribution(localRhs, threadNum);
+                    
+                    if ( rowNum != UNASSIGNED )
+                    {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                        rhs(rowNum) += localRhs;
+                    }
+                    
+                    analysisModel().dofManager().addToSecondaryVariableAt(rowDof, localRhs);
+                }
+                continue;
+            }
+            
+            int fcLabel = analysisModel().domainManager().givePhysicalEntityNumberFor(fldCond[ifc].domainLabel());
+            Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(fcLabel);
+            ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(fcLabel);
+            int nCells = domCell.size();
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for ( int i = 0; i < nCells; i++ )
+            {
+                Cell* curCell = domCell[i];
 
-                    Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
-                    std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, fldCond[ifc], time);
+                RealVector localRhs;
+                std::vector<Dof*> rowDof;
 
-                    for ( int j = 0; j < localRhs.dim(); j++)
+                std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, fldCond[ifc], time);
+
+                for ( int j = 0; j < localRhs.dim(); j++)
+                {
+                    if ( rowDof[j] )
                     {
-                        if ( rowDof[j] )
-                        {
-                            int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
-                            int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
-                            int idx = this->giveIndexForDofGroup(dofGrp);
-                            _convergenceCriterion[idx]->processLocalResidualContribution(localRhs(j), threadNum);
+                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
+                        int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
+                        int idx = this->giveIndexForDofGroup(dofGrp);
+                        _convergenceCriterion[idx]->processLocalResidualContribution(localRhs(j), threadNum);
 
-                            if ( rowNum != UNASSIGNED )
-                            {
+                        if ( rowNum != UNASSIGNED )
+                        {
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-                                rhs(rowNum) += localRhs(j);
-                            }
-
-                            analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localRhs(j));
+                            rhs(rowNum) += localRhs(j);
                         }
+
+                        analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localRhs(j));
                     }
                 }
             }
@@ -555,7 +914,8 @@ RealVector NewtonRaphson::assembleRightHandSide( int stage
         int boundaryId = analysisModel().domainManager().givePhysicalEntityNumberFor(bndCond[ibc].boundaryName());
         Numerics* numerics = analysisModel().numericsManager().giveNumerics(bndCond[ibc].targetNumerics());
         
-        int nBCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
+        ArraySpan<Cell* const> bndCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(boundaryId);
+        int nBCells = bndCell.size();
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -566,40 +926,36 @@ RealVector NewtonRaphson::assembleRightHandSide( int stage
             threadNum = omp_get_thread_num();
 #endif
 #ifdef _OPENMP
-#pragma omp for
+#pragma omp for schedule(static)
 #endif
             for ( int i = 0; i < nBCells; i++ ) 
             {
-                Cell* curCell = analysisModel().domainManager().giveBoundaryCell(i);
-                int label = analysisModel().domainManager().giveLabelOf(curCell);
+                Cell* curCell = bndCell[i];
 
-                if ( label == boundaryId )
-                {
-                    RealVector localRhs;
-                    std::vector<Dof*> rowDof;
+                RealVector localRhs;
+                std::vector<Dof*> rowDof;
 
-                    // Specifics of BC imposition are handled by numerics
-                    std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, bndCond[ibc], time);
-                    
-                    for ( int j = 0; j < localRhs.dim(); j++)
+                // Specifics of BC imposition are handled by numerics
+                std::tie(rowDof,localRhs) = numerics->giveStaticRightHandSideAt(curCell, stage, UNASSIGNED, bndCond[ibc], time);
+                
+                for ( int j = 0; j < localRhs.dim(); j++)
+                {
+                    if ( rowDof[j] )
                     {
-                        if ( rowDof[j] )
+                        int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
+                        int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
+                        int idx = this->giveIndexForDofGroup(dofGrp);
+                        _convergenceCriterion[idx]->processLocalResidualContribution(localRhs(j), threadNum);
+                        
+                        if ( rowNum != UNASSIGNED )
                         {
-                            int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[j]);
-                            int dofGrp = analysisModel().dofManager().giveGroupNumberFor(rowDof[j]);
-                            int idx = this->giveIndexForDofGroup(dofGrp);
-                            _convergenceCriterion[idx]->processLocalResidualContribution(localRhs(j), threadNum);
-                            
-                            if ( rowNum != UNASSIGNED )
-                            {
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-                                rhs(rowNum) += localRhs(j);
-                            }
-
-                            analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localRhs(j));
+                            rhs(rowNum) += localRhs(j);
                         }
+
+                        analysisModel().dofManager().addToSecondaryVariableAt(rowDof[j], localRhs(j));
                     }
                 }
             }
@@ -613,6 +969,21 @@ RealVector NewtonRaphson::assembleRightHandSide( int stage
     return rhs;
 }
 // ---------------------------------------------------------------------------
+void NewtonRaphson::shiftPrimaryVariables( const RealVector& dU, double scale )
+{
+    int nActiveDof = (int)_activeDof.size();
+    
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for ( int j = 0; j < nActiveDof; j++ )
+    {
+        int eqNo = _activeDofEqNo[j];
+        if ( eqNo != UNASSIGNED )
+            analysisModel().dofManager().updatePrimaryVariableAt(_activeDof[j], scale*dU(eqNo), correction);
+    }
+}
+// ---------------------------------------------------------------------------
 int NewtonRaphson::giveIndexForDofGroup( int dofGroupNum )
 {
     int idx = -1;
@@ -25,6 +25,10 @@
 #define	NEWTONRAPHSON_HPP
 
 #include "SolutionMethod.hpp"
+#include "ConvergenceCriteria/ConvergenceCriterion.hpp"
+#include "Core/BlockAssembly.hpp"
+#include "Core/ElementMatrixCache.hpp"
+#include "Core/StaticCondensation.hpp"
 #include <map>
 #include <tuple>
 #include <vector>
@@ -62,11 +66,48 @@ namespace broomstyx
         int           _nUnknowns;
         double        _overRelaxation;
         
+        // Energy-based line search with adaptive damping of the initial
+        // step length, used in place of constant over-relaxation
+        bool   _lineSearch;
+        int    _maxLineSearchTrials;
+        double _lineSearchTolerance;
+        double _damping;
+        
         std::vector<ConvergenceCriterion*> _convergenceCriterion;
+        std::vector<DofGroupNorms>         _dofGrpNorms;
         int _maxIter;
         int _substepCount;
         bool _abortAtMaxIter;
         
+        // Active DOFs at stage with their equation numbers and DOF group
+        // indices, cached when the sparsity profile is formed
+        std::vector<Dof*> _activeDof;
+        std::vector<int>  _activeDofEqNo;
+        std::vector<int>  _activeDofGrpIdx;
+        
+        // Blocks of cells assembled as separate tasks
+        BlockAssembly _blockAssembly;
+        
+        // Optional reuse of element matrices between assemblies
+        bool               _cacheElementMatrices;
+        ElementMatrixCache _elMatCache;
+        
+        // Optional static condensation of domains with constant coefficient
+        // matrices. The Jacobian is then assembled from the remaining cells
+        // only, over the retained equations.
+        bool               _condenseDomains;
+        StaticCondensation _condensation;
+        BlockAssembly      _retainedAssembly;
+        
+        void applyCorrection( const RealVector& dU );
+        void applyCorrectionWithLineSearch( int stage
+                                          , const TimeData& time
+                                          , const RealVector& dU
+                                          , const RealVector& rhs
+                                          , const RealVector& resid );
+        void shiftPrimaryVariables( const RealVector& dU, double scale );
+        void computeResidualNorms( const RealVector& resid );
+        
         virtual RealVector assembleLeftHandSide( int stage, const TimeData& time );
         virtual void       assembleJacobian( int stage, const TimeData& time );
         
@@ -23,6 +23,7 @@
 
 #include "SolutionMethod.hpp"
 #include <chrono>
+#include <stdexcept>
 #include "Core/AnalysisModel.hpp"
 #include "Core/Diagnostics.hpp"
 #include "Core/DomainManager.hpp"
@@ -36,6 +37,14 @@ SolutionMethod::SolutionMethod() {}
 
 SolutionMethod::~SolutionMethod() {}
 // ---------------------------------------------------------------------------
+int SolutionMethod::computeSolutionsForLoadCases( int stage
+                                                , const std::vector<std::vector<BoundaryCondition>>& bndCond
+                                                , const std::vector<std::vector<FieldCondition>>& fldCond
+                                                , TimeData& time )
+{
+    throw std::runtime_error("Solution method '" + _name + "' does not support multiple load cases!\nSource: SolutionMethod");
+}
+// ---------------------------------------------------------------------------
 void SolutionMethod::getCurrentLoadStep()
 {
     _loadStep = analysisModel().solutionManager().giveCurrentLoadStep();
@@ -56,38 +65,28 @@ void SolutionMethod::imposeConstraintsAt( int stage
         int boundaryId = analysisModel().domainManager().givePhysicalEntityNumberFor(bndCond[ibc].boundaryName());
         Numerics* numerics = analysisModel().numericsManager().giveNumerics(bndCond[ibc].targetNumerics());
         
-        int nBCells = analysisModel().domainManager().giveNumberOfBoundaryCells();
+        ArraySpan<Cell* const> bndCell = analysisModel().domainManager().giveBoundaryCellsWithLabel(boundaryId);
+        int nBCells = bndCell.size();
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
         for ( int iCell = 0; iCell < nBCells; iCell++ )
         {
-            Cell* curCell = analysisModel().domainManager().giveBoundaryCell(iCell);
-            int label = analysisModel().domainManager().giveLabelOf(curCell);
-
-            if ( label == boundaryId )
-            {
-                // Specifics of constraint imposition are handled by numerics
-                numerics->imposeConstraintAt(curCell, stage, bndCond[ibc],time);
-            }
+            // Specifics of constraint imposition are handled by numerics
+            numerics->imposeConstraintAt(bndCell[iCell], stage, bndCond[ibc],time);
         }
 
         // Some boundary conditions are actually internal conditions, so we need to loop over domain cells too
-        int nDCells = analysisModel().domainManager().giveNumberOfDomainCells();
+        ArraySpan<Cell* const> domCell = analysisModel().domainManager().giveDomainCellsWithLabel(boundaryId);
+        int nDCells = domCell.size();
 
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
         for ( int iCell = 0; iCell < nDCells; iCell++ )
         {
-            Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
-            int label = analysisModel().domainManager().giveLabelOf(curCell);
-
-            if ( label == boundaryId )
-            {
-                // Specifics of constraint imposition are handled by numerics
-                numerics->imposeConstraintAt(curCell, stage, bndCond[ibc],time);
-            }
+            // Specifics of constraint imposition are handled by numerics
+            numerics->imposeConstraintAt(domCell[iCell], stage, bndCond[ibc],time);
         }
     }
 
@@ -96,6 +95,25 @@ void SolutionMethod::imposeConstraintsAt( int stage
     diagnostics().addSetupTime(tictoc.count());
 }
 // ---------------------------------------------------------------------------
+void SolutionMethod::retrieveSolutionForLoadCase( int loadCase
+                                                , int stage
+                                                , const std::vector<BoundaryCondition>& bndCond
+                                                , const std::vector<FieldCondition>& fldCond
+                                                , TimeData& time )
+{
+    throw std::runtime_error("Solution method '" + _name + "' does not support multiple load cases!\nSource: SolutionMethod");
+}
+// ---------------------------------------------------------------------------
+bool SolutionMethod::supportsDistributedExecution()
+{
+    return false;
+}
+// ---------------------------------------------------------------------------
+bool SolutionMethod::supportsLoadCases()
+{
+    return false;
+}
+// ---------------------------------------------------------------------------
 bool broomstyx::SolutionMethod::checkConvergenceOfNumericsAt( int stage, const TimeData& time )
 {
     bool isConverged = true;
@@ -28,6 +28,7 @@
 #include <vector>
 #include "Core/BoundaryCondition.hpp"
 #include "Core/FieldCondition.hpp"
+#include "Core/LoadVectorCache.hpp"
 #include "Core/TimeData.hpp"
 #include "Util/RealVector.hpp"
 
@@ -56,14 +57,34 @@ namespace broomstyx
                                        , const std::vector<FieldCondition>& fldCond
                                        , TimeData& time ) = 0;
         
+        // Solution of several load cases sharing one coefficient matrix. The
+        // solution of each load case is transferred to the DOFs separately
+        // via retrieveSolutionForLoadCase(...)
+        virtual int  computeSolutionsForLoadCases( int stage
+                                                 , const std::vector<std::vector<BoundaryCondition>>& bndCond
+                                                 , const std::vector<std::vector<FieldCondition>>& fldCond
+                                                 , TimeData& time );
+        
+        virtual void retrieveSolutionForLoadCase( int loadCase
+                                                , int stage
+                                                , const std::vector<BoundaryCondition>& bndCond
+                                                , const std::vector<FieldCondition>& fldCond
+                                                , TimeData& time );
+        
         virtual void formSparsityProfileForStage ( int stage ) = 0;
         virtual void initializeSolvers() = 0;
         virtual void readDataFromFile( FILE* fp ) = 0;
+        virtual bool supportsDistributedExecution();
+        virtual bool supportsLoadCases();
 
     protected:
         LoadStep* _loadStep;
         std::string _name;
         
+        // Right hand side contributions of field conditions with uniform
+        // values, formed on first use in the load step
+        LoadVectorCache _loadVectorCache;
+        
         static bool checkConvergenceOfNumericsAt( int stage, const TimeData& time );
     };
 }
@@ -25,6 +25,7 @@
 #include <cmath>
 #include <cstdio>
 #include "Core/ObjectFactory.hpp"
+#include "Util/reductions.hpp"
 
 using namespace broomstyx;
 
@@ -55,7 +56,7 @@ void CSR0::addToComponent( int rowNum, int colNum, double val )
     {
         if ( _prfVec2[jdx] == colNum )
         {
-            _val(jdx) += val;
+            _val[jdx] += val;
             success = true;
         }
         else
@@ -88,7 +89,7 @@ void CSR0::atomicAddToComponent( int rowNum, int colNum, double val )
 #ifdef _OPENMP
 #pragma omp atomic
 #endif
-            _val(jdx) += val;
+            _val[jdx] += val;
             success = true;
         }
         else
@@ -108,20 +109,53 @@ void CSR0::finalizeProfile()
     for ( int i = 0; i < _dim1; i++ )
         _nnz += _nz[i].size();
 
-    // Construct arrays
-    _prfVec1.assign( _dim1 + 1, 0 );
-    _prfVec2.assign( _nnz, 0 );
+    // Construct arrays. Entries are written using the same static row
+    // partitioning as the matrix-vector product so that memory pages are
+    // first touched by the threads that later work on them.
+    _prfVec1 = std::vector<int, DefaultInitAllocator<int> >();
+    _prfVec2 = std::vector<int, DefaultInitAllocator<int> >();
+    _prfVec1.resize( _dim1 + 1 );
+    _prfVec2.resize( _nnz );
 
-    int curIdx = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < _dim1; i++ )
+        _prfVec1[i+1] = _nz[i].size();
+    
+    _prfVec1[0] = 0;
+    for ( int i = 0; i < _dim1; i++ )
+        _prfVec1[i+1] += _prfVec1[i];
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for ( int i = 0; i < _dim1; i++ )
     {
-        _prfVec1[i+1] = _prfVec1[i] + _nz[i].size();
-        std::set<int>::iterator it;
-        for ( it = _nz[i].begin(); it != _nz[i].end(); ++it )
-            _prfVec2[curIdx++] = *it;
+        int curIdx = _prfVec1[i];
+        for ( auto it = _nz[i].begin(); it != _nz[i].end(); ++it )
+            _prfVec2[curIdx++] = (*it);
     }
 }
 // ----------------------------------------------------------------------------
+RealVector CSR0::giveDiagonal()
+{
+    RealVector d(_dim1);
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < _dim1; i++ )
+        for ( int j = _prfVec1[i]; j < _prfVec1[i+1]; j++ )
+            if ( _prfVec2[j] == i )
+            {
+                d(i) = _val[j];
+                break;
+            }
+    
+    return d;
+}
+// ----------------------------------------------------------------------------
 std::tuple<int*,int*> CSR0::giveProfileArrays()
 {
     return std::make_tuple(_prfVec1.data(),_prfVec2.data());
@@ -129,12 +163,24 @@ std::tuple<int*,int*> CSR0::giveProfileArrays()
 // ----------------------------------------------------------------------------
 double* CSR0::giveValArray() 
 { 
-    return _val.ptr(); 
+    return _val.data(); 
 }
 // ----------------------------------------------------------------------------
 void CSR0::initializeValues()
 {
-    _val.init(_nnz);
+    // Storage is reused when the number of nonzeros is unchanged
+    if ( (int)_val.size() != _nnz )
+    {
+        _val = std::vector<double, DefaultInitAllocator<double> >();
+        _val.resize( _nnz );
+    }
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < _dim1; i++ )
+        for ( int j = _prfVec1[i]; j < _prfVec1[i+1]; j++ )
+            _val[j] = 0.;
 }
 // ----------------------------------------------------------------------------
 void CSR0::initializeProfile( int dim1, int dim2 )
@@ -155,15 +201,15 @@ RealVector CSR0::lumpRows()
     RealVector b(_dim1);
     
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
 #endif
     for ( int i = 0; i < _dim1; i++ )
     {
         for ( int j = _prfVec1[i]; j < _prfVec1[i+1]; j++ )
         {
-            b(i) += std::fabs(_val(j));            
+            b(i) += std::fabs(_val[j]);            
             if ( _symFlag && _prfVec2[j] != i )
-                b(_prfVec2[j]) += std::fabs(_val(j));
+                b(_prfVec2[j]) += std::fabs(_val[j]);
         }
     }
     
@@ -193,7 +239,7 @@ void CSR0::printTo( FILE* fp, int n )
         for ( int j = 0; j < diff; j++)
         {
             colCount++;
-            std::fprintf(fp, "\n%*d  %*d  %.*e", width1, i, width2, _prfVec2[colCount], n, _val(colCount));
+            std::fprintf(fp, "\n%*d  %*d  %.*e", width1, i, width2, _prfVec2[colCount], n, _val[colCount]);
         }
     }
     fprintf(fp, "\n");
@@ -208,16 +254,35 @@ RealVector CSR0::times(const RealVector& x)
     
     RealVector b(_dim1);
     
+    if ( _symFlag )
+    {
+        // Only the upper triangular portion is stored, so contributions of
+        // the lower triangular portion are scattered to other rows and must
+        // be reduced over threads
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(static) reduction(+:b)
 #endif
-    for ( int i = 0; i < _dim1; i++ )
+        for ( int i = 0; i < _dim1; i++ )
+        {
+            for ( int j = _prfVec1[i]; j < _prfVec1[i+1]; j++ )
+            {
+                b(i) += _val[j] * x(_prfVec2[j]);
+                if ( _prfVec2[j] != i )
+                    b(_prfVec2[j]) += _val[j] * x(i);
+            }
+        }
+    }
+    else
     {
-        for ( int j = _prfVec1[i]; j < _prfVec1[i+1]; j++ )
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for ( int i = 0; i < _dim1; i++ )
         {
-            b(i) += _val(j) * x(_prfVec2[j]);            
-            if ( _symFlag && _prfVec2[j] != i )
-                b(_prfVec2[j]) += _val(j) * x(i);
+            double sum = 0.;
+            for ( int j = _prfVec1[i]; j < _prfVec1[i+1]; j++ )
+                sum += _val[j] * x(_prfVec2[j]);
+            b(i) = sum;
         }
     }
     
@@ -25,6 +25,7 @@
 #define	CSR1_HPP
 
 #include "SparseMatrix.hpp"
+#include "Util/DefaultInitAllocator.hpp"
 
 namespace broomstyx
 {
@@ -38,6 +39,7 @@ namespace broomstyx
         void atomicAddToComponent( int rowNum, int colNum, double val ) override;
         void finalizeProfile() override;
         std::tuple< int*,int* > giveProfileArrays() override;
+        RealVector giveDiagonal() override;
         double* giveValArray() override;
         void initializeProfile( int dim1, int dim2 ) override;
         void initializeValues() override;
@@ -47,9 +49,9 @@ namespace broomstyx
         RealVector times( const RealVector& x ) override;
     
     private:
-        std::vector<int> _prfVec1;
-        std::vector<int> _prfVec2;
-        RealVector _val;
+        std::vector<int, DefaultInitAllocator<int> > _prfVec1;
+        std::vector<int, DefaultInitAllocator<int> > _prfVec2;
+        std::vector<double, DefaultInitAllocator<double> > _val;
         std::vector< std::set<int> > _nz;
     };
 }
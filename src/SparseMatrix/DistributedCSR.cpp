@@ -0,0 +1,254 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "DistributedCSR.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include "Core/Communicator.hpp"
+#include "Core/ObjectFactory.hpp"
+
+using namespace broomstyx;
+
+registerBroomstyxObject(SparseMatrix, DistributedCSR)
+
+// Constructor
+DistributedCSR::DistributedCSR()
+    : _rowBegin(0)
+    , _rowEnd(0)
+{}
+
+// Destructor
+DistributedCSR::~DistributedCSR() {}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void DistributedCSR::addToComponent( int rowNum, int colNum, double val )
+{
+    _val[this->giveIndexOfComponentAt(rowNum, colNum)] += val;
+}
+// ----------------------------------------------------------------------------
+void DistributedCSR::atomicAddToComponent( int rowNum, int colNum, double val )
+{
+    int idx = this->giveIndexOfComponentAt(rowNum, colNum);
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    _val[idx] += val;
+}
+// ----------------------------------------------------------------------------
+void DistributedCSR::finalizeProfile()
+{
+    int nOwned = _rowEnd - _rowBegin;
+    
+    // Ghost columns, sorted by global index and hence by owning process
+    std::set<int> ghostCol;
+    for ( int i = 0; i < nOwned; i++ )
+        for ( int col : _nz[i] )
+            if ( col < _rowBegin || col >= _rowEnd )
+                ghostCol.insert(col);
+    _ghostCol.assign(ghostCol.begin(), ghostCol.end());
+    
+    _nnz = 0;
+    _rowPtr.assign(nOwned + 1, 0);
+    for ( int i = 0; i < nOwned; i++ )
+    {
+        _nnz += _nz[i].size();
+        _rowPtr[i+1] = _nnz;
+    }
+    
+    _colIdx.resize(_nnz);
+    for ( int i = 0; i < nOwned; i++ )
+    {
+        int curIdx = _rowPtr[i];
+        for ( int col : _nz[i] )
+        {
+            if ( col >= _rowBegin && col < _rowEnd )
+                _colIdx[curIdx++] = col - _rowBegin;
+            else
+                _colIdx[curIdx++] = nOwned + (std::lower_bound(_ghostCol.begin(), _ghostCol.end(), col) - _ghostCol.begin());
+        }
+    }
+    _nz.clear();
+    
+    // Communication pattern for ghost columns
+    std::vector<int> rangeStart = communicator().gatherFromAll(_rowBegin);
+    rangeStart.push_back(_dim1);
+    _halo.initialize(_ghostCol, rangeStart);
+}
+// ----------------------------------------------------------------------------
+RealVector DistributedCSR::giveDiagonal()
+{
+    RealVector d(_dim1);
+    int nOwned = _rowEnd - _rowBegin;
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < nOwned; i++ )
+        for ( int j = _rowPtr[i]; j < _rowPtr[i+1]; j++ )
+            if ( _colIdx[j] == i )
+            {
+                d(_rowBegin + i) = _val[j];
+                break;
+            }
+    
+    return d;
+}
+// ----------------------------------------------------------------------------
+std::tuple<int,int> DistributedCSR::giveOwnedRowRange()
+{
+    return std::make_tuple(_rowBegin, _rowEnd);
+}
+// ----------------------------------------------------------------------------
+std::tuple<int*,int*> DistributedCSR::giveProfileArrays()
+{
+    return std::make_tuple(_rowPtr.data(), _colIdx.data());
+}
+// ----------------------------------------------------------------------------
+double* DistributedCSR::giveValArray()
+{
+    return _val.data();
+}
+// ----------------------------------------------------------------------------
+void DistributedCSR::initializeProfile( int dim1, int dim2 )
+{
+    _dim1 = dim1;
+    _dim2 = dim2;
+    this->setOwnedRowRangeTo(0, dim1);
+}
+// ----------------------------------------------------------------------------
+void DistributedCSR::initializeValues()
+{
+    _val.assign(_nnz, 0.);
+}
+// ----------------------------------------------------------------------------
+void DistributedCSR::insertNonzeroComponentAt( int rowIdx, int colIdx )
+{
+    // Rows owned by other processes are not stored
+    if ( rowIdx >= _rowBegin && rowIdx < _rowEnd )
+        _nz[rowIdx - _rowBegin].insert(colIdx);
+}
+// ----------------------------------------------------------------------------
+RealVector DistributedCSR::lumpRows()
+{
+    RealVector b(_dim1);
+    int nOwned = _rowEnd - _rowBegin;
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < nOwned; i++ )
+        for ( int j = _rowPtr[i]; j < _rowPtr[i+1]; j++ )
+            b(_rowBegin + i) += std::fabs(_val[j]);
+    
+    return b;
+}
+// ----------------------------------------------------------------------------
+void DistributedCSR::printTo( FILE* fp, int n )
+{
+    int nOwned = _rowEnd - _rowBegin;
+    int width = (int)std::log10((double)_dim2);
+    
+    std::fprintf(fp, "\nnRows = %d (owned: %d to %d)", _dim1, _rowBegin, _rowEnd - 1);
+    std::fprintf(fp, "\nnCols = %d", _dim2);
+    std::fprintf(fp, "\nnNonzeros = %d\n", _nnz);
+    
+    for ( int i = 0; i < nOwned; i++ )
+        for ( int j = _rowPtr[i]; j < _rowPtr[i+1]; j++ )
+        {
+            int col = _colIdx[j] < nOwned ? _rowBegin + _colIdx[j] : _ghostCol[_colIdx[j] - nOwned];
+            std::fprintf(fp, "\n%*d  %*d  %.*e", width, _rowBegin + i, width, col, n, _val[j]);
+        }
+    std::fprintf(fp, "\n");
+}
+// ----------------------------------------------------------------------------
+void DistributedCSR::setOwnedRowRangeTo( int rowBegin, int rowEnd )
+{
+    if ( rowBegin < 0 || rowEnd > _dim1 || rowEnd < rowBegin )
+        throw std::runtime_error("Invalid range of owned rows [" + std::to_string(rowBegin) + ", " 
+                + std::to_string(rowEnd) + ")!\nSource: DistributedCSR");
+    
+    _rowBegin = rowBegin;
+    _rowEnd = rowEnd;
+    _nz.assign(rowEnd - rowBegin, std::set<int>());
+}
+// ----------------------------------------------------------------------------
+RealVector DistributedCSR::times( const RealVector& x )
+{
+    if ( x.dim() != _dim2 )
+        throw std::runtime_error("\nSize mismatch in sparse matrix - vector multiplication.\n\tdim(A) = [ "
+                + std::to_string(_dim1) + " x " + std::to_string(_dim2) + " ], dim(B) = " 
+                + std::to_string(x.dim()));
+    
+    // Values at ghost columns are received from their owners
+    _halo.exchange(x, _ghostVal);
+    
+    RealVector b(_dim1);
+    int nOwned = _rowEnd - _rowBegin;
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int i = 0; i < nOwned; i++ )
+    {
+        double sum = 0.;
+        for ( int j = _rowPtr[i]; j < _rowPtr[i+1]; j++ )
+        {
+            int col = _colIdx[j];
+            sum += _val[j] * ( col < nOwned ? x(_rowBegin + col) : _ghostVal[col - nOwned] );
+        }
+        b(_rowBegin + i) = sum;
+    }
+    
+    return b;
+}
+
+// Private methods
+// ----------------------------------------------------------------------------
+int DistributedCSR::giveIndexOfComponentAt( int rowNum, int colNum )
+{
+    int nOwned = _rowEnd - _rowBegin;
+    int localCol = -1;
+    if ( colNum >= _rowBegin && colNum < _rowEnd )
+        localCol = colNum - _rowBegin;
+    else
+    {
+        auto it = std::lower_bound(_ghostCol.begin(), _ghostCol.end(), colNum);
+        if ( it != _ghostCol.end() && *it == colNum )
+            localCol = nOwned + (it - _ghostCol.begin());
+    }
+    
+    if ( rowNum >= _rowBegin && rowNum < _rowEnd && localCol >= 0 )
+    {
+        int localRow = rowNum - _rowBegin;
+        for ( int j = _rowPtr[localRow]; j < _rowPtr[localRow + 1]; j++ )
+            if ( _colIdx[j] == localCol )
+                return j;
+    }
+    
+    throw std::runtime_error("\nAttempted access to non-existing component location in sparse matrix:\n\trow = "
+            + std::to_string(rowNum) + ", col = " + std::to_string(colNum));
+}
@@ -0,0 +1,77 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef DISTRIBUTEDCSR_HPP
+#define DISTRIBUTEDCSR_HPP
+
+#include "SparseMatrix.hpp"
+#include "Core/HaloExchange.hpp"
+
+namespace broomstyx
+{
+    // Compressed sparse row storage of the rows owned by the current
+    // process. Column indices are global; columns owned by other processes
+    // (ghost columns) are exchanged with their owners in each matrix-vector
+    // product. Rows are always stored in full, since the transposed
+    // contributions of a symmetric matrix would belong to other processes.
+    class DistributedCSR : public SparseMatrix
+    {
+    public:
+        DistributedCSR();
+        virtual ~DistributedCSR();
+
+        void addToComponent( int rowNum, int colNum, double val ) override;
+        void atomicAddToComponent( int rowNum, int colNum, double val ) override;
+        void finalizeProfile() override;
+        std::tuple< int,int > giveOwnedRowRange() override;
+        std::tuple< int*,int* > giveProfileArrays() override;
+        RealVector giveDiagonal() override;
+        double* giveValArray() override;
+        void initializeProfile( int dim1, int dim2 ) override;
+        void initializeValues() override;
+        void insertNonzeroComponentAt( int rowIdx, int colIdx ) override;
+        RealVector lumpRows() override;
+        void       printTo( FILE* fp, int n ) override;
+        void       setOwnedRowRangeTo( int rowBegin, int rowEnd ) override;
+        RealVector times( const RealVector& x ) override;
+        
+    private:
+        int _rowBegin;
+        int _rowEnd;
+        
+        // Row pointers and local column indices. Owned columns come first,
+        // followed by ghost columns in the order of _ghostCol.
+        std::vector<int> _rowPtr;
+        std::vector<int> _colIdx;
+        std::vector<double> _val;
+        std::vector< std::set<int> > _nz;
+        
+        std::vector<int> _ghostCol;
+        std::vector<double> _ghostVal;
+        HaloExchange _halo;
+        
+        int giveIndexOfComponentAt( int rowNum, int colNum );
+    };
+}
+
+#endif /* DISTRIBUTEDCSR_HPP */
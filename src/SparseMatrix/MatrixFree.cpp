@@ -0,0 +1,179 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "MatrixFree.hpp"
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include "Core/AnalysisModel.hpp"
+#include "Core/DofManager.hpp"
+#include "Core/DomainManager.hpp"
+#include "Core/ObjectFactory.hpp"
+#include "Numerics/Numerics.hpp"
+
+using namespace broomstyx;
+
+registerBroomstyxObject(SparseMatrix, MatrixFree)
+
+// Constructor
+MatrixFree::MatrixFree()
+    : _hasContext(false)
+    , _stage(UNASSIGNED)
+    , _subsys(UNASSIGNED)
+{
+    _nnz = 0;
+}
+
+// Destructor
+MatrixFree::~MatrixFree() {}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void MatrixFree::addToComponent( int rowNum, int colNum, double val )
+{
+    // Only diagonal components are retained
+    if ( rowNum == colNum )
+        _diag(rowNum) += val;
+}
+// ----------------------------------------------------------------------------
+void MatrixFree::atomicAddToComponent( int rowNum, int colNum, double val )
+{
+    // Only diagonal components are retained
+    if ( rowNum == colNum )
+    {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        _diag(rowNum) += val;
+    }
+}
+// ----------------------------------------------------------------------------
+void MatrixFree::finalizeProfile()
+{
+    // No sparsity profile is stored
+    _nnz = 0;
+}
+// ----------------------------------------------------------------------------
+std::tuple<int*,int*> MatrixFree::giveProfileArrays()
+{
+    throw std::runtime_error("Matrix-free operator does not store profile arrays!\nSource: MatrixFree");
+}
+// ----------------------------------------------------------------------------
+RealVector MatrixFree::giveDiagonal()
+{
+    return _diag;
+}
+// ----------------------------------------------------------------------------
+double* MatrixFree::giveValArray()
+{
+    throw std::runtime_error("Matrix-free operator does not store matrix components!\nSource: MatrixFree");
+}
+// ----------------------------------------------------------------------------
+void MatrixFree::initializeProfile( int dim1, int dim2 )
+{
+    if ( dim1 != dim2 )
+        throw std::runtime_error("Matrix-free operator must be square!\nSource: MatrixFree");
+    
+    _dim1 = dim1;
+    _dim2 = dim2;
+    _diag.init(_dim1);
+}
+// ----------------------------------------------------------------------------
+void MatrixFree::initializeValues()
+{
+    _diag.init(_dim1);
+}
+// ----------------------------------------------------------------------------
+void MatrixFree::insertNonzeroComponentAt( int rowIdx, int colIdx )
+{
+    // No sparsity profile is stored
+}
+// ----------------------------------------------------------------------------
+RealVector MatrixFree::lumpRows()
+{
+    throw std::runtime_error("Row lumping is not supported by matrix-free operator!\nSource: MatrixFree");
+}
+// ----------------------------------------------------------------------------
+void MatrixFree::printTo( FILE* fp, int n )
+{
+    std::fprintf(fp, "\nnRows = %d", _dim1);
+    std::fprintf(fp, "\nnCols = %d", _dim2);
+    std::fprintf(fp, "\nMatrix-free operator, diagonal components:\n");
+    for ( int i = 0; i < _dim1; i++ )
+        std::fprintf(fp, "\n%d  %.*e", i, n, _diag(i));
+}
+// ----------------------------------------------------------------------------
+void MatrixFree::setEvaluationContextTo( int stage, int subsys, const TimeData& time )
+{
+    _stage = stage;
+    _subsys = subsys;
+    _time = time;
+    _hasContext = true;
+}
+// ----------------------------------------------------------------------------
+RealVector MatrixFree::times( const RealVector& x )
+{
+    if ( x.dim() != _dim2 )
+        throw std::runtime_error("\nSize mismatch in sparse matrix - vector multiplication.\n\tdim(A) = [ "
+                + std::to_string(_dim1) + " x " + std::to_string(_dim2) + " ], dim(B) = " 
+                + std::to_string(x.dim()));
+    
+    if ( !_hasContext )
+        throw std::runtime_error("Matrix-free operator was used before being assigned an evaluation context!\n"
+                + std::string("Solution method might not support matrix-free operators.\nSource: MatrixFree"));
+    
+    RealVector b(_dim1);
+    int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+    
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( int iCell = 0; iCell < nCells; iCell++ )
+    {
+        Cell* curCell = analysisModel().domainManager().giveDomainCell(iCell);
+        int label = analysisModel().domainManager().giveLabelOf(curCell);
+        Numerics* numerics = analysisModel().domainManager().giveNumericsForDomain(label);
+        
+        std::vector<Dof*> rowDof;
+        RealVector prodVal;
+        std::tie(rowDof, prodVal) = numerics->giveStaticCoefficientMatrixProductAt(curCell, _stage, _subsys, _time, x);
+        
+        int nRows = rowDof.size();
+        for ( int i = 0; i < nRows; i++ )
+        {
+            if ( rowDof[i] )
+            {
+                int rowNum = analysisModel().dofManager().giveEquationNumberAt(rowDof[i]);
+                if ( rowNum != UNASSIGNED )
+                {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                    b(rowNum) += prodVal(i);
+                }
+            }
+        }
+    }
+    
+    return b;
+}
@@ -0,0 +1,66 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef MATRIXFREE_HPP
+#define	MATRIXFREE_HPP
+
+#include "SparseMatrix.hpp"
+#include "Core/TimeData.hpp"
+
+namespace broomstyx
+{
+    // Operator that does not store the coefficient matrix. Products are
+    // evaluated on the fly from the cell kernels of the numerics assigned to
+    // each domain, while only the diagonal is kept from assembly for use in
+    // preconditioning.
+    class MatrixFree : public SparseMatrix
+    {
+    public:
+        MatrixFree();
+        virtual ~MatrixFree();
+
+        void addToComponent( int rowNum, int colNum, double val ) override;
+        void atomicAddToComponent( int rowNum, int colNum, double val ) override;
+        void finalizeProfile() override;
+        std::tuple< int*,int* > giveProfileArrays() override;
+        RealVector giveDiagonal() override;
+        double* giveValArray() override;
+        void initializeProfile( int dim1, int dim2 ) override;
+        void initializeValues() override;
+        void insertNonzeroComponentAt( int rowIdx, int colIdx) override;
+        RealVector lumpRows() override;
+        void       printTo( FILE* fp, int n ) override;
+        void       setEvaluationContextTo( int stage, int subsys, const TimeData& time ) override;
+        RealVector times( const RealVector& x ) override;
+        
+    private:
+        RealVector _diag;
+        
+        bool     _hasContext;
+        int      _stage;
+        int      _subsys;
+        TimeData _time;
+    };
+}
+
+#endif	/* MATRIXFREE_HPP */
@@ -53,6 +53,13 @@ int SparseMatrix::giveNumberOfNonzeros()
     return _nnz; 
 }
 // ----------------------------------------------------------------------------
+std::tuple<int,int> SparseMatrix::giveOwnedRowRange()
+{
+    // All rows are stored by the current process unless the format
+    // distributes them over processes
+    return std::make_tuple(0, _dim1);
+}
+// ----------------------------------------------------------------------------
 bool SparseMatrix::isSymmetric()
 {
     return _symFlag;
@@ -61,4 +68,16 @@ bool SparseMatrix::isSymmetric()
 void SparseMatrix::setSymmetryTo(bool true_or_false )
 { 
     _symFlag = true_or_false;
-}
\ No newline at end of file
+}
+// ----------------------------------------------------------------------------
+void SparseMatrix::setEvaluationContextTo( int stage, int subsys, const TimeData& time )
+{
+    // Assembled formats do not need to know how their components were
+    // calculated. Operators that evaluate their components on the fly
+    // should override this.
+}
+// ----------------------------------------------------------------------------
+void SparseMatrix::setOwnedRowRangeTo( int rowBegin, int rowEnd )
+{
+    throw std::runtime_error("Sparse matrix format does not support distribution of rows over processes!\nSource: SparseMatrix");
+}
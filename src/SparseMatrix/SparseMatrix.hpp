@@ -32,6 +32,8 @@
 
 namespace broomstyx
 {
+    class TimeData;
+    
     class SparseMatrix
     {
     public:
@@ -51,12 +53,16 @@ namespace broomstyx
         virtual void atomicAddToComponent( int rowNum, int colNum, double val ) = 0;
         virtual void finalizeProfile() = 0;
         virtual std::tuple< int*,int* > giveProfileArrays() = 0;
+        virtual RealVector giveDiagonal() = 0;
+        virtual std::tuple< int,int > giveOwnedRowRange();
         virtual double* giveValArray() = 0;
         virtual void initializeProfile( int dim1, int dim2 ) = 0;
         virtual void initializeValues() = 0;
         virtual void insertNonzeroComponentAt( int rowIdx, int colIdx ) = 0;
         virtual RealVector lumpRows() = 0;
         virtual void printTo( FILE* fp, int n ) = 0;
+        virtual void setEvaluationContextTo( int stage, int subsys, const TimeData& time );
+        virtual void setOwnedRowRangeTo( int rowBegin, int rowEnd );
         virtual RealVector times( const RealVector& x ) = 0;
 
     protected:
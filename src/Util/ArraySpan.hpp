@@ -0,0 +1,54 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef ARRAYSPAN_HPP
+#define	ARRAYSPAN_HPP
+
+namespace broomstyx
+{
+    // Non-owning view of a contiguous range of objects, used to expose rows
+    // of compressed adjacency arrays without copying them. A span remains
+    // valid only as long as the array it refers to is not resized or
+    // rebuilt.
+    
+    template <typename T>
+    class ArraySpan
+    {
+    public:
+        ArraySpan() : _first(nullptr), _size(0) {}
+        ArraySpan( T* first, int size ) : _first(first), _size(size) {}
+        
+        T* begin() const { return _first; }
+        T* end() const { return _first + _size; }
+        bool empty() const { return _size == 0; }
+        int size() const { return _size; }
+        
+        T& operator[]( int i ) const { return _first[i]; }
+        
+    private:
+        T*  _first;
+        int _size;
+    };
+}
+
+#endif	/* ARRAYSPAN_HPP */
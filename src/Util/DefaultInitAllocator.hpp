@@ -0,0 +1,65 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef DEFAULTINITALLOCATOR_HPP
+#define	DEFAULTINITALLOCATOR_HPP
+
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace broomstyx
+{
+    // Allocator whose value-initialization (e.g. from std::vector::resize)
+    // leaves trivial types uninitialized. This keeps the memory pages of
+    // large arrays untouched until they are filled within parallel loops, so
+    // that first touch places them near the threads that use them.
+    
+    template <typename T, typename A = std::allocator<T> >
+    class DefaultInitAllocator : public A
+    {
+        typedef std::allocator_traits<A> a_t;
+        
+    public:
+        template <typename U> struct rebind
+        {
+            using other = DefaultInitAllocator<U, typename a_t::template rebind_alloc<U> >;
+        };
+        
+        using A::A;
+        
+        template <typename U>
+        void construct( U* ptr ) noexcept( std::is_nothrow_default_constructible<U>::value )
+        {
+            ::new(static_cast<void*>(ptr)) U;
+        }
+        
+        template <typename U, typename... Args>
+        void construct( U* ptr, Args&&... args )
+        {
+            a_t::construct(static_cast<A&>(*this), ptr, std::forward<Args>(args)...);
+        }
+    };
+}
+
+#endif	/* DEFAULTINITALLOCATOR_HPP */
@@ -0,0 +1,96 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "MappedFile.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace broomstyx;
+
+// Constructor
+MappedFile::MappedFile()
+    : _data(nullptr)
+    , _size(0)
+{}
+
+// Destructor
+MappedFile::~MappedFile()
+{
+    this->close();
+}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void MappedFile::close()
+{
+    if ( _data )
+        munmap(const_cast<char*>(_data), _size);
+    
+    _data = nullptr;
+    _size = 0;
+}
+// ----------------------------------------------------------------------------
+bool MappedFile::open( const std::string& filename )
+{
+    this->close();
+    
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if ( fd < 0 )
+        return false;
+    
+    struct stat fileStat;
+    if ( fstat(fd, &fileStat) != 0 || fileStat.st_size == 0 )
+    {
+        ::close(fd);
+        return false;
+    }
+    
+    void* addr = mmap(nullptr, (std::size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if ( addr == MAP_FAILED )
+        return false;
+    
+    _data = static_cast<const char*>(addr);
+    _size = (std::size_t)fileStat.st_size;
+    
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+namespace broomstyx
+{
+    std::uint64_t giveHashOf( const void* data, std::size_t size, std::uint64_t seed )
+    {
+        const unsigned char* byte = static_cast<const unsigned char*>(data);
+        std::uint64_t hash = seed;
+        for ( std::size_t i = 0; i < size; i++ )
+        {
+            hash ^= byte[i];
+            hash *= 1099511628211ULL;
+        }
+        
+        return hash;
+    }
+}
@@ -0,0 +1,60 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef MAPPEDFILE_HPP
+#define	MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace broomstyx
+{
+    // Read-only memory mapping of a file. The mapping is released when the
+    // object is destroyed, so pointers into it must not outlive it.
+    
+    class MappedFile
+    {
+    public:
+        MappedFile();
+        ~MappedFile();
+        
+        // Disable copy constructor and assignment operator
+        MappedFile( const MappedFile& ) = delete;
+        MappedFile& operator=( const MappedFile& ) = delete;
+        
+        void        close();
+        const char* data() const { return _data; }
+        bool        open( const std::string& filename );
+        std::size_t size() const { return _size; }
+        
+    private:
+        const char* _data;
+        std::size_t _size;
+    };
+    
+    // 64-bit FNV-1a hash, chainable through 'seed'
+    std::uint64_t giveHashOf( const void* data, std::size_t size, std::uint64_t seed = 14695981039346656037ULL );
+}
+
+#endif	/* MAPPEDFILE_HPP */
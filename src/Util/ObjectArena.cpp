@@ -0,0 +1,138 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "ObjectArena.hpp"
+#include <cstdint>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define ARENA_BLOCK_SIZE 65536
+
+using namespace broomstyx;
+
+// Constructor
+ObjectArena::ObjectArena()
+{
+    int nThreads = 1;
+#ifdef _OPENMP
+    nThreads = omp_get_max_threads();
+#endif
+    
+    // One pool per thread plus one shared pool for threads beyond the number
+    // known at construction
+    _pool.assign(nThreads + 1, Pool());
+    for ( auto& pool : _pool )
+    {
+        pool.used = 0;
+        pool.nObjects = 0;
+        pool.isShared = false;
+    }
+    _pool.back().isShared = true;
+}
+
+// Destructor
+ObjectArena::~ObjectArena()
+{
+    this->clear();
+}
+
+// Public methods
+// ----------------------------------------------------------------------------
+void ObjectArena::clear()
+{
+    for ( auto& pool : _pool )
+    {
+        for ( auto it = pool.destructor.rbegin(); it != pool.destructor.rend(); ++it )
+            it->fcn(it->obj);
+        
+        for ( auto curBlock : pool.block )
+            ::operator delete(curBlock);
+        
+        pool.block.clear();
+        pool.blockSize.clear();
+        pool.destructor.clear();
+        pool.used = 0;
+        pool.nObjects = 0;
+    }
+}
+// ----------------------------------------------------------------------------
+std::size_t ObjectArena::giveNumberOfObjects() const
+{
+    std::size_t nObjects = 0;
+    for ( auto& pool : _pool )
+        nObjects += pool.nObjects;
+    
+    return nObjects;
+}
+// ----------------------------------------------------------------------------
+std::size_t ObjectArena::giveReservedBytes() const
+{
+    std::size_t nBytes = 0;
+    for ( auto& pool : _pool )
+        for ( auto curSize : pool.blockSize )
+            nBytes += curSize;
+    
+    return nBytes;
+}
+
+// Private methods
+// ----------------------------------------------------------------------------
+void* ObjectArena::allocateFrom( Pool& pool, std::size_t size, std::size_t alignment )
+{
+    if ( !pool.block.empty() )
+    {
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(pool.block.back());
+        std::uintptr_t addr = (base + pool.used + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+        if ( addr + size <= base + pool.blockSize.back() )
+        {
+            pool.used = addr + size - base;
+            return reinterpret_cast<void*>(addr);
+        }
+    }
+    
+    // Start a new block; oversized objects get a block of their own
+    std::size_t newBlockSize = ( size + alignment > ARENA_BLOCK_SIZE ) ? size + alignment : ARENA_BLOCK_SIZE;
+    pool.block.push_back(static_cast<char*>(::operator new(newBlockSize)));
+    pool.blockSize.push_back(newBlockSize);
+    
+    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(pool.block.back());
+    std::uintptr_t addr = (base + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+    pool.used = addr + size - base;
+    
+    return reinterpret_cast<void*>(addr);
+}
+// ----------------------------------------------------------------------------
+ObjectArena::Pool& ObjectArena::givePoolForCurrentThread()
+{
+    int threadNum = 0;
+#ifdef _OPENMP
+    threadNum = omp_get_thread_num();
+#endif
+    
+    if ( threadNum < (int)_pool.size() - 1 )
+        return _pool[threadNum];
+    else
+        return _pool.back();
+}
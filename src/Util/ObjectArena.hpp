@@ -0,0 +1,112 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef OBJECTARENA_HPP
+#define	OBJECTARENA_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace broomstyx
+{
+    // Arena for many small, long-lived objects (e.g. numerics and material
+    // status objects). Objects are placed contiguously in large blocks, in
+    // creation order, instead of being allocated individually. Each OpenMP
+    // thread allocates from its own pool so that creation within a
+    // statically scheduled loop over cells is lock-free and keeps objects in
+    // cell order. Objects cannot be freed individually; clear() runs all
+    // destructors and releases the blocks en bloc.
+    
+    class ObjectArena final
+    {
+    public:
+        ObjectArena();
+        ~ObjectArena();
+        
+        // Disable copy constructor and assignment operator
+        ObjectArena( const ObjectArena& ) = delete;
+        ObjectArena& operator=( const ObjectArena& ) = delete;
+        
+        template <typename T, typename... Args>
+        T* create( Args&&... args )
+        {
+            Pool& pool = this->givePoolForCurrentThread();
+            if ( pool.isShared )
+            {
+                std::lock_guard<std::mutex> guard(_sharedPoolMutex);
+                return this->createIn<T>(pool, std::forward<Args>(args)...);
+            }
+            else
+                return this->createIn<T>(pool, std::forward<Args>(args)...);
+        }
+        
+        void        clear();
+        std::size_t giveNumberOfObjects() const;
+        std::size_t giveReservedBytes() const;
+        
+    private:
+        struct Destructor
+        {
+            void* obj;
+            void (*fcn)( void* );
+        };
+        
+        // Pools are padded to separate cache lines to avoid false sharing
+        struct alignas(64) Pool
+        {
+            std::vector<char*>      block;
+            std::vector<std::size_t> blockSize;
+            std::size_t             used;
+            std::vector<Destructor> destructor;
+            std::size_t             nObjects;
+            bool                    isShared;
+        };
+        
+        std::vector<Pool> _pool;
+        std::mutex        _sharedPoolMutex;
+        
+        template <typename T, typename... Args>
+        T* createIn( Pool& pool, Args&&... args )
+        {
+            void* mem = this->allocateFrom(pool, sizeof(T), alignof(T));
+            T* obj = ::new(mem) T(std::forward<Args>(args)...);
+            if ( !std::is_trivially_destructible<T>::value )
+                pool.destructor.push_back({obj, &ObjectArena::destroyObject<T>});
+            ++pool.nObjects;
+            
+            return obj;
+        }
+        
+        template <typename T>
+        static void destroyObject( void* obj ) { static_cast<T*>(obj)->~T(); }
+        
+        void* allocateFrom( Pool& pool, std::size_t size, std::size_t alignment );
+        Pool& givePoolForCurrentThread();
+    };
+}
+
+#endif	/* OBJECTARENA_HPP */
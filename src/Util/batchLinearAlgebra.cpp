@@ -0,0 +1,132 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "batchLinearAlgebra.hpp"
+
+namespace broomstyx
+{
+    // ---------------------------------------------------------------------------
+    void gatherIntoLane( RealMatrix& A, int lane, double* batchA )
+    {
+        if ( A.isScaled() || A.isTransposed() )
+            A.simplify();
+        
+        int nRows = A.dim1();
+        int nCols = A.dim2();
+        
+        for ( int i = 0; i < nRows; i++ )
+            for ( int j = 0; j < nCols; j++ )
+                batchA[ (i*nCols + j)*simdBatchWidth + lane ] = A(i,j);
+    }
+    // ---------------------------------------------------------------------------
+    void addBatchedBtCB( int           nStrain
+                       , int           nDof
+                       , const double* bmat
+                       , const double* cmat
+                       , const double* weight
+                       , double*       kmat
+                       , double*       work )
+    {
+        const int W = simdBatchWidth;
+        
+        // work = weight*C*B
+        for ( int i = 0; i < nStrain; i++ )
+            for ( int j = 0; j < nDof; j++ )
+            {
+                double* w = work + (i*nDof + j)*W;
+#pragma GCC ivdep
+                for ( int lane = 0; lane < W; lane++ )
+                    w[ lane ] = 0.;
+                
+                for ( int k = 0; k < nStrain; k++ )
+                {
+                    const double* c = cmat + (i*nStrain + k)*W;
+                    const double* b = bmat + (k*nDof + j)*W;
+#pragma GCC ivdep
+                    for ( int lane = 0; lane < W; lane++ )
+                        w[ lane ] += c[ lane ]*b[ lane ];
+                }
+                
+#pragma GCC ivdep
+                for ( int lane = 0; lane < W; lane++ )
+                    w[ lane ] *= weight[ lane ];
+            }
+        
+        // K += trp(B)*work
+        for ( int i = 0; i < nDof; i++ )
+            for ( int j = 0; j < nDof; j++ )
+            {
+                double* k = kmat + (i*nDof + j)*W;
+                for ( int s = 0; s < nStrain; s++ )
+                {
+                    const double* b = bmat + (s*nDof + i)*W;
+                    const double* w = work + (s*nDof + j)*W;
+#pragma GCC ivdep
+                    for ( int lane = 0; lane < W; lane++ )
+                        k[ lane ] += b[ lane ]*w[ lane ];
+                }
+            }
+    }
+    // ---------------------------------------------------------------------------
+    void addBtCBx( int           nStrain
+                 , int           nDof
+                 , const double* bmat
+                 , const double* cmat
+                 , double        weight
+                 , const double* x
+                 , double*       y )
+    {
+        double strain[ maxStrainComponents ] = {0.};
+        double stress[ maxStrainComponents ] = {0.};
+        
+        // strain = B*x
+        for ( int j = 0; j < nDof; j++ )
+        {
+            const double* b = bmat + j*nStrain;
+#pragma GCC ivdep
+            for ( int i = 0; i < nStrain; i++ )
+                strain[ i ] += b[ i ]*x[ j ];
+        }
+        
+        // stress = weight*C*strain
+        for ( int k = 0; k < nStrain; k++ )
+        {
+            const double* c = cmat + k*nStrain;
+            double s = weight*strain[ k ];
+#pragma GCC ivdep
+            for ( int i = 0; i < nStrain; i++ )
+                stress[ i ] += c[ i ]*s;
+        }
+        
+        // y += trp(B)*stress
+        for ( int j = 0; j < nDof; j++ )
+        {
+            const double* b = bmat + j*nStrain;
+            double val = 0.;
+            for ( int i = 0; i < nStrain; i++ )
+                val += b[ i ]*stress[ i ];
+            
+            y[ j ] += val;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef BATCHLINEARALGEBRA_HPP
+#define BATCHLINEARALGEBRA_HPP
+
+#include "RealMatrix.hpp"
+
+namespace broomstyx
+{
+    // Number of cells whose element matrices are computed together. Batched
+    // matrices store component (i,j) of all cells contiguously, i.e. the
+    // value for cell 'lane' is at [(i*nCols + j)*simdBatchWidth + lane], so
+    // that operations on all cells of a batch vectorize over the lanes.
+    const int simdBatchWidth = 8;
+    
+    // Copy matrix A of one cell into a lane of a batched matrix, resolving
+    // any pending scaling or transposition of A
+    void gatherIntoLane( RealMatrix& A, int lane, double* batchA );
+    
+    // Add weight*trp(B)*C*B to the batched nDof x nDof matrix K, where B
+    // is nStrain x nDof and C is nStrain x nStrain. The workspace must hold
+    // nStrain*nDof*simdBatchWidth values.
+    void addBatchedBtCB( int           nStrain
+                       , int           nDof
+                       , const double* bmat
+                       , const double* cmat
+                       , const double* weight
+                       , double*       kmat
+                       , double*       work );
+    
+    // Largest number of strain components accepted by addBtCBx
+    const int maxStrainComponents = 6;
+    
+    // Add weight*trp(B)*C*B*x to y for a single cell without forming the
+    // nDof x nDof matrix. B and C are stored column-major as in RealMatrix.
+    void addBtCBx( int           nStrain
+                 , int           nDof
+                 , const double* bmat
+                 , const double* cmat
+                 , double        weight
+                 , const double* x
+                 , double*       y );
+}
+
+#endif /* BATCHLINEARALGEBRA_HPP */
@@ -0,0 +1,263 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "meshOrdering.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include <numeric>
+
+namespace broomstyx
+{
+    // Helper functions (not exposed)
+    // ------------------------------------------------------------------------
+    namespace
+    {
+        // Breadth-first traversal from 'root' restricted to vertices with
+        // mark[v] != stamp. Returns vertices of the last level reached and
+        // writes the number of levels into 'depth'.
+        std::vector<int> findLastLevelFrom( int root
+                                          , const std::vector<int>& adjPtr
+                                          , const std::vector<int>& adjIdx
+                                          , const std::vector<bool>& done
+                                          , std::vector<int>& mark
+                                          , int stamp
+                                          , int& depth )
+        {
+            std::vector<int> curLevel(1, root), nextLevel;
+            mark[root] = stamp;
+            depth = 0;
+            
+            while ( true )
+            {
+                nextLevel.clear();
+                for ( int v : curLevel )
+                    for ( int k = adjPtr[v]; k < adjPtr[v + 1]; k++ )
+                    {
+                        int w = adjIdx[k];
+                        if ( !done[w] && mark[w] != stamp )
+                        {
+                            mark[w] = stamp;
+                            nextLevel.push_back(w);
+                        }
+                    }
+                
+                depth++;
+                if ( nextLevel.empty() )
+                    return curLevel;
+                curLevel.swap(nextLevel);
+            }
+        }
+        
+        // --------------------------------------------------------------------
+        // Convert axis coordinates to the 'transposed' Hilbert index
+        // (J. Skilling, AIP Conf. Proc. 707, 2004)
+        void axesToTranspose( uint64_t* X, int nBits, int nDim )
+        {
+            uint64_t M = (uint64_t)1 << (nBits - 1), P, Q, t;
+            
+            // Inverse undo
+            for ( Q = M; Q > 1; Q >>= 1 )
+            {
+                P = Q - 1;
+                for ( int i = 0; i < nDim; i++ )
+                {
+                    if ( X[i] & Q )
+                        X[0] ^= P;
+                    else
+                    {
+                        t = (X[0] ^ X[i]) & P;
+                        X[0] ^= t;
+                        X[i] ^= t;
+                    }
+                }
+            }
+            
+            // Gray encode
+            for ( int i = 1; i < nDim; i++ )
+                X[i] ^= X[i - 1];
+            t = 0;
+            for ( Q = M; Q > 1; Q >>= 1 )
+                if ( X[nDim - 1] & Q )
+                    t ^= Q - 1;
+            for ( int i = 0; i < nDim; i++ )
+                X[i] ^= t;
+        }
+        
+        // --------------------------------------------------------------------
+        std::vector<int> spaceFillingCurveOrdering( const std::vector<RealVector>& point, bool hilbert )
+        {
+            int nPoints = point.size();
+            std::vector<int> perm(nPoints);
+            std::iota(perm.begin(), perm.end(), 0);
+            if ( nPoints == 0 )
+                return perm;
+            
+            // Bounding box
+            double lo[3], hi[3];
+            for ( int j = 0; j < 3; j++ )
+                lo[j] = hi[j] = point[0](j);
+            for ( int i = 1; i < nPoints; i++ )
+                for ( int j = 0; j < 3; j++ )
+                {
+                    lo[j] = std::min(lo[j], point[i](j));
+                    hi[j] = std::max(hi[j], point[i](j));
+                }
+            
+            // Treat mesh as planar if all points lie at the same z-coordinate
+            int nDim = ( hi[2] > lo[2] ) ? 3 : 2;
+            int nBits = ( nDim == 3 ) ? 21 : 31;
+            double maxInt = (double)(((uint64_t)1 << nBits) - 1);
+            
+            std::vector<uint64_t> key(nPoints, 0);
+            for ( int i = 0; i < nPoints; i++ )
+            {
+                uint64_t X[3] = {0, 0, 0};
+                for ( int j = 0; j < nDim; j++ )
+                    if ( hi[j] > lo[j] )
+                        X[j] = (uint64_t)((point[i](j) - lo[j])/(hi[j] - lo[j])*maxInt);
+                
+                if ( hilbert )
+                    axesToTranspose(X, nBits, nDim);
+                
+                // Interleave bits, most significant first
+                uint64_t curKey = 0;
+                for ( int b = nBits - 1; b >= 0; b-- )
+                    for ( int j = 0; j < nDim; j++ )
+                        curKey = (curKey << 1) | ((X[j] >> b) & 1);
+                key[i] = curKey;
+            }
+            
+            std::stable_sort(perm.begin(), perm.end(), [&key]( int a, int b ) { return key[a] < key[b]; });
+            
+            return perm;
+        }
+    }
+    
+    // ------------------------------------------------------------------------
+    std::vector<int> reverseCuthillMcKeeOrdering( const std::vector<int>& adjPtr
+                                                , const std::vector<int>& adjIdx )
+    {
+        int nVert = (int)adjPtr.size() - 1;
+        std::vector<int> perm;
+        perm.reserve(nVert);
+        
+        std::vector<int> degree(nVert);
+        for ( int i = 0; i < nVert; i++ )
+            degree[i] = adjPtr[i + 1] - adjPtr[i];
+        
+        // Candidate roots sorted by increasing degree
+        std::vector<int> byDegree(nVert);
+        std::iota(byDegree.begin(), byDegree.end(), 0);
+        std::stable_sort(byDegree.begin(), byDegree.end(), [&degree]( int a, int b ) { return degree[a] < degree[b]; });
+        
+        std::vector<bool> done(nVert, false);
+        std::vector<int> mark(nVert, -1);
+        std::vector<int> nbr;
+        int stamp = 0;
+        
+        for ( int candidate : byDegree )
+        {
+            if ( done[candidate] )
+                continue;
+            
+            // Find pseudo-peripheral root of current connected component
+            int root = candidate, depth, newDepth;
+            std::vector<int> lastLevel = findLastLevelFrom(root, adjPtr, adjIdx, done, mark, stamp++, depth);
+            while ( true )
+            {
+                int next = *std::min_element(lastLevel.begin(), lastLevel.end(), 
+                        [&degree]( int a, int b ) { return degree[a] < degree[b]; });
+                std::vector<int> nextLevel = findLastLevelFrom(next, adjPtr, adjIdx, done, mark, stamp++, newDepth);
+                if ( newDepth <= depth )
+                    break;
+                
+                root = next;
+                depth = newDepth;
+                lastLevel.swap(nextLevel);
+            }
+            
+            // Cuthill-McKee traversal, visiting neighbors by increasing degree
+            int head = perm.size();
+            perm.push_back(root);
+            done[root] = true;
+            while ( head < (int)perm.size() )
+            {
+                int v = perm[head++];
+                nbr.clear();
+                for ( int k = adjPtr[v]; k < adjPtr[v + 1]; k++ )
+                    if ( !done[adjIdx[k]] )
+                    {
+                        done[adjIdx[k]] = true;
+                        nbr.push_back(adjIdx[k]);
+                    }
+                
+                std::stable_sort(nbr.begin(), nbr.end(), [&degree]( int a, int b ) { return degree[a] < degree[b]; });
+                perm.insert(perm.end(), nbr.begin(), nbr.end());
+            }
+        }
+        
+        std::reverse(perm.begin(), perm.end());
+        return perm;
+    }
+    
+    // ------------------------------------------------------------------------
+    std::vector<int> hilbertCurveOrdering( const std::vector<RealVector>& point )
+    {
+        return spaceFillingCurveOrdering(point, true);
+    }
+    
+    // ------------------------------------------------------------------------
+    std::vector<int> mortonCurveOrdering( const std::vector<RealVector>& point )
+    {
+        return spaceFillingCurveOrdering(point, false);
+    }
+    
+    // ------------------------------------------------------------------------
+    int giveBandwidthOf( const std::vector<int>& adjPtr
+                       , const std::vector<int>& adjIdx )
+    {
+        int bandwidth = 0;
+        for ( int i = 0; i < (int)adjPtr.size() - 1; i++ )
+            for ( int k = adjPtr[i]; k < adjPtr[i + 1]; k++ )
+                bandwidth = std::max(bandwidth, std::abs(i - adjIdx[k]));
+        
+        return bandwidth;
+    }
+    
+    // ------------------------------------------------------------------------
+    long giveEnvelopeSizeOf( const std::vector<int>& adjPtr
+                           , const std::vector<int>& adjIdx )
+    {
+        long envelope = 0;
+        for ( int i = 0; i < (int)adjPtr.size() - 1; i++ )
+        {
+            int minIdx = i;
+            for ( int k = adjPtr[i]; k < adjPtr[i + 1]; k++ )
+                minIdx = std::min(minIdx, adjIdx[k]);
+            envelope += i - minIdx;
+        }
+        
+        return envelope;
+    }
+}
@@ -0,0 +1,58 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef MESHORDERING_HPP
+#define	MESHORDERING_HPP
+
+#include <vector>
+#include "RealVector.hpp"
+
+namespace broomstyx
+{
+    // All ordering functions return a permutation 'perm' such that perm[i]
+    // is the old index of the entity that is to be placed at new position i.
+    // Graphs are given in compressed form: the neighbors of vertex i are
+    // adjIdx[adjPtr[i]] ... adjIdx[adjPtr[i+1]-1].
+    
+    std::vector<int>
+    reverseCuthillMcKeeOrdering( const std::vector<int>& adjPtr
+                               , const std::vector<int>& adjIdx );
+    
+    std::vector<int>
+    hilbertCurveOrdering( const std::vector<RealVector>& point );
+    
+    std::vector<int>
+    mortonCurveOrdering( const std::vector<RealVector>& point );
+    
+    // Largest index difference between adjacent vertices
+    int
+    giveBandwidthOf( const std::vector<int>& adjPtr
+                   , const std::vector<int>& adjIdx );
+    
+    // Sum over all vertices of the distance to the lowest-numbered neighbor
+    long
+    giveEnvelopeSizeOf( const std::vector<int>& adjPtr
+                      , const std::vector<int>& adjIdx );
+}
+
+#endif	/* MESHORDERING_HPP */
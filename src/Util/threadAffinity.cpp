@@ -0,0 +1,188 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#include "threadAffinity.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace broomstyx
+{
+    namespace
+    {
+        struct LogicalCpu
+        {
+            int cpu;
+            int socket;
+            int core;
+        };
+        
+        // --------------------------------------------------------------------
+        int readTopologyValue( int cpu, const char* item )
+        {
+            char path[128];
+            std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/%s", cpu, item);
+            
+            int val = 0;
+            FILE* fp = std::fopen(path, "r");
+            if ( fp )
+            {
+                if ( std::fscanf(fp, "%d", &val) != 1 )
+                    val = 0;
+                std::fclose(fp);
+            }
+            return val;
+        }
+        
+        // --------------------------------------------------------------------
+        int giveSocketOf( int cpu )
+        {
+            return ( cpu < 0 ) ? -1 : readTopologyValue(cpu, "physical_package_id");
+        }
+        
+        // --------------------------------------------------------------------
+        int giveCurrentCpu()
+        {
+#ifdef __linux__
+            return sched_getcpu();
+#else
+            return -1;
+#endif
+        }
+        
+        // --------------------------------------------------------------------
+        // Logical CPUs available to the process, arranged according to the
+        // specified policy
+        std::vector<int> arrangeAvailableCpus( const std::string& policy )
+        {
+            std::vector<LogicalCpu> avail;
+#ifdef __linux__
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            if ( sched_getaffinity(0, sizeof(mask), &mask) == 0 )
+                for ( int i = 0; i < CPU_SETSIZE; i++ )
+                    if ( CPU_ISSET(i, &mask) )
+                        avail.push_back({i, readTopologyValue(i, "physical_package_id"), readTopologyValue(i, "core_id")});
+#endif
+            // Compact: socket by socket, distinct cores before hyperthreads
+            std::stable_sort(avail.begin(), avail.end(), []( const LogicalCpu& a, const LogicalCpu& b )
+            {
+                if ( a.socket != b.socket )
+                    return a.socket < b.socket;
+                return a.core < b.core;
+            });
+            
+            std::vector<int> cpu;
+            if ( policy == "Compact" )
+            {
+                for ( auto& curCpu : avail )
+                    cpu.push_back(curCpu.cpu);
+            }
+            else
+            {
+                // Scatter: take one CPU from each socket in turn
+                std::vector<std::vector<int> > perSocket;
+                int lastSocket = -1;
+                for ( auto& curCpu : avail )
+                {
+                    if ( curCpu.socket != lastSocket )
+                        perSocket.push_back(std::vector<int>());
+                    perSocket.back().push_back(curCpu.cpu);
+                    lastSocket = curCpu.socket;
+                }
+                
+                for ( int k = 0; (int)cpu.size() < (int)avail.size(); k++ )
+                    for ( auto& socketCpu : perSocket )
+                        if ( k < (int)socketCpu.size() )
+                            cpu.push_back(socketCpu[k]);
+            }
+            
+            return cpu;
+        }
+    }
+    
+    // ------------------------------------------------------------------------
+    void pinThreads( const std::string& policy )
+    {
+        if ( policy == "None" )
+            return;
+        if ( policy != "Compact" && policy != "Scatter" )
+            throw std::runtime_error("Unrecognized thread affinity policy '" + policy + "'!\nSource: threadAffinity");
+        
+#if defined(_OPENMP) && defined(__linux__)
+        std::vector<int> cpu = arrangeAvailableCpus(policy);
+        if ( cpu.empty() )
+            return;
+        
+#pragma omp parallel
+        {
+            int threadNum = omp_get_thread_num();
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            CPU_SET(cpu[threadNum % cpu.size()], &mask);
+            pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask);
+        }
+#endif
+    }
+    
+    // ------------------------------------------------------------------------
+    void reportThreadPlacement( const std::string& policy )
+    {
+#ifdef _OPENMP
+        int nThreads = omp_get_max_threads();
+        std::vector<int> cpu(nThreads, -1);
+        
+#pragma omp parallel
+        {
+            cpu[omp_get_thread_num()] = giveCurrentCpu();
+        }
+        
+        std::printf("\n  Thread placement (policy = %s, OMP_PROC_BIND = %d, threads = %d)\n", policy.c_str(), (int)omp_get_proc_bind(), nThreads);
+        
+        std::vector<int> threadsPerSocket;
+        for ( int i = 0; i < nThreads; i++ )
+        {
+            int socket = giveSocketOf(cpu[i]);
+            std::printf("    thread %3d -> cpu %3d (socket %d)\n", i, cpu[i], socket);
+            if ( socket >= 0 )
+            {
+                if ( socket >= (int)threadsPerSocket.size() )
+                    threadsPerSocket.resize(socket + 1, 0);
+                threadsPerSocket[socket] += 1;
+            }
+        }
+        for ( int i = 0; i < (int)threadsPerSocket.size(); i++ )
+            std::printf("    Threads on socket %d = %d\n", i, threadsPerSocket[i]);
+#endif
+    }
+}
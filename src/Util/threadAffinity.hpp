@@ -0,0 +1,40 @@
+/*
+  Copyright (c) 2014 - 2019 University of Bergen
+  
+  This file is part of the BROOMStyx project.
+
+  BROOMStyx is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  BROOMStyx is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with BROOMStyx.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the AUTHORS file
+  for the list of copyright holders.
+*/
+
+#ifndef THREADAFFINITY_HPP
+#define	THREADAFFINITY_HPP
+
+#include <string>
+
+namespace broomstyx
+{
+    // Pin OpenMP threads to logical CPUs. Policies:
+    //   None    - leave placement to the OpenMP runtime (OMP_PROC_BIND etc.)
+    //   Compact - fill the cores of one socket before moving to the next
+    //   Scatter - distribute consecutive threads round-robin over sockets
+    void pinThreads( const std::string& policy );
+    
+    void reportThreadPlacement( const std::string& policy );
+}
+
+#endif	/* THREADAFFINITY_HPP */
@@ -23,8 +23,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <cstring>
 #include "Core/AnalysisModel.hpp"
+#include "Core/Communicator.hpp"
 #include "Core/Diagnostics.hpp"
 #include "Core/ObjectFactory.hpp"
 
@@ -43,9 +45,14 @@ int main( int argc, char **argv )
     }
     
     if ( std::strcmp(argv[1],"--test") == 0 )
-    	perform_tests();
+    	return perform_tests() > 0 ? 1 : 0;
     else
     {
+		// Only the root process reports progress in distributed runs
+		communicator().initialize(&argc, &argv);
+		if ( !communicator().isRoot() )
+			std::freopen("/dev/null", "w", stdout);
+		
 		if ( objectFactory().hasError() )
 		{
 			std::printf("\n\tRegistration error detected in class factory.\n\n");
@@ -67,6 +74,11 @@ int main( int argc, char **argv )
 			{
 				std::printf("\n%s\nException caught in main.cpp\n\n", e.what());
 				std::fflush(stdout);
+				if ( communicator().isDistributed() )
+				{
+					std::fprintf(stderr, "\nProcess %d: %s\n", communicator().giveRank(), e.what());
+					communicator().abort();
+				}
 			}
 
 			toc = std::chrono::high_resolution_clock::now();
@@ -75,6 +87,7 @@ int main( int argc, char **argv )
 
 			diagnostics().outputDiagnostics();
 		}
+		communicator().finalize();
     }
     return 0;
 }
@@ -0,0 +1,170 @@
+#include "analysisRun.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <stdexcept>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Core/AnalysisModel.hpp"
+#include "Core/ObjectFactory.hpp"
+
+using namespace broomstyx;
+
+namespace
+{
+	// Stream for check outcomes, which remains the terminal when standard
+	// output of a child process is redirected
+	FILE* reportStream = nullptr;
+}
+
+std::string makeScratchDirectory( const std::string& testName )
+{
+	std::string dirTemplate = "/tmp/broomstyx_" + testName + "_XXXXXX";
+	std::vector<char> buf(dirTemplate.begin(), dirTemplate.end());
+	buf.push_back('\0');
+	if ( !mkdtemp(buf.data()) )
+		throw std::runtime_error("Failed to create scratch directory for test '" + testName + "'!");
+
+	return std::string(buf.data());
+}
+
+void removeScratchDirectory( const std::string& dir )
+{
+	std::error_code ec;
+	std::filesystem::remove_all(dir, ec);
+}
+
+int runInChildProcess( const std::string& dir, const std::string& logName, const std::function<int()>& task )
+{
+	std::fflush(stdout);
+	pid_t pid = fork();
+	if ( pid < 0 )
+		return 1;
+	if ( pid == 0 )
+	{
+		int nFailed = 1;
+		int reportFd = dup(fileno(stdout));
+		if ( reportFd < 0 || chdir(dir.c_str()) != 0 || !std::freopen((logName + ".log").c_str(), "w", stdout) )
+			std::_Exit(1);
+		reportStream = fdopen(reportFd, "w");
+
+		if ( objectFactory().hasError() )
+			std::printf("\n\tRegistration error detected in class factory.\n\n");
+		else
+		{
+			try
+			{
+				nFailed = task();
+			}
+			catch (std::exception& e)
+			{
+				std::printf("\n%s\nException caught in test\n\n", e.what());
+				nFailed = 1;
+			}
+		}
+		std::fflush(stdout);
+		if ( reportStream )
+			std::fflush(reportStream);
+		std::_Exit(std::min(nFailed, 100));
+	}
+
+	int status = 0;
+	waitpid(pid, &status, 0);
+
+	return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
+
+bool runAnalysisInChildProcess( const std::string& dir, const std::string& inputName, const std::string& input )
+{
+	if ( !writeTextFile(dir + "/" + inputName + ".inp", input) )
+		return false;
+
+	int status = runInChildProcess(dir, inputName, [&inputName]()
+	{
+		analysisModel().initializeYourself(inputName);
+		analysisModel().solveYourself();
+		return 0;
+	});
+
+	return status == 0;
+}
+
+bool writeTextFile( const std::string& filename, const std::string& contents )
+{
+	FILE* fp = std::fopen(filename.c_str(), "w");
+	if ( !fp )
+		return false;
+	std::fputs(contents.c_str(), fp);
+	std::fclose(fp);
+
+	return true;
+}
+
+std::string readTextFile( const std::string& filename )
+{
+	std::string contents;
+	FILE* fp = std::fopen(filename.c_str(), "r");
+	if ( !fp )
+		return contents;
+
+	char buf[4096];
+	std::size_t n;
+	while ( (n = std::fread(buf, 1, sizeof(buf), fp)) > 0 )
+		contents.append(buf, n);
+	std::fclose(fp);
+
+	return contents;
+}
+
+std::vector<std::string> readLinesFrom( const std::string& filename )
+{
+	std::vector<std::string> line;
+	std::string contents = readTextFile(filename);
+
+	std::size_t begin = 0;
+	while ( begin < contents.size() )
+	{
+		std::size_t end = contents.find('\n', begin);
+		if ( end == std::string::npos )
+			end = contents.size();
+		line.push_back(contents.substr(begin, end - begin));
+		begin = end + 1;
+	}
+
+	return line;
+}
+
+std::vector< std::vector<double> > readCsvRowsFrom( const std::string& filename )
+{
+	std::vector< std::vector<double> > row;
+	std::vector<std::string> line = readLinesFrom(filename);
+	for ( int i = 1; i < (int)line.size(); i++ )
+	{
+		std::vector<double> val;
+		const char* str = line[i].c_str();
+		char* end;
+		for ( double x = std::strtod(str, &end); end != str; x = std::strtod(str, &end) )
+		{
+			val.push_back(x);
+			str = end;
+			while ( *str == ',' || *str == ' ' )
+				++str;
+		}
+		row.push_back(val);
+	}
+
+	return row;
+}
+
+bool verify( bool condition, const std::string& description )
+{
+	FILE* fp = reportStream ? reportStream : stdout;
+	std::fprintf(fp, "  %-66s %s\n", description.c_str(), condition ? "passed" : "FAILED");
+	std::fflush(fp);
+
+	return condition;
+}
@@ -0,0 +1,33 @@
+#ifndef _ANALYSIS_RUN_HPP_
+#define _ANALYSIS_RUN_HPP_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// Helpers for tests that run complete analyses. Since the analysis model is
+// a singleton, every analysis runs in a child process of its own (as in
+// broomstyx_bench), inside a scratch directory that receives the input file,
+// the log and all output of the run. Scratch directories of failed tests
+// are kept for inspection.
+
+std::string makeScratchDirectory( const std::string& testName );
+void removeScratchDirectory( const std::string& dir );
+
+// Runs a task in a child process within 'dir', with standard output going
+// to '<logName>.log'. Returns the number of failures reported by the task,
+// or 1 if it terminated abnormally.
+int runInChildProcess( const std::string& dir, const std::string& logName, const std::function<int()>& task );
+bool runAnalysisInChildProcess( const std::string& dir, const std::string& inputName, const std::string& input );
+bool writeTextFile( const std::string& filename, const std::string& contents );
+
+std::string readTextFile( const std::string& filename );
+std::vector<std::string> readLinesFrom( const std::string& filename );
+
+// Values in the rows of a CSV file after its header
+std::vector< std::vector<double> > readCsvRowsFrom( const std::string& filename );
+
+// Reports the outcome of a check, also from within child processes
+bool verify( bool condition, const std::string& description );
+
+#endif /* _ANALYSIS_RUN_HPP_ */
@@ -4,6 +4,10 @@
 void test_StackRealMatrix_Implementation();
 void test_StackRealVector_Implementation();
 void test_stack_linear_algebra();
+int test_element_matrix_cache();
+int test_load_cases();
+int test_localized_alternate_minimization();
+int test_static_condensation();
 
 int perform_tests()
 {
@@ -11,7 +15,15 @@ int perform_tests()
 //	test_StackRealVector_Implementation();
 	test_stack_linear_algebra();
 
-	return 0;
+	// Tests that run complete analyses return their number of failures
+	int nFailed = 0;
+	nFailed += test_element_matrix_cache();
+	nFailed += test_load_cases();
+	nFailed += test_localized_alternate_minimization();
+	nFailed += test_static_condensation();
+
+	std::printf("\n%d test(s) failed\n\n", nFailed);
+	return nFailed;
 }
 
 #endif /* _TEST_HPP_ */
@@ -0,0 +1,128 @@
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "analysisRun.hpp"
+#include "Core/AnalysisModel.hpp"
+#include "Core/Cell.hpp"
+#include "Core/DomainManager.hpp"
+#include "Core/ElementMatrixCache.hpp"
+#include "Numerics/Numerics.hpp"
+
+using namespace broomstyx;
+
+namespace
+{
+	// Numerics whose single coefficient matrix entry identifies the cell and
+	// the revision it was computed for, and which counts its evaluations
+	class RevisionNumerics : public Numerics
+	{
+	public:
+		bool tracksChanges = true;
+		int  nEvaluations = 0;
+
+		void finalizeDataAt( Cell* targetCell, const TimeData& time ) override {}
+		void deleteNumericsAt( Cell* targetCell ) override {}
+		void initializeNumericsAt( Cell* targetCell ) override {}
+		bool tracksCoefficientMatrixChanges() override { return tracksChanges; }
+
+		std::tuple< std::vector<Dof*>, std::vector<Dof*>, RealVector >
+			giveStaticCoefficientMatrixAt( Cell* targetCell, int stage, int subsys, const TimeData& time ) override
+		{
+			++nEvaluations;
+			RealVector coefVal({100.*targetCell->id() + targetCell->giveCoefficientMatrixRevision()});
+
+			return std::make_tuple(std::vector<Dof*>(1, nullptr), std::vector<Dof*>(1, nullptr), std::move(coefVal));
+		}
+	};
+
+	std::string giveCacheInput()
+	{
+		return "*FIELDS_PER_NODE 2\n*FIELDS_PER_CELL 0\n"
+			"*DOF_PER_NODE\n2\nux DofGroup 1 NodalField 1 0\nuy DofGroup 1 NodalField 2 0\n"
+			"*SOLUTION_STAGES 1\n"
+			"*NUMERICS\n1\n1 PlaneStrain_Fe_Tri3 NodalDof ux uy Stage 1 Subsystem 1 CellFieldOutput 0\n"
+			"*MATERIALS\n2\n1 Density 1.0\n2 LinearIsotropicElasticity PlaneStrain 210.0e3 0.3\n"
+			"*DOMAIN_ASSIGNMENTS\n1\n\"domain\" Numerics 1 MaterialSet 1 2\n"
+			"*MESH_READER StructuredMeshGenerator\n*MESH_FILE Tri3:2x2\n"
+			"*OUTPUT_FORMAT Paraview\nFILENAME out\nPOINT_DATA 1\nVECTOR u 1 2 0\nCELL_DATA 0\n"
+			"*END\n";
+	}
+
+	// Executed in the child process, on the cells of a small mesh
+	int checkElementMatrixCache()
+	{
+		analysisModel().initializeYourself("cache");
+
+		int nCells = analysisModel().domainManager().giveNumberOfDomainCells();
+		std::vector<Cell*> cell(nCells, nullptr);
+		for ( int i = 0; i < nCells; i++ )
+			cell[i] = analysisModel().domainManager().giveDomainCell(i);
+		ArraySpan<Cell* const> cellSpan(cell.data(), nCells);
+
+		RevisionNumerics numerics;
+		ElementMatrixCache cache;
+		cache.initializeSlots(nCells);
+		for ( Cell* curCell : cell )
+			cache.reserveSlotFor(curCell, 1);
+		cache.allocatePool();
+
+		TimeData time;
+		auto isCurrent = [&cell]( const CoefficientMatrixBatch& batch )
+		{
+			bool current = ( (int)batch.coefVal.size() == (int)cell.size() );
+			for ( int i = 0; current && i < (int)cell.size(); i++ )
+				current = ( batch.coefVal[i] == 100.*cell[i]->id() + cell[i]->giveCoefficientMatrixRevision() );
+			return current;
+		};
+
+		int nFailed = 0;
+		CoefficientMatrixBatch batch;
+		cache.giveCoefficientMatricesAt(cellSpan, &numerics, 1, 1, time, batch);
+		nFailed += !verify(numerics.nEvaluations == nCells && isCurrent(batch), "First assembly computes all cell matrices");
+
+		batch.clear();
+		numerics.nEvaluations = 0;
+		cache.giveCoefficientMatricesAt(cellSpan, &numerics, 1, 1, time, batch);
+		nFailed += !verify(numerics.nEvaluations == 0 && isCurrent(batch), "Unchanged cells are served from the cache");
+
+		cell[1]->flagCoefficientMatrixChange();
+		batch.clear();
+		numerics.nEvaluations = 0;
+		cache.giveCoefficientMatricesAt(cellSpan, &numerics, 1, 1, time, batch);
+		nFailed += !verify(numerics.nEvaluations == 1 && isCurrent(batch), "Only the flagged cell is recomputed after a change");
+
+		batch.clear();
+		numerics.nEvaluations = 0;
+		cache.giveCoefficientMatricesAt(cellSpan, &numerics, 1, 1, time, batch);
+		nFailed += !verify(numerics.nEvaluations == 0 && isCurrent(batch), "Recomputed matrix is stored for later assemblies");
+
+		numerics.tracksChanges = false;
+		batch.clear();
+		numerics.nEvaluations = 0;
+		cache.giveCoefficientMatricesAt(cellSpan, &numerics, 1, 1, time, batch);
+		nFailed += !verify(numerics.nEvaluations == nCells && isCurrent(batch), "Untracked numerics are recomputed on every assembly");
+
+		return nFailed;
+	}
+}
+
+int test_element_matrix_cache()
+{
+	std::printf("\n========================");
+	std::printf("\n  Element matrix cache");
+	std::printf("\n========================\n");
+
+	std::string dir = makeScratchDirectory("element_matrix_cache");
+	if ( !writeTextFile(dir + "/cache.inp", giveCacheInput()) )
+		return 1;
+
+	int nFailed = runInChildProcess(dir, "cache", checkElementMatrixCache);
+	if ( nFailed == 0 )
+		removeScratchDirectory(dir);
+	else
+		verify(false, "Element matrix cache checks (see " + dir + ")");
+
+	return nFailed;
+}
@@ -0,0 +1,153 @@
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "analysisRun.hpp"
+
+namespace
+{
+	// Model with its output going to files named 'name'
+	std::string giveModelInput( const std::string& name )
+	{
+		return "*FIELDS_PER_NODE 2\n*FIELDS_PER_CELL 0\n"
+			"*DOF_PER_NODE\n2\nux DofGroup 1 NodalField 1 0\nuy DofGroup 1 NodalField 2 0\n"
+			"*SOLUTION_STAGES 1\n"
+			"*NUMERICS\n1\n1 PlaneStrain_Fe_Tri3 NodalDof ux uy Stage 1 Subsystem 1 CellFieldOutput 0\n"
+			"*MATERIALS\n2\n1 Density 1.0\n2 LinearIsotropicElasticity PlaneStrain 210.0e3 0.3\n"
+			"*DOMAIN_ASSIGNMENTS\n1\n\"domain\" Numerics 1 MaterialSet 1 2\n"
+			"*MESH_READER StructuredMeshGenerator\n*MESH_FILE Tri3:4x4\n"
+			"*OUTPUT_FORMAT Paraview\nFILENAME " + name + "\nPOINT_DATA 1\nVECTOR u 1 2 0\nCELL_DATA 0\n"
+			"*CSV_OUTPUT 1\nrx BoundaryReaction \"left\" NodalDof ux\nCSV_FILE " + name + "\n";
+	}
+
+	std::string giveSolutionMethodInput()
+	{
+		return "SOLUTION_METHODS\nStage 1 LinearStatic LinearSolver ConjugateGradient Format CSR0 1.e-12 2000 Preconditioner Jacobi\n"
+			"WRITE_INTERVAL 1\nPOSTPROCESSING 0\n";
+	}
+
+	// Boundary conditions with the right edge displaced by 'ux'
+	std::string giveBoundaryConditionInput( const std::string& ux )
+	{
+		return "BOUNDARY_CONDITIONS 3\n"
+			"\"left\" 1 NodalConstraint ux Constant 0.0\n"
+			"\"bottom\" 1 NodalConstraint uy Constant 0.0\n"
+			"\"right\" 1 NodalConstraint ux Constant " + ux + "\n"
+			"FIELD_CONDITIONS 0\n";
+	}
+
+	// Two load steps, of which only the first declares load cases. Output of
+	// the second load step must go to the base CSV and Paraview files again.
+	std::string giveLoadCaseInput()
+	{
+		return giveModelInput("res") + "*LOADSTEPS\n2\n"
+			"1\nPREPROCESSING 0\nSTART_TIME 0.0\nEND_TIME 1.0\nINITIAL_TIME_INCREMENT 1.0\nMAX_SUBSTEPS 1\n"
+			"LOAD_CASES 2\n"
+			"Case a " + giveBoundaryConditionInput("0.01") +
+			"Case b " + giveBoundaryConditionInput("0.02")
+			+ giveSolutionMethodInput() +
+			"2\nPREPROCESSING 0\nSTART_TIME 1.0\nEND_TIME 2.0\nINITIAL_TIME_INCREMENT 1.0\nMAX_SUBSTEPS 1\n"
+			+ giveBoundaryConditionInput("0.03") + giveSolutionMethodInput() +
+			"*END\n";
+	}
+
+	// One load step without load cases, for comparison with a single case
+	std::string giveSingleCaseInput( const std::string& name, const std::string& ux )
+	{
+		return giveModelInput(name) + "*LOADSTEPS\n1\n"
+			"1\nPREPROCESSING 0\nSTART_TIME 0.0\nEND_TIME 1.0\nINITIAL_TIME_INCREMENT 1.0\nMAX_SUBSTEPS 1\n"
+			+ giveBoundaryConditionInput(ux) + giveSolutionMethodInput() +
+			"*END\n";
+	}
+
+	bool agree( double a, double b )
+	{
+		return std::fabs(a - b) <= 1.0e-8*std::fabs(b);
+	}
+}
+
+int test_load_cases()
+{
+	std::printf("\n==============");
+	std::printf("\n  Load cases");
+	std::printf("\n==============\n");
+
+	std::string dir = makeScratchDirectory("load_cases");
+	int nFailed = 0;
+
+	if ( !verify(runAnalysisInChildProcess(dir, "loadCases", giveLoadCaseInput()), "Two load steps, the first with load cases a and b") )
+		return 1;
+
+	// Header plus one row per substep written to each file, and the initial
+	// state in the base file
+	std::vector<std::string> csvA = readLinesFrom(dir + "/Output_CSV/res_a.csv");
+	std::vector<std::string> csvB = readLinesFrom(dir + "/Output_CSV/res_b.csv");
+	std::vector<std::string> csvBase = readLinesFrom(dir + "/Output_CSV/res.csv");
+
+	nFailed += !verify(csvA.size() == 2 && csvA[1].find("1.000000000000000e+00") == 0, "Load case a written to res_a.csv at t = 1");
+	nFailed += !verify(csvB.size() == 2 && csvB[1].find("1.000000000000000e+00") == 0, "Load case b written to res_b.csv at t = 1");
+	nFailed += !verify(csvBase.size() == 3 && csvBase[2].find("2.000000000000000e+00") == 0, "Second load step written to res.csv at t = 2");
+
+	// Last collection entry belongs to the second load step
+	std::vector<std::string> pvd = readLinesFrom(dir + "/Output_Paraview/res.pvd");
+	std::string lastDataSet;
+	for ( auto& line : pvd )
+		if ( line.find("<DataSet") != std::string::npos )
+			lastDataSet = line;
+
+	nFailed += !verify(lastDataSet.find("timestep=\"2.0") != std::string::npos
+			&& lastDataSet.find("group=") == std::string::npos
+			&& lastDataSet.find("res_a_") == std::string::npos
+			&& lastDataSet.find("res_b_") == std::string::npos, "Second load step written to base vtu file name");
+
+	// Reactions are linear in the prescribed displacement of the right edge
+	std::vector< std::vector<double> > rowA = readCsvRowsFrom(dir + "/Output_CSV/res_a.csv");
+	std::vector< std::vector<double> > rowB = readCsvRowsFrom(dir + "/Output_CSV/res_b.csv");
+	std::vector< std::vector<double> > rowBase = readCsvRowsFrom(dir + "/Output_CSV/res.csv");
+
+	bool hasReactions = rowA.size() == 1 && rowA[0].size() == 2 && rowB.size() == 1 && rowB[0].size() == 2
+		&& rowBase.size() == 2 && rowBase[1].size() == 2 && std::fabs(rowA[0][1]) > 0.;
+	nFailed += !verify(hasReactions, "Nonzero reaction written for each load case");
+
+	if ( hasReactions )
+	{
+		double rxA = rowA[0][1];
+		nFailed += !verify(agree(rowB[0][1], 2.*rxA), "Reaction of load case b is twice that of load case a");
+		nFailed += !verify(agree(rowBase[1][1], 3.*rxA), "Reaction of second load step is thrice that of load case a");
+
+		// Each load case must reproduce a separate analysis with its boundary
+		// conditions alone
+		std::vector<std::string> caseName = {"a", "b"};
+		std::vector<std::string> caseUx = {"0.01", "0.02"};
+		for ( int i = 0; i < 2; i++ )
+		{
+			std::string name = "single_" + caseName[i];
+			std::string desc = "Load case " + caseName[i] + " matches separate analysis";
+			if ( !runAnalysisInChildProcess(dir, name, giveSingleCaseInput(name, caseUx[i])) )
+			{
+				nFailed += !verify(false, desc);
+				continue;
+			}
+
+			std::vector< std::vector<double> > rowSingle = readCsvRowsFrom(dir + "/Output_CSV/" + name + ".csv");
+			double rxCase = ( i == 0 ) ? rowA[0][1] : rowB[0][1];
+			nFailed += !verify(rowSingle.size() == 2 && rowSingle[1].size() == 2 && agree(rxCase, rowSingle[1][1]), desc);
+		}
+	}
+
+	// Transient runs do not support load cases, which must be rejected while
+	// the input is read
+	std::string transientInput = giveLoadCaseInput();
+	for ( std::size_t pos = transientInput.find("LinearStatic"); pos != std::string::npos; pos = transientInput.find("LinearStatic", pos) )
+		transientInput.replace(pos, 12, "LinearTransient");
+
+	bool isRejected = !runAnalysisInChildProcess(dir, "transientLoadCases", transientInput)
+		&& readTextFile(dir + "/transientLoadCases.log").find("does not support multiple load cases") != std::string::npos;
+	nFailed += !verify(isRejected, "Load cases rejected for LinearTransient");
+
+	if ( nFailed == 0 )
+		removeScratchDirectory(dir);
+
+	return nFailed;
+}
@@ -0,0 +1,128 @@
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "analysisRun.hpp"
+
+namespace
+{
+	// Gmsh mesh of the unit square with n x n subdivisions into Tri3 cells.
+	// Cells of the middle row form domain "weak", the rest domain "domain".
+	std::string giveWeakBandMesh( int n )
+	{
+		std::string mesh = "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n"
+			"$PhysicalNames\n4\n2 1 \"domain\"\n2 4 \"weak\"\n1 2 \"bottom\"\n1 3 \"top\"\n$EndPhysicalNames\n";
+
+		char buf[256];
+		mesh += "$Nodes\n" + std::to_string((n + 1)*(n + 1)) + "\n";
+		for ( int j = 0; j <= n; j++ )
+			for ( int i = 0; i <= n; i++ )
+			{
+				std::snprintf(buf, sizeof(buf), "%d %.15e %.15e 0\n", j*(n + 1) + i + 1, (double)i/n, (double)j/n);
+				mesh += buf;
+			}
+		mesh += "$EndNodes\n";
+
+		auto node = [n]( int i, int j ) { return j*(n + 1) + i + 1; };
+		std::string elements;
+		int nElements = 0;
+		for ( int i = 0; i < n; i++ )
+		{
+			std::snprintf(buf, sizeof(buf), "%d 1 2 2 2 %d %d\n", ++nElements, node(i, 0), node(i + 1, 0));
+			elements += buf;
+			std::snprintf(buf, sizeof(buf), "%d 1 2 3 3 %d %d\n", ++nElements, node(i, n), node(i + 1, n));
+			elements += buf;
+		}
+		for ( int j = 0; j < n; j++ )
+			for ( int i = 0; i < n; i++ )
+			{
+				int phys = ( j == n/2 ) ? 4 : 1;
+				std::snprintf(buf, sizeof(buf), "%d 2 2 %d %d %d %d %d\n", ++nElements, phys, phys, node(i, j), node(i + 1, j), node(i + 1, j + 1));
+				elements += buf;
+				std::snprintf(buf, sizeof(buf), "%d 2 2 %d %d %d %d %d\n", ++nElements, phys, phys, node(i, j), node(i + 1, j + 1), node(i, j + 1));
+				elements += buf;
+			}
+		mesh += "$Elements\n" + std::to_string(nElements) + "\n" + elements + "$EndElements\n";
+
+		return mesh;
+	}
+
+	// Phase-field fracture of a square pulled at the top, with damage
+	// concentrating in the weak band. The phase field is either solved over
+	// the whole mesh or over the active region only.
+	std::string giveAlternateMinimizationInput( const std::string& csvFile, bool localize )
+	{
+		std::string linearSolver = "LinearSolver ConjugateGradient Format CSR0 1.e-14 4000 Preconditioner Jacobi";
+		std::string method = localize ? "LocalizedAlternateMinimization" : "AlternateMinimization";
+		std::string localization = localize ? " LocalizedSubsystem 2 ActivityThreshold 0.3 BufferLayers 1" : "";
+
+		return "*FIELDS_PER_NODE 3\n*FIELDS_PER_CELL 0\n"
+			"*DOF_PER_NODE\n3\nux DofGroup 1 NodalField 1 0\nuy DofGroup 1 NodalField 2 0\nphi DofGroup 2 NodalField 3 0\n"
+			"*SOLUTION_STAGES 1\n"
+			"*NUMERICS\n1\n1 PhaseFieldFracture_Fe_Tri3 NodalDof ux uy phi Stage 1 Subsystem 1 2 CellFieldOutput 0\n"
+			"AnalysisMode PlaneStrain CharacteristicLength 0.1 IrreversibilityThreshold 0.9\n"
+			"*MATERIALS\n4\n1 Density 1.0\n"
+			"2 BourdinDamageModel LinearIsotropicElasticity PlaneStrain 210.0e3 0.3 QuadraticDegradation\n"
+			"3 Constant_CERR 2.7\n4 Constant_CERR 0.027\n"
+			"*DOMAIN_ASSIGNMENTS\n2\n\"domain\" Numerics 1 MaterialSet 1 2 3\n\"weak\" Numerics 1 MaterialSet 1 2 4\n"
+			"*MESH_READER GmshReader\n*MESH_FILE mesh.msh\n"
+			"*OUTPUT_FORMAT Paraview\nFILENAME " + csvFile + "\nPOINT_DATA 2\nVECTOR u 1 2 0\nSCALAR phi 3\nCELL_DATA 0\n"
+			"*CSV_OUTPUT 1\nry BoundaryReaction \"top\" NodalDof uy\nCSV_FILE " + csvFile + "\n"
+			"*LOADSTEPS\n1\n"
+			"1\nPREPROCESSING 0\nSTART_TIME 0.0\nEND_TIME 1.0\nINITIAL_TIME_INCREMENT 0.25\nMAX_SUBSTEPS 10\n"
+			"BOUNDARY_CONDITIONS 4\n"
+			"\"bottom\" 1 NodalConstraint ux Constant 0.0\n"
+			"\"bottom\" 1 NodalConstraint uy Constant 0.0\n"
+			"\"top\" 1 NodalConstraint ux Constant 0.0\n"
+			"\"top\" 1 NodalConstraint uy Linear 0.0 2.0e-3\n"
+			"FIELD_CONDITIONS 0\n"
+			"SOLUTION_METHODS\nStage 1 " + method + " DofGroups 2 1 L2_L1 CR 1e-6 1e-6 1e-12 1e-12 2 L2_L1 CR 1e-6 1e-6 1e-12 1e-12 "
+				"Subsystems 2 1 nDofGroups 1 Label 1 " + linearSolver + " OverRelaxation 1.0 "
+				"2 nDofGroups 1 Label 2 " + linearSolver + " OverRelaxation 1.0 MaxIterations 200 Abort" + localization + "\n"
+			"WRITE_INTERVAL 1\nPOSTPROCESSING 0\n"
+			"*END\n";
+	}
+}
+
+int test_localized_alternate_minimization()
+{
+	std::printf("\n=====================================");
+	std::printf("\n  Localized alternate minimization");
+	std::printf("\n=====================================\n");
+
+	std::string dir = makeScratchDirectory("localized_alternate_minimization");
+	if ( !writeTextFile(dir + "/mesh.msh", giveWeakBandMesh(10)) )
+		return 1;
+
+	int nFailed = 0;
+	nFailed += !verify(runAnalysisInChildProcess(dir, "full", giveAlternateMinimizationInput("full", false)), "Alternate minimization over whole mesh");
+	nFailed += !verify(runAnalysisInChildProcess(dir, "localized", giveAlternateMinimizationInput("localized", true)), "Alternate minimization with localized phase field");
+	if ( nFailed > 0 )
+		return nFailed;
+
+	std::vector< std::vector<double> > full = readCsvRowsFrom(dir + "/Output_CSV/full.csv");
+	std::vector< std::vector<double> > localized = readCsvRowsFrom(dir + "/Output_CSV/localized.csv");
+
+	bool sameSize = ( full.size() == 5 && full.size() == localized.size() );
+	for ( int i = 0; sameSize && i < (int)full.size(); i++ )
+		sameSize = ( full[i].size() == 2 && localized[i].size() == 2 );
+	nFailed += !verify(sameSize, "Reactions written at every substep");
+
+	// Both runs converge to the same solution within the tolerances of the
+	// convergence criteria
+	bool sameReactions = sameSize && std::fabs(full.back()[1]) > 0.;
+	for ( int i = 0; sameReactions && i < (int)full.size(); i++ )
+	{
+		double scale = std::fabs(full.back()[1]);
+		for ( int j = 0; j < 2; j++ )
+			if ( std::fabs(full[i][j] - localized[i][j]) > 1.0e-6*scale )
+				sameReactions = false;
+	}
+	nFailed += !verify(sameReactions, "Localized and full reactions agree");
+
+	if ( nFailed == 0 )
+		removeScratchDirectory(dir);
+
+	return nFailed;
+}
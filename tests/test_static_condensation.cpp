@@ -0,0 +1,117 @@
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "analysisRun.hpp"
+
+namespace
+{
+	// Gmsh mesh of the unit square with n x n subdivisions into Tri3 cells.
+	// Cells left of x = 0.5 form domain "domain", the rest domain "outer".
+	std::string giveTwoDomainMesh( int n )
+	{
+		std::string mesh = "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n"
+			"$PhysicalNames\n4\n2 1 \"domain\"\n2 4 \"outer\"\n1 2 \"left\"\n1 3 \"right\"\n$EndPhysicalNames\n";
+
+		char buf[256];
+		mesh += "$Nodes\n" + std::to_string((n + 1)*(n + 1)) + "\n";
+		for ( int j = 0; j <= n; j++ )
+			for ( int i = 0; i <= n; i++ )
+			{
+				std::snprintf(buf, sizeof(buf), "%d %.15e %.15e 0\n", j*(n + 1) + i + 1, (double)i/n, (double)j/n);
+				mesh += buf;
+			}
+		mesh += "$EndNodes\n";
+
+		auto node = [n]( int i, int j ) { return j*(n + 1) + i + 1; };
+		std::string elements;
+		int nElements = 0;
+		for ( int j = 0; j < n; j++ )
+		{
+			std::snprintf(buf, sizeof(buf), "%d 1 2 2 2 %d %d\n", ++nElements, node(0, j), node(0, j + 1));
+			elements += buf;
+			std::snprintf(buf, sizeof(buf), "%d 1 2 3 3 %d %d\n", ++nElements, node(n, j), node(n, j + 1));
+			elements += buf;
+		}
+		for ( int j = 0; j < n; j++ )
+			for ( int i = 0; i < n; i++ )
+			{
+				int phys = ( 2*i < n ) ? 1 : 4;
+				std::snprintf(buf, sizeof(buf), "%d 2 2 %d %d %d %d %d\n", ++nElements, phys, phys, node(i, j), node(i + 1, j), node(i + 1, j + 1));
+				elements += buf;
+				std::snprintf(buf, sizeof(buf), "%d 2 2 %d %d %d %d %d\n", ++nElements, phys, phys, node(i, j), node(i + 1, j + 1), node(i, j + 1));
+				elements += buf;
+			}
+		mesh += "$Elements\n" + std::to_string(nElements) + "\n" + elements + "$EndElements\n";
+
+		return mesh;
+	}
+
+	std::string giveCondensationInput( const std::string& csvFile, bool condense )
+	{
+		std::string linearSolver = "LinearSolver ConjugateGradient Format CSR0 1.e-14 4000 Preconditioner Jacobi";
+		std::string condensation = condense ? " StaticCondensation 1 \"outer\" " + linearSolver : "";
+
+		return "*FIELDS_PER_NODE 2\n*FIELDS_PER_CELL 0\n"
+			"*DOF_PER_NODE\n2\nux DofGroup 1 NodalField 1 0\nuy DofGroup 1 NodalField 2 0\n"
+			"*SOLUTION_STAGES 1\n"
+			"*NUMERICS\n1\n1 PlaneStrain_Fe_Tri3 NodalDof ux uy Stage 1 Subsystem 1 CellFieldOutput 0\n"
+			"*MATERIALS\n2\n1 Density 1.0\n2 LinearIsotropicElasticity PlaneStrain 210.0e3 0.3\n"
+			"*DOMAIN_ASSIGNMENTS\n2\n\"domain\" Numerics 1 MaterialSet 1 2\n\"outer\" Numerics 1 MaterialSet 1 2\n"
+			"*MESH_READER GmshReader\n*MESH_FILE mesh.msh\n"
+			"*OUTPUT_FORMAT Paraview\nFILENAME " + csvFile + "\nPOINT_DATA 1\nVECTOR u 1 2 0\nCELL_DATA 0\n"
+			"*CSV_OUTPUT 2\nrx BoundaryReaction \"left\" NodalDof ux\nry BoundaryReaction \"left\" NodalDof uy\nCSV_FILE " + csvFile + "\n"
+			"*LOADSTEPS\n1\n"
+			"1\nPREPROCESSING 0\nSTART_TIME 0.0\nEND_TIME 1.0\nINITIAL_TIME_INCREMENT 0.5\nMAX_SUBSTEPS 10\n"
+			"BOUNDARY_CONDITIONS 3\n"
+			"\"left\" 1 NodalConstraint ux Constant 0.0\n"
+			"\"left\" 1 NodalConstraint uy Constant 0.0\n"
+			"\"right\" 1 NodalConstraint ux Linear 0.0 1.0e-3\n"
+			"FIELD_CONDITIONS 0\n"
+			"SOLUTION_METHODS\nStage 1 NewtonRaphson DofGroups 1 1 LInf CR 1.e-6 1.e-6 1.e-12 1.e-8 " + linearSolver
+				+ " LineSearch 5 0.5 ElementMatrixCache" + condensation + " MaxIterations 20\n"
+			"WRITE_INTERVAL 1\nPOSTPROCESSING 0\n"
+			"*END\n";
+	}
+}
+
+int test_static_condensation()
+{
+	std::printf("\n======================");
+	std::printf("\n  Static condensation");
+	std::printf("\n======================\n");
+
+	std::string dir = makeScratchDirectory("static_condensation");
+	if ( !writeTextFile(dir + "/mesh.msh", giveTwoDomainMesh(8)) )
+		return 1;
+
+	int nFailed = 0;
+	nFailed += !verify(runAnalysisInChildProcess(dir, "full", giveCondensationInput("full", false)), "Analysis without condensation");
+	nFailed += !verify(runAnalysisInChildProcess(dir, "condensed", giveCondensationInput("condensed", true)), "Analysis with domain \"outer\" condensed");
+	if ( nFailed > 0 )
+		return nFailed;
+
+	std::vector< std::vector<double> > full = readCsvRowsFrom(dir + "/Output_CSV/full.csv");
+	std::vector< std::vector<double> > condensed = readCsvRowsFrom(dir + "/Output_CSV/condensed.csv");
+
+	bool sameSize = ( full.size() == 3 && full.size() == condensed.size() );
+	for ( int i = 0; sameSize && i < (int)full.size(); i++ )
+		sameSize = ( full[i].size() == 3 && condensed[i].size() == 3 );
+	nFailed += !verify(sameSize, "Reactions written at every substep");
+
+	bool sameReactions = sameSize && std::fabs(full.back()[1]) > 0.;
+	for ( int i = 0; sameReactions && i < (int)full.size(); i++ )
+	{
+		double scale = std::fabs(full.back()[1]);
+		for ( int j = 0; j < 3; j++ )
+			if ( std::fabs(full[i][j] - condensed[i][j]) > 1.0e-8*scale )
+				sameReactions = false;
+	}
+	nFailed += !verify(sameReactions, "Condensed and uncondensed reactions agree");
+
+	if ( nFailed == 0 )
+		removeScratchDirectory(dir);
+
+	return nFailed;
+}